@@ -1,6 +1,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include "sm4_drbg.h"
 
 // ---------------------------- 工具宏 ----------------------------
 #define ROL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
@@ -123,12 +124,16 @@ int main(){
                      0x0f1e2d3c,0x4b5a6978,0x8695a4b3,0xc2d1e0f0};
     uint8_t plaintext[32]="Hello, this is SM4-GCM test!!";
     uint8_t ciphertext[32], tag[16];
-    uint8_t iv[12]={0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b};
+    // 96 位随机 IV 取自 CTR_DRBG（sm4_drbg.cpp），同一密钥下不会重复使用
+    uint8_t iv[12];
+    if(sm4_drbg_random(iv,sizeof(iv))!=0){ perror("sm4_drbg_random"); return 1; }
     uint8_t aad[16]="ExtraAuthData";
 
     sm4_gcm_encrypt(plaintext,ciphertext,32,rk,iv,aad,16,tag);
 
-    printf("Ciphertext: ");
+    printf("IV: ");
+    for(int i=0;i<12;i++) printf("%02x ",iv[i]);
+    printf("\nCiphertext: ");
     for(int i=0;i<32;i++) printf("%02x ",ciphertext[i]);
     printf("\nTag: ");
     for(int i=0;i<16;i++) printf("%02x ",tag[i]);
@@ -0,0 +1,380 @@
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/prctl.h>
+#include <semaphore.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <new>
+#include "crypto_sched.h"
+#include "sm4_multikey.h"
+#include "sm3_mb.h"
+
+// 编译：g++ -O2 -mavx2 -pthread -I../Project4 -DSM4_MULTIKEY_NO_MAIN crypto_sched.cpp SM4-multikey.cpp ../Project4/sm3_mb.c ../Project4/sm3.c
+// 队列是 sm2_pool.c 里同样的 Vyukov 环：每个槽位带序号，提交与取出各一次 CAS。
+// 工作线程睡眠用信号量：先置 sleeping 再复查队列，提交方入队、一道 seq_cst 屏障后看到 sleeping 才 sem_post，不会丢唤醒。
+// done：0 未完成，1 完成，2 未完成且有线程在 futex 上等。只有等过的任务完成时才需要一次 FUTEX_WAKE。
+
+#define SM4_STAGE_BLOCKS 1024
+
+struct cell_t {
+    alignas(64) std::atomic<size_t> seq;
+    cs_job *job;
+};
+
+struct batch_t {
+    cs_job *jobs[CS_BATCH_MAX];
+    int n;
+    size_t blocks;
+    uint64_t oldest;            // 最早一个任务的提交时间
+};
+
+// 工作线程的批缓冲与 SM4 暂存区
+struct wstate_t {
+    alignas(64) uint32_t rk_tab[CS_BATCH_MAX * 32];
+    uint8_t mk[CS_BATCH_MAX][16];
+    uint8_t stage[SM4_STAGE_BLOCKS][16];
+    uint32_t idx[SM4_STAGE_BLOCKS];
+    uint8_t dig[CS_BATCH_MAX][32];
+    batch_t b[3];
+};
+
+struct queue_t {
+    cell_t *cells;
+    size_t mask;
+    alignas(64) std::atomic<size_t> enq;
+    alignas(64) std::atomic<size_t> deq;
+    alignas(64) std::atomic<size_t> depth_max;
+    std::atomic<int> sleeping;
+    sem_t sem;
+    pthread_t th;
+    int sem_ok, threaded;
+    wstate_t *w;
+    cs_sched *s;
+};
+
+struct cs_sched {
+    queue_t *q;
+    int nq;
+    uint64_t deadline_ns;
+    std::atomic<int> stop;
+    alignas(64) std::atomic<uint64_t> submitted, completed, rejected;
+    std::atomic<uint64_t> full_flushes, deadline_flushes, jobs_flushed;
+    std::atomic<uint64_t> sm3_blocks, sm3_slots, sm4_blocks, sm4_slots;
+    std::atomic<uint64_t> lat_sum, lat_max;
+};
+
+static void futex_wait(std::atomic<int> *a, int val) {
+    syscall(SYS_futex, (int*)a, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+static void futex_wake(std::atomic<int> *a) {
+    syscall(SYS_futex, (int*)a, FUTEX_WAKE_PRIVATE, INT32_MAX, NULL, NULL, 0);
+}
+
+static uint64_t now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// ---------------------------- 无锁队列 ----------------------------
+static bool q_push(queue_t *q, cs_job *job) {
+    size_t pos = q->enq.load(std::memory_order_relaxed);
+    cell_t *c;
+    for (;;) {
+        c = &q->cells[pos & q->mask];
+        size_t seq = c->seq.load(std::memory_order_acquire);
+        intptr_t d = (intptr_t)seq - (intptr_t)pos;
+        if (d == 0) {
+            if (q->enq.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (d < 0) {
+            return false;
+        } else {
+            pos = q->enq.load(std::memory_order_relaxed);
+        }
+    }
+    c->job = job;
+    c->seq.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+static cs_job *q_pop(queue_t *q) {
+    size_t pos = q->deq.load(std::memory_order_relaxed);
+    cell_t *c;
+    for (;;) {
+        c = &q->cells[pos & q->mask];
+        size_t seq = c->seq.load(std::memory_order_acquire);
+        intptr_t d = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (d == 0) {
+            if (q->deq.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (d < 0) {
+            return NULL;
+        } else {
+            pos = q->deq.load(std::memory_order_relaxed);
+        }
+    }
+    cs_job *job = c->job;
+    c->seq.store(pos + q->mask + 1, std::memory_order_release);
+    return job;
+}
+
+static bool q_empty(queue_t *q) {
+    size_t pos = q->deq.load(std::memory_order_seq_cst);
+    return q->cells[pos & q->mask].seq.load(std::memory_order_seq_cst) != pos + 1;
+}
+
+static size_t q_depth(queue_t *q) {
+    size_t e = q->enq.load(std::memory_order_relaxed), d = q->deq.load(std::memory_order_relaxed);
+    return e > d ? e - d : 0;
+}
+
+// ---------------------------- 执行一批 ----------------------------
+static void atomic_max(std::atomic<uint64_t> &a, uint64_t v) {
+    uint64_t cur = a.load(std::memory_order_relaxed);
+    while (cur < v && !a.compare_exchange_weak(cur, v, std::memory_order_relaxed)) {}
+}
+
+static void complete(cs_job *j) {
+    cs_done_fn cb = j->cb;
+    if (cb) cb(j, j->arg);
+    else if (j->done.exchange(1, std::memory_order_acq_rel) == 2) futex_wake(&j->done);
+}
+
+static void run_sm3(cs_sched *s, wstate_t *w, batch_t *b) {
+    const uint8_t *msg[CS_BATCH_MAX];
+    size_t len[CS_BATCH_MAX], blocks = 0;
+    for (int i = 0; i < b->n; i++) {
+        msg[i] = b->jobs[i]->in;
+        len[i] = b->jobs[i]->len;
+        blocks += (len[i] + 8) / 64 + 1;
+    }
+    size_t steps = sm3_mb_hash(msg, len, (size_t)b->n, w->dig);
+    for (int i = 0; i < b->n; i++) memcpy(b->jobs[i]->out, w->dig[i], 32);
+    s->sm3_blocks.fetch_add(blocks, std::memory_order_relaxed);
+    // 逐条计算时每个分组只用了 8 个通道中的 1 个
+    s->sm3_slots.fetch_add(steps ? steps * CS_LANES : blocks * CS_LANES, std::memory_order_relaxed);
+}
+
+static void run_sm4(cs_sched *s, wstate_t *w, batch_t *b, int dec) {
+    size_t k = 0;
+    for (int i = 0; i < b->n; i++) {
+        cs_job *j = b->jobs[i];
+        memcpy(w->mk[i], j->key, 16);
+        if (j->len) memcpy(w->stage[k], j->in, j->len);
+        for (size_t e = k + j->len / 16; k < e; k++) w->idx[k] = (uint32_t)i;
+    }
+    sm4_expand_keys(w->mk, (size_t)b->n, w->rk_tab);
+    sm4_crypt_multikey(w->stage, w->stage, w->idx, k, w->rk_tab, dec);
+    s->sm4_blocks.fetch_add(k, std::memory_order_relaxed);
+    s->sm4_slots.fetch_add((k + CS_LANES - 1) / CS_LANES * CS_LANES, std::memory_order_relaxed);
+    k = 0;
+    for (int i = 0; i < b->n; i++) {
+        cs_job *j = b->jobs[i];
+        if (j->len) memcpy(j->out, w->stage[k], j->len);
+        k += j->len / 16;
+    }
+}
+
+// 统计按批累加，先于完成通知更新，等待方醒来时计数已经包含自己
+static void flush(cs_sched *s, wstate_t *w, int c, bool full) {
+    batch_t *b = &w->b[c];
+    if (b->n == 0) return;
+    if (c == CS_SM3) run_sm3(s, w, b);
+    else run_sm4(s, w, b, c == CS_SM4_DEC);
+    uint64_t now = now_ns(), lat_sum = 0, lat_max = 0;
+    for (int i = 0; i < b->n; i++) {
+        uint64_t lat = now - b->jobs[i]->t_submit;
+        lat_sum += lat;
+        if (lat > lat_max) lat_max = lat;
+    }
+    s->lat_sum.fetch_add(lat_sum, std::memory_order_relaxed);
+    atomic_max(s->lat_max, lat_max);
+    (full ? s->full_flushes : s->deadline_flushes).fetch_add(1, std::memory_order_relaxed);
+    s->jobs_flushed.fetch_add((uint64_t)b->n, std::memory_order_relaxed);
+    s->completed.fetch_add((uint64_t)b->n, std::memory_order_relaxed);
+    for (int i = 0; i < b->n; i++) complete(b->jobs[i]);
+    b->n = 0;
+    b->blocks = 0;
+}
+
+// 攒够 8 个通道就算满
+static bool batch_full(const batch_t *b, int c) {
+    return c == CS_SM3 ? b->n >= CS_LANES : b->blocks >= CS_LANES;
+}
+
+static void add_job(cs_sched *s, wstate_t *w, cs_job *j) {
+    int c = j->op;
+    batch_t *b = &w->b[c];
+    size_t nb = c == CS_SM3 ? 0 : j->len / 16;
+    if (b->n == CS_BATCH_MAX || b->blocks + nb > SM4_STAGE_BLOCKS) flush(s, w, c, true);
+    if (b->n == 0) b->oldest = j->t_submit;
+    b->jobs[b->n++] = j;
+    b->blocks += nb;
+}
+
+// ---------------------------- 工作线程 ----------------------------
+static void *worker_main(void *arg) {
+    queue_t *q = (queue_t*)arg;
+    cs_sched *s = q->s;
+    wstate_t *w = q->w;
+    prctl(PR_SET_TIMERSLACK, 1000UL);           // 默认 50 µs 的定时器松弛会直接加到 deadline 上
+    for (;;) {
+        int got = 0;
+        cs_job *j;
+        while (got < 4 * CS_BATCH_MAX && (j = q_pop(q)) != NULL) { add_job(s, w, j); got++; }
+        // 自己的队列空了：从别的队列偷一批
+        for (int k = 1; got == 0 && k < s->nq; k++) {
+            queue_t *o = &s->q[(q - s->q + k) % s->nq];
+            while (got < CS_BATCH_MAX && (j = q_pop(o)) != NULL) { add_job(s, w, j); got++; }
+        }
+
+        bool stopping = s->stop.load(std::memory_order_acquire) && got == 0;
+        uint64_t now = now_ns(), wake = 0;
+        for (int c = 0; c < 3; c++) {
+            batch_t *b = &w->b[c];
+            if (b->n == 0) continue;
+            if (batch_full(b, c)) flush(s, w, c, true);
+            else if (stopping || now - b->oldest >= s->deadline_ns) flush(s, w, c, false);
+            else if (wake == 0 || b->oldest + s->deadline_ns < wake) wake = b->oldest + s->deadline_ns;
+        }
+        if (got) continue;
+        if (stopping) break;
+
+        // 队列空：有未满的批就睡到最早的截止时间，否则一直睡到有人提交
+        q->sleeping.store(1, std::memory_order_seq_cst);
+        if (!q_empty(q) || s->stop.load(std::memory_order_seq_cst)) {
+            q->sleeping.store(0, std::memory_order_relaxed);
+            continue;
+        }
+        if (wake) {
+            struct timespec ts;
+            clock_gettime(CLOCK_REALTIME, &ts);
+            uint64_t left = wake > now ? wake - now : 0;
+            ts.tv_sec += (time_t)(left / 1000000000ull);
+            ts.tv_nsec += (long)(left % 1000000000ull);
+            if (ts.tv_nsec >= 1000000000L) { ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
+            while (sem_timedwait(&q->sem, &ts) != 0 && errno == EINTR) {}
+        } else {
+            while (sem_wait(&q->sem) != 0 && errno == EINTR) {}
+        }
+        q->sleeping.store(0, std::memory_order_relaxed);
+    }
+    return NULL;
+}
+
+// ---------------------------- 接口 ----------------------------
+cs_sched *cs_create(const cs_config *cfg) {
+    int nq = cfg && cfg->nqueues > 0 ? cfg->nqueues : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    size_t want = cfg && cfg->queue_cap ? cfg->queue_cap : 1024, cap = 2;
+    uint32_t dl = cfg && cfg->deadline_us ? cfg->deadline_us : 200;
+    if (nq < 1) nq = 1;
+    if (nq > CS_MAX_QUEUES) nq = CS_MAX_QUEUES;
+    while (cap < want) cap <<= 1;
+
+    cs_sched *s = new cs_sched();
+    s->nq = nq;
+    s->deadline_ns = (uint64_t)dl * 1000;
+    s->q = new queue_t[nq]();
+    int ok = 1;
+    for (int i = 0; i < nq; i++) {
+        queue_t *q = &s->q[i];
+        q->s = s;
+        q->mask = cap - 1;
+        q->sem_ok = sem_init(&q->sem, 0, 0) == 0;
+        q->cells = (cell_t*)aligned_alloc(64, cap * sizeof(cell_t));
+        q->w = (wstate_t*)aligned_alloc(64, sizeof(wstate_t));
+        if (!q->sem_ok || !q->cells || !q->w) { ok = 0; break; }
+        for (size_t k = 0; k < cap; k++) new (&q->cells[k].seq) std::atomic<size_t>(k);
+        memset(q->w->b, 0, sizeof(q->w->b));
+    }
+    for (int i = 0; ok && i < nq; i++) {
+        s->q[i].threaded = pthread_create(&s->q[i].th, NULL, worker_main, &s->q[i]) == 0;
+        if (!s->q[i].threaded) ok = 0;
+    }
+    if (!ok) { cs_destroy(s); return NULL; }
+    return s;
+}
+
+void cs_destroy(cs_sched *s) {
+    if (!s) return;
+    s->stop.store(1, std::memory_order_seq_cst);
+    for (int i = 0; i < s->nq; i++) if (s->q[i].threaded) sem_post(&s->q[i].sem);
+    for (int i = 0; i < s->nq; i++) if (s->q[i].threaded) pthread_join(s->q[i].th, NULL);
+    for (int i = 0; i < s->nq; i++) {
+        if (s->q[i].sem_ok) sem_destroy(&s->q[i].sem);
+        free(s->q[i].cells);
+        free(s->q[i].w);
+    }
+    delete[] s->q;
+    delete s;
+}
+
+int cs_submit(cs_sched *s, cs_job *job) {
+    if (!job || !job->out || (job->len && !job->in) || job->op < CS_SM3 || job->op > CS_SM4_DEC ||
+        (job->op != CS_SM3 && (!job->key || job->len % 16 || job->len > CS_SM4_MAX_LEN))) {
+        errno = EINVAL;
+        return -1;
+    }
+    job->done.store(0, std::memory_order_relaxed);
+    job->t_submit = now_ns();
+    int cpu = sched_getcpu();
+    int first = cpu < 0 ? 0 : cpu % s->nq;
+    for (int k = 0; k < s->nq; k++) {
+        queue_t *q = &s->q[(first + k) % s->nq];
+        if (!q_push(q, job)) continue;
+        s->submitted.fetch_add(1, std::memory_order_relaxed);
+        size_t d = q_depth(q), m = q->depth_max.load(std::memory_order_relaxed);
+        while (m < d && !q->depth_max.compare_exchange_weak(m, d, std::memory_order_relaxed)) {}
+        // 入队的 release 写可以排到下面读 sleeping 之后，与工作线程“写 sleeping、读 seq”两边互相看不见；
+        // 全屏障保证两边至少有一方看到对方的写
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (q->sleeping.load(std::memory_order_seq_cst) && q->sleeping.exchange(0)) sem_post(&q->sem);
+        return 0;
+    }
+    s->rejected.fetch_add(1, std::memory_order_relaxed);
+    errno = EAGAIN;
+    return -1;
+}
+
+int cs_poll(const cs_job *job) {
+    return job->done.load(std::memory_order_acquire) == 1;
+}
+
+// 先短暂自旋，仍未完成就在 done 上 futex 等待
+void cs_wait(cs_job *job) {
+    for (int i = 0; i < 64; i++) {
+        if (job->done.load(std::memory_order_acquire) == 1) return;
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    int v = 0;
+    if (job->done.compare_exchange_strong(v, 2, std::memory_order_acq_rel) || v == 2)
+        while (job->done.load(std::memory_order_acquire) != 1) futex_wait(&job->done, 2);
+}
+
+void cs_get_stats(cs_sched *s, cs_stats *st) {
+    memset(st, 0, sizeof(*st));
+    st->submitted = s->submitted.load(std::memory_order_relaxed);
+    st->completed = s->completed.load(std::memory_order_relaxed);
+    st->rejected = s->rejected.load(std::memory_order_relaxed);
+    st->full_flushes = s->full_flushes.load(std::memory_order_relaxed);
+    st->deadline_flushes = s->deadline_flushes.load(std::memory_order_relaxed);
+    st->jobs_flushed = s->jobs_flushed.load(std::memory_order_relaxed);
+    st->sm3_blocks = s->sm3_blocks.load(std::memory_order_relaxed);
+    st->sm3_lane_slots = s->sm3_slots.load(std::memory_order_relaxed);
+    st->sm4_blocks = s->sm4_blocks.load(std::memory_order_relaxed);
+    st->sm4_lane_slots = s->sm4_slots.load(std::memory_order_relaxed);
+    st->lat_sum_ns = s->lat_sum.load(std::memory_order_relaxed);
+    st->lat_max_ns = s->lat_max.load(std::memory_order_relaxed);
+    st->nqueues = s->nq;
+    for (int i = 0; i < s->nq; i++) {
+        st->depth[i] = q_depth(&s->q[i]);
+        st->depth_max[i] = s->q[i].depth_max.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,72 @@
+#ifndef CRYPTO_SCHED_H
+#define CRYPTO_SCHED_H
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// ---------------------------- 批量 SM3 / SM4 任务调度器 ----------------------------
+// 很多线程各自提交很小的 SM3 / SM4 请求时，逐个调用只能跑单分组代码。
+// 调度器把请求攒成整批，交给多通道内核：
+//   SM3      → sm3_mb_hash（Project4/sm3_mb.c，AVX2 8 条消息并行）
+//   SM4 加解密 → sm4_expand_keys + sm4_crypt_multikey（SM4-multikey.cpp，每个分组带自己的密钥）
+// 每个工作线程有一条无锁的有界 MPMC 队列（Vyukov）。提交方按当前 CPU 选队列，满了就依次试下一条。
+// 工作线程取空队列后，凑够一批（SM3 8 条消息、SM4 8 个分组）立即执行；不够一批时最多等 deadline_us，
+// 到期后把不满的一批也执行掉。自己的队列空了会去别的队列偷任务。
+// 完成通知二选一：cb 非空时在工作线程里调用 cb，此后调度器不再访问该任务；
+// 否则置 done，由 cs_poll / cs_wait 观察。
+
+#define CS_MAX_QUEUES      64
+#define CS_LANES           8
+#define CS_BATCH_MAX       64          // 每类请求一次最多执行的任务数
+#define CS_SM4_MAX_LEN     4096        // 单个 SM4 请求的上限（256 个分组）
+
+enum cs_op { CS_SM3 = 0, CS_SM4_ENC = 1, CS_SM4_DEC = 2 };
+
+struct cs_job;
+typedef void (*cs_done_fn)(cs_job *job, void *arg);
+
+struct cs_job {
+    // 调用方填写
+    int op;
+    const uint8_t *in;          // SM3：消息；SM4：len / 16 个分组
+    uint8_t *out;               // SM3：32 字节摘要；SM4：与 in 等长，可以与 in 相同
+    size_t len;                 // SM4 须为 16 的倍数且不超过 CS_SM4_MAX_LEN
+    const uint8_t *key;         // SM4 的 16 字节密钥
+    cs_done_fn cb;
+    void *arg;
+    // 调度器使用
+    std::atomic<int> done;
+    uint64_t t_submit;
+};
+
+struct cs_config {
+    int nqueues;                // 队列数 = 工作线程数；<= 0 时取在线 CPU 数
+    size_t queue_cap;           // 每条队列的容量，向上取整到 2 的幂；0 时取 1024
+    uint32_t deadline_us;       // 不满一批时的最长等待；0 时取 200
+};
+
+struct cs_stats {
+    uint64_t submitted, completed, rejected;   // rejected：所有队列都满
+    uint64_t full_flushes, deadline_flushes;
+    uint64_t jobs_flushed;                     // jobs_flushed / 两类 flush 之和 = 平均批大小
+    uint64_t sm3_blocks, sm3_lane_slots;       // 通道利用率 = blocks / slots
+    uint64_t sm4_blocks, sm4_lane_slots;
+    uint64_t lat_sum_ns, lat_max_ns;           // 提交到完成
+    int nqueues;
+    size_t depth[CS_MAX_QUEUES];               // 当前队列深度
+    size_t depth_max[CS_MAX_QUEUES];           // 历史最大深度
+};
+
+struct cs_sched;
+
+cs_sched *cs_create(const cs_config *cfg);     // cfg 可为 NULL；失败返回 NULL
+// 等队列里已有的任务全部完成后停止工作线程并释放
+void cs_destroy(cs_sched *s);
+
+// 成功返回 0；参数不合法返回 -1（errno = EINVAL），所有队列都满返回 -1（errno = EAGAIN）
+int  cs_submit(cs_sched *s, cs_job *job);
+int  cs_poll(const cs_job *job);               // 完成返回 1
+void cs_wait(cs_job *job);                    // 短暂自旋后在 futex 上睡眠
+void cs_get_stats(cs_sched *s, cs_stats *st);
+
+#endif
@@ -0,0 +1,237 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+#include "crypto_sched.h"
+#include "sm4_multikey.h"
+#include "sm3.h"
+
+// ---------------------------- 批量任务调度器演示 ----------------------------
+// 编译：
+//   gcc -O2 -mavx2 -c ../Project4/sm3.c ../Project4/sm3_mb.c
+//   g++ -O2 -mavx2 -pthread -I../Project4 -DSM4_MULTIKEY_NO_MAIN crypto_sched_demo.cpp crypto_sched.cpp SM4-multikey.cpp sm3.o sm3_mb.o -o crypto_sched_demo
+// 用法：./crypto_sched_demo [生产线程数]
+//   1. 多线程随机混合提交 SM3 / SM4 加密 / SM4 解密（部分用回调），逐个与标量结果比对
+//   2. 小请求吞吐：每个线程直接调用标量实现 vs 异步提交给调度器（每线程 64 个在途）
+//   3. 同步逐个提交（每次只有 1 个在途）时的延迟，即不满一批、靠 deadline 触发的情形
+
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t rng_next(uint64_t *s) {
+    *s ^= *s << 13; *s ^= *s >> 7; *s ^= *s << 17;
+    return *s;
+}
+
+static void print_stats(cs_sched *s) {
+    cs_stats st;
+    cs_get_stats(s, &st);
+    uint64_t flushes = st.full_flushes + st.deadline_flushes;
+    size_t dmax = 0;
+    for (int i = 0; i < st.nqueues; i++) dmax = std::max(dmax, st.depth_max[i]);
+    printf("    submitted %llu, completed %llu, rejected %llu\n",
+           (unsigned long long)st.submitted, (unsigned long long)st.completed, (unsigned long long)st.rejected);
+    printf("    flushes: %llu full, %llu deadline; avg batch %.1f jobs; max queue depth %zu\n",
+           (unsigned long long)st.full_flushes, (unsigned long long)st.deadline_flushes,
+           flushes ? (double)st.jobs_flushed / flushes : 0.0, dmax);
+    printf("    lane fill: SM3 %.1f%%, SM4 %.1f%%; latency avg %.1f us, max %.1f us\n",
+           st.sm3_lane_slots ? 100.0 * st.sm3_blocks / st.sm3_lane_slots : 0.0,
+           st.sm4_lane_slots ? 100.0 * st.sm4_blocks / st.sm4_lane_slots : 0.0,
+           st.completed ? st.lat_sum_ns / 1e3 / st.completed : 0.0, st.lat_max_ns / 1e3);
+}
+
+// ---------------------------- 1. 正确性 ----------------------------
+struct req_t {
+    cs_job job;
+    uint8_t key[16];
+    uint8_t in[CS_SM4_MAX_LEN], out[CS_SM4_MAX_LEN];
+    std::atomic<int> cb_done;
+};
+
+static void on_done(cs_job *job, void *arg) {
+    (void)job;
+    ((req_t*)arg)->cb_done.store(1, std::memory_order_release);
+}
+
+struct mix_arg_t {
+    cs_sched *s;
+    int id, rounds, bad;
+};
+
+static void *mix_main(void *p) {
+    mix_arg_t *a = (mix_arg_t*)p;
+    const int W = 32;
+    req_t *r = new req_t[W];
+    uint64_t rs = 0x9e3779b97f4a7c15ULL * (uint64_t)(a->id + 1);
+    for (int round = 0; round < a->rounds; round++) {
+        for (int i = 0; i < W; i++) {
+            req_t *q = &r[i];
+            int op = (int)(rng_next(&rs) % 3);
+            size_t len = op == CS_SM3 ? rng_next(&rs) % 300 : 16 * (rng_next(&rs) % 17);
+            for (size_t k = 0; k < len; k++) q->in[k] = (uint8_t)rng_next(&rs);
+            for (int k = 0; k < 16; k++) q->key[k] = (uint8_t)rng_next(&rs);
+            q->job.op = op;
+            q->job.in = q->in;
+            q->job.out = q->out;
+            q->job.len = len;
+            q->job.key = q->key;
+            q->cb_done.store(0);
+            q->job.cb = (rng_next(&rs) & 1) ? on_done : NULL;
+            q->job.arg = q;
+            while (cs_submit(a->s, &q->job) != 0) sched_yield();
+        }
+        for (int i = 0; i < W; i++) {
+            req_t *q = &r[i];
+            if (q->job.cb) { while (!q->cb_done.load(std::memory_order_acquire)) sched_yield(); }
+            else cs_wait(&q->job);
+            uint8_t ref[CS_SM4_MAX_LEN];
+            if (q->job.op == CS_SM3) {
+                sm3_hash(q->in, q->job.len, ref);
+                if (memcmp(ref, q->out, 32) != 0) a->bad++;
+            } else {
+                uint32_t rk[32];
+                sm4_expand_key(q->key, rk);
+                for (size_t k = 0; k < q->job.len; k += 16)
+                    sm4_crypt_block(q->in + k, ref + k, rk, q->job.op == CS_SM4_DEC);
+                if (q->job.len && memcmp(ref, q->out, q->job.len) != 0) a->bad++;
+            }
+        }
+    }
+    delete[] r;
+    return NULL;
+}
+
+// ---------------------------- 2. 吞吐 ----------------------------
+struct tp_arg_t {
+    cs_sched *s;            // NULL 时直接调用标量实现
+    int op, id;
+    size_t n;
+    const uint8_t *data;    // 每个请求 64 字节输入，SM4 用前 32 字节
+    const uint8_t *keys;
+    uint8_t *out;
+};
+
+static void *tp_main(void *p) {
+    tp_arg_t *a = (tp_arg_t*)p;
+    size_t len = a->op == CS_SM3 ? 64 : 32;
+    if (!a->s) {
+        for (size_t i = 0; i < a->n; i++) {
+            if (a->op == CS_SM3) { sm3_hash(a->data + 64 * i, len, a->out + 64 * i); continue; }
+            uint32_t rk[32];
+            sm4_expand_key(a->keys + 16 * i, rk);
+            sm4_crypt_block(a->data + 64 * i, a->out + 64 * i, rk, 0);
+            sm4_crypt_block(a->data + 64 * i + 16, a->out + 64 * i + 16, rk, 0);
+        }
+        return NULL;
+    }
+    const size_t W = 64;
+    cs_job *jobs = new cs_job[W];
+    for (size_t base = 0; base < a->n; base += W) {
+        size_t m = std::min(W, a->n - base);
+        for (size_t k = 0; k < m; k++) {
+            size_t i = base + k;
+            cs_job *j = &jobs[k];
+            j->op = a->op; j->in = a->data + 64 * i; j->out = a->out + 64 * i; j->len = len;
+            j->key = a->keys + 16 * i; j->cb = NULL; j->arg = NULL;
+            while (cs_submit(a->s, j) != 0) sched_yield();
+        }
+        for (size_t k = 0; k < m; k++) cs_wait(&jobs[k]);
+    }
+    delete[] jobs;
+    return NULL;
+}
+
+static double run_tp(cs_sched *s, int op, int nthr, size_t per, const uint8_t *data, const uint8_t *keys, uint8_t *out) {
+    std::vector<pthread_t> th(nthr);
+    std::vector<tp_arg_t> args(nthr);
+    double t0 = now_sec();
+    for (int t = 0; t < nthr; t++) {
+        size_t off = (size_t)t * per;
+        args[t] = tp_arg_t{ s, op, t, per, data + 64 * off, keys + 16 * off, out + 64 * off };
+        pthread_create(&th[t], NULL, tp_main, &args[t]);
+    }
+    for (int t = 0; t < nthr; t++) pthread_join(th[t], NULL);
+    return now_sec() - t0;
+}
+
+int main(int argc, char **argv) {
+    int nthr = argc > 1 ? atoi(argv[1]) : 4;
+    if (nthr < 1) nthr = 1;
+    cs_config cfg = { 0, 1024, 200 };
+
+    // 1. 正确性
+    cs_sched *s = cs_create(&cfg);
+    if (!s) { fprintf(stderr, "cs_create failed\n"); return 1; }
+    std::vector<pthread_t> th(nthr);
+    std::vector<mix_arg_t> ma(nthr);
+    for (int t = 0; t < nthr; t++) {
+        ma[t] = mix_arg_t{ s, t, 300, 0 };
+        pthread_create(&th[t], NULL, mix_main, &ma[t]);
+    }
+    int bad = 0;
+    for (int t = 0; t < nthr; t++) { pthread_join(th[t], NULL); bad += ma[t].bad; }
+    cs_job inval = {};
+    inval.op = CS_SM4_ENC; inval.len = 24;
+    uint8_t tmp[32], key[16] = {0};
+    inval.in = tmp; inval.out = tmp; inval.key = key;
+    int rej = cs_submit(s, &inval) == -1 && errno == EINVAL;
+    printf("%d threads x %d mixed SM3/SM4 jobs vs scalar: %s\n", nthr, 300 * 32, bad ? "FAIL" : "OK");
+    printf("invalid SM4 length rejected: %s\n", rej ? "OK" : "FAIL");
+    print_stats(s);
+    cs_destroy(s);
+
+    // 2. 吞吐
+    const size_t N = 1 << 18, per = N / (size_t)nthr;
+    uint8_t *data = (uint8_t*)malloc(N * 64), *keys = (uint8_t*)malloc(N * 16);
+    uint8_t *o1 = (uint8_t*)malloc(N * 64), *o2 = (uint8_t*)malloc(N * 64);
+    uint64_t rs = 12345;
+    for (size_t i = 0; i < N * 64; i++) data[i] = (uint8_t)rng_next(&rs);
+    for (size_t i = 0; i < N * 16; i++) keys[i] = (uint8_t)rng_next(&rs);
+    static const char *names[2] = { "SM3, 64-byte messages", "SM4, 32-byte records, one key each" };
+    static const int ops[2] = { CS_SM3, CS_SM4_ENC };
+    for (int k = 0; k < 2; k++) {
+        memset(o1, 0, N * 64); memset(o2, 0, N * 64);
+        double ts = run_tp(NULL, ops[k], nthr, per, data, keys, o1);
+        s = cs_create(&cfg);
+        double tb = run_tp(s, ops[k], nthr, per, data, keys, o2);
+        int same = memcmp(o1, o2, N * 64) == 0;
+        printf("\n%s, %d threads, %zu requests:\n", names[k], nthr, per * nthr);
+        printf("  inline scalar : %.2f M req/s\n", per * nthr / ts / 1e6);
+        printf("  scheduler     : %.2f M req/s (%.2fx)%s\n", per * nthr / tb / 1e6, ts / tb, same ? "" : "  MISMATCH");
+        print_stats(s);
+        cs_destroy(s);
+        if (!same) bad++;
+    }
+    free(data); free(keys); free(o1); free(o2);
+
+    // 3. 同步逐个提交：每个任务都要等到 deadline 才被执行
+    static const uint32_t deadlines[2] = { 50, 200 };
+    for (int k = 0; k < 2; k++) {
+        cs_config c1 = { 1, 64, deadlines[k] };
+        s = cs_create(&c1);
+        std::vector<double> lat;
+        uint8_t msg[64] = {0}, dig[32];
+        cs_job j = {};
+        j.op = CS_SM3; j.in = msg; j.out = dig; j.len = sizeof(msg);
+        for (int i = 0; i < 2000; i++) {
+            double t0 = now_sec();
+            cs_submit(s, &j);
+            cs_wait(&j);
+            lat.push_back((now_sec() - t0) * 1e6);
+        }
+        std::sort(lat.begin(), lat.end());
+        printf("\nsynchronous SM3, deadline %u us: p50 %.1f us, p99 %.1f us\n",
+               deadlines[k], lat[lat.size() / 2], lat[lat.size() * 99 / 100]);
+        print_stats(s);
+        cs_destroy(s);
+    }
+    return bad ? 1 : 0;
+}
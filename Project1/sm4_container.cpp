@@ -0,0 +1,319 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/random.h>
+#include <sys/stat.h>
+#include "sm4_gcm.h"
+#include "sm4_container.h"
+#include "thread_pool.h"
+
+// ---------------------------- 分块容器实现 ----------------------------
+// 写入端把明文攒满 batch 个块后并行加密、一次 pwrite 写出。只有确认后面还有数据时才写出整批，
+// 所以 close 时缓冲区里剩下的最后一块一定能带上 last 标记。
+// 读取端按同样的批大小（nthreads * CHUNKS_PER_THREAD 块）分批 pread 连续密文、并行解密、拷出请求的部分，
+// 读多大的区间都只占两块批缓冲。
+// 并行部分用 Project4/thread_pool.c 的共享线程池；写入端的两块批缓冲用 tp_alloc 分配，
+// 按与加密相同的静态划分预先写入，每个 worker 加密的块与它读写的页在同一个 NUMA 节点上。
+
+#define CHUNKS_PER_THREAD 4
+#define LAST_INDEX        0xffffffffu   // 块号上限，同时是 trailer 的 IV 块号
+
+static const uint8_t MAGIC[8] = { 'S','M','4','G','C','M','C', 2 };
+
+struct sm4c_writer {
+    int fd, nthreads;
+    uint32_t cs;
+    size_t batch;                       // 每批块数
+    sm4_gcm_key key;
+    uint8_t header[SM4C_HEADER_BYTES];
+    uint8_t *pbuf, *cbuf;               // 明文缓冲 batch*cs，密文缓冲 batch*(cs+16)
+    size_t pbuf_len;
+    uint64_t next_idx, total, off;
+};
+
+struct sm4c_reader {
+    int fd, nthreads;
+    uint32_t cs;
+    sm4_gcm_key key;
+    uint8_t header[SM4C_HEADER_BYTES];
+    uint64_t count, total;
+};
+
+static void put_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static void put_be64(uint8_t *p, uint64_t v) {
+    put_be32(p, (uint32_t)(v >> 32)); put_be32(p + 4, (uint32_t)v);
+}
+
+static uint32_t get_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static uint64_t get_be64(const uint8_t *p) {
+    return ((uint64_t)get_be32(p) << 32) | get_be32(p + 4);
+}
+
+// IV = salt 前 7 字节 || idx(4) || flag(1)
+static void chunk_iv(uint8_t iv[12], const uint8_t *header, uint32_t idx, uint8_t flag) {
+    memcpy(iv, header + 16, 7);
+    put_be32(iv + 7, idx);
+    iv[11] = flag;
+}
+
+static int pread_full(int fd, uint8_t *p, size_t n, uint64_t off) {
+    while (n) {
+        ssize_t r = pread(fd, p, n, (off_t)off);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return -1;
+        p += r; n -= (size_t)r; off += (uint64_t)r;
+    }
+    return 0;
+}
+
+static int pwrite_full(int fd, const uint8_t *p, size_t n, uint64_t off) {
+    while (n) {
+        ssize_t r = pwrite(fd, p, n, (off_t)off);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return -1;
+        p += r; n -= (size_t)r; off += (uint64_t)r;
+    }
+    return 0;
+}
+
+static void wipe(void *p, size_t n) {
+    volatile uint8_t *v = (volatile uint8_t*)p;
+    while (n--) *v++ = 0;
+}
+
+// K_f = SM4(K, salt)，salt 在 header[16..32)
+static void file_key(sm4_gcm_key *k, const uint8_t key[16], const uint8_t *header) {
+    uint32_t rk[32];
+    uint8_t fk[16];
+    sm4_expand_key(key, rk);
+    sm4_crypt_block(header + 16, fk, rk, 0);
+    sm4_gcm_setkey(k, fk);
+    wipe(rk, sizeof(rk));
+    wipe(fk, sizeof(fk));
+}
+
+// ---------------------------- 并行处理一段连续的块 ----------------------------
+// 明文按 cs 排列，密文按 cs+16 排列；第 j 块长度为 cs，若 has_last 则第 n-1 块长度为 last_len 且带 last 标记
+struct job_t {
+    const sm4_gcm_key *key;
+    const uint8_t *header;
+    uint64_t first;
+    uint32_t cs;
+    size_t n, last_len;
+    int has_last, dec;
+    const uint8_t *in;
+    uint8_t *out;
+    int bad[TP_MAX_WORKERS];            // 按 worker 分开记录，避免多个线程写同一个字
+};
+
+static void job_range(void *arg, size_t lo, size_t hi, int worker) {
+    job_t *j = (job_t*)arg;
+    size_t stride = (size_t)j->cs + SM4C_TAG_BYTES;
+    for (size_t i = lo; i < hi; i++) {
+        int last = j->has_last && i == j->n - 1;
+        size_t len = last ? j->last_len : j->cs;
+        uint8_t iv[12];
+        chunk_iv(iv, j->header, (uint32_t)(j->first + i), (uint8_t)last);
+        if (!j->dec) {
+            uint8_t *c = j->out + i * stride;
+            sm4_gcm_seal(j->key, iv, j->header, SM4C_HEADER_BYTES, j->in + i * j->cs, c, len, c + len);
+        } else {
+            const uint8_t *c = j->in + i * stride;
+            if (sm4_gcm_open(j->key, iv, j->header, SM4C_HEADER_BYTES, c, j->out + i * j->cs, len, c + len) != 0)
+                j->bad[worker] = 1;
+        }
+    }
+}
+
+// 返回 0，有块认证失败返回 -1
+static int run_chunks(job_t *j, int nthreads) {
+    if (j->n == 0) return 0;
+    tp_parallel_for(nthreads > 1 ? tp_default() : NULL, nthreads, j->n, 1, job_range, j);
+    int bad = 0;
+    for (int i = 0; i < TP_MAX_WORKERS; i++) bad |= j->bad[i];
+    return bad ? -1 : 0;
+}
+
+// ---------------------------- 写入端 ----------------------------
+sm4c_writer *sm4c_writer_open(int fd, const uint8_t key[16], uint32_t chunk_size, int nthreads) {
+    if (chunk_size < SM4C_MIN_CHUNK || chunk_size > SM4C_MAX_CHUNK) { errno = EINVAL; return NULL; }
+    sm4c_writer *w = (sm4c_writer*)calloc(1, sizeof(*w));
+    if (!w) return NULL;
+    w->fd = fd;
+    w->nthreads = nthreads < 1 ? 1 : nthreads;
+    w->cs = chunk_size;
+    tp_pool *pool = w->nthreads > 1 ? tp_default() : NULL;
+    w->batch = (size_t)w->nthreads * CHUNKS_PER_THREAD;
+    w->pbuf = (uint8_t*)tp_alloc(pool, w->nthreads, w->batch * chunk_size);
+    w->cbuf = (uint8_t*)tp_alloc(pool, w->nthreads, w->batch * ((size_t)chunk_size + SM4C_TAG_BYTES));
+    memcpy(w->header, MAGIC, 8);
+    put_be32(w->header + 8, chunk_size);
+    if (!w->pbuf || !w->cbuf || getrandom(w->header + 16, 16, 0) != 16 ||
+        pwrite_full(fd, w->header, SM4C_HEADER_BYTES, 0) != 0) {
+        tp_free(w->pbuf, w->batch * chunk_size);
+        tp_free(w->cbuf, w->batch * ((size_t)chunk_size + SM4C_TAG_BYTES));
+        free(w);
+        return NULL;
+    }
+    file_key(&w->key, key, w->header);
+    w->off = SM4C_HEADER_BYTES;
+    return w;
+}
+
+// 加密并写出缓冲区中的 n 块；final 时最后一块取缓冲区剩余长度并带 last 标记
+static int flush_chunks(sm4c_writer *w, size_t n, int final) {
+    if (w->next_idx + n > LAST_INDEX) { errno = EFBIG; return -1; }
+    job_t j;
+    memset(&j, 0, sizeof(j));
+    j.key = &w->key;
+    j.header = w->header;
+    j.first = w->next_idx;
+    j.cs = w->cs;
+    j.n = n;
+    j.has_last = final;
+    j.last_len = final ? w->pbuf_len - (n - 1) * w->cs : w->cs;
+    j.in = w->pbuf;
+    j.out = w->cbuf;
+    run_chunks(&j, w->nthreads);
+    size_t bytes = w->pbuf_len + n * SM4C_TAG_BYTES;
+    if (pwrite_full(w->fd, w->cbuf, bytes, w->off) != 0) return -1;
+    w->off += bytes;
+    w->next_idx += n;
+    w->pbuf_len = 0;
+    return 0;
+}
+
+int sm4c_write(sm4c_writer *w, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t*)data;
+    size_t cap = w->batch * w->cs;
+    while (len) {
+        if (w->pbuf_len == cap && flush_chunks(w, w->batch, 0) != 0) return -1;   // 后面还有数据，整批都不是最后一块
+        size_t n = cap - w->pbuf_len < len ? cap - w->pbuf_len : len;
+        memcpy(w->pbuf + w->pbuf_len, p, n);
+        w->pbuf_len += n; w->total += n; p += n; len -= n;
+    }
+    return 0;
+}
+
+int sm4c_writer_close(sm4c_writer *w) {
+    size_t n = w->pbuf_len == 0 ? 1 : (w->pbuf_len + w->cs - 1) / w->cs;   // 至少一块，空文件也有带 last 标记的空块
+    int rc = flush_chunks(w, n, 1);
+    if (rc == 0) {
+        uint8_t tr[SM4C_TRAILER_BYTES], iv[12];
+        sm4_gcm_ctx c;
+        put_be64(tr, w->next_idx);
+        put_be64(tr + 8, w->total);
+        chunk_iv(iv, w->header, LAST_INDEX, 2);
+        sm4_gcm_start(&c, &w->key, iv);
+        sm4_gcm_aad(&c, w->header, SM4C_HEADER_BYTES);
+        sm4_gcm_aad(&c, tr, 16);
+        sm4_gcm_finish(&c, tr + 16);
+        rc = pwrite_full(w->fd, tr, sizeof(tr), w->off);
+    }
+    wipe(w->pbuf, w->batch * w->cs);
+    wipe(&w->key, sizeof(w->key));
+    tp_free(w->pbuf, w->batch * w->cs);
+    tp_free(w->cbuf, w->batch * ((size_t)w->cs + SM4C_TAG_BYTES));
+    free(w);
+    return rc;
+}
+
+// ---------------------------- 读取端 ----------------------------
+sm4c_reader *sm4c_reader_open(int fd, const uint8_t key[16], int nthreads) {
+    sm4c_reader *r = (sm4c_reader*)calloc(1, sizeof(*r));
+    if (!r) return NULL;
+    struct stat st;
+    uint8_t tr[SM4C_TRAILER_BYTES];
+    r->fd = fd;
+    r->nthreads = nthreads < 1 ? 1 : nthreads;
+    if (fstat(fd, &st) != 0 || pread_full(fd, r->header, SM4C_HEADER_BYTES, 0) != 0 ||
+        (uint64_t)st.st_size < SM4C_HEADER_BYTES + SM4C_TAG_BYTES + SM4C_TRAILER_BYTES ||
+        pread_full(fd, tr, sizeof(tr), (uint64_t)st.st_size - SM4C_TRAILER_BYTES) != 0) goto bad;
+    {
+        r->cs = get_be32(r->header + 8);
+        if (memcmp(r->header, MAGIC, 8) != 0 || get_be32(r->header + 12) != 0 ||
+            r->cs < SM4C_MIN_CHUNK || r->cs > SM4C_MAX_CHUNK) goto bad;
+
+        file_key(&r->key, key, r->header);
+        uint8_t iv[12], tag[16], diff = 0;
+        sm4_gcm_ctx c;
+        chunk_iv(iv, r->header, LAST_INDEX, 2);
+        sm4_gcm_start(&c, &r->key, iv);
+        sm4_gcm_aad(&c, r->header, SM4C_HEADER_BYTES);
+        sm4_gcm_aad(&c, tr, 16);
+        sm4_gcm_finish(&c, tag);
+        for (int i = 0; i < 16; i++) diff |= tag[i] ^ tr[16 + i];
+        if (diff) goto bad;
+
+        // trailer 已认证，再核对块数、总长与文件大小
+        r->count = get_be64(tr);
+        r->total = get_be64(tr + 8);
+        uint64_t want = r->total == 0 ? 1 : (r->total + r->cs - 1) / r->cs;
+        if (r->count != want || r->count > LAST_INDEX ||
+            (uint64_t)st.st_size != SM4C_HEADER_BYTES + r->total + r->count * SM4C_TAG_BYTES + SM4C_TRAILER_BYTES) goto bad;
+    }
+    return r;
+bad:
+    wipe(&r->key, sizeof(r->key));
+    free(r);
+    errno = EBADMSG;
+    return NULL;
+}
+
+uint64_t sm4c_size(const sm4c_reader *r) { return r->total; }
+uint32_t sm4c_chunk_size(const sm4c_reader *r) { return r->cs; }
+
+ssize_t sm4c_pread(sm4c_reader *r, void *buf, size_t len, uint64_t off) {
+    if (off >= r->total || len == 0) return 0;
+    if (len > r->total - off) len = (size_t)(r->total - off);
+    uint64_t first = off / r->cs, last = (off + len - 1) / r->cs;
+    size_t batch = (size_t)r->nthreads * CHUNKS_PER_THREAD;
+    if (batch > last - first + 1) batch = (size_t)(last - first + 1);
+    uint8_t *cbuf = (uint8_t*)malloc(batch * ((size_t)r->cs + SM4C_TAG_BYTES));
+    uint8_t *pbuf = (uint8_t*)malloc(batch * r->cs);
+    if (!cbuf || !pbuf) { free(cbuf); free(pbuf); errno = ENOMEM; return -1; }
+    ssize_t rc = -1;
+    size_t n;
+    for (uint64_t c = first; c <= last; c += n) {
+        n = last - c + 1 < batch ? (size_t)(last - c + 1) : batch;
+        int has_last = c + n - 1 == r->count - 1;
+        size_t last_len = has_last ? (size_t)(r->total - (c + n - 1) * r->cs) : r->cs;
+        size_t pbytes = (n - 1) * r->cs + last_len;
+        if (pread_full(r->fd, cbuf, pbytes + n * SM4C_TAG_BYTES,
+                       SM4C_HEADER_BYTES + c * ((uint64_t)r->cs + SM4C_TAG_BYTES)) != 0) { errno = EIO; goto out; }
+        job_t j;
+        memset(&j, 0, sizeof(j));
+        j.key = &r->key;
+        j.header = r->header;
+        j.first = c;
+        j.cs = r->cs;
+        j.n = n;
+        j.has_last = has_last;
+        j.last_len = last_len;
+        j.dec = 1;
+        j.in = cbuf;
+        j.out = pbuf;
+        if (run_chunks(&j, r->nthreads) != 0) { memset(buf, 0, len); errno = EBADMSG; goto out; }
+        // 这一批明文 [c*cs, c*cs + pbytes) 与请求区间的交集
+        uint64_t lo = c * r->cs > off ? c * r->cs : off, hi = c * r->cs + pbytes < off + len ? c * r->cs + pbytes : off + len;
+        memcpy((uint8_t*)buf + (lo - off), pbuf + (lo - c * r->cs), (size_t)(hi - lo));
+    }
+    rc = (ssize_t)len;
+out:
+    wipe(pbuf, batch * r->cs);
+    free(cbuf); free(pbuf);
+    return rc;
+}
+
+void sm4c_reader_close(sm4c_reader *r) {
+    if (!r) return;
+    wipe(&r->key, sizeof(r->key));
+    free(r);
+}
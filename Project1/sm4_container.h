@@ -0,0 +1,48 @@
+#ifndef SM4_CONTAINER_H
+#define SM4_CONTAINER_H
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+// ---------------------------- 分块 SM4-GCM 加密容器 ----------------------------
+// 文件布局（整数均为大端）：
+//   header   32 字节  "SM4GCMC" | 版本 2 | chunk_size(4) | 0(4) | salt(16)
+//   chunk_i  明文 chunk_size 字节（最后一块 0..chunk_size 字节）的密文 || 16 字节 tag
+//   trailer  32 字节  块数(8) | 明文总长(8) | tag
+// 每个文件用自己的密钥 K_f = SM4(K, salt)，salt 每个文件随机取 128 位。同一个 K 下加密 2^48 个文件，
+// salt 碰撞的概率也只有约 2^-33；GCM 的 nonce 只需在一个文件内唯一。每块独立做 SM4-GCM（密钥 K_f）：
+//   IV  = salt 前 7 字节 || i(4) || last(1)，last 只在最后一块为 1
+//   AAD = header
+// trailer 是对 header || 块数 || 总长 的 GMAC，IV = salt 前 7 字节 || ffffffff || 02。
+// 读取时先验证 trailer，再检查文件大小与块数、总长是否自洽。
+// 截断、删块、调换块的顺序、把别的文件的块拼进来都会被拒绝：块号在 IV 里，每个文件的密钥不同，最后一块有 last 标记。
+// 随机读只解密被访问的块，按批处理，内存占用与读取长度无关；同一个 reader 可以被多个线程同时 pread。
+
+#define SM4C_HEADER_BYTES   32
+#define SM4C_TRAILER_BYTES  32
+#define SM4C_TAG_BYTES      16
+#define SM4C_DEFAULT_CHUNK  65536
+#define SM4C_MIN_CHUNK      512
+#define SM4C_MAX_CHUNK      (16u << 20)
+
+struct sm4c_writer;
+struct sm4c_reader;
+
+// fd 需可 pwrite；nthreads 为并行加密的线程数（<= 1 时在调用线程内完成，否则用共享线程池
+// tp_default() 的前 nthreads 个 worker）。失败返回 NULL
+sm4c_writer *sm4c_writer_open(int fd, const uint8_t key[16], uint32_t chunk_size, int nthreads);
+// 追加明文，成功返回 0
+int sm4c_write(sm4c_writer *w, const void *data, size_t len);
+// 写出剩余块（最后一块带 last 标记）和 trailer，释放 w。成功返回 0
+int sm4c_writer_close(sm4c_writer *w);
+
+// 验证 header 与 trailer。失败返回 NULL（格式错误或认证失败时 errno = EBADMSG）
+sm4c_reader *sm4c_reader_open(int fd, const uint8_t key[16], int nthreads);
+uint64_t sm4c_size(const sm4c_reader *r);
+uint32_t sm4c_chunk_size(const sm4c_reader *r);
+// 读 [off, off+len) 的明文，返回读到的字节数（到达末尾时可能少于 len）。
+// 所涉及的块有任何一块认证失败都返回 -1，errno = EBADMSG，buf 清零
+ssize_t sm4c_pread(sm4c_reader *r, void *buf, size_t len, uint64_t off);
+void sm4c_reader_close(sm4c_reader *r);
+
+#endif
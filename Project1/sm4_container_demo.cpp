@@ -0,0 +1,251 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "sm4_gcm.h"
+#include "sm4_container.h"
+
+// ---------------------------- 分块 SM4-GCM 容器演示 ----------------------------
+// 编译：
+//   gcc -O2 -c ../Project4/thread_pool.c
+//   g++ -O2 -mavx2 -pthread -I../Project4 -DSM4_MULTIKEY_NO_MAIN sm4_container_demo.cpp sm4_container.cpp sm4_gcm.cpp SM4-multikey.cpp thread_pool.o -o sm4_container_demo
+// 用法：
+//   ./sm4_container_demo                                   自检（RFC 8998 向量、随机读、篡改/截断）+ 性能
+//   ./sm4_container_demo enc <key_hex> <in> <out> [chunk] [threads]
+//   ./sm4_container_demo dec <key_hex> <in> <out> [threads]
+//   ./sm4_container_demo cat <key_hex> <file> <offset> <len>   随机读一段明文到 stdout
+
+static int parse_hex(const char *s, uint8_t *out, size_t n) {
+    if (strlen(s) != 2 * n) return -1;
+    for (size_t i = 0; i < n; i++) {
+        unsigned v;
+        if (sscanf(s + 2 * i, "%2x", &v) != 1) return -1;
+        out[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t rng_state = 0x243f6a8885a308d3ULL;
+static uint64_t rng() {
+    rng_state ^= rng_state << 13; rng_state ^= rng_state >> 7; rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static int run_enc(const uint8_t key[16], const char *in, const char *out, uint32_t cs, int threads) {
+    int fi = open(in, O_RDONLY), fo = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fi < 0 || fo < 0) { perror("open"); return 1; }
+    sm4c_writer *w = sm4c_writer_open(fo, key, cs, threads);
+    static uint8_t buf[1 << 20];
+    ssize_t n;
+    int rc = w ? 0 : 1;
+    while (rc == 0 && (n = read(fi, buf, sizeof(buf))) > 0) rc = sm4c_write(w, buf, (size_t)n);
+    if (w && sm4c_writer_close(w) != 0) rc = 1;
+    close(fi); close(fo);
+    if (rc) { fprintf(stderr, "encrypt failed\n"); unlink(out); }
+    return rc;
+}
+
+static int run_dec(const uint8_t key[16], const char *in, const char *out, int threads) {
+    int fi = open(in, O_RDONLY), fo = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fi < 0 || fo < 0) { perror("open"); return 1; }
+    sm4c_reader *r = sm4c_reader_open(fi, key, threads);
+    static uint8_t buf[1 << 20];
+    int rc = r ? 0 : 1;
+    for (uint64_t off = 0; r && off < sm4c_size(r); ) {
+        ssize_t n = sm4c_pread(r, buf, sizeof(buf), off);
+        if (n <= 0 || write(fo, buf, (size_t)n) != n) { rc = 1; break; }
+        off += (uint64_t)n;
+    }
+    sm4c_reader_close(r);
+    close(fi); close(fo);
+    if (rc) { fprintf(stderr, "decrypt failed: %s\n", strerror(errno)); unlink(out); }
+    return rc;
+}
+
+static int run_cat(const uint8_t key[16], const char *file, uint64_t off, size_t len) {
+    int fd = open(file, O_RDONLY);
+    sm4c_reader *r = fd < 0 ? NULL : sm4c_reader_open(fd, key, 1);
+    if (!r) { fprintf(stderr, "open failed: %s\n", strerror(errno)); return 1; }
+    uint8_t *buf = (uint8_t*)malloc(len ? len : 1);
+    ssize_t n = sm4c_pread(r, buf, len, off);
+    if (n < 0) { fprintf(stderr, "read failed: %s\n", strerror(errno)); return 1; }
+    fwrite(buf, 1, (size_t)n, stdout);
+    free(buf);
+    sm4c_reader_close(r);
+    close(fd);
+    return 0;
+}
+
+// 用不规则的写入长度生成容器文件
+static int make_file(const char *path, const uint8_t key[16], const uint8_t *data, size_t len, uint32_t cs, int threads) {
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    sm4c_writer *w = sm4c_writer_open(fd, key, cs, threads);
+    int rc = w ? 0 : -1;
+    for (size_t off = 0; rc == 0 && off < len; ) {
+        size_t n = (size_t)(rng() % 200000);
+        if (n > len - off) n = len - off;
+        rc = sm4c_write(w, data + off, n);
+        off += n;
+    }
+    if (w && sm4c_writer_close(w) != 0) rc = -1;
+    close(fd);
+    return rc;
+}
+
+static int check_all(const char *path, const uint8_t key[16], const uint8_t *data, size_t len) {
+    int fd = open(path, O_RDONLY);
+    sm4c_reader *r = sm4c_reader_open(fd, key, 2);
+    int ok = r && sm4c_size(r) == len;
+    uint8_t *buf = (uint8_t*)malloc(len + 1);
+    if (ok && len) ok = sm4c_pread(r, buf, len + 100, 0) == (ssize_t)len && memcmp(buf, data, len) == 0;
+    free(buf);
+    sm4c_reader_close(r);
+    close(fd);
+    return ok;
+}
+
+static void flip_byte(const char *path, off_t off) {
+    int fd = open(path, O_RDWR);
+    uint8_t b;
+    if (pread(fd, &b, 1, off) == 1) { b ^= 0x01; if (pwrite(fd, &b, 1, off) != 1) perror("pwrite"); }
+    close(fd);
+}
+
+int main(int argc, char **argv) {
+    uint8_t key[16];
+    if (argc >= 5 && strcmp(argv[1], "enc") == 0 && parse_hex(argv[2], key, 16) == 0)
+        return run_enc(key, argv[3], argv[4], argc > 5 ? (uint32_t)atoi(argv[5]) : SM4C_DEFAULT_CHUNK, argc > 6 ? atoi(argv[6]) : 1);
+    if (argc >= 5 && strcmp(argv[1], "dec") == 0 && parse_hex(argv[2], key, 16) == 0)
+        return run_dec(key, argv[3], argv[4], argc > 5 ? atoi(argv[5]) : 1);
+    if (argc == 6 && strcmp(argv[1], "cat") == 0 && parse_hex(argv[2], key, 16) == 0)
+        return run_cat(key, argv[3], strtoull(argv[4], NULL, 10), (size_t)strtoull(argv[5], NULL, 10));
+
+    // RFC 8998 附录 A.1 的 SM4-GCM 测试向量
+    uint8_t iv[12], aad[20], pt[64], ct[64], want[64], tag[16], want_tag[16];
+    parse_hex("0123456789abcdeffedcba9876543210", key, 16);
+    parse_hex("00001234567800000000abcd", iv, 12);
+    parse_hex("feedfacedeadbeeffeedfacedeadbeefabaddad2", aad, 20);
+    parse_hex("aaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbccccccccccccccccdddddddddddddddd"
+              "eeeeeeeeeeeeeeeeffffffffffffffffeeeeeeeeeeeeeeeeaaaaaaaaaaaaaaaa", pt, 64);
+    parse_hex("17f399f08c67d5ee19d0dc9969c4bb7d5fd46fd3756489069157b282bb200735"
+              "d82710ca5c22f0ccfa7cbf93d496ac15a56834cbcf98c397b4024a2691233b8d", want, 64);
+    parse_hex("83de3541e4c2b58177e065a9bf7b62ec", want_tag, 16);
+    sm4_gcm_key gk;
+    sm4_gcm_setkey(&gk, key);
+    sm4_gcm_seal(&gk, iv, aad, 20, pt, ct, 64, tag);
+    printf("RFC 8998 SM4-GCM vector: %s\n", memcmp(ct, want, 64) == 0 && memcmp(tag, want_tag, 16) == 0 ? "OK" : "FAIL");
+
+    // 容器往返：空文件、不足一块、整块倍数、多批次
+    const char *path = "/tmp/sm4c_demo.bin";
+    const size_t BIG = 24u << 20;
+    const uint32_t CS = 4096;
+    uint8_t *data = (uint8_t*)malloc(BIG);
+    for (size_t i = 0; i < BIG; i++) data[i] = (uint8_t)(rng() >> 56);
+    static const size_t lens[] = { 0, 1, CS - 1, CS, 5 * CS, 3 * CS + 17, 1000003 };
+    int ok = 1;
+    for (size_t t = 0; t < sizeof(lens) / sizeof(lens[0]); t++)
+        if (make_file(path, key, data, lens[t], CS, 1 + (int)(t % 3)) != 0 || !check_all(path, key, data, lens[t])) ok = 0;
+    printf("round trip (0 .. 1000003 bytes, chunk %u): %s\n", CS, ok ? "OK" : "FAIL");
+
+    // 随机读：与原文逐字节比较
+    make_file(path, key, data, 1000003, CS, 3);
+    int fd = open(path, O_RDONLY);
+    sm4c_reader *r = sm4c_reader_open(fd, key, 2);
+    uint8_t *buf = (uint8_t*)malloc(1 << 16);
+    ok = r != NULL;
+    for (int i = 0; ok && i < 2000; i++) {
+        uint64_t off = rng() % 1000100;
+        size_t len = (size_t)(rng() % 20000);
+        ssize_t n = sm4c_pread(r, buf, len, off);
+        size_t want_n = off >= 1000003 ? 0 : (len < 1000003 - off ? len : (size_t)(1000003 - off));
+        if (n != (ssize_t)want_n || (n > 0 && memcmp(buf, data + off, (size_t)n) != 0)) ok = 0;
+    }
+    printf("2000 random reads: %s\n", ok ? "OK" : "FAIL");
+    sm4c_reader_close(r);
+    close(fd);
+
+    // 篡改第 3 块：读它失败，读别的块不受影响
+    flip_byte(path, SM4C_HEADER_BYTES + 3 * (CS + SM4C_TAG_BYTES) + 100);
+    fd = open(path, O_RDONLY);
+    r = sm4c_reader_open(fd, key, 1);
+    int t1 = r && sm4c_pread(r, buf, 10, 3 * CS + 5) < 0 && errno == EBADMSG;
+    int t2 = r && sm4c_pread(r, buf, 10, 7 * CS + 5) == 10 && memcmp(buf, data + 7 * CS + 5, 10) == 0;
+    sm4c_reader_close(r);
+    close(fd);
+    printf("tampered chunk rejected, other chunks readable: %s\n", t1 && t2 ? "OK" : "FAIL");
+
+    // 截断：去掉最后一块和 trailer、只去掉 trailer、篡改 header 的块大小和 salt
+    int trunc_ok = 1;
+    off_t cuts[2] = { (off_t)(SM4C_HEADER_BYTES + 244 * (CS + SM4C_TAG_BYTES)), 0 };
+    make_file(path, key, data, 1000003, CS, 1);
+    fd = open(path, O_RDONLY);
+    cuts[1] = lseek(fd, 0, SEEK_END) - SM4C_TRAILER_BYTES;
+    close(fd);
+    for (int i = 0; i < 2; i++) {
+        make_file(path, key, data, 1000003, CS, 1);
+        if (truncate(path, cuts[i]) != 0) perror("truncate");
+        fd = open(path, O_RDONLY);
+        if ((r = sm4c_reader_open(fd, key, 1)) != NULL) { trunc_ok = 0; sm4c_reader_close(r); }
+        close(fd);
+    }
+    for (int pos = 10; pos <= 30; pos += 20) {
+        make_file(path, key, data, 1000003, CS, 1);
+        flip_byte(path, pos);
+        fd = open(path, O_RDONLY);
+        if ((r = sm4c_reader_open(fd, key, 1)) != NULL) { trunc_ok = 0; sm4c_reader_close(r); }
+        close(fd);
+    }
+    printf("truncated / header-tampered files rejected: %s\n", trunc_ok ? "OK" : "FAIL");
+
+    // 调换两块密文：各自的块号不对，两块都读不出来
+    make_file(path, key, data, 1000003, CS, 1);
+    fd = open(path, O_RDWR);
+    uint8_t *c1 = (uint8_t*)malloc(CS + 16), *c2 = (uint8_t*)malloc(CS + 16);
+    off_t o1 = SM4C_HEADER_BYTES + 10 * (CS + 16), o2 = SM4C_HEADER_BYTES + 11 * (CS + 16);
+    if (pread(fd, c1, CS + 16, o1) != CS + 16 || pread(fd, c2, CS + 16, o2) != CS + 16 ||
+        pwrite(fd, c2, CS + 16, o1) != CS + 16 || pwrite(fd, c1, CS + 16, o2) != CS + 16) perror("swap");
+    r = sm4c_reader_open(fd, key, 1);
+    int sw = r && sm4c_pread(r, buf, 10, 10 * CS) < 0 && sm4c_pread(r, buf, 10, 11 * CS) < 0;
+    sm4c_reader_close(r);
+    close(fd);
+    printf("swapped chunks rejected: %s\n", sw ? "OK" : "FAIL");
+    free(c1); free(c2);
+
+    // 性能：整体写入；4 KiB 随机读与“整条消息一个 tag”时必须整体解密的对比
+    double t0 = now_sec();
+    make_file(path, key, data, BIG, SM4C_DEFAULT_CHUNK, 1);
+    double t_w1 = now_sec() - t0;
+    t0 = now_sec();
+    make_file(path, key, data, BIG, SM4C_DEFAULT_CHUNK, 4);
+    double t_w4 = now_sec() - t0;
+    fd = open(path, O_RDONLY);
+    r = sm4c_reader_open(fd, key, 1);
+    const int NR = 2000;
+    t0 = now_sec();
+    for (int i = 0; i < NR; i++) sm4c_pread(r, buf, 4096, rng() % (BIG - 4096));
+    double t_rd = (now_sec() - t0) / NR;
+    sm4c_reader_close(r);
+    close(fd);
+    uint8_t *whole = (uint8_t*)malloc(BIG);
+    t0 = now_sec();
+    sm4_gcm_seal(&gk, iv, NULL, 0, data, whole, BIG, tag);
+    sm4_gcm_open(&gk, iv, NULL, 0, whole, whole, BIG, tag);
+    double t_whole = (now_sec() - t0) / 2;
+    printf("write %zu MB, chunk %u: %.1f MB/s (1 thread), %.1f MB/s (4 threads)\n",
+           BIG >> 20, SM4C_DEFAULT_CHUNK, BIG / t_w1 / 1e6, BIG / t_w4 / 1e6);
+    printf("random 4 KiB read: %.1f us (one 64 KiB chunk) vs %.1f ms to open the whole %zu MB as one GCM message\n",
+           t_rd * 1e6, t_whole * 1e3, BIG >> 20);
+    unlink(path);
+    free(data); free(buf); free(whole);
+    return 0;
+}
@@ -0,0 +1,191 @@
+#include <string.h>
+#include "sm4_multikey.h"
+#include "sm4_ctr_hmac.h"
+
+// ---------------------------- SM4-CTR + HMAC-SM3 实现 ----------------------------
+// 每段：fill_counters 写出 nb 个计数器分组 → sm4_crypt_multikey 原地加密成密钥流 → 与数据异或，
+// 加密时随后 sm3_update 这一段密文，解密时在异或之前 sm3_update。密钥流缓冲和数据段都在 L1 里。
+// 不满一个分组的尾部密钥流留在 ctx->ks，下一次调用先用完它。
+
+#define CHUNK_BLOCKS (SM4CH_CHUNK / 16)
+
+static const uint32_t KEY0[CHUNK_BLOCKS] = { 0 };        // 所有分组都用密钥表里的第 0 个密钥
+
+// 密钥、密钥流和带密钥的 SM3 状态用完即清；局部变量之后不再使用，memset 可能被编译器删掉
+static void wipe(void *p, size_t n) {
+    explicit_bzero(p, n);
+}
+
+static inline void store_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static inline uint32_t load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline void store_be64(uint8_t *p, uint64_t v) {
+    store_be32(p, (uint32_t)(v >> 32)); store_be32(p + 4, (uint32_t)v);
+}
+
+// ks[0..nb) = SM4(ctr+1), ..., SM4(ctr+nb)，ctr 前进 nb（低 32 位）
+static void keystream(const uint32_t *rk, uint8_t ctr[16], uint8_t (*ks)[16], size_t nb) {
+    uint32_t n = load_be32(ctr + 12);
+    for (size_t i = 0; i < nb; i++) {
+        memcpy(ks[i], ctr, 12);
+        store_be32(ks[i] + 12, ++n);
+    }
+    store_be32(ctr + 12, n);
+    sm4_crypt_multikey(ks, ks, KEY0, nb, rk, 0);
+}
+
+static inline void xor_bytes(uint8_t *out, const uint8_t *in, const uint8_t *ks, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t a, b;
+        memcpy(&a, in + i, 8); memcpy(&b, ks + i, 8);
+        a ^= b;
+        memcpy(out + i, &a, 8);
+    }
+    for (; i < n; i++) out[i] = in[i] ^ ks[i];
+}
+
+void sm4ch_setkey(sm4ch_key *k, const uint8_t enc_key[16], const uint8_t *mac_key, size_t mac_len) {
+    uint8_t kb[64] = { 0 }, pad[64];
+    sm4_expand_key(enc_key, k->rk);
+    if (mac_len > 64) sm3_hash(mac_key, mac_len, kb);
+    else if (mac_len) memcpy(kb, mac_key, mac_len);
+    for (int i = 0; i < 64; i++) pad[i] = kb[i] ^ 0x36;
+    sm3_init(&k->inner);
+    sm3_update(&k->inner, pad, 64);
+    for (int i = 0; i < 64; i++) pad[i] = kb[i] ^ 0x5c;
+    sm3_init(&k->outer);
+    sm3_update(&k->outer, pad, 64);
+    wipe(kb, sizeof(kb));
+    wipe(pad, sizeof(pad));
+}
+
+void sm4ch_start(sm4ch_ctx *c, const sm4ch_key *k, const uint8_t iv[12]) {
+    c->key = k;
+    c->h = k->inner;
+    memcpy(c->ctr, iv, 12);
+    store_be32(c->ctr + 12, 0);
+    c->ks_used = 16;
+    c->aad_len = c->ct_len = 0;
+}
+
+void sm4ch_aad(sm4ch_ctx *c, const uint8_t *aad, size_t len) {
+    sm3_update(&c->h, aad, len);
+    c->aad_len += len;
+}
+
+static void update(sm4ch_ctx *c, const uint8_t *in, uint8_t *out, size_t len, int dec) {
+    alignas(32) uint8_t ks[CHUNK_BLOCKS][16];
+    c->ct_len += len;
+    if (c->ks_used < 16 && len) {       // 上次剩下的密钥流
+        size_t n = 16 - c->ks_used < len ? 16 - c->ks_used : len;
+        if (dec) sm3_update(&c->h, in, n);
+        xor_bytes(out, in, c->ks + c->ks_used, n);
+        if (!dec) sm3_update(&c->h, out, n);
+        c->ks_used += n;
+        in += n; out += n; len -= n;
+    }
+    while (len >= 16) {
+        size_t nb = len / 16 < CHUNK_BLOCKS ? len / 16 : CHUNK_BLOCKS, n = nb * 16;
+        keystream(c->key->rk, c->ctr, ks, nb);
+        if (dec) sm3_update(&c->h, in, n);
+        xor_bytes(out, in, ks[0], n);
+        if (!dec) sm3_update(&c->h, out, n);
+        in += n; out += n; len -= n;
+    }
+    if (len) {
+        keystream(c->key->rk, c->ctr, (uint8_t (*)[16])c->ks, 1);
+        if (dec) sm3_update(&c->h, in, len);
+        xor_bytes(out, in, c->ks, len);
+        if (!dec) sm3_update(&c->h, out, len);
+        c->ks_used = len;
+    }
+    wipe(ks, sizeof(ks));
+}
+
+void sm4ch_encrypt_update(sm4ch_ctx *c, const uint8_t *in, uint8_t *out, size_t len) {
+    update(c, in, out, len, 0);
+}
+
+void sm4ch_decrypt_update(sm4ch_ctx *c, const uint8_t *in, uint8_t *out, size_t len) {
+    update(c, in, out, len, 1);
+}
+
+// inner = H(K⊕ipad || AAD || C || 长度)，tag = H(K⊕opad || inner)
+static void finish_mac(sm3_ctx *h, const sm4ch_key *k, uint64_t aad_len, uint64_t ct_len, uint8_t tag[32]) {
+    uint8_t lens[16], inner[32];
+    store_be64(lens, aad_len * 8);
+    store_be64(lens + 8, ct_len * 8);
+    sm3_update(h, lens, 16);
+    sm3_final(h, inner);
+    sm3_ctx o = k->outer;
+    sm3_update(&o, inner, 32);
+    sm3_final(&o, tag);
+    wipe(&o, sizeof(o));
+}
+
+void sm4ch_finish(sm4ch_ctx *c, uint8_t tag[SM4CH_TAG_LEN]) {
+    finish_mac(&c->h, c->key, c->aad_len, c->ct_len, tag);
+    wipe(c->ks, sizeof(c->ks));
+}
+
+void sm4ch_seal(const sm4ch_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+                const uint8_t *in, uint8_t *out, size_t len, uint8_t tag[SM4CH_TAG_LEN]) {
+    sm4ch_ctx c;
+    sm4ch_start(&c, k, iv);
+    sm4ch_aad(&c, aad, aad_len);
+    sm4ch_encrypt_update(&c, in, out, len);
+    sm4ch_finish(&c, tag);
+    wipe(&c, sizeof(c));
+}
+
+int sm4ch_open(const sm4ch_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+               const uint8_t *in, uint8_t *out, size_t len, const uint8_t *tag, size_t tag_len) {
+    uint8_t t[SM4CH_TAG_LEN];
+    if (tag_len < 16 || tag_len > SM4CH_TAG_LEN) {
+        memset(out, 0, len);
+        return -1;
+    }
+    sm4ch_ctx c;
+    sm4ch_start(&c, k, iv);
+    sm4ch_aad(&c, aad, aad_len);
+    sm4ch_decrypt_update(&c, in, out, len);
+    sm4ch_finish(&c, t);
+    wipe(&c, sizeof(c));
+    uint8_t diff = 0;
+    for (size_t i = 0; i < tag_len; i++) diff |= t[i] ^ tag[i];
+    if (diff) {
+        memset(out, 0, len);
+        return -1;
+    }
+    return 0;
+}
+
+void sm4ch_ctr(const sm4ch_key *k, const uint8_t iv[12], const uint8_t *in, uint8_t *out, size_t len) {
+    alignas(32) uint8_t ks[CHUNK_BLOCKS][16];
+    uint8_t ctr[16];
+    memcpy(ctr, iv, 12);
+    store_be32(ctr + 12, 0);
+    while (len) {
+        size_t nb = (len + 15) / 16 < CHUNK_BLOCKS ? (len + 15) / 16 : CHUNK_BLOCKS;
+        size_t n = nb * 16 < len ? nb * 16 : len;
+        keystream(k->rk, ctr, ks, nb);
+        xor_bytes(out, in, ks[0], n);
+        in += n; out += n; len -= n;
+    }
+    wipe(ks, sizeof(ks));
+}
+
+void sm4ch_mac(const sm4ch_key *k, const uint8_t *aad, size_t aad_len, const uint8_t *ct, size_t len,
+               uint8_t tag[SM4CH_TAG_LEN]) {
+    sm3_ctx h = k->inner;
+    sm3_update(&h, aad, aad_len);
+    sm3_update(&h, ct, len);
+    finish_mac(&h, k, aad_len, len, tag);
+    wipe(&h, sizeof(h));
+}
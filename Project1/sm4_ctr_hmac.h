@@ -0,0 +1,59 @@
+#ifndef SM4_CTR_HMAC_H
+#define SM4_CTR_HMAC_H
+#include <stdint.h>
+#include <stddef.h>
+#include "sm3.h"
+
+// ---------------------------- SM4-CTR + HMAC-SM3（先加密后 MAC） ----------------------------
+// 给只接受 CTR + HMAC 而不接受 GCM 的对端用：
+//   计数器分组 = IV(12) || ctr(4)，ctr 从 1 开始按 32 位大端递增（同 GCM 的 inc32），单条消息不超过 2^32 - 1 个分组
+//   C   = P ⊕ SM4(K_e, 计数器分组...)
+//   Tag = HMAC-SM3(K_m, AAD || C || len(AAD) || len(C))，长度为 64 位大端比特数，防止 AAD 与 C 的分界被挪动
+// 融合实现：数据按 SM4CH_CHUNK 字节一段处理，一段先加密（生成密钥流 + 异或），紧接着把这一段密文送进 SM3 压缩，
+// 数据在 L1 里只被读写一遍；解密时先对这一段密文做 MAC，再解密。
+// 密钥流每段一次交给 sm4_crypt_multikey（SM4-multikey.cpp，AVX2 8 个分组并行），HMAC 的内外两个填充分组在
+// setkey 时压缩好，每条消息省掉两次压缩。
+// 编译时与 SM4-multikey.cpp（-DSM4_MULTIKEY_NO_MAIN）和 Project4/sm3.c 一起链接。
+
+#define SM4CH_CHUNK    8192            // 融合处理的段长（字节，16 的倍数）
+#define SM4CH_TAG_LEN  32
+
+struct sm4ch_key {
+    alignas(64) uint32_t rk[32];
+    sm3_ctx inner, outer;               // 已吸收 K_m ⊕ ipad / K_m ⊕ opad 的 SM3 状态
+};
+
+struct sm4ch_ctx {
+    const sm4ch_key *key;
+    sm3_ctx h;                          // HMAC 内层
+    uint8_t ctr[16];
+    uint8_t ks[16];                     // 当前计数器分组的密钥流
+    size_t ks_used;
+    uint64_t aad_len, ct_len;
+};
+
+// mac_key 任意长度（超过 64 字节时先做 SM3）
+void sm4ch_setkey(sm4ch_key *k, const uint8_t enc_key[16], const uint8_t *mac_key, size_t mac_len);
+
+// 流式接口：start 之后先 aad（可多次），再 encrypt/decrypt（可多次，不能与 aad 交错），最后 finish。
+// 流式 decrypt 在 finish 之前就交出了明文，需要先认证再用明文的场合请用 sm4ch_open
+void sm4ch_start(sm4ch_ctx *c, const sm4ch_key *k, const uint8_t iv[12]);
+void sm4ch_aad(sm4ch_ctx *c, const uint8_t *aad, size_t len);
+void sm4ch_encrypt_update(sm4ch_ctx *c, const uint8_t *in, uint8_t *out, size_t len);   // in 可等于 out
+void sm4ch_decrypt_update(sm4ch_ctx *c, const uint8_t *in, uint8_t *out, size_t len);
+void sm4ch_finish(sm4ch_ctx *c, uint8_t tag[SM4CH_TAG_LEN]);
+
+// 一次性接口。open 与 seal 一样逐段“先 MAC 后解密”只读一遍数据，tag 不符时返回 -1 并清零输出
+// （与 sm4_gcm_open 相同）；tag_len 可以是 16..32（截断的 tag 比较前 tag_len 字节）
+void sm4ch_seal(const sm4ch_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+                const uint8_t *in, uint8_t *out, size_t len, uint8_t tag[SM4CH_TAG_LEN]);
+int  sm4ch_open(const sm4ch_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+                const uint8_t *in, uint8_t *out, size_t len, const uint8_t *tag, size_t tag_len);
+
+// 分开的两步，用来组成传统的两遍做法（也可以在解密前先单独认证）：
+// 只做 CTR 加/解密；只对 AAD 与密文计算 tag
+void sm4ch_ctr(const sm4ch_key *k, const uint8_t iv[12], const uint8_t *in, uint8_t *out, size_t len);
+void sm4ch_mac(const sm4ch_key *k, const uint8_t *aad, size_t aad_len, const uint8_t *ct, size_t len,
+               uint8_t tag[SM4CH_TAG_LEN]);
+
+#endif
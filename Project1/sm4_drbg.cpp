@@ -0,0 +1,205 @@
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/random.h>
+#include <atomic>
+#include "sm4_multikey.h"
+#include "sm4_drbg.h"
+
+// ---------------------------- CTR_DRBG 实现 ----------------------------
+// V 按 128 位大端整数加 1（模 2^128）。密钥只以轮密钥的形式保存，每次 Update 重新扩展。
+// 每线程缓冲：buf[pos..) 是还没用过的输出；pos == SM4_DRBG_BUF_BYTES 表示空。
+
+#define RESEED_LIMIT (1ull << 48)
+
+static const uint32_t KEY0[SM4_DRBG_BATCH] = { 0 };     // 所有分组都用密钥表里的第 0 个密钥
+
+static void wipe(void *p, size_t n) {
+    explicit_bzero(p, n);
+}
+
+static inline uint64_t load_be64(const uint8_t *p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v = v << 8 | p[i];
+    return v;
+}
+
+static inline void store_be64(uint8_t *p, uint64_t v) {
+    for (int i = 7; i >= 0; i--) { p[i] = (uint8_t)v; v >>= 8; }
+}
+
+// ctr[0..n) = V+1, V+2, ..., V+n，V 前进到 V+n
+static void fill_counters(uint8_t V[16], uint8_t (*ctr)[16], size_t n) {
+    uint64_t hi = load_be64(V), lo = load_be64(V + 8);
+    for (size_t i = 0; i < n; i++) {
+        if (++lo == 0) hi++;
+        store_be64(ctr[i], hi);
+        store_be64(ctr[i] + 8, lo);
+    }
+    store_be64(V, hi);
+    store_be64(V + 8, lo);
+}
+
+// K || V = (E(K, V+1) || E(K, V+2)) ⊕ p，p 为 NULL 时按全 0 处理
+static void update(sm4_ctr_drbg *d, const uint8_t p[32]) {
+    uint8_t t[2][16];
+    fill_counters(d->V, t, 2);
+    sm4_crypt_block(t[0], t[0], d->rk, 0);
+    sm4_crypt_block(t[1], t[1], d->rk, 0);
+    if (p) for (int i = 0; i < 32; i++) t[i >> 4][i & 15] ^= p[i];
+    sm4_expand_key(t[0], d->rk);
+    memcpy(d->V, t[1], 16);
+    wipe(t, sizeof(t));
+}
+
+// 熵输入 ⊕ 补 0 到 32 字节的附加串
+static void seed_material(uint8_t out[32], const uint8_t entropy[32], const uint8_t *s, size_t slen) {
+    memcpy(out, entropy, 32);
+    for (size_t i = 0; i < slen; i++) out[i] ^= s[i];
+}
+
+int sm4_ctr_drbg_instantiate(sm4_ctr_drbg *d, const uint8_t entropy[32], const uint8_t *pers, size_t plen) {
+    static const uint8_t zero[16] = { 0 };
+    if (plen > SM4_DRBG_SEEDLEN) return -1;
+    uint8_t m[32];
+    seed_material(m, entropy, pers, plen);
+    sm4_expand_key(zero, d->rk);
+    memset(d->V, 0, 16);
+    update(d, m);
+    wipe(m, sizeof(m));
+    d->reseed_counter = 1;
+    return 0;
+}
+
+int sm4_ctr_drbg_reseed(sm4_ctr_drbg *d, const uint8_t entropy[32], const uint8_t *add, size_t alen) {
+    if (alen > SM4_DRBG_SEEDLEN) return -1;
+    uint8_t m[32];
+    seed_material(m, entropy, add, alen);
+    update(d, m);
+    wipe(m, sizeof(m));
+    d->reseed_counter = 1;
+    return 0;
+}
+
+int sm4_ctr_drbg_generate(sm4_ctr_drbg *d, uint8_t *out, size_t len, const uint8_t *add, size_t alen) {
+    if (len > SM4_DRBG_MAX_REQUEST || alen > SM4_DRBG_SEEDLEN || d->reseed_counter > RESEED_LIMIT) return -1;
+    uint8_t a[32] = { 0 };
+    if (alen) {
+        memcpy(a, add, alen);
+        update(d, a);
+    }
+    alignas(32) uint8_t ctr[SM4_DRBG_BATCH][16];
+    while (len) {
+        size_t nb = (len + 15) / 16;
+        if (nb > SM4_DRBG_BATCH) nb = SM4_DRBG_BATCH;
+        fill_counters(d->V, ctr, nb);
+        sm4_crypt_multikey(ctr, ctr, KEY0, nb, d->rk, 0);
+        size_t n = nb * 16 < len ? nb * 16 : len;
+        memcpy(out, ctr, n);
+        out += n;
+        len -= n;
+    }
+    wipe(ctr, sizeof(ctr));
+    update(d, alen ? a : NULL);
+    wipe(a, sizeof(a));
+    d->reseed_counter++;
+    return 0;
+}
+
+void sm4_ctr_drbg_wipe(sm4_ctr_drbg *d) {
+    wipe(d, sizeof(*d));
+}
+
+// ---------------------------- 每线程缓冲 ----------------------------
+
+struct tls_drbg {
+    sm4_ctr_drbg d;
+    uint8_t buf[SM4_DRBG_BUF_BYTES];
+    size_t pos;
+    unsigned refills;                   // 上次播种以来的 generate 次数
+    unsigned gen;                       // 播种时的 fork 代数
+    int ready;
+};
+
+static thread_local tls_drbg tls;
+static std::atomic<unsigned> fork_gen;
+static pthread_once_t atfork_once = PTHREAD_ONCE_INIT;
+
+static void on_fork_child() {
+    fork_gen.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void register_atfork() {
+    pthread_atfork(NULL, NULL, on_fork_child);
+}
+
+static int get_entropy(uint8_t *p, size_t n) {
+    while (n) {
+        ssize_t r = getrandom(p, n, 0);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return -1;
+        p += r; n -= (size_t)r;
+    }
+    return 0;
+}
+
+// 首次使用、fork 之后或到达重播种间隔时调用。个性化串区分同一份熵下的不同线程与 fork 代数
+static int seed(tls_drbg *t) {
+    uint8_t e[32];
+    struct { const void *self; pthread_t tid; unsigned gen; } pers = { t, pthread_self(), 0 };
+    pthread_once(&atfork_once, register_atfork);
+    unsigned gen = fork_gen.load(std::memory_order_relaxed);
+    pers.gen = gen;
+    if (get_entropy(e, sizeof(e)) != 0) return -1;
+    int rc = t->ready && t->gen == gen
+           ? sm4_ctr_drbg_reseed(&t->d, e, NULL, 0)
+           : sm4_ctr_drbg_instantiate(&t->d, e, (const uint8_t *)&pers, sizeof(pers));
+    wipe(e, sizeof(e));
+    if (rc != 0) return -1;
+    wipe(t->buf, sizeof(t->buf));
+    t->pos = SM4_DRBG_BUF_BYTES;
+    t->refills = 0;
+    t->gen = gen;
+    t->ready = 1;
+    return 0;
+}
+
+static int generate(tls_drbg *t, uint8_t *out, size_t len) {
+    if (t->refills >= SM4_DRBG_RESEED_REFILLS && seed(t) != 0) return -1;
+    t->refills++;
+    return sm4_ctr_drbg_generate(&t->d, out, len, NULL, 0);
+}
+
+int sm4_drbg_random(void *out, size_t len) {
+    tls_drbg *t = &tls;
+    uint8_t *o = (uint8_t *)out;
+    if (!t->ready || t->gen != fork_gen.load(std::memory_order_relaxed))
+        if (seed(t) != 0) return -1;
+    size_t have = SM4_DRBG_BUF_BYTES - t->pos;
+    if (len <= have) {                  // 快路径
+        memcpy(o, t->buf + t->pos, len);
+        wipe(t->buf + t->pos, len);
+        t->pos += len;
+        return 0;
+    }
+    memcpy(o, t->buf + t->pos, have);
+    wipe(t->buf + t->pos, have);
+    t->pos = SM4_DRBG_BUF_BYTES;
+    o += have; len -= have;
+    while (len >= SM4_DRBG_BUF_BYTES) { // 大请求直接生成，不经过缓冲
+        size_t n = len < SM4_DRBG_MAX_REQUEST ? len : SM4_DRBG_MAX_REQUEST;
+        if (generate(t, o, n) != 0) return -1;
+        o += n; len -= n;
+    }
+    if (len) {
+        if (generate(t, t->buf, SM4_DRBG_BUF_BYTES) != 0) return -1;
+        memcpy(o, t->buf, len);
+        wipe(t->buf, len);
+        t->pos = len;
+    }
+    return 0;
+}
+
+int sm4_drbg_reseed() {
+    return seed(&tls);
+}
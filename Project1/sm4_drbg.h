@@ -0,0 +1,43 @@
+#ifndef SM4_DRBG_H
+#define SM4_DRBG_H
+#include <stdint.h>
+#include <stddef.h>
+
+// ---------------------------- CTR_DRBG（SM4） ----------------------------
+// NIST SP 800-90A Rev.1 §10.2.1，分组密码为 SM4，不用派生函数（熵输入取自 getrandom，视为满熵）：
+//   keylen = blocklen = 128，seedlen = 256（32 字节），ctr_len = 128（整个 V 作为计数器）。
+//   Update(p)：K || V = (E(K, V+1) || E(K, V+2)) ⊕ p
+//   实例化：K = 0, V = 0, Update(entropy ⊕ pers)；重播种：Update(entropy ⊕ add)
+//   生成：  (有 add 时先 Update(add)) 输出 E(K, V+1) || E(K, V+2) || ...，然后 Update(add)
+// 计数器分组每 SM4_DRBG_BATCH 个一起交给 sm4_crypt_multikey（SM4-multikey.cpp，AVX2 8 个分组并行），
+// 所有分组用同一个密钥。
+// 上层是每线程一个实例的缓冲接口 sm4_drbg_random，做法与 Project4/drbg.c 的 Hash_DRBG 相同：
+// 一次生成 SM4_DRBG_BUF_BYTES 字节，小请求只拷贝，用过的字节清零；
+// 每 SM4_DRBG_RESEED_REFILLS 次生成或 fork 之后从 getrandom 重播种。
+// 编译时与 SM4-multikey.cpp（-DSM4_MULTIKEY_NO_MAIN）一起链接。
+
+#define SM4_DRBG_SEEDLEN        32
+#define SM4_DRBG_MAX_REQUEST    65536           // 单次生成的上限（2^19 位）
+#define SM4_DRBG_BATCH          256             // 每次交给 sm4_crypt_multikey 的分组数
+#define SM4_DRBG_BUF_BYTES      4096            // 每线程预生成的字节数
+#define SM4_DRBG_RESEED_REFILLS (1u << 14)      // 64 MiB 输出后重播种
+
+struct sm4_ctr_drbg {
+    alignas(64) uint32_t rk[32];        // K 的轮密钥
+    uint8_t V[16];
+    uint64_t reseed_counter;
+};
+
+// entropy 固定 32 字节；pers / add 最多 32 字节，可为 NULL。超限返回 -1
+int  sm4_ctr_drbg_instantiate(sm4_ctr_drbg *d, const uint8_t entropy[32], const uint8_t *pers, size_t plen);
+int  sm4_ctr_drbg_reseed(sm4_ctr_drbg *d, const uint8_t entropy[32], const uint8_t *add, size_t alen);
+// out 最多 SM4_DRBG_MAX_REQUEST 字节；reseed_counter 超过 2^48 时返回 -1（需要先重播种）
+int  sm4_ctr_drbg_generate(sm4_ctr_drbg *d, uint8_t *out, size_t len, const uint8_t *add, size_t alen);
+void sm4_ctr_drbg_wipe(sm4_ctr_drbg *d);
+
+// 每线程缓冲接口：任意长度，成功返回 0；getrandom 失败返回 -1 并保留 errno
+int sm4_drbg_random(void *out, size_t len);
+// 立即用 getrandom 重播种本线程的实例，并丢弃已缓冲的输出
+int sm4_drbg_reseed();
+
+#endif
@@ -0,0 +1,168 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/random.h>
+#include <sys/wait.h>
+#include "sm4_drbg.h"
+#include "sm4_multikey.h"
+#include "sm3.h"
+
+// ---------------------------- CTR_DRBG（SM4）演示 ----------------------------
+// 编译：
+//   gcc -O2 -c ../Project4/sm3.c
+//   g++ -O2 -mavx2 -pthread -I../Project4 -DSM4_MULTIKEY_NO_MAIN sm4_drbg_demo.cpp sm4_drbg.cpp SM4-multikey.cpp sm3.o -o sm4_drbg_demo
+// 1. 固定输入的已知答案：期望值由按 SP 800-90A 逐步实现的 Python 脚本算出（SM4 用 openssl enc -sm4-ecb），
+//    覆盖附加输入、重播种、单次最大请求、不满一个分组的尾部，以及 V 跨过 2^128 回绕
+// 2. sm4_drbg_random：各线程、fork 前后的输出互不相同，跨缓冲边界的请求也能拼接
+// 3. 每次调用的延迟，以及 8 分组并行与逐个分组加密计数器的生成吞吐
+
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int check_hex(const char *name, const uint8_t *p, size_t n, const char *hex) {
+    char s[2 * 64 + 1];
+    for (size_t i = 0; i < n; i++) sprintf(s + 2 * i, "%02x", p[i]);
+    int ok = strcmp(s, hex) == 0;
+    printf("  %-34s %s\n", name, ok ? "OK" : "FAIL");
+    return ok ? 0 : 1;
+}
+
+static int known_answer() {
+    static uint8_t out[65536];
+    uint8_t e[96], h[32];
+    for (int i = 0; i < 96; i++) e[i] = (uint8_t)i;
+    sm4_ctr_drbg d;
+    int bad = 0;
+    printf("CTR_DRBG-SM4 known answers:\n");
+    sm4_ctr_drbg_instantiate(&d, e, (const uint8_t *)"sm4_drbg_demo", 13);
+    sm4_ctr_drbg_generate(&d, out, 16, NULL, 0);
+    bad += check_hex("generate 16", out, 16, "476d85a8f6110b42e2f1375e93b1f6ac");
+    sm4_ctr_drbg_generate(&d, out, 5000, (const uint8_t *)"additional input", 16);
+    sm3_hash(out, 5000, h);
+    bad += check_hex("generate 5000 + additional input", h, 32,
+                     "0f1c5566b2b51e0d1e90208651f37fc6c48696ce676a896a02499e52ced0e37c");
+    sm4_ctr_drbg_reseed(&d, e + 64, (const uint8_t *)"reseed", 6);
+    sm4_ctr_drbg_generate(&d, out, 65536, NULL, 0);
+    sm3_hash(out, 65536, h);
+    bad += check_hex("reseed, generate 65536", h, 32,
+                     "abb05611b87e994420c457f2a6c75f7d3f62c7f71625484017f09f0b54a2fbe8");
+    sm4_ctr_drbg_generate(&d, out, 33, NULL, 0);
+    bad += check_hex("generate 33", out, 33, "2d3c9416ed6697bdfe4798675e6b0ce616437377d3d2c62e6c4f76891b0a6d5de6");
+    sm4_ctr_drbg_instantiate(&d, e, NULL, 0);
+    memset(d.V, 0xff, 15);
+    d.V[15] = 0xf0;
+    sm4_ctr_drbg_generate(&d, out, 1000, NULL, 0);
+    sm3_hash(out, 1000, h);
+    bad += check_hex("counter wraps past 2^128", h, 32,
+                     "b0be94776b5907952db1ce1d6fe2fde08e801782379f9e11a3f82442b2de88bb");
+    int rej = sm4_ctr_drbg_generate(&d, out, SM4_DRBG_MAX_REQUEST + 1, NULL, 0) == -1 &&
+              sm4_ctr_drbg_instantiate(&d, e, e, 33) == -1;
+    printf("  %-34s %s\n", "oversized request / personalization", rej ? "rejected" : "FAIL");
+    sm4_ctr_drbg_wipe(&d);
+    return bad + !rej;
+}
+
+static void *thread_main(void *arg) {
+    sm4_drbg_random(arg, 32);
+    return NULL;
+}
+
+static int per_thread() {
+    enum { T = 8 };
+    uint8_t out[T][32];
+    pthread_t th[T];
+    int bad = 0;
+    for (int i = 0; i < T; i++) pthread_create(&th[i], NULL, thread_main, out[i]);
+    for (int i = 0; i < T; i++) pthread_join(th[i], NULL);
+    for (int i = 0; i < T; i++) for (int j = i + 1; j < T; j++) if (memcmp(out[i], out[j], 32) == 0) bad = 1;
+    printf("\nsm4_drbg_random:\n  %-34s %s\n", "8 threads, distinct output", bad ? "FAIL" : "OK");
+
+    // 父进程已缓冲了输出；fork 后子进程必须重新播种，不能复用同一段缓冲
+    uint8_t a[16], b[16], c[16];
+    int fd[2];
+    sm4_drbg_random(a, 16);
+    if (pipe(fd) != 0) return 1;
+    pid_t pid = fork();
+    if (pid == 0) {
+        sm4_drbg_random(b, 16);
+        ssize_t w = write(fd[1], b, 16);
+        _exit(w == 16 ? 0 : 1);
+    }
+    sm4_drbg_random(c, 16);
+    int ok = read(fd[0], b, 16) == 16 && memcmp(b, c, 16) != 0;
+    waitpid(pid, NULL, 0);
+    close(fd[0]); close(fd[1]);
+    printf("  %-34s %s\n", "fork: child differs from parent", ok ? "OK" : "FAIL");
+    bad += !ok;
+
+    // 不同长度的请求拼出 1 MB，逐段检查没有全 0 的 64 字节段（缓冲拼接错误时会出现）
+    size_t n = 1 << 20, pos = 0, zero = 0;
+    uint8_t *big = (uint8_t *)malloc(n);
+    static const uint8_t z[64] = { 0 };
+    for (size_t k = 1; pos < n; k = k * 7 % 9001 + 1) {
+        size_t m = k < n - pos ? k : n - pos;
+        if (sm4_drbg_random(big + pos, m) != 0) { zero = 1; break; }
+        pos += m;
+    }
+    for (size_t i = 0; i + 64 <= n; i += 64) zero += memcmp(big + i, z, 64) == 0;
+    printf("  %-34s %s\n", "mixed request sizes, 1 MB", zero ? "FAIL" : "OK");
+    free(big);
+    return bad + (zero != 0);
+}
+
+static void bench() {
+    static const size_t sizes[] = { 12, 16, 32, 256 };
+    const size_t N = 4000000;
+    uint8_t out[256], e[32];
+    volatile uint8_t sink = 0;
+    sm4_ctr_drbg d;
+    if (getrandom(e, sizeof(e), 0) != (ssize_t)sizeof(e)) return;
+    sm4_ctr_drbg_instantiate(&d, e, NULL, 0);
+    printf("\nper-call latency (ns):\n  %-6s %15s %12s %22s\n", "bytes", "sm4_drbg_random", "getrandom",
+           "sm4_ctr_drbg_generate");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t len = sizes[s], n = N / (len / 12 + 1);
+        double t0 = now_sec();
+        for (size_t i = 0; i < n; i++) { sm4_drbg_random(out, len); sink ^= out[0]; }
+        double t1 = now_sec();
+        for (size_t i = 0; i < n / 8; i++) { if (getrandom(out, len, 0) < 0) break; sink ^= out[0]; }
+        double t2 = now_sec();
+        for (size_t i = 0; i < n / 8; i++) { sm4_ctr_drbg_generate(&d, out, len, NULL, 0); sink ^= out[0]; }
+        double t3 = now_sec();
+        printf("  %-6zu %15.1f %12.1f %22.1f\n", len, (t1 - t0) / n * 1e9, (t2 - t1) / (n / 8) * 1e9,
+               (t3 - t2) / (n / 8) * 1e9);
+    }
+
+    // 生成吞吐：8 分组并行 vs 逐个分组（同样的计数器序列）
+    static uint8_t bulk[SM4_DRBG_MAX_REQUEST];
+    const int R = 256;
+    double t0 = now_sec();
+    for (int i = 0; i < R; i++) sm4_ctr_drbg_generate(&d, bulk, SM4_DRBG_MAX_REQUEST, NULL, 0);
+    double t1 = now_sec();
+    uint8_t ctr[16] = { 0 };
+    for (int i = 0; i < R; i++)
+        for (size_t j = 0; j < SM4_DRBG_MAX_REQUEST; j += 16) {
+            ctr[15]++;
+            sm4_crypt_block(ctr, bulk + j, d.rk, 0);
+        }
+    double t2 = now_sec();
+    sink ^= bulk[0];
+    printf("  bulk generate (64 KiB requests): %.0f MB/s, block-at-a-time keystream %.0f MB/s\n",
+           (double)R * SM4_DRBG_MAX_REQUEST / (t1 - t0) / 1e6, (double)R * SM4_DRBG_MAX_REQUEST / (t2 - t1) / 1e6);
+    sm4_ctr_drbg_wipe(&d);
+    (void)sink;
+}
+
+int main() {
+    int bad = known_answer();
+    bad += per_thread();
+    bench();
+    return bad ? 1 : 0;
+}
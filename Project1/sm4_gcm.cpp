@@ -0,0 +1,276 @@
+#include <string.h>
+#include <sys/uio.h>
+#include "sm4_gcm.h"
+
+static inline uint32_t load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline void store_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static inline uint64_t load_be64(const uint8_t *p) {
+    return ((uint64_t)load_be32(p) << 32) | load_be32(p + 4);
+}
+
+static inline void store_be64(uint8_t *p, uint64_t v) {
+    store_be32(p, (uint32_t)(v >> 32)); store_be32(p + 4, (uint32_t)v);
+}
+
+// ---------------------------- GHASH ----------------------------
+static const uint64_t LAST4[16] = {
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+
+// X = X · H（GF(2^128)，GCM 的位序），每次处理 4 位
+static void gmul(const sm4_gcm_key *k, uint8_t X[16]) {
+    uint8_t lo = X[15] & 0xf;
+    uint64_t zh = k->HH[lo], zl = k->HL[lo];
+    for (int i = 15; i >= 0; i--) {
+        lo = X[i] & 0xf;
+        uint8_t hi = X[i] >> 4;
+        if (i != 15) {
+            uint8_t rem = (uint8_t)(zl & 0xf);
+            zl = (zh << 60) | (zl >> 4);
+            zh = (zh >> 4) ^ (LAST4[rem] << 48);
+            zh ^= k->HH[lo]; zl ^= k->HL[lo];
+        }
+        uint8_t rem = (uint8_t)(zl & 0xf);
+        zl = (zh << 60) | (zl >> 4);
+        zh = (zh >> 4) ^ (LAST4[rem] << 48);
+        zh ^= k->HH[hi]; zl ^= k->HL[hi];
+    }
+    store_be64(X, zh); store_be64(X + 8, zl);
+}
+
+static inline void ghash_block(sm4_gcm_ctx *c, const uint8_t b[16]) {
+    for (int i = 0; i < 16; i++) c->X[i] ^= b[i];
+    gmul(c->key, c->X);
+}
+
+void sm4_gcm_setkey(sm4_gcm_key *k, const uint8_t key[16]) {
+    uint8_t H[16] = {0};
+    sm4_expand_key(key, k->rk);
+    sm4_crypt_block(H, H, k->rk, 0);
+    uint64_t vh = load_be64(H), vl = load_be64(H + 8);
+    k->HL[8] = vl; k->HH[8] = vh;
+    k->HL[0] = 0;  k->HH[0] = 0;
+    for (int i = 4; i > 0; i >>= 1) {
+        uint64_t t = (vl & 1) * 0xe1000000ULL;
+        vl = (vh << 63) | (vl >> 1);
+        vh = (vh >> 1) ^ (t << 32);
+        k->HL[i] = vl; k->HH[i] = vh;
+    }
+    for (int i = 2; i <= 8; i *= 2)
+        for (int j = 1; j < i; j++) {
+            k->HH[i + j] = k->HH[i] ^ k->HH[j];
+            k->HL[i + j] = k->HL[i] ^ k->HL[j];
+        }
+}
+
+// ---------------------------- 流式 GCM ----------------------------
+static inline void inc32(uint8_t ctr[16]) {
+    store_be32(ctr + 12, load_be32(ctr + 12) + 1);
+}
+
+void sm4_gcm_start(sm4_gcm_ctx *c, const sm4_gcm_key *k, const uint8_t iv[12]) {
+    memset(c, 0, sizeof(*c));
+    c->key = k;
+    memcpy(c->J0, iv, 12);
+    c->J0[15] = 1;
+    memcpy(c->ctr, c->J0, 16);
+    c->ks_used = 16;                            // 没有可用的密钥流
+}
+
+void sm4_gcm_aad(sm4_gcm_ctx *c, const uint8_t *aad, size_t len) {
+    c->aad_len += len;
+    if (c->buf_len) {
+        size_t n = 16 - c->buf_len < len ? 16 - c->buf_len : len;
+        memcpy(c->buf + c->buf_len, aad, n);
+        c->buf_len += n; aad += n; len -= n;
+        if (c->buf_len < 16) return;
+        ghash_block(c, c->buf);
+        c->buf_len = 0;
+    }
+    for (; len >= 16; aad += 16, len -= 16) ghash_block(c, aad);
+    memcpy(c->buf, aad, len);
+    c->buf_len = len;
+}
+
+// AAD 结束：不满一块的尾部补零后并入 GHASH
+static inline void aad_done(sm4_gcm_ctx *c) {
+    if (c->ct_len == 0 && c->buf_len && c->aad_len) {
+        memset(c->buf + c->buf_len, 0, 16 - c->buf_len);
+        ghash_block(c, c->buf);
+        c->buf_len = 0;
+    }
+}
+
+// dec = 0：out = in ⊕ 密钥流，GHASH 吸收 out；dec = 1：GHASH 吸收 in
+static void gcm_update(sm4_gcm_ctx *c, const uint8_t *in, uint8_t *out, size_t len, int dec) {
+    if (len == 0) return;
+    aad_done(c);
+    c->ct_len += len;
+    // 先用完上一段剩下的密钥流，此时 buf 中的密文与 ks_used 对齐
+    while (len && c->ks_used < 16) {
+        uint8_t ci = dec ? *in : (uint8_t)(*in ^ c->ks[c->ks_used]);
+        *out = (uint8_t)(*in ^ c->ks[c->ks_used]);
+        c->buf[c->buf_len++] = ci;
+        c->ks_used++; in++; out++; len--;
+        if (c->buf_len == 16) { ghash_block(c, c->buf); c->buf_len = 0; }
+    }
+    // 整块
+    for (; len >= 16; in += 16, out += 16, len -= 16) {
+        uint8_t ks[16];
+        inc32(c->ctr);
+        sm4_crypt_block(c->ctr, ks, c->key->rk, 0);
+        if (dec) ghash_block(c, in);
+        for (int i = 0; i < 16; i++) out[i] = (uint8_t)(in[i] ^ ks[i]);
+        if (!dec) ghash_block(c, out);
+    }
+    // 尾部：生成新的密钥流分组，用掉一部分
+    if (len) {
+        inc32(c->ctr);
+        sm4_crypt_block(c->ctr, c->ks, c->key->rk, 0);
+        for (size_t i = 0; i < len; i++) {
+            c->buf[i] = dec ? in[i] : (uint8_t)(in[i] ^ c->ks[i]);
+            out[i] = (uint8_t)(in[i] ^ c->ks[i]);
+        }
+        c->buf_len = len;
+        c->ks_used = len;
+    }
+}
+
+void sm4_gcm_encrypt_update(sm4_gcm_ctx *c, const uint8_t *in, uint8_t *out, size_t len) {
+    gcm_update(c, in, out, len, 0);
+}
+
+void sm4_gcm_decrypt_update(sm4_gcm_ctx *c, const uint8_t *in, uint8_t *out, size_t len) {
+    gcm_update(c, in, out, len, 1);
+}
+
+// ---------------------------- 分散/聚集 ----------------------------
+static size_t iov_total(const struct iovec *iov, int cnt) {
+    size_t n = 0;
+    for (int i = 0; i < cnt; i++) n += iov[i].iov_len;
+    return n;
+}
+
+// 按 len 字节清零片段（认证失败时用）
+static void iov_zero(const struct iovec *iov, int cnt, size_t len) {
+    for (int i = 0; i < cnt && len; i++) {
+        size_t n = iov[i].iov_len < len ? iov[i].iov_len : len;
+        memset(iov[i].iov_base, 0, n);
+        len -= n;
+    }
+}
+
+void sm4_gcm_aad_iov(sm4_gcm_ctx *c, const struct iovec *iov, int iovcnt) {
+    for (int i = 0; i < iovcnt; i++)
+        sm4_gcm_aad(c, (const uint8_t *)iov[i].iov_base, iov[i].iov_len);
+}
+
+// 同时遍历 src 与 dst，每次取两边当前片段剩余部分的较短者交给 gcm_update；
+// 分组跨片段时由上下文里的 ks / buf 衔接
+static int gcm_update_iov(sm4_gcm_ctx *c, const struct iovec *src, int srccnt,
+                          const struct iovec *dst, int dstcnt, int dec) {
+    if (!dst) { dst = src; dstcnt = srccnt; }
+    else if (iov_total(dst, dstcnt) < iov_total(src, srccnt)) return -1;
+    int j = 0;
+    size_t doff = 0;
+    for (int i = 0; i < srccnt; i++) {
+        const uint8_t *p = (const uint8_t *)src[i].iov_base;
+        size_t n = src[i].iov_len;
+        while (n) {
+            while (doff == dst[j].iov_len) { j++; doff = 0; }
+            size_t m = dst[j].iov_len - doff < n ? dst[j].iov_len - doff : n;
+            gcm_update(c, p, (uint8_t *)dst[j].iov_base + doff, m, dec);
+            p += m; n -= m; doff += m;
+        }
+    }
+    return 0;
+}
+
+int sm4_gcm_encrypt_iov(sm4_gcm_ctx *c, const struct iovec *src, int srccnt,
+                        const struct iovec *dst, int dstcnt) {
+    return gcm_update_iov(c, src, srccnt, dst, dstcnt, 0);
+}
+
+int sm4_gcm_decrypt_iov(sm4_gcm_ctx *c, const struct iovec *src, int srccnt,
+                        const struct iovec *dst, int dstcnt) {
+    return gcm_update_iov(c, src, srccnt, dst, dstcnt, 1);
+}
+
+void sm4_gcm_finish(sm4_gcm_ctx *c, uint8_t tag[16]) {
+    uint8_t lens[16], s[16];
+    aad_done(c);
+    if (c->buf_len) {                           // 密文尾部补零
+        memset(c->buf + c->buf_len, 0, 16 - c->buf_len);
+        ghash_block(c, c->buf);
+    }
+    store_be64(lens, c->aad_len * 8);
+    store_be64(lens + 8, c->ct_len * 8);
+    ghash_block(c, lens);
+    sm4_crypt_block(c->J0, s, c->key->rk, 0);
+    for (int i = 0; i < 16; i++) tag[i] = (uint8_t)(c->X[i] ^ s[i]);
+    memset(c, 0, sizeof(*c));
+}
+
+void sm4_gcm_seal(const sm4_gcm_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+                  const uint8_t *in, uint8_t *out, size_t len, uint8_t tag[16]) {
+    sm4_gcm_ctx c;
+    sm4_gcm_start(&c, k, iv);
+    sm4_gcm_aad(&c, aad, aad_len);
+    sm4_gcm_encrypt_update(&c, in, out, len);
+    sm4_gcm_finish(&c, tag);
+}
+
+int sm4_gcm_open(const sm4_gcm_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+                 const uint8_t *in, uint8_t *out, size_t len, const uint8_t tag[16]) {
+    sm4_gcm_ctx c;
+    uint8_t t[16], diff = 0;
+    sm4_gcm_start(&c, k, iv);
+    sm4_gcm_aad(&c, aad, aad_len);
+    sm4_gcm_decrypt_update(&c, in, out, len);
+    sm4_gcm_finish(&c, t);
+    for (int i = 0; i < 16; i++) diff |= t[i] ^ tag[i];
+    if (diff) { memset(out, 0, len); return -1; }
+    return 0;
+}
+
+int sm4_gcm_seal_iov(const sm4_gcm_key *k, const uint8_t iv[12], const struct iovec *aad, int aadcnt,
+                     const struct iovec *src, int srccnt, const struct iovec *dst, int dstcnt,
+                     uint8_t tag[16]) {
+    sm4_gcm_ctx c;
+    sm4_gcm_start(&c, k, iv);
+    sm4_gcm_aad_iov(&c, aad, aadcnt);
+    if (sm4_gcm_encrypt_iov(&c, src, srccnt, dst, dstcnt) != 0) {
+        memset(&c, 0, sizeof(c));
+        return -1;
+    }
+    sm4_gcm_finish(&c, tag);
+    return 0;
+}
+
+int sm4_gcm_open_iov(const sm4_gcm_key *k, const uint8_t iv[12], const struct iovec *aad, int aadcnt,
+                     const struct iovec *src, int srccnt, const struct iovec *dst, int dstcnt,
+                     const uint8_t tag[16]) {
+    sm4_gcm_ctx c;
+    uint8_t t[16], diff = 0;
+    sm4_gcm_start(&c, k, iv);
+    sm4_gcm_aad_iov(&c, aad, aadcnt);
+    if (sm4_gcm_decrypt_iov(&c, src, srccnt, dst, dstcnt) != 0) {
+        memset(&c, 0, sizeof(c));
+        return -1;
+    }
+    sm4_gcm_finish(&c, t);
+    for (int i = 0; i < 16; i++) diff |= t[i] ^ tag[i];
+    if (diff) {
+        if (dst) iov_zero(dst, dstcnt, iov_total(src, srccnt));
+        else     iov_zero(src, srccnt, iov_total(src, srccnt));
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+#ifndef SM4_GCM_H
+#define SM4_GCM_H
+#include <stdint.h>
+#include <stddef.h>
+#include "sm4_multikey.h"
+
+struct iovec;
+
+// ---------------------------- SM4 / SM4-GCM 库 ----------------------------
+// 标准 GCM（NIST SP 800-38D，与 RFC 8998 的 SM4-GCM 一致）：
+//   96 位 IV 时 J0 = IV || 0^31 || 1，数据从 inc32(J0) 开始做 CTR，
+//   GHASH 覆盖 AAD || C || len(AAD) || len(C)，Tag = E(J0) ⊕ GHASH。
+// GHASH 用 4 位 Shoup 表（每个密钥 256 字节）。流式接口允许任意长度分段，
+// 不满 16 字节的尾部留在上下文里，和下一段拼成完整分组。
+// SM4-GCM.cpp 是演示程序，计数器与长度块都没有按标准处理，这里是独立的正确实现。
+// 分组密码本身不另写一份：密钥扩展与单分组加密来自 SM4-multikey.cpp（sm4_multikey.h），
+// 链接时带上 SM4-multikey.cpp 并加 -DSM4_MULTIKEY_NO_MAIN。
+
+struct sm4_gcm_key {
+    uint32_t rk[32];
+    uint64_t HL[16], HH[16];        // H 的 4 位乘法表
+};
+
+struct sm4_gcm_ctx {
+    const sm4_gcm_key *key;
+    uint8_t J0[16], ctr[16];
+    uint8_t X[16];                  // GHASH 累加值
+    uint8_t ks[16];                 // 当前计数器分组的密钥流
+    uint8_t buf[16];                // 未满一个分组的 AAD 或密文
+    size_t  ks_used, buf_len;
+    uint64_t aad_len, ct_len;
+};
+
+void sm4_gcm_setkey(sm4_gcm_key *k, const uint8_t key[16]);
+
+// 流式接口：start 之后先 aad（可多次），再 encrypt/decrypt（可多次，不能与 aad 交错），最后 finish
+void sm4_gcm_start(sm4_gcm_ctx *c, const sm4_gcm_key *k, const uint8_t iv[12]);
+void sm4_gcm_aad(sm4_gcm_ctx *c, const uint8_t *aad, size_t len);
+void sm4_gcm_encrypt_update(sm4_gcm_ctx *c, const uint8_t *in, uint8_t *out, size_t len);   // in 可等于 out
+void sm4_gcm_decrypt_update(sm4_gcm_ctx *c, const uint8_t *in, uint8_t *out, size_t len);
+void sm4_gcm_finish(sm4_gcm_ctx *c, uint8_t tag[16]);
+
+// 分散/聚集接口：直接按 iovec 片段处理，片段边界落在分组中间时由上下文衔接，不经过中间缓冲。
+// dst 为 NULL 时原地处理 src；否则 dst 的切分方式可以与 src 不同（两者不能部分重叠），但总长不能小于 src，
+// 不满足时返回 -1 且不处理任何数据。
+void sm4_gcm_aad_iov(sm4_gcm_ctx *c, const struct iovec *iov, int iovcnt);
+int  sm4_gcm_encrypt_iov(sm4_gcm_ctx *c, const struct iovec *src, int srccnt,
+                         const struct iovec *dst, int dstcnt);
+int  sm4_gcm_decrypt_iov(sm4_gcm_ctx *c, const struct iovec *src, int srccnt,
+                         const struct iovec *dst, int dstcnt);
+// 一次性分散/聚集接口；open 在 tag 不符时返回 -1 并清零输出片段
+int  sm4_gcm_seal_iov(const sm4_gcm_key *k, const uint8_t iv[12], const struct iovec *aad, int aadcnt,
+                      const struct iovec *src, int srccnt, const struct iovec *dst, int dstcnt,
+                      uint8_t tag[16]);
+int  sm4_gcm_open_iov(const sm4_gcm_key *k, const uint8_t iv[12], const struct iovec *aad, int aadcnt,
+                      const struct iovec *src, int srccnt, const struct iovec *dst, int dstcnt,
+                      const uint8_t tag[16]);
+
+// 一次性接口；解密时 tag 不符返回 -1 并清零输出
+void sm4_gcm_seal(const sm4_gcm_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+                  const uint8_t *in, uint8_t *out, size_t len, uint8_t tag[16]);
+int  sm4_gcm_open(const sm4_gcm_key *k, const uint8_t iv[12], const uint8_t *aad, size_t aad_len,
+                  const uint8_t *in, uint8_t *out, size_t len, const uint8_t tag[16]);
+
+#endif
@@ -0,0 +1,177 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <time.h>
+#include "sm4_gcm.h"
+
+// ---------------------------- SM4-GCM 分散/聚集接口演示 ----------------------------
+// 编译：g++ -O2 -mavx2 -DSM4_MULTIKEY_NO_MAIN sm4_gcm_iov_demo.cpp sm4_gcm.cpp SM4-multikey.cpp -o sm4_gcm_iov_demo
+// 用法：./sm4_gcm_iov_demo     自检（RFC 8998 向量、随机切分、原地/异地、篡改）+ 性能
+// 性能部分模拟网络栈的分片报文：头部 66 字节作 AAD，载荷是 3 个不规则长度的页片段，
+// 对比“先拷进连续的 bounce 缓冲再加密”和直接对片段原地加密。
+
+static int parse_hex(const char *s, uint8_t *out, size_t n) {
+    if (strlen(s) != 2 * n) return -1;
+    for (size_t i = 0; i < n; i++) {
+        unsigned v;
+        if (sscanf(s + 2 * i, "%2x", &v) != 1) return -1;
+        out[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t rng_state = 0x243f6a8885a308d3ULL;
+static uint64_t rng() {
+    rng_state ^= rng_state << 13; rng_state ^= rng_state >> 7; rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// 把 buf[0, len) 随机切成至多 max 段（含 0 长度段和 1 字节段），返回段数
+static int split(uint8_t *buf, size_t len, struct iovec *iov, int max) {
+    int n = 0;
+    size_t off = 0;
+    while (off < len && n < max - 1) {
+        size_t r = rng() % 4, m;
+        if (r == 0)      m = 0;
+        else if (r == 1) m = 1 + rng() % 15;
+        else             m = rng() % 100;
+        if (m > len - off) m = len - off;
+        iov[n].iov_base = buf + off;
+        iov[n].iov_len = m;
+        n++; off += m;
+    }
+    iov[n].iov_base = buf + off;
+    iov[n].iov_len = len - off;
+    return n + 1;
+}
+
+int main() {
+    // RFC 8998 附录 A.1 的 SM4-GCM 测试向量，AAD 与明文都切成碎片后原地加密
+    uint8_t key[16], iv[12], aad[20], pt[64], want[64], tag[16], want_tag[16];
+    parse_hex("0123456789abcdeffedcba9876543210", key, 16);
+    parse_hex("00001234567800000000abcd", iv, 12);
+    parse_hex("feedfacedeadbeeffeedfacedeadbeefabaddad2", aad, 20);
+    parse_hex("aaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbccccccccccccccccdddddddddddddddd"
+              "eeeeeeeeeeeeeeeeffffffffffffffffeeeeeeeeeeeeeeeeaaaaaaaaaaaaaaaa", pt, 64);
+    parse_hex("17f399f08c67d5ee19d0dc9969c4bb7d5fd46fd3756489069157b282bb200735"
+              "d82710ca5c22f0ccfa7cbf93d496ac15a56834cbcf98c397b4024a2691233b8d", want, 64);
+    parse_hex("83de3541e4c2b58177e065a9bf7b62ec", want_tag, 16);
+    sm4_gcm_key gk;
+    sm4_gcm_setkey(&gk, key);
+    struct iovec av[2] = { { aad, 3 }, { aad + 3, 17 } };
+    struct iovec pv[4] = { { pt, 7 }, { pt + 7, 9 }, { pt + 16, 1 }, { pt + 17, 47 } };
+    int ok = sm4_gcm_seal_iov(&gk, iv, av, 2, pv, 4, NULL, 0, tag) == 0;
+    printf("RFC 8998 vector, fragmented in place: %s\n",
+           ok && memcmp(pt, want, 64) == 0 && memcmp(tag, want_tag, 16) == 0 ? "OK" : "FAIL");
+
+    // 随机长度、随机切分：结果与连续接口一致；解密原地还原；篡改后输出片段被清零
+    enum { MAXLEN = 5000, MAXV = 256 };
+    static uint8_t msg[MAXLEN], ref[MAXLEN], a[300], x[MAXLEN], y[MAXLEN + 64];
+    static struct iovec sv[MAXV], dv[MAXV], aiv[MAXV];
+    int bad = 0;
+    for (int t = 0; t < 3000; t++) {
+        size_t len = (size_t)(rng() % MAXLEN), alen = (size_t)(rng() % 300);
+        for (size_t i = 0; i < len; i++) msg[i] = (uint8_t)rng();
+        for (size_t i = 0; i < alen; i++) a[i] = (uint8_t)rng();
+        uint8_t t_ref[16], t1[16], t2[16];
+        sm4_gcm_seal(&gk, iv, a, alen, msg, ref, len, t_ref);
+
+        int na = split(a, alen, aiv, MAXV);
+        memcpy(x, msg, len);
+        int ns = split(x, len, sv, MAXV);
+        if (sm4_gcm_seal_iov(&gk, iv, aiv, na, sv, ns, NULL, 0, t1) != 0 ||
+            memcmp(x, ref, len) != 0 || memcmp(t1, t_ref, 16) != 0) { bad++; continue; }
+
+        // 异地：src 是原文的另一种切分，dst 比 src 长
+        ns = split(msg, len, sv, MAXV);
+        int nd = split(y, len + 64, dv, MAXV);
+        if (sm4_gcm_seal_iov(&gk, iv, aiv, na, sv, ns, dv, nd, t2) != 0 ||
+            memcmp(y, ref, len) != 0 || memcmp(t2, t_ref, 16) != 0) { bad++; continue; }
+
+        ns = split(x, len, sv, MAXV);
+        if (sm4_gcm_open_iov(&gk, iv, aiv, na, sv, ns, NULL, 0, t_ref) != 0 ||
+            memcmp(x, msg, len) != 0) { bad++; continue; }
+
+        if (len) {
+            memcpy(x, ref, len);
+            x[rng() % len] ^= 0x80;
+            ns = split(x, len, sv, MAXV);
+            int rc = sm4_gcm_open_iov(&gk, iv, aiv, na, sv, ns, NULL, 0, t_ref);
+            int zero = 1;
+            for (size_t i = 0; i < len; i++) zero &= x[i] == 0;
+            if (rc != -1 || !zero) bad++;
+        }
+    }
+    printf("3000 random fragmentations (in place / out of place / open / tamper): %s\n", bad ? "FAIL" : "OK");
+
+    struct iovec shortv = { y, 10 };
+    struct iovec longv = { msg, 11 };
+    printf("dst shorter than src rejected: %s\n",
+           sm4_gcm_seal_iov(&gk, iv, NULL, 0, &longv, 1, &shortv, 1, tag) == -1 ? "OK" : "FAIL");
+
+    // 性能：NP 个分片报文，载荷总量约 48 MB，远大于缓存，memcpy 按内存带宽计
+    const int NP = 6144, HDR = 66, NF = 3;
+    uint8_t *hdrs = (uint8_t*)malloc((size_t)NP * 128);
+    uint8_t *pages = (uint8_t*)aligned_alloc(4096, (size_t)NP * NF * 4096);
+    uint8_t *bounce = (uint8_t*)malloc(NF * 4096);
+    struct iovec *frag = (struct iovec*)malloc(sizeof(struct iovec) * NP * NF);
+    uint8_t (*tags)[16] = (uint8_t (*)[16])malloc((size_t)NP * 16);
+    size_t total = 0;
+    for (size_t i = 0; i < (size_t)NP * 128; i++) hdrs[i] = (uint8_t)rng();
+    for (size_t i = 0; i < (size_t)NP * NF * 4096; i++) pages[i] = (uint8_t)rng();
+    for (int p = 0; p < NP; p++)
+        for (int f = 0; f < NF; f++) {
+            size_t off = rng() % 1024, len = 1024 + rng() % (3072 - off + 1);
+            frag[p * NF + f].iov_base = pages + ((size_t)p * NF + f) * 4096 + off;
+            frag[p * NF + f].iov_len = len;
+            total += len;
+        }
+
+    // 只做聚集拷贝：这就是 bounce 方案多出来的内存流量
+    double t0 = now_sec();
+    for (int p = 0; p < NP; p++) {
+        size_t o = 0;
+        for (int f = 0; f < NF; f++) { memcpy(bounce + o, frag[p * NF + f].iov_base, frag[p * NF + f].iov_len); o += frag[p * NF + f].iov_len; }
+    }
+    double t_copy = now_sec() - t0;
+
+    t0 = now_sec();
+    for (int p = 0; p < NP; p++) {
+        size_t o = 0;
+        for (int f = 0; f < NF; f++) { memcpy(bounce + o, frag[p * NF + f].iov_base, frag[p * NF + f].iov_len); o += frag[p * NF + f].iov_len; }
+        uint8_t niv[12] = { 0 };
+        memcpy(niv, &p, sizeof(p));
+        sm4_gcm_seal(&gk, niv, hdrs + (size_t)p * 128, HDR, bounce, bounce, o, tags[p]);
+    }
+    double t_bounce = now_sec() - t0;
+
+    t0 = now_sec();
+    for (int p = 0; p < NP; p++) {
+        struct iovec h = { hdrs + (size_t)p * 128, (size_t)HDR };
+        uint8_t niv[12] = { 0 }, tg[16];
+        memcpy(niv, &p, sizeof(p));
+        sm4_gcm_seal_iov(&gk, niv, &h, 1, frag + p * NF, NF, NULL, 0, tg);
+        if (memcmp(tg, tags[p], 16) != 0) bad++;
+    }
+    double t_iov = now_sec() - t0;
+
+    double mb = total / 1e6;
+    printf("\n%d packets, %d-byte header (AAD) + %d page fragments, %.1f MB payload\n", NP, HDR, NF, mb);
+    printf("  gather memcpy only        : %8.1f ms  (%.0f MB/s)\n", t_copy * 1e3, mb / t_copy);
+    printf("  bounce buffer + seal      : %8.1f ms  (%.1f MB/s)\n", t_bounce * 1e3, mb / t_bounce);
+    printf("  sm4_gcm_seal_iov in place : %8.1f ms  (%.1f MB/s)%s\n", t_iov * 1e3, mb / t_iov,
+           bad ? "  TAG MISMATCH" : "");
+    printf("  copy avoided: %.1f MB, %.1f ms (%.1f%% of the bounce path)\n",
+           mb, t_copy * 1e3, 100.0 * t_copy / t_bounce);
+
+    free(hdrs); free(pages); free(bounce); free(frag); free(tags);
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,19 @@
+#ifndef SM4_MULTIKEY_H
+#define SM4_MULTIKEY_H
+#include <stdint.h>
+#include <stddef.h>
+
+// ---------------------------- 多密钥批量 SM4 ----------------------------
+// 实现在 SM4-multikey.cpp，作为库使用时以 -DSM4_MULTIKEY_NO_MAIN 编译。
+// 密钥表每个密钥 32 个轮密钥（128 字节），表需 64 字节对齐。
+// 这里也是 sm4_gcm / sm4_drbg / sm4_ctr_hmac / crypto_sched 共用的唯一一份 SM4 实现，它们可以链接进同一个程序。
+
+void sm4_expand_key(const uint8_t mk[16], uint32_t rk[32]);
+void sm4_crypt_block(const uint8_t in[16], uint8_t out[16], const uint32_t rk[32], int dec);
+
+void sm4_expand_keys(const uint8_t (*mk)[16], size_t n, uint32_t *rk_tab);
+// 分组 j 用 rk_tab 中第 key_idx[j] 个密钥加密（dec = 1 时解密），in 与 out 可以相同
+void sm4_crypt_multikey(const uint8_t (*in)[16], uint8_t (*out)[16], const uint32_t *key_idx, size_t n,
+                        const uint32_t *rk_tab, int dec);
+
+#endif
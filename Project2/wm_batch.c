@@ -0,0 +1,355 @@
+// wm_batch.c
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include "wm_core.h"
+#include "wm_io.h"
+
+/*
+  批量 DWT-SVD 水印（原生引擎）
+  用法:
+    ./wm_batch embed   <图像目录或 png> <水印 png> <输出目录> [alpha=0.1] [线程数=1]
+        输出目录写入含水印图（同名 png）、每张图的 <名>_S.npy（LL 前 128 个奇异值）以及 Uw.npy / Vw.npy
+    ./wm_batch extract <含水印目录或 png> <输出目录> <辅助文件目录> [alpha=0.1] [线程数=1]
+        按文件名在辅助目录中找 <名>_S.npy，找不到时用 original_S.npy（embed_watermark.py 的产物）
+    ./wm_batch selftest
+*/
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int has_png_ext(const char *name){
+    size_t n = strlen(name);
+    return n > 4 && strcasecmp(name + n - 4, ".png") == 0;
+}
+
+static int cmp_str(const void *a, const void *b){
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/* 目录下所有 png（按名字排序）；参数本身是文件时只有它一个 */
+static char **list_pngs(const char *path, size_t *count){
+    struct stat st;
+    char **v = NULL;
+    size_t n = 0, cap = 0;
+    *count = 0;
+    if(stat(path, &st) != 0) return NULL;
+    if(!S_ISDIR(st.st_mode)){
+        v = malloc(sizeof(char *));
+        if(v && (v[0] = strdup(path))) *count = 1;
+        return v;
+    }
+    DIR *d = opendir(path);
+    if(!d) return NULL;
+    struct dirent *de;
+    while((de = readdir(d))){
+        if(!has_png_ext(de->d_name)) continue;
+        if(n == cap){
+            cap = cap ? cap * 2 : 64;
+            char **nv = realloc(v, cap * sizeof(char *));
+            if(!nv) break;
+            v = nv;
+        }
+        size_t len = strlen(path) + strlen(de->d_name) + 2;
+        if(!(v[n] = malloc(len))) break;
+        snprintf(v[n], len, "%s/%s", path, de->d_name);
+        n++;
+    }
+    closedir(d);
+    qsort(v, n, sizeof(char *), cmp_str);
+    *count = n;
+    return v;
+}
+
+static const char *base_name(const char *p){
+    const char *s = strrchr(p, '/');
+    return s ? s + 1 : p;
+}
+
+/* 文件名去掉 .png */
+static void stem(const char *p, char *out, size_t cap){
+    snprintf(out, cap, "%s", base_name(p));
+    size_t n = strlen(out);
+    if(n > 4 && has_png_ext(out)) out[n-4] = 0;
+}
+
+/* ---------------- 批处理 ---------------- */
+
+typedef struct {
+    char **files;
+    size_t n;
+    size_t next;            // 原子取下一张
+    const char *out_dir, *aux_dir;
+    double alpha;
+    int extract;
+    const double *sw, *uw, *vw;
+    size_t failed;
+} batch_t;
+
+typedef struct {
+    batch_t *b;
+    int threaded;
+} worker_t;
+
+static int process_one(batch_t *b, const char *path, wm_ws *ws, uint8_t **src, size_t *cap, uint8_t *img){
+    int w, h;
+    char name[1024], out[2048];
+    if(wm_png_read_gray(path, src, cap, &w, &h) != 0) return -1;
+    wm_resize_linear(*src, w, h, img, WM_IMG, WM_IMG);
+    stem(path, name, sizeof(name));
+    if(!b->extract){
+        double s[WM_K];
+        wm_embed(img, b->sw, b->alpha, s, ws);
+        snprintf(out, sizeof(out), "%s/%s.png", b->out_dir, name);
+        if(wm_png_write_gray(out, img, WM_IMG, WM_IMG) != 0) return -1;
+        snprintf(out, sizeof(out), "%s/%s_S.npy", b->out_dir, name);
+        return wm_npy_write(out, s, WM_K, 0);
+    }
+    double s[WM_K];
+    uint8_t mark[WM_MARK * WM_MARK];
+    snprintf(out, sizeof(out), "%s/%s_S.npy", b->aux_dir, name);
+    if(wm_npy_read(out, s, WM_K) != WM_K){
+        snprintf(out, sizeof(out), "%s/original_S.npy", b->aux_dir);
+        if(wm_npy_read(out, s, WM_K) != WM_K) return -1;
+    }
+    wm_extract(img, s, b->uw, b->vw, b->alpha, mark, ws);
+    snprintf(out, sizeof(out), "%s/%s.png", b->out_dir, name);
+    return wm_png_write_gray(out, mark, WM_MARK, WM_MARK);
+}
+
+static void *worker_main(void *arg){
+    batch_t *b = ((worker_t *)arg)->b;
+    wm_ws *ws = wm_ws_new();
+    uint8_t *src = NULL, *img = malloc((size_t)WM_IMG * WM_IMG);
+    size_t cap = 0;
+    if(!ws || !img){
+        // 无法分配工作区：不取任务，留给其他线程
+        wm_ws_free(ws);
+        free(img);
+        return NULL;
+    }
+    for(;;){
+        size_t i = __atomic_fetch_add(&b->next, 1, __ATOMIC_RELAXED);
+        if(i >= b->n) break;
+        if(process_one(b, b->files[i], ws, &src, &cap, img) != 0){
+            fprintf(stderr, "failed: %s\n", b->files[i]);
+            __atomic_fetch_add(&b->failed, 1, __ATOMIC_RELAXED);
+        }
+    }
+    wm_ws_free(ws);
+    free(src);
+    free(img);
+    return NULL;
+}
+
+static void run_batch(batch_t *b, int nthreads){
+    if(nthreads < 1) nthreads = 1;
+    pthread_t *th = calloc((size_t)nthreads, sizeof(pthread_t));
+    worker_t *ws = calloc((size_t)nthreads, sizeof(worker_t));
+    if(!th || !ws){ nthreads = 1; }
+    for(int i=1;i<nthreads;i++){
+        ws[i].b = b;
+        ws[i].threaded = pthread_create(&th[i], NULL, worker_main, &ws[i]) == 0;
+    }
+    worker_t self = { b, 0 };
+    worker_main(&self);
+    for(int i=1;i<nthreads;i++) if(ws[i].threaded) pthread_join(th[i], NULL);
+    free(th);
+    free(ws);
+}
+
+static int load_mark(const char *path, uint8_t *mark){
+    uint8_t *src = NULL;
+    size_t cap = 0;
+    int w, h;
+    if(wm_png_read_gray(path, &src, &cap, &w, &h) != 0) return -1;
+    wm_resize_linear(src, w, h, mark, WM_MARK, WM_MARK);
+    free(src);
+    return 0;
+}
+
+static int cmd_batch(int extract, int argc, char **argv){
+    batch_t b = {0};
+    if(argc < 5) return 2;
+    const char *in = argv[2];
+    b.out_dir = extract ? argv[3] : argv[4];
+    b.aux_dir = extract ? argv[4] : b.out_dir;
+    b.alpha = argc > 5 ? atof(argv[5]) : 0.1;
+    int nthreads = argc > 6 ? atoi(argv[6]) : 1;
+    b.extract = extract;
+    mkdir(b.out_dir, 0755);
+
+    double *sw = malloc(sizeof(double) * WM_MARK);
+    double *uw = malloc(sizeof(double) * WM_MARK * WM_MARK);
+    double *vw = malloc(sizeof(double) * WM_MARK * WM_MARK);
+    if(!sw || !uw || !vw) return 1;
+    char p[2048];
+    if(!extract){
+        uint8_t mark[WM_MARK * WM_MARK];
+        wm_ws *ws = wm_ws_new();
+        if(!ws || load_mark(argv[3], mark) != 0){ fprintf(stderr, "cannot read watermark %s\n", argv[3]); return 1; }
+        wm_mark_prepare(mark, sw, uw, vw, ws);
+        wm_ws_free(ws);
+        snprintf(p, sizeof(p), "%s/Uw.npy", b.out_dir);
+        if(wm_npy_write(p, uw, WM_MARK, WM_MARK) != 0) return 1;
+        snprintf(p, sizeof(p), "%s/Vw.npy", b.out_dir);
+        if(wm_npy_write(p, vw, WM_MARK, WM_MARK) != 0) return 1;
+    } else {
+        snprintf(p, sizeof(p), "%s/Uw.npy", b.aux_dir);
+        if(wm_npy_read(p, uw, WM_MARK * WM_MARK) != WM_MARK * WM_MARK){ fprintf(stderr, "cannot read %s\n", p); return 1; }
+        snprintf(p, sizeof(p), "%s/Vw.npy", b.aux_dir);
+        if(wm_npy_read(p, vw, WM_MARK * WM_MARK) != WM_MARK * WM_MARK){ fprintf(stderr, "cannot read %s\n", p); return 1; }
+    }
+    b.sw = sw; b.uw = uw; b.vw = vw;
+    b.files = list_pngs(in, &b.n);
+    if(!b.n){ fprintf(stderr, "no png under %s\n", in); return 1; }
+
+    double t0 = now_sec();
+    run_batch(&b, nthreads);
+    double t1 = now_sec();
+    printf("%s: %zu images (%zu failed), %d threads, %.3f s, %.2f ms/image, %.1f images/s\n",
+           extract ? "extract" : "embed", b.n, b.failed, nthreads, t1 - t0,
+           (t1 - t0) / b.n * 1e3, b.n / (t1 - t0));
+    for(size_t i=0;i<b.n;i++) free(b.files[i]);
+    free(b.files);
+    free(sw); free(uw); free(vw);
+    return b.failed ? 1 : 0;
+}
+
+/* ---------------- 自检 ---------------- */
+
+/* 单边 Jacobi SVD，只求奇异值，作为截断 SVD 的参照 */
+static void jacobi_singular_values(const double *a0, int m, int n, double *s){
+    double *a = malloc(sizeof(double) * m * n);
+    memcpy(a, a0, sizeof(double) * m * n);
+    for(int sweep=0; sweep<30; sweep++){
+        double off = 0;
+        for(int i=0;i<n-1;i++)
+            for(int j=i+1;j<n;j++){
+                double al = 0, be = 0, ga = 0;
+                for(int r=0;r<m;r++){
+                    double x = a[r*n+i], y = a[r*n+j];
+                    al += x*x; be += y*y; ga += x*y;
+                }
+                if(fabs(ga) <= 1e-15 * sqrt(al * be)) continue;
+                off = fmax(off, fabs(ga) / sqrt(al * be));
+                double z = (be - al) / (2 * ga);
+                double t = (z >= 0 ? 1 : -1) / (fabs(z) + sqrt(1 + z*z));
+                double c = 1 / sqrt(1 + t*t), sn = c * t;
+                for(int r=0;r<m;r++){
+                    double x = a[r*n+i], y = a[r*n+j];
+                    a[r*n+i] = c*x - sn*y;
+                    a[r*n+j] = sn*x + c*y;
+                }
+            }
+        if(off < 1e-15) break;
+    }
+    for(int j=0;j<n;j++){
+        double t = 0;
+        for(int r=0;r<m;r++) t += a[r*n+j] * a[r*n+j];
+        s[j] = sqrt(t);
+    }
+    for(int i=0;i<n;i++)                           // 降序
+        for(int j=i+1;j<n;j++) if(s[j] > s[i]){ double t = s[i]; s[i] = s[j]; s[j] = t; }
+    free(a);
+}
+
+static int selftest(void){
+    int ok = 1;
+    uint64_t rng = 0x0123456789abcdefULL;
+    uint8_t *img = malloc(WM_IMG * WM_IMG), *back = malloc(WM_IMG * WM_IMG);
+    wm_ws *ws = wm_ws_new();
+    double *ll = malloc(sizeof(double) * WM_LL * WM_LL), *lh = malloc(sizeof(double) * WM_LL * WM_LL);
+    double *hl = malloc(sizeof(double) * WM_LL * WM_LL), *hh = malloc(sizeof(double) * WM_LL * WM_LL);
+    if(!img || !back || !ws || !ll || !lh || !hl || !hh) return 1;
+
+    // 平滑图像 + 噪声：奇异值分布接近自然图像
+    for(int y=0;y<WM_IMG;y++)
+        for(int x=0;x<WM_IMG;x++){
+            rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17;
+            double v = 128 + 60 * sin(x * 0.031) * cos(y * 0.017) + 40 * sin((x + 2*y) * 0.05) + (double)(rng % 32) - 16;
+            img[y*WM_IMG + x] = (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+        }
+
+    // 1. Haar 往返精确还原
+    wm_haar_fwd(img, ll, lh, hl, hh);
+    wm_haar_inv(ll, lh, hl, hh, back);
+    int same = memcmp(img, back, WM_IMG * WM_IMG) == 0;
+    printf("haar round trip (%s): %s\n", wm_haar_simd() ? "avx2" : "scalar", same ? "OK" : "FAIL");
+    ok &= same;
+
+    // 2. 截断 SVD：奇异值与 Jacobi 参照比较，检查 A v = σ u 与正交性
+    double s[WM_LL], ref[WM_LL];
+    double *u = malloc(sizeof(double) * WM_LL * WM_K), *vt = malloc(sizeof(double) * WM_K * WM_LL);
+    double t0 = now_sec();
+    wm_svd_topk(ll, WM_LL, WM_LL, WM_K, s, u, vt, ws);
+    double t1 = now_sec();
+    jacobi_singular_values(ll, WM_LL, WM_LL, ref);
+    double t2 = now_sec();
+    double serr = 0, res = 0, orth = 0;
+    for(int j=0;j<WM_K;j++) serr = fmax(serr, fabs(s[j] - ref[j]) / ref[0]);
+    for(int j=0;j<WM_K;j++){
+        for(int r=0;r<WM_LL;r++){
+            double t = 0;
+            for(int i=0;i<WM_LL;i++) t += ll[r*WM_LL+i] * vt[j*WM_LL+i];
+            res = fmax(res, fabs(t - s[j] * u[r*WM_K+j]) / s[0]);
+        }
+        for(int c=0;c<=j;c++){
+            double du = 0, dv = 0;
+            for(int r=0;r<WM_LL;r++){ du += u[r*WM_K+j] * u[r*WM_K+c]; dv += vt[j*WM_LL+r] * vt[c*WM_LL+r]; }
+            orth = fmax(orth, fmax(fabs(du - (c == j)), fabs(dv - (c == j))));
+        }
+    }
+    printf("top-%d SVD: max |s - s_jacobi|/s1 = %.2e, max |Av - su|/s1 = %.2e, orthogonality = %.2e  %s\n",
+           WM_K, serr, res, orth, serr < 1e-12 && res < 1e-10 && orth < 1e-8 ? "OK" : "FAIL");
+    printf("  truncated SVD %.2f ms, Jacobi (full) %.2f ms\n", (t1 - t0) * 1e3, (t2 - t1) * 1e3);
+    ok &= serr < 1e-12 && res < 1e-10 && orth < 1e-8;
+
+    // 3. 嵌入 → 提取往返
+    uint8_t mark[WM_MARK * WM_MARK], got[WM_MARK * WM_MARK];
+    for(int y=0;y<WM_MARK;y++)
+        for(int x=0;x<WM_MARK;x++) mark[y*WM_MARK + x] = ((x / 16 + y / 16) & 1) ? 255 : 0;
+    double sw[WM_MARK], so[WM_K];
+    double *uw = malloc(sizeof(double) * WM_MARK * WM_MARK), *vw = malloc(sizeof(double) * WM_MARK * WM_MARK);
+    wm_mark_prepare(mark, sw, uw, vw, ws);
+    memcpy(back, img, WM_IMG * WM_IMG);
+    wm_embed(back, sw, 0.1, so, ws);
+    double psnr = 0;
+    for(int i=0;i<WM_IMG*WM_IMG;i++) psnr += (double)(back[i] - img[i]) * (back[i] - img[i]);
+    psnr = 10 * log10(255.0 * 255.0 / (psnr / (WM_IMG * WM_IMG)));
+    wm_extract(back, so, uw, vw, 0.1, got, ws);
+    double mse = 0;
+    for(int i=0;i<WM_MARK*WM_MARK;i++) mse += (double)(got[i] - mark[i]) * (got[i] - mark[i]);
+    mse /= WM_MARK * WM_MARK;
+    printf("embed/extract round trip: watermarked PSNR %.2f dB, extracted watermark MSE %.2f  %s\n",
+           psnr, mse, mse < 500 ? "OK" : "FAIL");
+    ok &= mse < 500;
+
+    free(u); free(vt); free(uw); free(vw);
+    free(ll); free(lh); free(hl); free(hh);
+    free(img); free(back);
+    wm_ws_free(ws);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv){
+    int rc = 2;
+    if(argc >= 2 && strcmp(argv[1], "selftest") == 0) return selftest();
+    if(argc >= 2 && strcmp(argv[1], "embed") == 0) rc = cmd_batch(0, argc, argv);
+    else if(argc >= 2 && strcmp(argv[1], "extract") == 0) rc = cmd_batch(1, argc, argv);
+    if(rc == 2){
+        fprintf(stderr, "usage: %s embed <in> <watermark.png> <out_dir> [alpha] [threads]\n"
+                        "       %s extract <in> <out_dir> <aux_dir> [alpha] [threads]\n"
+                        "       %s selftest\n", argv[0], argv[0], argv[0]);
+    }
+    return rc;
+}
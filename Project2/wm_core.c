@@ -0,0 +1,447 @@
+// wm_core.c
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <immintrin.h>
+#include "wm_core.h"
+
+#define NMAX WM_LL
+
+struct wm_ws {
+    double *ll, *lh, *hl, *hh;      // Haar 子带
+    double *g;                      // Gram 矩阵，三对角化时原地修改
+    double *hv;                     // Householder 向量（第 k 行存第 k 步）
+    double *y;                      // 三对角矩阵的特征向量 / 回代后的右奇异向量（k×n）
+    double *u;                      // 左奇异向量（m×k）
+    double d[NMAX], e[NMAX], e2[NMAX], beta[NMAX], p[NMAX], lam[NMAX];
+    double fd[NMAX], fdl[NMAX], fdu[NMAX], fdu2[NMAX];   // 三对角 LU
+    int ipiv[NMAX];
+    double s[NMAX];
+};
+
+wm_ws *wm_ws_new(void){
+    wm_ws *ws = calloc(1, sizeof(*ws));
+    if(!ws) return NULL;
+    size_t q = (size_t)WM_LL * WM_LL;
+    ws->ll = malloc(q * sizeof(double));
+    ws->lh = malloc(q * sizeof(double));
+    ws->hl = malloc(q * sizeof(double));
+    ws->hh = malloc(q * sizeof(double));
+    ws->g  = malloc(q * sizeof(double));
+    ws->hv = malloc(q * sizeof(double));
+    ws->y  = malloc(q * sizeof(double));
+    ws->u  = malloc(q * sizeof(double));
+    if(!ws->ll || !ws->lh || !ws->hl || !ws->hh || !ws->g || !ws->hv || !ws->y || !ws->u){
+        wm_ws_free(ws);
+        return NULL;
+    }
+    return ws;
+}
+
+void wm_ws_free(wm_ws *ws){
+    if(!ws) return;
+    free(ws->ll); free(ws->lh); free(ws->hl); free(ws->hh);
+    free(ws->g); free(ws->hv); free(ws->y); free(ws->u);
+    free(ws);
+}
+
+/* ---------------- Haar（lifting） ----------------
+   2×2 块 [a b; c d]：行内先求和/差 s = a+b, t = a-b，再跨行组合
+     LL = (s0+s1)/2, LH = (s0-s1)/2, HL = (t0+t1)/2, HH = (t0-t1)/2
+   LL 与 pywt 一致；细节子带的符号约定与 pywt 不同，但正逆变换配套使用，不影响结果。 */
+
+static void haar_fwd_scalar(const uint8_t *img, double *ll, double *lh, double *hl, double *hh){
+    for(int i=0;i<WM_LL;i++){
+        const uint8_t *r0 = img + (size_t)(2*i) * WM_IMG, *r1 = r0 + WM_IMG;
+        for(int x=0;x<WM_LL;x++){
+            int s0 = r0[2*x] + r0[2*x+1], t0 = r0[2*x] - r0[2*x+1];
+            int s1 = r1[2*x] + r1[2*x+1], t1 = r1[2*x] - r1[2*x+1];
+            size_t o = (size_t)i * WM_LL + x;
+            ll[o] = 0.5 * (s0 + s1); lh[o] = 0.5 * (s0 - s1);
+            hl[o] = 0.5 * (t0 + t1); hh[o] = 0.5 * (t0 - t1);
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static inline void store16_half(double *dst, __m256i v){
+    const __m256d h = _mm256_set1_pd(0.5);
+    __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+    __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+    _mm256_storeu_pd(dst,      _mm256_mul_pd(h, _mm256_cvtepi32_pd(_mm256_castsi256_si128(lo))));
+    _mm256_storeu_pd(dst + 4,  _mm256_mul_pd(h, _mm256_cvtepi32_pd(_mm256_extracti128_si256(lo, 1))));
+    _mm256_storeu_pd(dst + 8,  _mm256_mul_pd(h, _mm256_cvtepi32_pd(_mm256_castsi256_si128(hi))));
+    _mm256_storeu_pd(dst + 12, _mm256_mul_pd(h, _mm256_cvtepi32_pd(_mm256_extracti128_si256(hi, 1))));
+}
+
+/* 每次 32 字节 = 16 对像素：maddubs 乘 (1,1) 得和、乘 (1,-1) 得差，全程 16 位整数，最后转 double */
+__attribute__((target("avx2")))
+static void haar_fwd_avx2(const uint8_t *img, double *ll, double *lh, double *hl, double *hh){
+    const __m256i ones = _mm256_set1_epi8(1);
+    const __m256i pm = _mm256_set1_epi16((short)0xFF01);    // 字节 (1, -1)
+    for(int i=0;i<WM_LL;i++){
+        const uint8_t *r0 = img + (size_t)(2*i) * WM_IMG, *r1 = r0 + WM_IMG;
+        for(int x=0;x<WM_LL;x+=16){
+            __m256i a = _mm256_loadu_si256((const __m256i *)(r0 + 2*x));
+            __m256i b = _mm256_loadu_si256((const __m256i *)(r1 + 2*x));
+            __m256i s0 = _mm256_maddubs_epi16(a, ones), t0 = _mm256_maddubs_epi16(a, pm);
+            __m256i s1 = _mm256_maddubs_epi16(b, ones), t1 = _mm256_maddubs_epi16(b, pm);
+            size_t o = (size_t)i * WM_LL + x;
+            store16_half(ll + o, _mm256_add_epi16(s0, s1));
+            store16_half(lh + o, _mm256_sub_epi16(s0, s1));
+            store16_half(hl + o, _mm256_add_epi16(t0, t1));
+            store16_half(hh + o, _mm256_sub_epi16(t0, t1));
+        }
+    }
+}
+
+static inline uint8_t clip_u8(double v){
+    return v <= 0 ? 0 : v >= 255 ? 255 : (uint8_t)v;
+}
+
+static void haar_inv_scalar(const double *ll, const double *lh, const double *hl, const double *hh, uint8_t *img){
+    for(int i=0;i<WM_LL;i++){
+        uint8_t *r0 = img + (size_t)(2*i) * WM_IMG, *r1 = r0 + WM_IMG;
+        for(int x=0;x<WM_LL;x++){
+            size_t o = (size_t)i * WM_LL + x;
+            double s0 = ll[o] + lh[o], s1 = ll[o] - lh[o];
+            double t0 = hl[o] + hh[o], t1 = hl[o] - hh[o];
+            r0[2*x] = clip_u8(0.5 * (s0 + t0)); r0[2*x+1] = clip_u8(0.5 * (s0 - t0));
+            r1[2*x] = clip_u8(0.5 * (s1 + t1)); r1[2*x+1] = clip_u8(0.5 * (s1 - t1));
+        }
+    }
+}
+
+/* 4 个系数 → 每行 8 个像素：截断取整后交错 (a0 b0 a1 b1 ...) 并打包成字节 */
+__attribute__((target("avx2")))
+static inline void store_pairs(uint8_t *dst, __m256d a, __m256d b){
+    const __m256d lo = _mm256_setzero_pd(), hi = _mm256_set1_pd(255.0);
+    __m128i ia = _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(a, lo), hi));
+    __m128i ib = _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(b, lo), hi));
+    __m128i w = _mm_packs_epi32(_mm_unpacklo_epi32(ia, ib), _mm_unpackhi_epi32(ia, ib));
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(w, w));
+}
+
+__attribute__((target("avx2")))
+static void haar_inv_avx2(const double *ll, const double *lh, const double *hl, const double *hh, uint8_t *img){
+    const __m256d h = _mm256_set1_pd(0.5);
+    for(int i=0;i<WM_LL;i++){
+        uint8_t *r0 = img + (size_t)(2*i) * WM_IMG, *r1 = r0 + WM_IMG;
+        for(int x=0;x<WM_LL;x+=4){
+            size_t o = (size_t)i * WM_LL + x;
+            __m256d L = _mm256_loadu_pd(ll + o), H = _mm256_loadu_pd(lh + o);
+            __m256d V = _mm256_loadu_pd(hl + o), D = _mm256_loadu_pd(hh + o);
+            __m256d s0 = _mm256_add_pd(L, H), s1 = _mm256_sub_pd(L, H);
+            __m256d t0 = _mm256_add_pd(V, D), t1 = _mm256_sub_pd(V, D);
+            store_pairs(r0 + 2*x, _mm256_mul_pd(h, _mm256_add_pd(s0, t0)), _mm256_mul_pd(h, _mm256_sub_pd(s0, t0)));
+            store_pairs(r1 + 2*x, _mm256_mul_pd(h, _mm256_add_pd(s1, t1)), _mm256_mul_pd(h, _mm256_sub_pd(s1, t1)));
+        }
+    }
+}
+
+int wm_haar_simd(void){
+    static int simd = -1;
+    if(simd < 0) simd = __builtin_cpu_supports("avx2") ? 1 : 0;
+    return simd;
+}
+
+void wm_haar_fwd(const uint8_t *img, double *ll, double *lh, double *hl, double *hh){
+    if(wm_haar_simd()) haar_fwd_avx2(img, ll, lh, hl, hh);
+    else               haar_fwd_scalar(img, ll, lh, hl, hh);
+}
+
+void wm_haar_inv(const double *ll, const double *lh, const double *hl, const double *hh, uint8_t *img){
+    if(wm_haar_simd()) haar_inv_avx2(ll, lh, hl, hh, img);
+    else               haar_inv_scalar(ll, lh, hl, hh, img);
+}
+
+/* ---------------- 截断 SVD ---------------- */
+
+/* G = AᵀA（n×n，完整存储），按行做秩 1 累加，内层连续访问 */
+static void gram(const double *a, int m, int n, double *g){
+    memset(g, 0, (size_t)n * n * sizeof(double));
+    for(int r=0;r<m;r++){
+        const double *ar = a + (size_t)r * n;
+        for(int i=0;i<n;i++){
+            double x = ar[i];
+            double *gi = g + (size_t)i * n;
+            for(int j=i;j<n;j++) gi[j] += x * ar[j];
+        }
+    }
+    for(int i=0;i<n;i++)
+        for(int j=0;j<i;j++) g[(size_t)i*n + j] = g[(size_t)j*n + i];
+}
+
+/* Householder 三对角化：Qᵀ G Q = T（对角 d，次对角 e），Q = H_0 H_1 … H_{n-3}，
+   H_k = I - beta_k v_k v_kᵀ，v_k 存在 hv 第 k 行的 [k+1, n) */
+static void tridiag(double *g, int n, double *d, double *e, double *hv, double *beta, double *p){
+    for(int k=0;k<n-2;k++){
+        double *v = hv + (size_t)k * n;
+        double xn = 0;
+        for(int i=k+1;i<n;i++){ v[i] = g[(size_t)i*n + k]; xn += v[i] * v[i]; }
+        xn = sqrt(xn);
+        double x0 = v[k+1];
+        double alpha = x0 > 0 ? -xn : xn;
+        d[k] = g[(size_t)k*n + k];
+        v[k+1] -= alpha;
+        double vv = 0;
+        for(int i=k+1;i<n;i++) vv += v[i] * v[i];
+        if(vv == 0){ beta[k] = 0; e[k] = x0; continue; }
+        double b = 2.0 / vv;
+        beta[k] = b;
+        e[k] = alpha;
+        // 尾部子矩阵 B ← H B H = B - v wᵀ - w vᵀ，w = p - (b/2)(vᵀp) v，p = b B v
+        double vp = 0;
+        for(int i=k+1;i<n;i++){
+            const double *gi = g + (size_t)i * n;
+            double s = 0;
+            for(int j=k+1;j<n;j++) s += gi[j] * v[j];
+            p[i] = b * s;
+            vp += v[i] * p[i];
+        }
+        double K = 0.5 * b * vp;
+        for(int i=k+1;i<n;i++) p[i] -= K * v[i];
+        for(int i=k+1;i<n;i++){
+            double *gi = g + (size_t)i * n;
+            double vi = v[i], wi = p[i];
+            for(int j=k+1;j<n;j++) gi[j] -= vi * p[j] + wi * v[j];
+        }
+    }
+    if(n >= 2){
+        d[n-2] = g[(size_t)(n-2)*n + n-2];
+        e[n-2] = g[(size_t)(n-1)*n + n-2];
+    }
+    d[n-1] = g[(size_t)(n-1)*n + n-1];
+}
+
+/* Sturm 序列：T 中小于 x 的特征值个数 */
+static int sturm_count(const double *d, const double *e2, int n, double x, double pivmin){
+    int c = 0;
+    double q = d[0] - x;
+    if(fabs(q) < pivmin) q = -pivmin;
+    if(q < 0) c++;
+    for(int i=1;i<n;i++){
+        q = d[i] - x - e2[i-1] / q;
+        if(fabs(q) < pivmin) q = -pivmin;
+        if(q < 0) c++;
+    }
+    return c;
+}
+
+/* 二分求前 k 大的特征值（降序） */
+static void top_eigenvalues(const double *d, const double *e, double *e2, int n, int k, double *lam, double *tnorm){
+    double lo = d[0], hi = d[0], emax = 0;
+    for(int i=0;i<n;i++){
+        double r = (i > 0 ? fabs(e[i-1]) : 0) + (i < n-1 ? fabs(e[i]) : 0);
+        if(d[i] - r < lo) lo = d[i] - r;
+        if(d[i] + r > hi) hi = d[i] + r;
+    }
+    for(int i=0;i<n-1;i++){ e2[i] = e[i] * e[i]; if(e2[i] > emax) emax = e2[i]; }
+    double pivmin = DBL_MIN * (emax > 1 ? emax : 1);
+    *tnorm = fmax(fabs(lo), fabs(hi));
+    double top = hi;    // 上一个特征值是下一个的上界
+    for(int j=0;j<k;j++){
+        int idx = n - 1 - j;            // 升序下标
+        double a = lo, b = top;
+        for(int it=0; it<200; it++){
+            double mid = 0.5 * (a + b);
+            if(b - a <= 2 * DBL_EPSILON * fmax(fabs(a), fabs(b)) + pivmin || mid == a || mid == b) break;
+            if(sturm_count(d, e2, n, mid, pivmin) > idx) b = mid; else a = mid;
+        }
+        lam[j] = 0.5 * (a + b);
+        top = b;
+    }
+}
+
+/* T - λI 的带部分主元 LU（同 LAPACK dgttrf） */
+static void tri_factor(wm_ws *ws, const double *d, const double *e, int n, double lam){
+    double *D = ws->fd, *DL = ws->fdl, *DU = ws->fdu, *DU2 = ws->fdu2;
+    for(int i=0;i<n;i++){ D[i] = d[i] - lam; ws->ipiv[i] = i; }
+    for(int i=0;i<n-1;i++){ DL[i] = e[i]; DU[i] = e[i]; DU2[i] = 0; }
+    for(int i=0;i<n-1;i++){
+        if(fabs(D[i]) >= fabs(DL[i])){
+            if(D[i] != 0){
+                double f = DL[i] / D[i];
+                DL[i] = f;
+                D[i+1] -= f * DU[i];
+            }
+        } else {
+            double f = D[i] / DL[i];
+            D[i] = DL[i];
+            DL[i] = f;
+            double t = DU[i];
+            DU[i] = D[i+1];
+            D[i+1] = t - f * D[i+1];
+            if(i < n-2){
+                DU2[i] = DU[i+1];
+                DU[i+1] = -f * DU[i+1];
+            }
+            ws->ipiv[i] = i + 1;
+        }
+    }
+}
+
+static void tri_solve(const wm_ws *ws, int n, double *x, double tiny){
+    const double *D = ws->fd, *DL = ws->fdl, *DU = ws->fdu, *DU2 = ws->fdu2;
+    for(int i=0;i<n-1;i++){
+        if(ws->ipiv[i] == i) x[i+1] -= DL[i] * x[i];
+        else { double t = x[i]; x[i] = x[i+1]; x[i+1] = t - DL[i] * x[i]; }
+    }
+    for(int i=n-1;i>=0;i--){
+        double s = x[i];
+        if(i + 1 < n) s -= DU[i] * x[i+1];
+        if(i + 2 < n) s -= DU2[i] * x[i+2];
+        double piv = D[i];
+        if(fabs(piv) < tiny) piv = piv < 0 ? -tiny : tiny;   // 特征值处 T-λI 奇异，用 eps·‖T‖ 代替零主元
+        x[i] = s / piv;
+    }
+}
+
+static void normalize(double *x, int n){
+    double s = 0;
+    for(int i=0;i<n;i++) s += x[i] * x[i];
+    s = s > 0 ? 1.0 / sqrt(s) : 0;
+    for(int i=0;i<n;i++) x[i] *= s;
+}
+
+/* 逆迭代求三对角特征向量（同 LAPACK dstein 的思路）：相近特征值归为一簇，簇内做 Gram-Schmidt */
+static void tri_eigenvectors(wm_ws *ws, const double *d, const double *e, int n, int k,
+                             double *lam, double tnorm, double *y){
+    double ortol = 1e-3 * tnorm, tiny = DBL_EPSILON * tnorm;
+    if(tiny == 0) tiny = DBL_MIN;
+    uint64_t rng = 0x9e3779b97f4a7c15ULL;
+    int c0 = 0;
+    double prev = 0;
+    for(int j=0;j<k;j++){
+        double l = lam[j];
+        if(j > 0){
+            if(lam[j-1] - lam[j] > ortol) c0 = j;
+            else if(prev - l < 10 * DBL_EPSILON * fabs(l) + tiny) l = prev - 10 * DBL_EPSILON * fabs(l) - tiny;
+        }
+        prev = l;
+        double *x = y + (size_t)j * n;
+        for(int i=0;i<n;i++){
+            rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17;
+            x[i] = (double)(rng >> 11) / 9007199254740992.0 - 0.5;
+        }
+        tri_factor(ws, d, e, n, l);
+        for(int it=0;it<3;it++){
+            tri_solve(ws, n, x, tiny);
+            for(int c=c0;c<j;c++){
+                const double *q = y + (size_t)c * n;
+                double dot = 0;
+                for(int i=0;i<n;i++) dot += q[i] * x[i];
+                for(int i=0;i<n;i++) x[i] -= dot * q[i];
+            }
+            normalize(x, n);
+        }
+    }
+}
+
+/* x ← Q x，Q = H_0 … H_{n-3}（先作用 H_{n-3}） */
+static void back_transform(const double *hv, const double *beta, int n, double *x){
+    for(int k=n-3;k>=0;k--){
+        if(beta[k] == 0) continue;
+        const double *v = hv + (size_t)k * n;
+        double t = 0;
+        for(int i=k+1;i<n;i++) t += v[i] * x[i];
+        t *= beta[k];
+        for(int i=k+1;i<n;i++) x[i] -= t * v[i];
+    }
+}
+
+int wm_svd_topk(const double *a, int m, int n, int k, double *s, double *u, double *vt, wm_ws *ws){
+    if(m < 1 || n < 2 || m > NMAX || n > NMAX || k < 1 || k > n) return -1;
+    double tnorm;
+    gram(a, m, n, ws->g);
+    tridiag(ws->g, n, ws->d, ws->e, ws->hv, ws->beta, ws->p);
+    top_eigenvalues(ws->d, ws->e, ws->e2, n, k, ws->lam, &tnorm);
+    for(int j=0;j<k;j++) s[j] = ws->lam[j] > 0 ? sqrt(ws->lam[j]) : 0;
+    if(!u && !vt) return 0;
+
+    double *v = vt ? vt : ws->y;
+    tri_eigenvectors(ws, ws->d, ws->e, n, k, ws->lam, tnorm, v);
+    for(int j=0;j<k;j++) back_transform(ws->hv, ws->beta, n, v + (size_t)j * n);
+    if(!u) return 0;
+
+    // U_k = A V_k diag(1/σ)
+    double stol = (s[0] > 0 ? s[0] : 1) * n * DBL_EPSILON;
+    for(int r=0;r<m;r++){
+        const double *ar = a + (size_t)r * n;
+        for(int j=0;j<k;j++){
+            const double *vj = v + (size_t)j * n;
+            double t = 0;
+            for(int i=0;i<n;i++) t += ar[i] * vj[i];
+            u[(size_t)r*k + j] = s[j] > stol ? t / s[j] : 0;
+        }
+    }
+    // 零奇异值：用单位向量与已有列正交化补齐
+    int cand = 0;
+    for(int j=0;j<k && j<m;j++){
+        if(s[j] > stol) continue;
+        for(; cand < m; cand++){
+            double *col = ws->p;
+            for(int r=0;r<m;r++) col[r] = r == cand;
+            for(int pass=0;pass<2;pass++)
+                for(int c=0;c<k;c++){
+                    if(c == j || (s[c] <= stol && c > j)) continue;
+                    double dot = 0;
+                    for(int r=0;r<m;r++) dot += u[(size_t)r*k + c] * col[r];
+                    for(int r=0;r<m;r++) col[r] -= dot * u[(size_t)r*k + c];
+                }
+            double nn = 0;
+            for(int r=0;r<m;r++) nn += col[r] * col[r];
+            if(nn > 0.25){
+                nn = 1.0 / sqrt(nn);
+                for(int r=0;r<m;r++) u[(size_t)r*k + j] = col[r] * nn;
+                cand++;
+                break;
+            }
+        }
+    }
+    return 0;
+}
+
+/* ---------------- 嵌入 / 提取 ---------------- */
+
+int wm_mark_prepare(const uint8_t *mark, double *sw, double *uw, double *vw, wm_ws *ws){
+    double *a = ws->ll;
+    for(size_t i=0;i<(size_t)WM_MARK*WM_MARK;i++) a[i] = mark[i];
+    return wm_svd_topk(a, WM_MARK, WM_MARK, WM_MARK, sw, uw, vw, ws);
+}
+
+void wm_embed(uint8_t *img, const double *sw, double alpha, double *s_orig, wm_ws *ws){
+    wm_haar_fwd(img, ws->ll, ws->lh, ws->hl, ws->hh);
+    wm_svd_topk(ws->ll, WM_LL, WM_LL, WM_K, s_orig, ws->u, ws->y, ws);
+    // LL' = U diag(S + alpha·Sw) Vᵀ = LL + U_k diag(alpha·Sw) V_kᵀ
+    double c[WM_K];
+    for(int j=0;j<WM_K;j++) c[j] = alpha * sw[j];
+    for(int r=0;r<WM_LL;r++){
+        double *row = ws->ll + (size_t)r * WM_LL;
+        for(int j=0;j<WM_K;j++){
+            double f = ws->u[(size_t)r*WM_K + j] * c[j];
+            const double *vj = ws->y + (size_t)j * WM_LL;
+            for(int i=0;i<WM_LL;i++) row[i] += f * vj[i];
+        }
+    }
+    wm_haar_inv(ws->ll, ws->lh, ws->hl, ws->hh, img);
+}
+
+void wm_extract(const uint8_t *img, const double *s_orig, const double *uw, const double *vw,
+                double alpha, uint8_t *mark, wm_ws *ws){
+    double s[WM_K], c[WM_K];
+    wm_haar_fwd(img, ws->ll, ws->lh, ws->hl, ws->hh);
+    wm_svd_topk(ws->ll, WM_LL, WM_LL, WM_K, s, NULL, NULL, ws);
+    for(int j=0;j<WM_K;j++) c[j] = (s[j] - s_orig[j]) / alpha;
+    double *row = ws->p;
+    for(int r=0;r<WM_MARK;r++){
+        memset(row, 0, WM_MARK * sizeof(double));
+        for(int j=0;j<WM_K;j++){
+            double f = uw[(size_t)r*WM_MARK + j] * c[j];
+            const double *vj = vw + (size_t)j * WM_MARK;
+            for(int i=0;i<WM_MARK;i++) row[i] += f * vj[i];
+        }
+        for(int i=0;i<WM_MARK;i++) mark[(size_t)r*WM_MARK + i] = clip_u8(row[i]);
+    }
+}
@@ -0,0 +1,53 @@
+// wm_core.h
+#ifndef WM_CORE_H
+#define WM_CORE_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  DWT-SVD 水印核心（C 实现），算法与 embed_watermark.py / extract_watermark.py 相同：
+    主图 512×512 → 一级 Haar → LL (256×256) 的 SVD，S' = S + alpha·Sw（前 128 个），重构后逆 Haar；
+    提取：S_w' = (S_emb - S_orig) / alpha，水印 = Uw·diag(S_w')·Vw。
+  与 Python 版的差别只在实现方式：
+    - Haar 用整数 lifting（AVX2 maddubs 一次得到相邻像素的和与差），逆变换同样向量化；
+    - SVD 只求前 k 个奇异三元组：Gram 矩阵 AᵀA → Householder 三对角化 → Sturm 二分求前 k 个特征值
+      → 三对角逆迭代求对应特征向量 → 回代；U 只算前 k 列。嵌入只需要 LL + alpha·U_k diag(Sw) V_kᵀ，
+      提取只需要前 128 个奇异值（不求向量）。
+  所有缓冲区放在 wm_ws 中，每个线程一份，跨图像复用。
+*/
+
+#define WM_IMG  512     // 主图统一缩放到 512×512
+#define WM_LL   256     // 一级 Haar 后 LL 子带边长
+#define WM_MARK 128     // 水印缩放到 128×128
+#define WM_K    128     // 嵌入 / 提取使用的奇异值个数
+
+typedef struct wm_ws wm_ws;
+
+wm_ws *wm_ws_new(void);
+void   wm_ws_free(wm_ws *ws);
+
+/* Haar：img 为 WM_IMG×WM_IMG，四个子带各 WM_LL×WM_LL（LL 为 (a+b+c+d)/2，与 pywt 'haar' 相同） */
+void wm_haar_fwd(const uint8_t *img, double *ll, double *lh, double *hl, double *hh);
+/* 逆变换，结果截断到 [0,255]（与 np.uint8(np.clip(x, 0, 255)) 相同） */
+void wm_haar_inv(const double *ll, const double *lh, const double *hl, const double *hh, uint8_t *img);
+/* 1 = 使用 AVX2 路径 */
+int  wm_haar_simd(void);
+
+/*
+  截断 SVD：a 为 m×n 行主序（m, n ≤ WM_LL），只求前 k 个奇异三元组，奇异值降序。
+  u 为 m×k 行主序（第 j 列是左奇异向量），vt 为 k×n（第 j 行是右奇异向量，即 numpy 的 Vh）；
+  u / vt 可为 NULL。奇异值为 0 的左向量用 Gram-Schmidt 补成正交基。返回 -1 表示参数超出范围。
+*/
+int  wm_svd_topk(const double *a, int m, int n, int k, double *s, double *u, double *vt, wm_ws *ws);
+
+/* 水印分解（每批一次）：mark 为 WM_MARK×WM_MARK；sw[WM_MARK]，uw / vw 为 WM_MARK×WM_MARK */
+int  wm_mark_prepare(const uint8_t *mark, double *sw, double *uw, double *vw, wm_ws *ws);
+
+/* img 为 WM_IMG×WM_IMG，原地写入含水印图；s_orig[WM_K] 输出 LL 的前 WM_K 个奇异值 */
+void wm_embed(uint8_t *img, const double *sw, double alpha, double *s_orig, wm_ws *ws);
+
+/* 从 WM_IMG×WM_IMG 图中提取 WM_MARK×WM_MARK 水印 */
+void wm_extract(const uint8_t *img, const double *s_orig, const double *uw, const double *vw,
+                double alpha, uint8_t *mark, wm_ws *ws);
+
+#endif
@@ -0,0 +1,188 @@
+// wm_io.c
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <png.h>
+#include "wm_io.h"
+
+int wm_png_read_gray(const char *path, uint8_t **buf, size_t *cap, int *w, int *h){
+    FILE *fp = fopen(path, "rb");
+    if(!fp) return -1;
+    png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_infop info = png ? png_create_info_struct(png) : NULL;
+    png_bytep *volatile rows = NULL;
+    if(!png || !info || setjmp(png_jmpbuf(png))){
+        png_destroy_read_struct(&png, &info, NULL);
+        free(rows);
+        fclose(fp);
+        return -1;
+    }
+    png_init_io(png, fp);
+    png_read_info(png, info);
+    int ct = png_get_color_type(png, info), bd = png_get_bit_depth(png, info);
+    if(bd == 16) png_set_strip_16(png);
+    if(ct == PNG_COLOR_TYPE_PALETTE) png_set_palette_to_rgb(png);
+    if(ct == PNG_COLOR_TYPE_GRAY && bd < 8) png_set_expand_gray_1_2_4_to_8(png);
+    if(ct & PNG_COLOR_MASK_ALPHA) png_set_strip_alpha(png);
+    if(ct == PNG_COLOR_TYPE_PALETTE || (ct & PNG_COLOR_MASK_COLOR)) png_set_rgb_to_gray(png, 1, 0.299, 0.587);
+    png_set_interlace_handling(png);
+    png_read_update_info(png, info);
+
+    int W = (int)png_get_image_width(png, info), H = (int)png_get_image_height(png, info);
+    if(png_get_rowbytes(png, info) != (size_t)W) png_error(png, "unexpected row layout");
+    size_t need = (size_t)W * H;
+    if(need > *cap){
+        uint8_t *nb = realloc(*buf, need);
+        if(!nb) png_error(png, "out of memory");
+        *buf = nb;
+        *cap = need;
+    }
+    rows = malloc(sizeof(png_bytep) * (size_t)H);
+    if(!rows) png_error(png, "out of memory");
+    for(int y=0;y<H;y++) rows[y] = *buf + (size_t)y * W;
+    png_read_image(png, rows);
+    png_read_end(png, NULL);
+    png_destroy_read_struct(&png, &info, NULL);
+    free(rows);
+    fclose(fp);
+    *w = W; *h = H;
+    return 0;
+}
+
+int wm_png_write_gray(const char *path, const uint8_t *img, int w, int h){
+    FILE *fp = fopen(path, "wb");
+    if(!fp) return -1;
+    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+    png_infop info = png ? png_create_info_struct(png) : NULL;
+    if(!png || !info || setjmp(png_jmpbuf(png))){
+        png_destroy_write_struct(&png, &info);
+        fclose(fp);
+        return -1;
+    }
+    png_init_io(png, fp);
+    png_set_IHDR(png, info, (png_uint_32)w, (png_uint_32)h, 8, PNG_COLOR_TYPE_GRAY,
+                 PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    png_write_info(png, info);
+    for(int y=0;y<h;y++) png_write_row(png, (png_const_bytep)(img + (size_t)y * w));
+    png_write_end(png, NULL);
+    png_destroy_write_struct(&png, &info);
+    return fclose(fp) == 0 ? 0 : -1;
+}
+
+/* cv2 INTER_LINEAR 的坐标与系数：fx = (d+0.5)·scale - 0.5，越界时钳到边缘且系数取 0 */
+#define COEF_BITS 11
+#define COEF_SCALE (1 << COEF_BITS)
+
+static void linear_coeffs(int ssize, int dsize, int *ofs, short *a){
+    double scale = (double)ssize / dsize;
+    for(int d=0; d<dsize; d++){
+        float f = (float)((d + 0.5) * scale - 0.5);
+        int s = (int)floorf(f);
+        f -= s;
+        if(s < 0){ f = 0; s = 0; }
+        if(s >= ssize - 1){ f = 0; s = ssize - 1; }
+        ofs[d] = s;
+        a[2*d] = (short)lrintf((1.f - f) * COEF_SCALE);
+        a[2*d+1] = (short)(COEF_SCALE - a[2*d]);
+    }
+}
+
+static void hresize(const uint8_t *row, int sw, const int *xofs, const short *alpha, int dw, int *out){
+    for(int x=0;x<dw;x++){
+        int s = xofs[x];
+        out[x] = row[s] * alpha[2*x] + (s + 1 < sw ? row[s+1] * alpha[2*x+1] : 0);
+    }
+}
+
+void wm_resize_linear(const uint8_t *src, int sw, int sh, uint8_t *dst, int dw, int dh){
+    if(sw == dw && sh == dh){           // cv2.resize 同尺寸时直接复制
+        memcpy(dst, src, (size_t)sw * sh);
+        return;
+    }
+    int *xofs = malloc(sizeof(int) * (size_t)dw), *yofs = malloc(sizeof(int) * (size_t)dh);
+    short *xa = malloc(sizeof(short) * 2 * (size_t)dw), *ya = malloc(sizeof(short) * 2 * (size_t)dh);
+    int *r0 = malloc(sizeof(int) * (size_t)dw), *r1 = malloc(sizeof(int) * (size_t)dw);
+    if(!xofs || !yofs || !xa || !ya || !r0 || !r1){
+        memset(dst, 0, (size_t)dw * dh);
+        goto out;
+    }
+    linear_coeffs(sw, dw, xofs, xa);
+    linear_coeffs(sh, dh, yofs, ya);
+    int have0 = -1, have1 = -1;
+    for(int y=0;y<dh;y++){
+        int s0 = yofs[y], s1 = s0 + 1 < sh ? s0 + 1 : sh - 1;
+        // 复用上一行已做过横向插值的源行
+        if(have1 == s0){ int *t = r0; r0 = r1; r1 = t; have0 = s0; have1 = -1; }
+        if(have0 != s0){ hresize(src + (size_t)s0 * sw, sw, xofs, xa, dw, r0); have0 = s0; }
+        if(have1 != s1){ hresize(src + (size_t)s1 * sw, sw, xofs, xa, dw, r1); have1 = s1; }
+        int b0 = ya[2*y], b1 = ya[2*y+1];
+        uint8_t *d = dst + (size_t)y * dw;
+        for(int x=0;x<dw;x++){
+            // 与 OpenCV VResizeLinearVec_32s8u 相同：(((S0>>4)·b0)>>16 + ((S1>>4)·b1)>>16 + 2) >> 2
+            int v = (((r0[x] >> 4) * b0) >> 16) + (((r1[x] >> 4) * b1) >> 16);
+            v = (v + 2) >> 2;
+            d[x] = (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+        }
+    }
+out:
+    free(xofs); free(yofs); free(xa); free(ya); free(r0); free(r1);
+}
+
+/* ---------------- .npy ---------------- */
+
+int wm_npy_write(const char *path, const double *a, size_t rows, size_t cols){
+    char hdr[128];
+    int n = cols ? snprintf(hdr, sizeof(hdr), "{'descr': '<f8', 'fortran_order': False, 'shape': (%zu, %zu), }", rows, cols)
+                 : snprintf(hdr, sizeof(hdr), "{'descr': '<f8', 'fortran_order': False, 'shape': (%zu,), }", rows);
+    int total = (10 + n + 1 + 63) / 64 * 64;    // 魔数 + 版本 + 长度 + 头 + '\n'，补齐到 64 字节
+    int pad = total - 10 - n - 1;
+    FILE *fp = fopen(path, "wb");
+    if(!fp) return -1;
+    unsigned hl = (unsigned)(total - 10);
+    fwrite("\x93NUMPY\x01\x00", 1, 8, fp);
+    fputc((int)(hl & 0xff), fp); fputc((int)(hl >> 8), fp);
+    fwrite(hdr, 1, (size_t)n, fp);
+    for(int i=0;i<pad;i++) fputc(' ', fp);
+    fputc('\n', fp);
+    size_t cnt = rows * (cols ? cols : 1);
+    size_t wr = fwrite(a, sizeof(double), cnt, fp);    // x86 小端，直接写
+    return fclose(fp) == 0 && wr == cnt ? 0 : -1;
+}
+
+long wm_npy_read(const char *path, double *a, size_t max){
+    FILE *fp = fopen(path, "rb");
+    if(!fp) return -1;
+    unsigned char pre[12];
+    long ret = -1;
+    char *hdr = NULL;
+    if(fread(pre, 1, 10, fp) != 10 || memcmp(pre, "\x93NUMPY", 6) != 0) goto out;
+    size_t hl = pre[8] | (size_t)pre[9] << 8;
+    if(pre[6] >= 2){                             // 2.0 版头长 4 字节
+        if(fread(pre + 10, 1, 2, fp) != 2) goto out;
+        hl |= (size_t)pre[10] << 16 | (size_t)pre[11] << 24;
+    }
+    hdr = malloc(hl + 1);
+    if(!hdr || fread(hdr, 1, hl, fp) != hl) goto out;
+    hdr[hl] = 0;
+    if(!strstr(hdr, "'<f8'") || !strstr(hdr, "'fortran_order': False")) goto out;
+    char *sh = strstr(hdr, "'shape': (");
+    if(!sh) goto out;
+    sh += 10;
+    size_t cnt = 1;
+    while(*sh && *sh != ')'){
+        char *end;
+        unsigned long long v = strtoull(sh, &end, 10);
+        if(end == sh) break;
+        cnt *= (size_t)v;
+        sh = end;
+        while(*sh == ',' || *sh == ' ') sh++;
+    }
+    size_t want = cnt < max ? cnt : max;
+    if(fread(a, sizeof(double), want, fp) != want) goto out;
+    ret = (long)want;
+out:
+    free(hdr);
+    fclose(fp);
+    return ret;
+}
@@ -0,0 +1,23 @@
+// wm_io.h
+#ifndef WM_IO_H
+#define WM_IO_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  图像与辅助文件读写：
+    - PNG 读入为 8 位灰度（libpng；彩色图用 png_set_rgb_to_gray(0.299, 0.587)，与 OpenCV 的 PNG 解码一致），
+      *buf / *cap 为可增长缓冲区，跨图像复用；
+    - 双线性缩放按 cv2.resize(INTER_LINEAR) 的 8 位定点公式（11 位系数，纵向 mulhi 组合）；
+    - .npy 读写（<f8，C 顺序），与 embed_watermark.py 保存的 original_S.npy / Uw.npy / Vw.npy 互通。
+*/
+
+int  wm_png_read_gray(const char *path, uint8_t **buf, size_t *cap, int *w, int *h);
+int  wm_png_write_gray(const char *path, const uint8_t *img, int w, int h);
+void wm_resize_linear(const uint8_t *src, int sw, int sh, uint8_t *dst, int dw, int dh);
+
+int  wm_npy_write(const char *path, const double *a, size_t rows, size_t cols);   // cols = 0 表示一维
+/* 读取最多 max 个元素，返回实际元素个数，出错返回 -1 */
+long wm_npy_read(const char *path, double *a, size_t max);
+
+#endif
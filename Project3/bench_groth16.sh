@@ -0,0 +1,72 @@
+#!/usr/bin/env bash
+# bench_groth16.sh -- constraint counts and Groth16 proving time for each Poseidon2 circuit variant.
+# Needs circom (>= 2.2) and snarkjs on PATH; circuits come from gen_poseidon2_circom.py.
+# Usage: ./bench_groth16.sh [reps=5] [O-level=1]   (run from Project3; writes groth16_bench.csv)
+#   O-level 1 keeps the linear constraints of the naive variants, 2 lets circom fold them.
+set -euo pipefail
+
+REPS=${1:-5}
+OLEVEL=${2:-1}
+OUT=build_bench
+CSV=groth16_bench.csv
+mkdir -p "$OUT"
+
+python3 gen_poseidon2_circom.py > /dev/null
+
+now_ms() { date +%s%3N; }
+
+# 一次性 Powers of Tau（BLS12-381，2^11 足够容纳最大的对照电路）
+PTAU="$OUT/pot11_final.ptau"
+if [ ! -f "$PTAU" ]; then
+    snarkjs powersoftau new bls12381 11 "$OUT/pot11_0000.ptau" > /dev/null
+    snarkjs powersoftau contribute "$OUT/pot11_0000.ptau" "$OUT/pot11_0001.ptau" \
+        --name=bench -e="poseidon2 bench" > /dev/null
+    snarkjs powersoftau prepare phase2 "$OUT/pot11_0001.ptau" "$PTAU" > /dev/null
+fi
+
+echo "variant,olevel,constraints,wires,setup_ms,witness_ms,prove_ms_avg,verify,matches_ref" > "$CSV"
+for src in circuits/poseidon2_t*_*.circom; do
+    name=$(basename "$src" .circom)
+    t=${name#poseidon2_t}; t=${t%%_*}
+    dir="$OUT/$name"
+    mkdir -p "$dir"
+    circom "$src" --r1cs --wasm --prime bls12381 --O"$OLEVEL" -o "$dir" > /dev/null
+    info=$(snarkjs r1cs info "$dir/$name.r1cs")
+    cons=$(echo "$info" | sed -n 's/.*# of Constraints: *\([0-9]*\).*/\1/p')
+    wires=$(echo "$info" | sed -n 's/.*# of Wires: *\([0-9]*\).*/\1/p')
+
+    t0=$(now_ms)
+    snarkjs groth16 setup "$dir/$name.r1cs" "$PTAU" "$dir/${name}_0000.zkey" > /dev/null
+    snarkjs zkey contribute "$dir/${name}_0000.zkey" "$dir/$name.zkey" --name=bench -e="bench" > /dev/null
+    snarkjs zkey export verificationkey "$dir/$name.zkey" "$dir/vk.json" > /dev/null
+    t1=$(now_ms)
+
+    # 随机输入；期望输出取自 poseidon2_ref.py（perm(in)[0]）
+    read -r input expect < <(python3 - "$t" <<'EOF'
+import json, random, sys
+from poseidon2_ref import load_params, permute
+t = int(sys.argv[1]); P = load_params(t)
+x = [random.randrange(P["p"]) for _ in range(t)]
+print(json.dumps({"in": [str(v) for v in x]}).replace(" ", ""), permute(x, P)[0])
+EOF
+)
+    echo "$input" > "$dir/input.json"
+    t2=$(now_ms)
+    node "$dir/${name}_js/generate_witness.js" "$dir/${name}_js/$name.wasm" "$dir/input.json" "$dir/witness.wtns"
+    t3=$(now_ms)
+
+    total=0
+    for _ in $(seq "$REPS"); do
+        a=$(now_ms)
+        snarkjs groth16 prove "$dir/$name.zkey" "$dir/witness.wtns" "$dir/proof.json" "$dir/public.json"
+        b=$(now_ms)
+        total=$((total + b - a))
+    done
+    verify=FAIL
+    snarkjs groth16 verify "$dir/vk.json" "$dir/public.json" "$dir/proof.json" | grep -q "OK" && verify=OK
+    match=FAIL
+    [ "$(python3 -c 'import json,sys; print(json.load(open(sys.argv[1]))[0])' "$dir/public.json")" = "$expect" ] && match=OK
+
+    echo "$name,O$OLEVEL,$cons,$wires,$((t1 - t0)),$((t3 - t2)),$((total / REPS)),$verify,$match" | tee -a "$CSV"
+done
+echo "✓ Wrote $CSV"
@@ -0,0 +1,6 @@
+pragma circom 2.2.2;
+// 深度 20（约 100 万叶子）的 Merkle 路径验证电路，root 为公开输入；编译时加 --prime bls12381
+
+include "../poseidon2_merkle.circom";
+
+component main {public [root]} = Poseidon2MerkleVerify(20);
@@ -0,0 +1,7 @@
+pragma circom 2.2.2;
+// generated by gen_poseidon2_circom.py from poseidon2_t2.json / poseidon2_t3.json, do not edit
+// 域为 BLS12-381 标量域：circom --prime bls12381
+
+include "../poseidon2_perm.circom";
+
+component main = Poseidon2HashNaive_t2();
@@ -0,0 +1,334 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Emit the Poseidon2 circom templates straight from poseidon2_t2.json / poseidon2_t3.json.
+
+Written files:
+  poseidon2_perm.circom             templates for t in {2,3}:
+                                      Poseidon2Perm_t{t}       optimized: linear layers stay linear combinations
+                                                               (circom vars), only the x^5 S-boxes create constraints
+                                      Poseidon2PermNaive_t{t}  every linear layer / round-constant addition is a signal
+                                      Poseidon2Hash_t{t}       wrapper: out = Perm(in)[0]
+  poseidon2.circom                  main = Poseidon2Hash_t3 (same interface as before: in[3] private, out public)
+  circuits/poseidon2_t{t}_{opt,naive}.circom   one main per variant, used by bench_groth16.sh
+
+Round structure follows poseidon2_ref.py: ME, RF/2 external rounds, RP internal rounds (constant and S-box
+on state[0] only), RF/2 external rounds. ME / MI are J + diag(mu - 1), so M*x = sum(x) + (mu_i - 1)*x_i.
+
+The same construction is replayed here on a small R1CS model (one linear combination per circom
+expression) to report exact constraint counts and to check the constraint system against
+poseidon2_ref.py on random inputs before anything is compiled.
+
+Usage: python3 gen_poseidon2_circom.py  (run from Project3)
+"""
+
+import os
+import random
+
+from poseidon2_ref import load_params, permute
+
+INSTANCES = (2, 3)
+
+# ---------------- R1CS model ----------------
+# A linear combination is {signal_index: coeff}, index 0 is the constant 1.
+
+class R1CS:
+    def __init__(self, p):
+        self.p = p
+        self.w = [1]            # witness, w[0] = 1
+        self.cons = []          # (A, B, C): <A,w> * <B,w> = <C,w>
+
+    def new_signal(self, value):
+        self.w.append(value % self.p)
+        return {len(self.w) - 1: 1}
+
+    def ev(self, lc):
+        return sum(c * self.w[i] for i, c in lc.items()) % self.p
+
+    def lc_add(self, a, b, kb=1):
+        r = dict(a)
+        for i, c in b.items():
+            r[i] = (r.get(i, 0) + kb * c) % self.p
+        return {i: c for i, c in r.items() if c}
+
+    def const(self, c):
+        return {0: c % self.p} if c % self.p else {}
+
+    def mul(self, a, b):            # x <== a * b
+        x = self.new_signal(self.ev(a) * self.ev(b))
+        self.cons.append((a, b, x))
+        return x
+
+    def bind(self, a):              # x <== a  (linear constraint)
+        x = self.new_signal(self.ev(a))
+        self.cons.append((self.const(1), a, x))
+        return x
+
+    def check(self):
+        return all(self.ev(A) * self.ev(B) % self.p == self.ev(C) for A, B, C in self.cons)
+
+def model_neptune(cs, s, diag, naive):
+    acc = {}
+    for x in s:
+        acc = cs.lc_add(acc, x)
+    s = [cs.lc_add(acc, x, d) for x, d in zip(s, diag)]
+    return [cs.bind(x) for x in s] if naive else s
+
+def model_sbox(cs, a, naive):
+    if naive:                       # Pow5 component: in <== a; x2, x4, out
+        a = cs.bind(a)
+    x2 = cs.mul(a, a)
+    x4 = cs.mul(x2, x2)
+    return cs.mul(x4, a)
+
+def model_perm(P, inputs, naive):
+    """Build the circuit exactly as the emitted template does; returns (cs, outputs)."""
+    p = P["p"]
+    rf, rp, t = P["RF"], P["RP"], P["t"]
+    me = [P["matrix_ME"][i][i] - 1 for i in range(t)]
+    mi = [P["matrix_MI"][i][i] - 1 for i in range(t)]
+    cs = R1CS(p)
+    s = [cs.new_signal(v) for v in inputs]
+    s = model_neptune(cs, s, me, naive)
+    for r in range(rf):
+        if r == rf // 2:
+            for c in P["round_constants_internal_c0"]:
+                a = cs.lc_add(s[0], cs.const(c))
+                if naive:
+                    a = cs.bind(a)
+                s[0] = model_sbox(cs, a, naive)
+                s = model_neptune(cs, s, mi, naive)
+        for i in range(t):
+            a = cs.lc_add(s[i], cs.const(P["round_constants_external"][r][i]))
+            if naive:
+                a = cs.bind(a)
+            s[i] = model_sbox(cs, a, naive)
+        s = model_neptune(cs, s, me, naive)
+    out = [cs.bind(x) for x in s]   # out[i] <== s[i]
+    return cs, [cs.ev(x) for x in out]
+
+def stats(cs):
+    nonlin = sum(1 for A, B, C in cs.cons if not (len(A) == 1 and 0 in A))
+    nnz = sum(len(A) + len(B) + len(C) for A, B, C in cs.cons)
+    return {"constraints": len(cs.cons), "nonlinear": nonlin, "linear": len(cs.cons) - nonlin,
+            "wires": len(cs.w), "nnz": nnz}
+
+# ---------------- circom emission ----------------
+
+def circom_array(values):
+    return "[" + ", ".join(str(v) for v in values) + "]"
+
+def emit_consts(P, indent):
+    t = P["t"]
+    ext = ",\n".join(indent + "    " + circom_array(r) for r in P["round_constants_external"])
+    inn = ",\n".join(indent + "    " + str(c) for c in P["round_constants_internal_c0"])
+    me = [P["matrix_ME"][i][i] - 1 for i in range(t)]
+    mi = [P["matrix_MI"][i][i] - 1 for i in range(t)]
+    return [
+        f"{indent}var RC_EXT[{P['RF']}][{t}] = [\n{ext}\n{indent}];",
+        f"{indent}var RC_INT[{P['RP']}] = [\n{inn}\n{indent}];",
+        f"{indent}var ME_DIAG[{t}] = {circom_array(me)};   // ME[i][i] - 1",
+        f"{indent}var MI_DIAG[{t}] = {circom_array(mi)};   // MI[i][i] - 1",
+    ]
+
+def emit_perm_opt(P):
+    t, rf, rp = P["t"], P["RF"], P["RP"]
+    n = rf * t + rp
+    L = []
+    L.append(f"// t = {t}：线性层只在 var 中累积线性组合，不单独成约束；每个 S-box 3 个乘法约束，共 {n} 个 S-box")
+    L.append(f"template Poseidon2Perm_t{t}() {{")
+    L.append(f"    signal input in[{t}];")
+    L.append(f"    signal output out[{t}];")
+    L.append("")
+    L += emit_consts(P, "    ")
+    L.append("")
+    L.append(f"    signal x2[{n}];")
+    L.append(f"    signal x4[{n}];")
+    L.append(f"    signal y[{n}];")
+    L.append("    var k = 0;")
+    L.append("    var acc;")
+    L.append(f"    var s[{t}];")
+    L.append(f"    for (var i = 0; i < {t}; i++) s[i] = in[i];")
+    L.append("")
+    L.append("    // 初始 ME：s_i = Σs + (μ_i - 1)·s_i")
+    L.append("    acc = 0;")
+    L.append(f"    for (var i = 0; i < {t}; i++) acc += s[i];")
+    L.append(f"    for (var i = 0; i < {t}; i++) s[i] = acc + ME_DIAG[i] * s[i];")
+    L.append("")
+    L.append(f"    for (var r = 0; r < {rf}; r++) {{")
+    L.append(f"        if (r == {rf // 2}) {{")
+    L.append("            // 内部轮：只有 state[0] 加常数、过 S-box；MI 同样化为求和加对角项")
+    L.append(f"            for (var j = 0; j < {rp}; j++) {{")
+    L.append("                var a = s[0] + RC_INT[j];")
+    L.append("                x2[k] <== a * a;")
+    L.append("                x4[k] <== x2[k] * x2[k];")
+    L.append("                y[k] <== x4[k] * a;")
+    L.append("                s[0] = y[k];")
+    L.append("                k++;")
+    L.append("                acc = 0;")
+    L.append(f"                for (var i = 0; i < {t}; i++) acc += s[i];")
+    L.append(f"                for (var i = 0; i < {t}; i++) s[i] = acc + MI_DIAG[i] * s[i];")
+    L.append("            }")
+    L.append("        }")
+    L.append("        // 外部轮")
+    L.append(f"        for (var i = 0; i < {t}; i++) {{")
+    L.append("            var a = s[i] + RC_EXT[r][i];")
+    L.append("            x2[k] <== a * a;")
+    L.append("            x4[k] <== x2[k] * x2[k];")
+    L.append("            y[k] <== x4[k] * a;")
+    L.append("            s[i] = y[k];")
+    L.append("            k++;")
+    L.append("        }")
+    L.append("        acc = 0;")
+    L.append(f"        for (var i = 0; i < {t}; i++) acc += s[i];")
+    L.append(f"        for (var i = 0; i < {t}; i++) s[i] = acc + ME_DIAG[i] * s[i];")
+    L.append("    }")
+    L.append("")
+    L.append(f"    for (var i = 0; i < {t}; i++) out[i] <== s[i];")
+    L.append("}")
+    return L
+
+def emit_perm_naive(P):
+    t, rf, rp = P["t"], P["RF"], P["RP"]
+    nsb = rf * t + rp
+    nst = 1 + rf + rp
+    L = []
+    L.append(f"// t = {t}，对照组：每个线性层输出、每次加常数都落成信号（与旧模板同样的写法，参数正确）")
+    L.append(f"template Poseidon2PermNaive_t{t}() {{")
+    L.append(f"    signal input in[{t}];")
+    L.append(f"    signal output out[{t}];")
+    L.append("")
+    L += emit_consts(P, "    ")
+    L.append("")
+    L.append(f"    signal st[{nst}][{t}];")
+    L.append(f"    signal ac[{nsb}];")
+    L.append(f"    component sb[{nsb}];")
+    L.append(f"    var cur[{t}];")
+    L.append("    var k = 0;")
+    L.append("    var n = 0;")
+    L.append("    var acc;")
+    L.append("")
+    L.append("    acc = 0;")
+    L.append(f"    for (var i = 0; i < {t}; i++) acc += in[i];")
+    L.append(f"    for (var i = 0; i < {t}; i++) st[0][i] <== acc + ME_DIAG[i] * in[i];")
+    L.append("")
+    L.append(f"    for (var r = 0; r < {rf}; r++) {{")
+    L.append(f"        if (r == {rf // 2}) {{")
+    L.append(f"            for (var j = 0; j < {rp}; j++) {{")
+    L.append("                ac[k] <== st[n][0] + RC_INT[j];")
+    L.append("                sb[k] = Pow5();")
+    L.append("                sb[k].in <== ac[k];")
+    L.append("                cur[0] = sb[k].out;")
+    L.append(f"                for (var i = 1; i < {t}; i++) cur[i] = st[n][i];")
+    L.append("                k++;")
+    L.append("                acc = 0;")
+    L.append(f"                for (var i = 0; i < {t}; i++) acc += cur[i];")
+    L.append(f"                for (var i = 0; i < {t}; i++) st[n + 1][i] <== acc + MI_DIAG[i] * cur[i];")
+    L.append("                n++;")
+    L.append("            }")
+    L.append("        }")
+    L.append(f"        for (var i = 0; i < {t}; i++) {{")
+    L.append("            ac[k] <== st[n][i] + RC_EXT[r][i];")
+    L.append("            sb[k] = Pow5();")
+    L.append("            sb[k].in <== ac[k];")
+    L.append("            cur[i] = sb[k].out;")
+    L.append("            k++;")
+    L.append("        }")
+    L.append("        acc = 0;")
+    L.append(f"        for (var i = 0; i < {t}; i++) acc += cur[i];")
+    L.append(f"        for (var i = 0; i < {t}; i++) st[n + 1][i] <== acc + ME_DIAG[i] * cur[i];")
+    L.append("        n++;")
+    L.append("    }")
+    L.append("")
+    L.append(f"    for (var i = 0; i < {t}; i++) out[i] <== st[n][i];")
+    L.append("}")
+    return L
+
+def emit_hash(t, perm):
+    return [
+        f"template {perm.replace('Perm', 'Hash')}() {{",
+        f"    signal input in[{t}];",
+        "    signal output out;",
+        f"    component perm = {perm}();",
+        f"    for (var i = 0; i < {t}; i++) perm.in[i] <== in[i];",
+        "    out <== perm.out[0];",
+        "}",
+    ]
+
+HEADER = "// generated by gen_poseidon2_circom.py from poseidon2_t2.json / poseidon2_t3.json, do not edit"
+
+def main_file(t, naive, include):
+    name = "Poseidon2HashNaive_t%d" % t if naive else "Poseidon2Hash_t%d" % t
+    return "\n".join([
+        "pragma circom 2.2.2;",
+        HEADER,
+        "// 域为 BLS12-381 标量域：circom --prime bls12381",
+        "",
+        f'include "{include}";',
+        "",
+        f"component main = {name}();",
+        "",
+    ])
+
+def main():
+    params = {t: load_params(t) for t in INSTANCES}
+    for P in params.values():
+        assert P["d"] == 5, "templates implement the x^5 S-box"
+        for M in (P["matrix_ME"], P["matrix_MI"]):
+            assert all(M[i][j] == 1 for i in range(P["t"]) for j in range(P["t"]) if i != j), \
+                "ME / MI must be J + diag(mu - 1)"
+
+    lib = ["pragma circom 2.2.2;", HEADER, "// 域为 BLS12-381 标量域，编译时加 --prime bls12381", ""]
+    lib += [
+        "// x^5：x2 = in², x4 = x2², out = x4·in（3 个约束）",
+        "template Pow5() {",
+        "    signal input in;",
+        "    signal output out;",
+        "    signal x2;",
+        "    signal x4;",
+        "    x2 <== in * in;",
+        "    x4 <== x2 * x2;",
+        "    out <== x4 * in;",
+        "}",
+        "",
+    ]
+    for t in INSTANCES:
+        P = params[t]
+        lib += emit_perm_opt(P) + [""] + emit_perm_naive(P) + [""]
+        lib += emit_hash(t, f"Poseidon2Perm_t{t}") + [""] + emit_hash(t, f"Poseidon2PermNaive_t{t}") + [""]
+    with open("poseidon2_perm.circom", "w", encoding="utf-8") as f:
+        f.write("\n".join(lib))
+    with open("poseidon2.circom", "w", encoding="utf-8") as f:
+        f.write(main_file(3, False, "poseidon2_perm.circom"))
+    os.makedirs("circuits", exist_ok=True)
+    for t in INSTANCES:
+        for naive in (False, True):
+            path = "circuits/poseidon2_t%d_%s.circom" % (t, "naive" if naive else "opt")
+            with open(path, "w", encoding="utf-8") as f:
+                f.write(main_file(t, naive, "../poseidon2_perm.circom"))
+    print("✓ Wrote poseidon2_perm.circom, poseidon2.circom, circuits/poseidon2_t{2,3}_{opt,naive}.circom")
+
+    # 约束统计 + 在 R1CS 模型上与 poseidon2_ref.py 比对
+    print()
+    print("%-22s %11s %9s %7s %7s %7s" % ("variant (perm only)", "constraints", "nonlinear", "linear", "wires", "nnz"))
+    rng = random.Random(1)
+    for t in INSTANCES:
+        P = params[t]
+        for naive in (False, True):
+            ok = True
+            for trial in range(3):
+                x = [rng.randrange(P["p"]) for _ in range(t)] if trial else list(range(t))
+                cs, out = model_perm(P, x, naive)
+                ok &= cs.check() and out == permute(x, P)
+            st = stats(cs)
+            print("%-22s %11d %9d %7d %7d %7d %s" % (
+                "t=%d %s" % (t, "naive" if naive else "opt"), st["constraints"], st["nonlinear"],
+                st["linear"], st["wires"], st["nnz"], "OK" if ok else "FAIL (does not match poseidon2_ref.py)"))
+            if not ok:
+                return 1
+    print("\nlinear = 未经 circom 线性化简（--O0 / --O1）时的线性约束数；--O2 会消去大部分，但会增加剩余约束的稠密度")
+    return 0
+
+if __name__ == "__main__":
+    raise SystemExit(main())
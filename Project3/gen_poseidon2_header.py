@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Bake poseidon2_t2.json / poseidon2_t3.json into poseidon2_params.h for the native engine (poseidon2.c).
+
+Emitted:
+  - field constants for 4x64-bit Montgomery arithmetic (R = 2^256): modulus, -p^-1 mod 2^64, R^2, R
+  - per instance t in {2,3}: external round constants [RF][t], internal constants [RP] (state[0] only),
+    both in Montgomery form, and the diagonals of ME / MI minus one.
+    ME and MI must be of the Neptune form produced by gen_poseidon2_params.py
+    (off-diagonal entries 1, small diagonal mu_i), so M*x = sum(x) + (mu_i - 1)*x_i.
+  - for the 8-lane AVX-512 IFMA path (poseidon2_ifma.c): the same field in radix 2^52
+    (5 limbs, Montgomery R' = 2^260) and the t=3 round constants in that form.
+
+Usage: python3 gen_poseidon2_header.py  (run from Project3, writes poseidon2_params.h)
+"""
+
+import json
+
+R = 1 << 256
+INSTANCES = (2, 3)
+
+def load(t):
+    with open(f"poseidon2_t{t}.json", encoding="utf-8") as f:
+        return json.load(f)
+
+def limbs(x):
+    return "{ " + ", ".join("0x%016xULL" % ((x >> (64 * i)) & (2**64 - 1)) for i in range(4)) + " }"
+
+def fe(x, p):
+    return "{%s}" % limbs(x * R % p)
+
+R52 = 1 << 260
+
+def limbs52(x):
+    return "{ " + ", ".join("0x%013xULL" % ((x >> (52 * i)) & (2**52 - 1)) for i in range(5)) + " }"
+
+def fe52(x, p):
+    return limbs52(x * R52 % p)
+
+def neptune_diag(M, name):
+    t = len(M)
+    for i in range(t):
+        for j in range(t):
+            if i != j and M[i][j] != 1:
+                raise ValueError(f"{name} is not of the form J + diag(mu - 1)")
+    diag = [M[i][i] - 1 for i in range(t)]
+    if any(d < 1 or d > 255 for d in diag):
+        raise ValueError(f"{name} diagonal must be small (2..256)")
+    return diag
+
+def main():
+    params = {t: load(t) for t in INSTANCES}
+    p = int(params[2]["field_modulus_hex"], 16)
+    rf, rp, d = params[2]["RF"], params[2]["RP"], params[2]["d"]
+    for t in INSTANCES:
+        P = params[t]
+        assert int(P["field_modulus_hex"], 16) == p and P["t"] == t
+        assert (P["RF"], P["RP"], P["d"]) == (rf, rp, d), "both instances must share RF/RP/d"
+        assert len(P["round_constants_external"]) == rf and all(len(r) == t for r in P["round_constants_external"])
+        assert len(P["round_constants_internal_c0"]) == rp
+    assert d == 5, "the native engine implements the x^5 S-box"
+    assert p < (1 << 255), "lazy reduction assumes a 255-bit modulus"
+
+    out = []
+    out.append("// poseidon2_params.h -- generated by gen_poseidon2_header.py from poseidon2_t2.json / poseidon2_t3.json, do not edit")
+    out.append("#ifndef POSEIDON2_PARAMS_H")
+    out.append("#define POSEIDON2_PARAMS_H")
+    out.append('#include "poseidon2.h"')
+    out.append("")
+    out.append("#define P2_RF %d" % rf)
+    out.append("#define P2_RP %d" % rp)
+    out.append("")
+    out.append("static const uint64_t P2_MOD[4]  = %s;" % limbs(p))
+    out.append("static const uint64_t P2_M0INV    = 0x%016xULL;" % ((-pow(p, -1, 1 << 64)) % (1 << 64)))
+    out.append("static const uint64_t P2_RR[4]   = %s;" % limbs(R * R % p))
+    out.append("static const uint64_t P2_ONE[4]  = %s;" % limbs(R % p))
+    for t in INSTANCES:
+        P = params[t]
+        me = neptune_diag(P["matrix_ME"], f"t={t} ME")
+        mi = neptune_diag(P["matrix_MI"], f"t={t} MI")
+        out.append("")
+        out.append("/* t = %d */" % t)
+        out.append("static const unsigned P2_T%d_ME_DIAG[%d] = { %s };   // ME[i][i] - 1" % (t, t, ", ".join(map(str, me))))
+        out.append("static const unsigned P2_T%d_MI_DIAG[%d] = { %s };   // MI[i][i] - 1" % (t, t, ", ".join(map(str, mi))))
+        out.append("static const p2_fe P2_T%d_RC_EXT[P2_RF][%d] = {" % (t, t))
+        for row in P["round_constants_external"]:
+            out.append("  { %s }," % ", ".join(fe(c, p) for c in row))
+        out.append("};")
+        out.append("static const p2_fe P2_T%d_RC_INT[P2_RP] = {" % t)
+        for c in P["round_constants_internal_c0"]:
+            out.append("  %s," % fe(c, p))
+        out.append("};")
+    out.append("")
+    out.append("/* radix 2^52，R' = 2^260（poseidon2_ifma.c） */")
+    out.append("static const uint64_t P2_MOD52[5]  = %s;" % limbs52(p))
+    out.append("static const uint64_t P2_M0INV52   = 0x%013xULL;" % ((-pow(p, -1, 1 << 52)) % (1 << 52)))
+    out.append("static const uint64_t P2_TO52[5]   = %s;   // 2^264 mod p: x*2^256 -> x*2^260" % limbs52((1 << 264) % p))
+    out.append("static const uint64_t P2_FROM52[5] = %s;   // 2^256 mod p: x*2^260 -> x*2^256" % limbs52(R % p))
+    P = params[3]
+    out.append("static const uint64_t P2_T3_RC_EXT52[P2_RF][3][5] = {")
+    for row in P["round_constants_external"]:
+        out.append("  { %s }," % ", ".join(fe52(c, p) for c in row))
+    out.append("};")
+    out.append("static const uint64_t P2_T3_RC_INT52[P2_RP][5] = {")
+    for c in P["round_constants_internal_c0"]:
+        out.append("  %s," % fe52(c, p))
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    with open("poseidon2_params.h", "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+    print("✓ Wrote poseidon2_params.h")
+
+if __name__ == "__main__":
+    main()
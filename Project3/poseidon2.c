@@ -0,0 +1,172 @@
+// poseidon2.c
+#include <string.h>
+#include "poseidon2.h"
+#include "poseidon2_params.h"
+
+typedef unsigned __int128 u128;
+
+#define P2_INLINE static inline __attribute__((always_inline))
+
+/* ---------------- Montgomery 运算（R = 2^256） ----------------
+   p < 2^255 且最高字 < 2^63 - 1：CIOS 中间结果不会溢出 4 个字（"no-carry" 优化），
+   加法和也小于 2^256，只需一次条件减。 */
+
+P2_INLINE void fe_reduce_once(uint64_t r[4], const uint64_t t[4]){
+    uint64_t s[4], bw = 0;
+    for(int j=0;j<4;j++){
+        u128 x = (u128)t[j] - P2_MOD[j] - bw;
+        s[j] = (uint64_t)x; bw = (uint64_t)(x >> 64) & 1;
+    }
+    uint64_t keep = -bw;            // t < p 时保留 t
+    for(int j=0;j<4;j++) r[j] = (t[j] & keep) | (s[j] & ~keep);
+}
+
+P2_INLINE void fe_mul(p2_fe *r, const p2_fe *a, const p2_fe *b){
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0;
+#pragma GCC unroll 4
+    for(int i=0;i<4;i++){
+        u128 A, C;
+        uint64_t bi = b->v[i], m;
+        A = (u128)a->v[0]*bi + t0;               t0 = (uint64_t)A;
+        m = t0 * P2_M0INV;
+        C = (u128)m*P2_MOD[0] + t0;
+        A = (u128)a->v[1]*bi + t1 + (A >> 64);   t1 = (uint64_t)A;
+        C = (u128)m*P2_MOD[1] + t1 + (C >> 64);  t0 = (uint64_t)C;
+        A = (u128)a->v[2]*bi + t2 + (A >> 64);   t2 = (uint64_t)A;
+        C = (u128)m*P2_MOD[2] + t2 + (C >> 64);  t1 = (uint64_t)C;
+        A = (u128)a->v[3]*bi + t3 + (A >> 64);   t3 = (uint64_t)A;
+        C = (u128)m*P2_MOD[3] + t3 + (C >> 64);  t2 = (uint64_t)C;
+        t3 = (uint64_t)(C >> 64) + (uint64_t)(A >> 64);
+    }
+    uint64_t t[4] = { t0, t1, t2, t3 };
+    fe_reduce_once(r->v, t);
+}
+
+P2_INLINE void fe_add(p2_fe *r, const p2_fe *a, const p2_fe *b){
+    uint64_t t[4], cy = 0;
+    for(int j=0;j<4;j++){
+        u128 x = (u128)a->v[j] + b->v[j] + cy;
+        t[j] = (uint64_t)x; cy = (uint64_t)(x >> 64);
+    }
+    fe_reduce_once(r->v, t);
+}
+
+/* r = d·a，d 为小常数（矩阵对角线），展开成加法链 */
+P2_INLINE void fe_mul_small(p2_fe *r, const p2_fe *a, unsigned d){
+    if(d == 1){ *r = *a; return; }
+    p2_fe acc = *a, base = *a;
+    unsigned top = 31 - (unsigned)__builtin_clz(d);
+    for(int i=(int)top-1;i>=0;i--){
+        fe_add(&acc, &acc, &acc);
+        if((d >> i) & 1) fe_add(&acc, &acc, &base);
+    }
+    *r = acc;
+}
+
+P2_INLINE void sbox(p2_fe *x){
+    p2_fe x2, x4;
+    fe_mul(&x2, x, x);
+    fe_mul(&x4, &x2, &x2);
+    fe_mul(x, &x4, x);
+}
+
+/* M·x，M = J + diag(d)：y_i = Σx + d_i·x_i */
+P2_INLINE void neptune(p2_fe *x, int t, const unsigned *diag){
+    p2_fe sum = x[0], dx;
+    for(int i=1;i<t;i++) fe_add(&sum, &sum, &x[i]);
+    for(int i=0;i<t;i++){
+        fe_mul_small(&dx, &x[i], diag[i]);
+        fe_add(&x[i], &sum, &dx);
+    }
+}
+
+/* ---------------- 置换 ---------------- */
+P2_INLINE void permute(p2_fe *s, int t, const p2_fe *rc_ext, const p2_fe *rc_int,
+                       const unsigned *me, const unsigned *mi){
+    neptune(s, t, me);
+    for(int r=0;r<P2_RF;r++){
+        if(r == P2_RF/2){
+            for(int i=0;i<P2_RP;i++){
+                fe_add(&s[0], &s[0], &rc_int[i]);
+                sbox(&s[0]);
+                neptune(s, t, mi);
+            }
+        }
+        for(int i=0;i<t;i++){
+            fe_add(&s[i], &s[i], &rc_ext[r*t + i]);
+            sbox(&s[i]);
+        }
+        neptune(s, t, me);
+    }
+}
+
+void poseidon2_permute_t2(p2_fe state[2]){
+    permute(state, 2, &P2_T2_RC_EXT[0][0], P2_T2_RC_INT, P2_T2_ME_DIAG, P2_T2_MI_DIAG);
+}
+
+void poseidon2_permute_t3(p2_fe state[3]){
+    permute(state, 3, &P2_T3_RC_EXT[0][0], P2_T3_RC_INT, P2_T3_ME_DIAG, P2_T3_MI_DIAG);
+}
+
+#if defined(__x86_64__)
+void poseidon2_permute_t3_x8_ifma(p2_fe (*states)[3]);   // poseidon2_ifma.c
+#endif
+
+int poseidon2_batch_lanes(void){
+#if defined(__x86_64__)
+    static int lanes;
+    if(!lanes) lanes = __builtin_cpu_supports("avx512ifma") ? 8 : 1;
+    return lanes;
+#else
+    return 1;
+#endif
+}
+
+void poseidon2_permute_t3_batch(p2_fe (*states)[3], size_t n){
+    size_t i = 0;
+#if defined(__x86_64__)
+    if(poseidon2_batch_lanes() == 8)
+        for(; i + 8 <= n; i += 8) poseidon2_permute_t3_x8_ifma(states + i);
+#endif
+    for(; i<n; i++) poseidon2_permute_t3(states[i]);
+}
+
+/* ---------------- 元素接口 ---------------- */
+
+int p2_fe_from_bytes(p2_fe *r, const uint8_t in[32]){
+    p2_fe x, rr;
+    for(int j=0;j<4;j++){
+        uint64_t w = 0;
+        for(int i=0;i<8;i++) w = (w << 8) | in[(3-j)*8 + i];
+        x.v[j] = w;
+    }
+    uint64_t bw = 0;
+    for(int j=0;j<4;j++){
+        u128 d = (u128)x.v[j] - P2_MOD[j] - bw;
+        bw = (uint64_t)(d >> 64) & 1;
+    }
+    if(!bw) return -1;
+    memcpy(rr.v, P2_RR, sizeof(rr.v));
+    fe_mul(r, &x, &rr);
+    return 0;
+}
+
+void p2_fe_to_bytes(uint8_t out[32], const p2_fe *a){
+    p2_fe one = {{ 1, 0, 0, 0 }}, x;
+    fe_mul(&x, a, &one);
+    for(int j=0;j<4;j++)
+        for(int i=0;i<8;i++) out[(3-j)*8 + i] = (uint8_t)(x.v[j] >> (56 - 8*i));
+}
+
+void p2_fe_from_u64(p2_fe *r, uint64_t x){
+    p2_fe a = {{ x, 0, 0, 0 }}, rr;
+    memcpy(rr.v, P2_RR, sizeof(rr.v));
+    fe_mul(r, &a, &rr);
+}
+
+int p2_fe_equal(const p2_fe *a, const p2_fe *b){
+    return ((a->v[0]^b->v[0]) | (a->v[1]^b->v[1]) | (a->v[2]^b->v[2]) | (a->v[3]^b->v[3])) == 0;
+}
+
+void p2_fe_add(p2_fe *r, const p2_fe *a, const p2_fe *b){ fe_add(r, a, b); }
+void p2_fe_mul(p2_fe *r, const p2_fe *a, const p2_fe *b){ fe_mul(r, a, b); }
@@ -0,0 +1,55 @@
+// poseidon2.h
+#ifndef POSEIDON2_H
+#define POSEIDON2_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  Poseidon2 置换（原生实现），参数与 poseidon2_t2.json / poseidon2_t3.json 相同，
+  由 gen_poseidon2_header.py 在编译前固化为 poseidon2_params.h：
+    域 BLS12-381 标量域 p = 0x73eda753...ffffffff00000001，S-box x^5，RF = 8，RP = 56
+  轮结构：初始 ME → RF/2 个外部轮 → RP 个内部轮（只对 state[0] 加常数、过 S-box）→ RF/2 个外部轮。
+  状态元素在内部一律为 Montgomery 形式 (x·2^256 mod p)；字节接口为 32 字节大端标准表示。
+*/
+
+typedef struct { uint64_t v[4]; } p2_fe;
+
+/* 字节/整数 <-> 域元素；in >= p 时返回 -1 */
+int  p2_fe_from_bytes(p2_fe *r, const uint8_t in[32]);
+void p2_fe_to_bytes(uint8_t out[32], const p2_fe *a);
+void p2_fe_from_u64(p2_fe *r, uint64_t x);
+int  p2_fe_equal(const p2_fe *a, const p2_fe *b);
+
+void p2_fe_add(p2_fe *r, const p2_fe *a, const p2_fe *b);
+void p2_fe_mul(p2_fe *r, const p2_fe *a, const p2_fe *b);
+
+void poseidon2_permute_t2(p2_fe state[2]);
+void poseidon2_permute_t3(p2_fe state[3]);
+
+/* n 个独立的 t=3 状态批量置换：CPU 支持 AVX-512 IFMA 时每 8 个一组走 poseidon2_ifma.c，
+   其余（以及不足 8 个的尾部）走标量实现；结果与逐个调用 poseidon2_permute_t3 完全相同 */
+void poseidon2_permute_t3_batch(p2_fe (*states)[3], size_t n);
+/* 批量入口实际使用的并行路数（8 = IFMA，1 = 标量） */
+int  poseidon2_batch_lanes(void);
+
+/*
+  海绵（poseidon2_sponge.c）：rate = t-1（state[0..t-2]），容量元素 state[t-1] 初值 out_len·2^64。
+  吸收按 rate 分块相加、块间置换；最后一块不足 rate 时补一个 1，恰好满块时改为容量元素 +1
+  （容量填充：不必为满块追加一整块填充）。挤出从 rate 位读取，块间置换。与 poseidon2_ref.py 的 sponge() 一致。
+*/
+typedef struct {
+    p2_fe s[3];
+    int t;
+    unsigned pos;       // 当前块已吸收的元素数
+    int squeezing;
+} p2_sponge;
+
+void p2_sponge_init(p2_sponge *sp, int t, unsigned out_len);   // t 为 2 或 3
+void p2_sponge_absorb(p2_sponge *sp, const p2_fe *in, size_t n);
+void p2_sponge_squeeze(p2_sponge *sp, p2_fe *out, size_t n);    // 首次调用时完成填充
+void p2_hash(p2_fe *out, const p2_fe *in, size_t n);             // t=3，单输出
+
+/* 2-to-1 压缩（t=3，前馈）：perm(l, r, 0)[0] + l */
+void p2_compress(p2_fe *out, const p2_fe *l, const p2_fe *r);
+
+#endif
@@ -0,0 +1,90 @@
+# poseidon2_crosscheck.py
+# Cross-check the native Poseidon2 engine (poseidon2.c) against poseidon2_ref.py on random states,
+# both the single-state entry points and the t=3 batch entry point (IFMA path when available),
+# plus the sponge and the Merkle root.
+# Usage:
+#   gcc -O2 -pthread -o poseidon2_demo poseidon2_demo.c poseidon2.c poseidon2_ifma.c poseidon2_sponge.c poseidon2_merkle.c
+#   python3 poseidon2_crosscheck.py [./poseidon2_demo] [rounds]
+
+import json, random, subprocess, sys
+from poseidon2_ref import load_params, permute, sponge, compress, merkle_root
+
+def run(exe, args):
+    return subprocess.run([exe] + args, capture_output=True, text=True, check=True).stdout
+
+def rand_state(t, p):
+    # 混入边界值 0、1、p-1
+    return [random.choice([0, 1, p - 1]) if random.random() < 0.2 else random.randrange(p) for _ in range(t)]
+
+def main():
+    exe = sys.argv[1] if len(sys.argv) > 1 else "./poseidon2_demo"
+    rounds = int(sys.argv[2]) if len(sys.argv) > 2 else 50
+    params = {t: load_params(t) for t in (2, 3)}
+    bad = 0
+    for i in range(rounds):
+        t = 2 + (i & 1)
+        p = params[t]["p"]
+        x = rand_state(t, p)
+        out = subprocess.run([exe, "kat", str(t)] + ["%x" % v for v in x],
+                             capture_output=True, text=True, check=True).stdout.split()
+        want = ["%064x" % v for v in permute(x, params[t])]
+        if out != want:
+            bad += 1
+            print("MISMATCH t=%d x=%s" % (t, x))
+    print("%d/%d permutations match poseidon2_ref.py" % (rounds - bad, rounds))
+
+    # 批量接口：k 不是 8 的倍数，覆盖 8 路向量部分与标量尾部
+    k = 8 * max(1, rounds // 16) + 3
+    p = params[3]["p"]
+    xs = [rand_state(3, p) for _ in range(k)]
+    lines = subprocess.run([exe, "katb"] + ["%x" % v for x in xs for v in x],
+                           capture_output=True, text=True, check=True).stdout.splitlines()
+    bbad = 0
+    for x, line in zip(xs, lines):
+        if line.split() != ["%064x" % v for v in permute(x, params[3])]:
+            bbad += 1
+            print("MISMATCH batch x=%s" % x)
+    bbad += k - len(lines)
+    print("%d/%d batch permutations match poseidon2_ref.py" % (k - bbad, k))
+
+    # 海绵：长度 0..7 覆盖空消息、不足一块与恰好满块；输出长度 1..3 覆盖多次挤出
+    sbad = 0
+    for i in range(rounds):
+        t = 2 + (i & 1)
+        x = rand_state(random.randrange(8), params[t]["p"])
+        out_len = 1 + random.randrange(3)
+        out = run(exe, ["sponge", str(t), str(out_len)] + ["%x" % v for v in x]).split()
+        if out != ["%064x" % v for v in sponge(x, params[t], out_len)]:
+            sbad += 1
+            print("MISMATCH sponge t=%d out_len=%d x=%s" % (t, out_len, x))
+    print("%d/%d sponge hashes match poseidon2_ref.py" % (rounds - sbad, rounds))
+
+    # Merkle 根：叶子数 1..33，含奇数层零子树补齐
+    mbad = 0
+    mrounds = max(1, rounds // 5)
+    for i in range(mrounds):
+        x = rand_state(1 + random.randrange(33), p)
+        out = run(exe, ["merkle"] + ["%x" % v for v in x]).split()
+        if out != ["%064x" % merkle_root(x, params[3])]:
+            mbad += 1
+            print("MISMATCH merkle n=%d" % len(x))
+    print("%d/%d Merkle roots match poseidon2_ref.py" % (mrounds - mbad, mrounds))
+
+    # 认证路径：按 poseidon2_merkle.circom 的规则（index_bits[k] = 1 时当前节点在右）重算根
+    pbad = 0
+    for i in range(mrounds):
+        x = rand_state(1 + random.randrange(33), p)
+        idx = random.randrange(len(x))
+        w = json.loads(run(exe, ["mpath", str(idx)] + ["%x" % v for v in x]))
+        cur = int(w["leaf"], 16)
+        for s, b in zip(w["siblings"], w["index_bits"]):
+            s = int(s, 16)
+            cur = compress(s, cur, params[3]) if b == "1" else compress(cur, s, params[3])
+        if cur != int(w["root"], 16) or cur != merkle_root(x, params[3]):
+            pbad += 1
+            print("MISMATCH path n=%d idx=%d" % (len(x), idx))
+    print("%d/%d Merkle paths verify under the circom rule" % (mrounds - pbad, mrounds))
+    return 1 if bad or bbad or sbad or mbad or pbad else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
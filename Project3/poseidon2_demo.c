@@ -0,0 +1,193 @@
+// poseidon2_demo.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "poseidon2.h"
+#include "poseidon2_merkle.h"
+
+/*
+  用法:
+    ./poseidon2_demo                     已知答案测试 + 性能测试
+    ./poseidon2_demo kat <t> <hex>...    输出置换结果（hex），供 poseidon2_crosscheck.py 与 poseidon2_ref.py 比对
+    ./poseidon2_demo katb <hex>...       3k 个输入视为 k 个 t=3 状态，经批量接口置换，每行输出一个状态
+    ./poseidon2_demo sponge <t> <out_len> <hex>...   海绵哈希
+    ./poseidon2_demo merkle <hex>...     以输入为叶子建树，输出根
+    ./poseidon2_demo mpath <index> <hex>...  输出第 index 个叶子的认证路径，格式即 poseidon2_merkle.circom 的 input.json
+*/
+
+/* 由 poseidon2_ref.py 生成：t=2 输入 (0,1)，t=3 输入 (0,1,2) */
+static const char *KAT_T2[2] = {
+    "369ca1fa0d05592f3bfcd68ef19dc91bf9c6b85cedaf7ab0424c79038f60d240",
+    "157244d9096334f4c6a8fb26e1354fe003f0f8c7dc173508ed7b4beb83aaafa1"
+};
+static const char *KAT_T3[3] = {
+    "3fe8e38909052a636c20f8540b6838bbb85205f1ed61edcbadba452c2f02e767",
+    "29b7f4328b709cd071bbd1646ac8bb7a1fd2751492227a0de5dbe0f03959af32",
+    "130e0bda5fa62dbc895dd85c5b3f366ed3105ec6bb3a118677c121d45b7d3982"
+};
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* 最多 64 个十六进制字符，左侧补零 */
+static int parse_fe(const char *s, p2_fe *r){
+    uint8_t b[32] = {0};
+    size_t n = strlen(s);
+    if(n > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')){ s += 2; n -= 2; }
+    if(n == 0 || n > 64) return -1;
+    for(size_t i=0;i<n;i++){
+        char c = s[n-1-i];
+        int v = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 :
+                c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+        if(v < 0) return -1;
+        b[31 - i/2] |= (uint8_t)(v << (4 * (i & 1)));
+    }
+    return p2_fe_from_bytes(r, b);
+}
+
+static void print_fe(const p2_fe *a){
+    uint8_t b[32];
+    p2_fe_to_bytes(b, a);
+    for(int i=0;i<32;i++) printf("%02x", b[i]);
+}
+
+static void print_fe_json(const p2_fe *a){
+    printf("\"0x"); print_fe(a); printf("\"");
+}
+
+static int check(const p2_fe *s, const char *const *want, int t){
+    for(int i=0;i<t;i++){
+        p2_fe w;
+        parse_fe(want[i], &w);
+        if(!p2_fe_equal(&s[i], &w)) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv){
+    if(argc >= 3 && strcmp(argv[1], "kat") == 0){
+        int t = atoi(argv[2]);
+        p2_fe s[3];
+        if((t != 2 && t != 3) || argc != 3 + t) return 1;
+        for(int i=0;i<t;i++) if(parse_fe(argv[3+i], &s[i]) != 0){ fprintf(stderr, "bad input\n"); return 1; }
+        if(t == 2) poseidon2_permute_t2(s); else poseidon2_permute_t3(s);
+        for(int i=0;i<t;i++){ print_fe(&s[i]); printf(i + 1 < t ? " " : "\n"); }
+        return 0;
+    }
+    if(argc >= 2 && strcmp(argv[1], "katb") == 0){
+        size_t k = (size_t)(argc - 2) / 3;
+        p2_fe (*s)[3] = malloc(sizeof(p2_fe[3]) * (k ? k : 1));
+        if(!s || (argc - 2) % 3 != 0) return 1;
+        for(size_t i=0;i<3*k;i++)
+            if(parse_fe(argv[2+i], &s[i/3][i%3]) != 0){ fprintf(stderr, "bad input\n"); return 1; }
+        poseidon2_permute_t3_batch(s, k);
+        for(size_t i=0;i<k;i++)
+            for(int j=0;j<3;j++){ print_fe(&s[i][j]); printf(j < 2 ? " " : "\n"); }
+        free(s);
+        return 0;
+    }
+
+    if(argc >= 4 && strcmp(argv[1], "sponge") == 0){
+        int t = atoi(argv[2]);
+        unsigned out_len = (unsigned)atoi(argv[3]);
+        size_t n = (size_t)(argc - 4);
+        p2_fe *in = malloc(sizeof(p2_fe) * (n ? n : 1)), *out = malloc(sizeof(p2_fe) * (out_len ? out_len : 1));
+        if(!in || !out || (t != 2 && t != 3)) return 1;
+        for(size_t i=0;i<n;i++) if(parse_fe(argv[4+i], &in[i]) != 0){ fprintf(stderr, "bad input\n"); return 1; }
+        p2_sponge sp;
+        p2_sponge_init(&sp, t, out_len);
+        // 分两次吸收，覆盖跨调用的分块
+        p2_sponge_absorb(&sp, in, n / 2);
+        p2_sponge_absorb(&sp, in + n / 2, n - n / 2);
+        p2_sponge_squeeze(&sp, out, out_len);
+        for(unsigned i=0;i<out_len;i++){ print_fe(&out[i]); printf(i + 1 < out_len ? " " : "\n"); }
+        free(in); free(out);
+        return 0;
+    }
+    if((argc >= 3 && strcmp(argv[1], "merkle") == 0) || (argc >= 4 && strcmp(argv[1], "mpath") == 0)){
+        int path = argv[1][1] == 'p';
+        size_t idx = path ? strtoull(argv[2], NULL, 10) : 0;
+        size_t n = (size_t)(argc - 2 - path);
+        p2_fe *leaves = malloc(sizeof(p2_fe) * n), sib[P2_MERKLE_MAX_DEPTH];
+        p2_merkle mt;
+        if(!leaves) return 1;
+        for(size_t i=0;i<n;i++) if(parse_fe(argv[2+path+i], &leaves[i]) != 0){ fprintf(stderr, "bad input\n"); return 1; }
+        if(p2_merkle_build(&mt, leaves, n, 0, 1) != 0) return 1;
+        if(!path){
+            print_fe(p2_merkle_root(&mt)); printf("\n");
+        } else {
+            if(p2_merkle_path(&mt, idx, sib) != 0) return 1;
+            printf("{\"leaf\": "); print_fe_json(&leaves[idx]);
+            printf(", \"siblings\": [");
+            for(unsigned k=0;k<mt.depth;k++){ print_fe_json(&sib[k]); printf(k + 1 < mt.depth ? ", " : ""); }
+            printf("], \"index_bits\": [");
+            for(unsigned k=0;k<mt.depth;k++) printf("\"%u\"%s", (unsigned)((idx >> k) & 1), k + 1 < mt.depth ? ", " : "");
+            printf("], \"root\": "); print_fe_json(p2_merkle_root(&mt)); printf("}\n");
+        }
+        p2_merkle_free(&mt);
+        free(leaves);
+        return 0;
+    }
+
+    p2_fe s2[2], s3[3];
+    for(int i=0;i<2;i++) p2_fe_from_u64(&s2[i], (uint64_t)i);
+    for(int i=0;i<3;i++) p2_fe_from_u64(&s3[i], (uint64_t)i);
+    poseidon2_permute_t2(s2);
+    poseidon2_permute_t3(s3);
+    printf("t=2 perm(0,1)[0]   = "); print_fe(&s2[0]); printf("\n");
+    printf("t=3 perm(0,1,2)[0] = "); print_fe(&s3[0]); printf("\n");
+    printf("t=2 matches poseidon2_ref.py: %s\n", check(s2, KAT_T2, 2) ? "OK" : "FAIL");
+    printf("t=3 matches poseidon2_ref.py: %s\n", check(s3, KAT_T3, 3) ? "OK" : "FAIL");
+
+    // 批量接口与单个接口一致：全域随机输入，夹杂 0 / p-1，N 不是 8 的倍数以覆盖尾部
+    enum { N = (1 << 16) + 5 };
+    p2_fe (*batch)[3] = malloc(sizeof(p2_fe[3]) * N);
+    p2_fe (*ref)[3] = malloc(sizeof(p2_fe[3]) * N);
+    p2_fe (*in)[3] = malloc(sizeof(p2_fe[3]) * N);
+    if(!batch || !ref || !in) return 1;
+    p2_fe pm1;
+    parse_fe("73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000000", &pm1);
+    uint64_t rng = 0x9e3779b97f4a7c15ULL;
+    for(size_t i=0;i<N;i++)
+        for(int j=0;j<3;j++){
+            uint8_t b[32];
+            do {
+                for(int k=0;k<32;k++){ rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17; b[k] = (uint8_t)rng; }
+                b[0] &= 0x7f;
+            } while(p2_fe_from_bytes(&in[i][j], b) != 0);
+            if(i % 97 == 0) in[i][j] = pm1;
+            if(i % 101 == 0) p2_fe_from_u64(&in[i][j], 0);
+        }
+    memcpy(batch, in, sizeof(p2_fe[3]) * N);
+    memcpy(ref, in, sizeof(p2_fe[3]) * N);
+
+    double t0 = now_sec();
+    for(size_t i=0;i<N;i++) poseidon2_permute_t3(ref[i]);
+    double t1 = now_sec();
+    poseidon2_permute_t3_batch(batch, N);
+    double t2 = now_sec();
+    for(size_t i=0;i<N;i++) poseidon2_permute_t2(ref[i]);   // 只测速度
+    double t3 = now_sec();
+
+    int same = 1;
+    for(size_t i=0;i<N;i++){
+        p2_fe x[3];
+        memcpy(x, in[i], sizeof(x));
+        poseidon2_permute_t3(x);
+        for(int j=0;j<3;j++) same &= p2_fe_equal(&x[j], &batch[i][j]);
+    }
+    printf("batch == single (%d lanes): %s\n", poseidon2_batch_lanes(), same ? "OK" : "FAIL");
+    printf("t=3 single: %.2f us/perm (%.0f perms/s)\n", (t1 - t0) / N * 1e6, N / (t1 - t0));
+    printf("t=3 batch:  %.2f us/perm (%.0f perms/s)\n", (t2 - t1) / N * 1e6, N / (t2 - t1));
+    printf("t=2 single: %.2f us/perm (%.0f perms/s)\n", (t3 - t2) / N * 1e6, N / (t3 - t2));
+    free(batch);
+    free(ref);
+    free(in);
+    return 0;
+}
@@ -0,0 +1,179 @@
+// poseidon2_ifma.c
+#include "poseidon2.h"
+#include "poseidon2_params.h"
+
+/*
+  8 路并行的 t=3 Poseidon2 置换（AVX-512 IFMA52），由 poseidon2_permute_t3_batch 在运行时选用。
+
+  表示：每个域元素拆成 5 个 52 位 limb（radix 2^52），一个 __m512i 存 8 个状态的同一个 limb（SoA），
+  Montgomery 形式 x·2^260 mod p。vpmadd52luq / vpmadd52huq 直接给出 52×52 位乘积的低 / 高 52 位，
+  累加器留在 64 位通道里延迟进位，每个 limb 只在乘法末尾归一化一次。
+  所有值保持在 [0, p) 的标准 limb 形式：与标量实现逐位一致，也保证 IFMA 的 52 位输入前提。
+  内部轮矩阵 MI = J + diag(d)：y_i = Σx + d_i·x_i，只需加法，d_i = 1 时就是 Σx + x_i。
+*/
+
+#if defined(__x86_64__)
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512ifma")
+#include <immintrin.h>
+
+#define V_INLINE static inline __attribute__((always_inline))
+#define MASK52 ((1ULL << 52) - 1)
+
+typedef struct { __m512i l[5]; } v52;
+
+V_INLINE __m512i bcast(uint64_t x){ return _mm512_set1_epi64((long long)x); }
+
+/* t < 2^260（limb 已归一化）时，t >= p 则减 p */
+V_INLINE void v_reduce_once(v52 *r, const __m512i t[5]){
+    const __m512i mask = bcast(MASK52);
+    __m512i d[5];
+    d[0] = _mm512_sub_epi64(t[0], bcast(P2_MOD52[0]));
+    for(int j=1;j<5;j++){
+        d[j] = _mm512_add_epi64(_mm512_sub_epi64(t[j], bcast(P2_MOD52[j])), _mm512_srai_epi64(d[j-1], 52));
+        d[j-1] = _mm512_and_si512(d[j-1], mask);
+    }
+    __mmask8 keep = _mm512_cmplt_epi64_mask(d[4], _mm512_setzero_si512());
+    for(int j=0;j<5;j++) r->l[j] = _mm512_mask_blend_epi64(keep, d[j], t[j]);
+}
+
+V_INLINE void v_carry(__m512i t[5]){
+    const __m512i mask = bcast(MASK52);
+    for(int j=0;j<4;j++){
+        t[j+1] = _mm512_add_epi64(t[j+1], _mm512_srli_epi64(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+}
+
+/* 逐 limb 交替乘加与约简（operand scanning）；p < 2^255 = R'/32，结果 < 2p，一次条件减 */
+V_INLINE void v_mul(v52 *r, const v52 *a, const v52 *b){
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+#pragma GCC unroll 5
+    for(int i=0;i<5;i++){
+        __m512i bi = b->l[i];
+        for(int j=0;j<5;j++){
+            t[j]   = _mm512_madd52lo_epu64(t[j],   a->l[j], bi);
+            t[j+1] = _mm512_madd52hi_epu64(t[j+1], a->l[j], bi);
+        }
+        __m512i m = _mm512_madd52lo_epu64(zero, t[0], bcast(P2_M0INV52));
+        for(int j=0;j<5;j++){
+            t[j]   = _mm512_madd52lo_epu64(t[j],   m, bcast(P2_MOD52[j]));
+            t[j+1] = _mm512_madd52hi_epu64(t[j+1], m, bcast(P2_MOD52[j]));
+        }
+        // t[0] 的低 52 位此时为 0
+        t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        for(int j=0;j<5;j++) t[j] = t[j+1];
+        t[5] = zero;
+    }
+    v_carry(t);
+    v_reduce_once(r, t);
+}
+
+V_INLINE void v_add(v52 *r, const v52 *a, const v52 *b){
+    __m512i t[5];
+    for(int j=0;j<5;j++) t[j] = _mm512_add_epi64(a->l[j], b->l[j]);
+    v_carry(t);
+    v_reduce_once(r, t);
+}
+
+V_INLINE void v_add_const(v52 *r, const v52 *a, const uint64_t c[5]){
+    __m512i t[5];
+    for(int j=0;j<5;j++) t[j] = _mm512_add_epi64(a->l[j], bcast(c[j]));
+    v_carry(t);
+    v_reduce_once(r, t);
+}
+
+V_INLINE void v_mul_const(v52 *r, const v52 *a, const uint64_t c[5]){
+    v52 k;
+    for(int j=0;j<5;j++) k.l[j] = bcast(c[j]);
+    v_mul(r, a, &k);
+}
+
+V_INLINE void v_mul_small(v52 *r, const v52 *a, unsigned d){
+    if(d == 1){ *r = *a; return; }
+    v52 acc = *a;
+    unsigned top = 31 - (unsigned)__builtin_clz(d);
+    for(int i=(int)top-1;i>=0;i--){
+        v_add(&acc, &acc, &acc);
+        if((d >> i) & 1) v_add(&acc, &acc, a);
+    }
+    *r = acc;
+}
+
+V_INLINE void v_sbox(v52 *x){
+    v52 x2, x4;
+    v_mul(&x2, x, x);
+    v_mul(&x4, &x2, &x2);
+    v_mul(x, &x4, x);
+}
+
+V_INLINE void v_neptune(v52 x[3], const unsigned diag[3]){
+    v52 sum, dx;
+    v_add(&sum, &x[0], &x[1]);
+    v_add(&sum, &sum, &x[2]);
+    for(int i=0;i<3;i++){
+        v_mul_small(&dx, &x[i], diag[i]);
+        v_add(&x[i], &sum, &dx);
+    }
+}
+
+/* 4×64 位 Montgomery (x·2^256) <-> 5×52 位，8 路转置 */
+V_INLINE void load8(v52 s[3], p2_fe (*in)[3]){
+    uint64_t buf[3][5][8];
+    for(int k=0;k<8;k++)
+        for(int i=0;i<3;i++){
+            const uint64_t *v = in[k][i].v;
+            buf[i][0][k] =  v[0] & MASK52;
+            buf[i][1][k] = ((v[0] >> 52) | (v[1] << 12)) & MASK52;
+            buf[i][2][k] = ((v[1] >> 40) | (v[2] << 24)) & MASK52;
+            buf[i][3][k] = ((v[2] >> 28) | (v[3] << 36)) & MASK52;
+            buf[i][4][k] =   v[3] >> 16;
+        }
+    for(int i=0;i<3;i++){
+        for(int j=0;j<5;j++) s[i].l[j] = _mm512_loadu_si512(buf[i][j]);
+        v_mul_const(&s[i], &s[i], P2_TO52);
+    }
+}
+
+V_INLINE void store8(p2_fe (*out)[3], v52 s[3]){
+    uint64_t buf[3][5][8];
+    for(int i=0;i<3;i++){
+        v_mul_const(&s[i], &s[i], P2_FROM52);
+        for(int j=0;j<5;j++) _mm512_storeu_si512(buf[i][j], s[i].l[j]);
+    }
+    for(int k=0;k<8;k++)
+        for(int i=0;i<3;i++){
+            uint64_t *v = out[k][i].v;
+            v[0] =  buf[i][0][k]        | (buf[i][1][k] << 52);
+            v[1] = (buf[i][1][k] >> 12) | (buf[i][2][k] << 40);
+            v[2] = (buf[i][2][k] >> 24) | (buf[i][3][k] << 28);
+            v[3] = (buf[i][3][k] >> 36) | (buf[i][4][k] << 16);
+        }
+}
+
+void poseidon2_permute_t3_x8_ifma(p2_fe (*states)[3]){
+    v52 s[3];
+    load8(s, states);
+    v_neptune(s, P2_T3_ME_DIAG);
+    for(int r=0;r<P2_RF;r++){
+        if(r == P2_RF/2){
+            for(int i=0;i<P2_RP;i++){
+                v_add_const(&s[0], &s[0], P2_T3_RC_INT52[i]);
+                v_sbox(&s[0]);
+                v_neptune(s, P2_T3_MI_DIAG);
+            }
+        }
+        for(int i=0;i<3;i++){
+            v_add_const(&s[i], &s[i], P2_T3_RC_EXT52[r][i]);
+            v_sbox(&s[i]);
+        }
+        v_neptune(s, P2_T3_ME_DIAG);
+    }
+    store8(states, s);
+}
+
+#pragma GCC pop_options
+
+#endif
@@ -0,0 +1,115 @@
+// poseidon2_merkle.c
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "poseidon2_merkle.h"
+
+#define GROUP 64              // 每次送进批量置换的节点数
+#define MIN_PARALLEL 4096     // 本层输出节点少于此数时不开线程
+
+typedef struct {
+    const p2_fe *in;
+    size_t in_n;
+    const p2_fe *zero;        // 下层的零子树哈希，补奇数层的右兄弟
+    p2_fe *out;
+    size_t lo, hi;            // 输出节点区间
+    int threaded;
+} job_t;
+
+static void *level_job(void *arg){
+    job_t *j = arg;
+    p2_fe st[GROUP][3], z;
+    p2_fe_from_u64(&z, 0);
+    for(size_t i=j->lo;i<j->hi;i+=GROUP){
+        size_t m = j->hi - i < GROUP ? j->hi - i : GROUP;
+        for(size_t k=0;k<m;k++){
+            size_t l = 2*(i + k);
+            st[k][0] = j->in[l];
+            st[k][1] = l + 1 < j->in_n ? j->in[l+1] : *j->zero;
+            st[k][2] = z;
+        }
+        poseidon2_permute_t3_batch(st, m);
+        for(size_t k=0;k<m;k++) p2_fe_add(&j->out[i+k], &st[k][0], &j->in[2*(i + k)]);
+    }
+    return NULL;
+}
+
+static void build_level(const p2_fe *in, size_t in_n, const p2_fe *zero, p2_fe *out, size_t out_n, int nthreads){
+    if(nthreads < 1 || out_n < MIN_PARALLEL) nthreads = 1;
+    job_t js[64];
+    pthread_t th[64];
+    if(nthreads > 64) nthreads = 64;
+    size_t per = (out_n + (size_t)nthreads - 1) / (size_t)nthreads;
+    per = (per + GROUP - 1) / GROUP * GROUP;
+    int nj = 0;
+    for(size_t lo=0; lo<out_n; lo+=per, nj++){
+        js[nj] = (job_t){ in, in_n, zero, out, lo, lo + per < out_n ? lo + per : out_n, 0 };
+        if(nj > 0) js[nj].threaded = pthread_create(&th[nj], NULL, level_job, &js[nj]) == 0;
+    }
+    if(nj > 0) level_job(&js[0]);
+    for(int i=1;i<nj;i++){
+        if(js[i].threaded) pthread_join(th[i], NULL);
+        else level_job(&js[i]);      // 线程创建失败：在本线程补做
+    }
+}
+
+int p2_merkle_build(p2_merkle *t, const p2_fe *leaves, size_t n, unsigned depth, int nthreads){
+    memset(t, 0, sizeof(*t));
+    if(n == 0) return -1;
+    unsigned need = 0;
+    while(need < P2_MERKLE_MAX_DEPTH && ((size_t)1 << need) < n) need++;
+    if(((size_t)1 << need) < n) return -1;
+    if(depth == 0) depth = need;
+    if(depth < need || depth > P2_MERKLE_MAX_DEPTH) return -1;
+
+    p2_fe_from_u64(&t->zero[0], 0);
+    for(unsigned k=0;k<depth;k++) p2_compress(&t->zero[k+1], &t->zero[k], &t->zero[k]);
+
+    t->depth = depth;
+    t->levels = calloc(depth + 1, sizeof(p2_level));
+    if(!t->levels) return -1;
+    size_t m = n;
+    for(unsigned k=0;k<=depth;k++){
+        t->levels[k].n = m;
+        t->levels[k].nodes = malloc(m * sizeof(p2_fe));
+        if(!t->levels[k].nodes){ p2_merkle_free(t); return -1; }
+        m = (m + 1) / 2;
+    }
+    memcpy(t->levels[0].nodes, leaves, n * sizeof(p2_fe));
+    for(unsigned k=1;k<=depth;k++)
+        build_level(t->levels[k-1].nodes, t->levels[k-1].n, &t->zero[k-1],
+                    t->levels[k].nodes, t->levels[k].n, nthreads);
+    return 0;
+}
+
+void p2_merkle_free(p2_merkle *t){
+    if(t->levels)
+        for(unsigned k=0;k<=t->depth;k++) free(t->levels[k].nodes);
+    free(t->levels);
+    t->levels = NULL;
+}
+
+const p2_fe *p2_merkle_root(const p2_merkle *t){
+    return &t->levels[t->depth].nodes[0];
+}
+
+int p2_merkle_path(const p2_merkle *t, size_t index, p2_fe *siblings){
+    if(index >= t->levels[0].n) return -1;
+    for(unsigned k=0;k<t->depth;k++){
+        size_t s = index ^ 1;
+        siblings[k] = s < t->levels[k].n ? t->levels[k].nodes[s] : t->zero[k];
+        index >>= 1;
+    }
+    return 0;
+}
+
+int p2_merkle_verify(const p2_fe *root, const p2_fe *leaf, size_t index,
+                     const p2_fe *siblings, unsigned depth){
+    p2_fe cur = *leaf;
+    for(unsigned k=0;k<depth;k++){
+        if((index >> k) & 1) p2_compress(&cur, &siblings[k], &cur);
+        else                 p2_compress(&cur, &cur, &siblings[k]);
+    }
+    if(depth < sizeof(size_t) * 8 && (index >> depth) != 0) return 0;
+    return p2_fe_equal(&cur, root);
+}
@@ -0,0 +1,43 @@
+pragma circom 2.2.2;
+// Poseidon2 Merkle 认证路径验证，与 poseidon2_merkle.c / poseidon2_ref.py 的 merkle_levels 使用同一规则：
+//   node = perm(left, right, 0)[0] + left（t=3 置换 + 前馈）
+// 域为 BLS12-381 标量域，编译时加 --prime bls12381。
+// 输入可由 `./poseidon2_demo mpath <index> <leaf>...` 直接生成（input.json）。
+
+include "poseidon2_perm.circom";
+
+template Poseidon2Compress() {
+    signal input l;
+    signal input r;
+    signal output out;
+
+    component perm = Poseidon2Perm_t3();
+    perm.in[0] <== l;
+    perm.in[1] <== r;
+    perm.in[2] <== 0;
+    out <== perm.out[0] + l;
+}
+
+// index_bits[k] = 1 表示第 k 层（从叶子数起）当前节点是右孩子
+template Poseidon2MerkleVerify(depth) {
+    signal input leaf;
+    signal input siblings[depth];
+    signal input index_bits[depth];
+    signal input root;
+
+    component h[depth];
+    signal cur[depth + 1];
+    signal d[depth];
+
+    cur[0] <== leaf;
+    for (var k = 0; k < depth; k++) {
+        index_bits[k] * (index_bits[k] - 1) === 0;
+        // b = 0: (cur, sib)；b = 1: (sib, cur)。一个乘法约束完成交换
+        d[k] <== index_bits[k] * (siblings[k] - cur[k]);
+        h[k] = Poseidon2Compress();
+        h[k].l <== cur[k] + d[k];
+        h[k].r <== siblings[k] - d[k];
+        cur[k + 1] <== h[k].out;
+    }
+    root === cur[depth];
+}
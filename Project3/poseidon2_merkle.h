@@ -0,0 +1,38 @@
+// poseidon2_merkle.h
+#ifndef POSEIDON2_MERKLE_H
+#define POSEIDON2_MERKLE_H
+#include "poseidon2.h"
+
+/*
+  基于 t=3 Poseidon2 的二叉 Merkle 树（与 poseidon2_merkle.circom、poseidon2_ref.py 的 merkle_levels 一致）：
+    node = p2_compress(left, right) = perm(left, right, 0)[0] + left
+  叶子是域元素（任意长度的数据先用 p2_hash 吸收成一个叶子）。树补齐到 2^depth 个叶子，补齐部分是零子树：
+    zero[0] = 0，zero[k+1] = compress(zero[k], zero[k])
+  只存实际节点，零子树按层查表，不占内存。
+  构建时每层按输出节点分段交给各线程，段内 64 个节点一组走 poseidon2_permute_t3_batch（IFMA 8 路）。
+*/
+
+#define P2_MERKLE_MAX_DEPTH 48
+
+typedef struct {
+    p2_fe *nodes;       // 本层实际节点
+    size_t n;
+} p2_level;
+
+typedef struct {
+    p2_level *levels;   // levels[0] = 叶子，levels[depth] = 根
+    unsigned depth;
+    p2_fe zero[P2_MERKLE_MAX_DEPTH + 1];
+} p2_merkle;
+
+/* depth = 0 表示取最小深度 ceil(log2 n)；depth 不够容纳 n 个叶子、n = 0 或内存不足时返回 -1 */
+int  p2_merkle_build(p2_merkle *t, const p2_fe *leaves, size_t n, unsigned depth, int nthreads);
+void p2_merkle_free(p2_merkle *t);
+const p2_fe *p2_merkle_root(const p2_merkle *t);
+
+/* siblings[depth]：siblings[0] 为叶子层的兄弟；index 的第 k 位为 1 表示第 k 层当前节点在右边 */
+int  p2_merkle_path(const p2_merkle *t, size_t index, p2_fe *siblings);
+int  p2_merkle_verify(const p2_fe *root, const p2_fe *leaf, size_t index,
+                      const p2_fe *siblings, unsigned depth);
+
+#endif
@@ -0,0 +1,232 @@
+// poseidon2_params.h -- generated by gen_poseidon2_header.py from poseidon2_t2.json / poseidon2_t3.json, do not edit
+#ifndef POSEIDON2_PARAMS_H
+#define POSEIDON2_PARAMS_H
+#include "poseidon2.h"
+
+#define P2_RF 8
+#define P2_RP 56
+
+static const uint64_t P2_MOD[4]  = { 0xffffffff00000001ULL, 0x53bda402fffe5bfeULL, 0x3339d80809a1d805ULL, 0x73eda753299d7d48ULL };
+static const uint64_t P2_M0INV    = 0xfffffffeffffffffULL;
+static const uint64_t P2_RR[4]   = { 0xc999e990f3f29c6dULL, 0x2b6cedcb87925c23ULL, 0x05d314967254398fULL, 0x0748d9d99f59ff11ULL };
+static const uint64_t P2_ONE[4]  = { 0x00000001fffffffeULL, 0x5884b7fa00034802ULL, 0x998c4fefecbc4ff5ULL, 0x1824b159acc5056fULL };
+
+/* t = 2 */
+static const unsigned P2_T2_ME_DIAG[2] = { 1, 1 };   // ME[i][i] - 1
+static const unsigned P2_T2_MI_DIAG[2] = { 1, 1 };   // MI[i][i] - 1
+static const p2_fe P2_T2_RC_EXT[P2_RF][2] = {
+  { {{ 0xd9b55a0bb2e92cc8ULL, 0x0a50904714b33111ULL, 0x3b34064975c65861ULL, 0x175c82acfbbdd44fULL }}, {{ 0xa6d0f12f57cde24dULL, 0x972063a24fee23bcULL, 0x9f1106faea9a99f3ULL, 0x70a89a01d2d1a68cULL }} },
+  { {{ 0x151815b3b428e9cdULL, 0x08b6fcfe8c6b35a6ULL, 0xe8d985befdf9ff78ULL, 0x60fcce510fd04ef3ULL }}, {{ 0x24e6e8475a0c0478ULL, 0x73fa4d4ff25c8550ULL, 0x28d14bc1d0df7476ULL, 0x522b848da5dc504eULL }} },
+  { {{ 0x7e0f89741cc52d68ULL, 0xe75c9faee6d088fdULL, 0x7a064711c89c450fULL, 0x6c768eb7eafeb728ULL }}, {{ 0xf777eb79713f2598ULL, 0x13354c0829d9c8daULL, 0x50378b35499a86a9ULL, 0x5396a5ff4ea7228eULL }} },
+  { {{ 0x7bf5e81e8941b854ULL, 0x002c56bcf129305aULL, 0x32b71284eb990d68ULL, 0x5e48948a16873b81ULL }}, {{ 0xc839e9cf70f4b0c7ULL, 0x798411e70b16cc94ULL, 0xb704fcd49b3acf97ULL, 0x5e7f18f6e640479fULL }} },
+  { {{ 0x289d5331a23d15dcULL, 0x312ecaf114f7d2e3ULL, 0xceb9a084add4e408ULL, 0x24bbb11681f37a69ULL }}, {{ 0x87ada9b2fd02f59fULL, 0x8660ed485eb7231bULL, 0x896becf42ee7c736ULL, 0x57ebed42c400d74eULL }} },
+  { {{ 0xaa2f09ec8283f808ULL, 0x8fb8cb220ac3e215ULL, 0xf0c2e3ea6b9eb1a4ULL, 0x2f9e5dcd85fed17eULL }}, {{ 0x83d6c528d37915dfULL, 0x62d8afcf6055c1a4ULL, 0x7329706c05bb20ecULL, 0x3583bb141237d174ULL }} },
+  { {{ 0xec0c86962da9703dULL, 0xd6fd7c6dd0f04fb5ULL, 0xde694e9ca28d95feULL, 0x60882e655dafaf39ULL }}, {{ 0xea633796ce63f269ULL, 0xad6d5e1416079c5fULL, 0xc115f07ad0ac5c28ULL, 0x05c762b61190f5abULL }} },
+  { {{ 0x88d5c52881c35bf5ULL, 0xd9b157ae229efa00ULL, 0xfdb4917fa8a8fe52ULL, 0x4b4e0ef1d6d8f19bULL }}, {{ 0x239d2e03c0aa4554ULL, 0x5c7eb0fd338d88d4ULL, 0x5b924962e904937bULL, 0x7332110db396cd46ULL }} },
+};
+static const p2_fe P2_T2_RC_INT[P2_RP] = {
+  {{ 0x8de428414a67522bULL, 0x10037fb6fde54ea5ULL, 0x577d11c45128e13eULL, 0x5fa9b7e98501107bULL }},
+  {{ 0xaec238a714d1fcdeULL, 0x7a929923e40e8565ULL, 0x307ccfabb0bceb50ULL, 0x075e0c9250354305ULL }},
+  {{ 0xec4e9f565c24c987ULL, 0x7f3e44768d5c376cULL, 0xd36106e0f2a70fdcULL, 0x4c4191107fd51d53ULL }},
+  {{ 0x26c6d428196fedf8ULL, 0xf9081aaccfe12c91ULL, 0xe2f570559dd8b0bbULL, 0x5837bcbdff8a7ffdULL }},
+  {{ 0x05f978d1f6f0e088ULL, 0x7fca5db1db582ac6ULL, 0xccaa9149e97a23a9ULL, 0x3dbd96cbf8ba050dULL }},
+  {{ 0x29a926fe2b020870ULL, 0xc70ef46715acbc39ULL, 0x35e7019bdce64c15ULL, 0x3b811edd07201569ULL }},
+  {{ 0x9719cd80cca50fe3ULL, 0x180a0ce1471f506bULL, 0x422991c04cc6f7aeULL, 0x5b5784178c14190dULL }},
+  {{ 0x54a9a87daf0c7b4eULL, 0x4bd9b877ef57fdebULL, 0xe81ed9587761c6d5ULL, 0x0d19017a4525c991ULL }},
+  {{ 0xb767ea201686ce8bULL, 0x067e8d618abf7692ULL, 0x57c242c2a0a2562bULL, 0x61e589c6c3e4816bULL }},
+  {{ 0x684e1d964270f77dULL, 0x33aa344a97ed58c3ULL, 0x9c02acf25f7c0eb0ULL, 0x1215cb28147110cdULL }},
+  {{ 0x9b942bbb71e452dbULL, 0x5eee5cd453b2649fULL, 0xa6fe1729f3de510bULL, 0x1dde135f6fdc1983ULL }},
+  {{ 0x517a5977645d69a5ULL, 0x8b816684f1e5d03aULL, 0xf38c082e9443eeeaULL, 0x26717c36ceff4502ULL }},
+  {{ 0x58dae5088a658f4aULL, 0x766e52ea6427730bULL, 0xeec296399d2648e3ULL, 0x1b7586ee045894ebULL }},
+  {{ 0x8d29bf12c63d7b05ULL, 0xf9743e375b2ec755ULL, 0x83d2fa1e66a1f844ULL, 0x1e8169f850aa5399ULL }},
+  {{ 0xa9c1b026f602ae22ULL, 0x294636c64db826b6ULL, 0x3a66a3ef9db6b6abULL, 0x31a1881df6e0d1ffULL }},
+  {{ 0xb9b33181646fbda1ULL, 0x66a1c72513a39ed0ULL, 0xedeae8d8069140b3ULL, 0x14d5d977aa279c78ULL }},
+  {{ 0xf476366fce9a1298ULL, 0xa6771fcdbcbbb257ULL, 0x83ee3b05a236241eULL, 0x0ec4d66752536edaULL }},
+  {{ 0x4ee7a7933e4ec82aULL, 0xa6fa6aa5bb375d3bULL, 0x2e35219359c35ab7ULL, 0x36ea3a2e3fd26509ULL }},
+  {{ 0x4289e78140cfa2f9ULL, 0xd7a1e6ad8f596f6bULL, 0x5a86999f88b358f1ULL, 0x2663cb144ccfdeeeULL }},
+  {{ 0x0b2fdb6e687ea003ULL, 0x2d71b137452ecc02ULL, 0x13a37cf5685e8be8ULL, 0x225ba383c76e142aULL }},
+  {{ 0x26b8b497ed0ae43fULL, 0x5c7c7fb7e2394fe5ULL, 0xd480f5cdb28bd008ULL, 0x27acbc3747ccace9ULL }},
+  {{ 0x3c1d1b005431ecd9ULL, 0x2612c2273a94f4afULL, 0x1c64d14ce3a0f78bULL, 0x11dcc667cbdc5eabULL }},
+  {{ 0x2113364997b40485ULL, 0xbb20f686c2f2b392ULL, 0xcb9b0f2209ae7769ULL, 0x5298afca6ab5681dULL }},
+  {{ 0x64fa3d94b507a099ULL, 0x001fafd5f7524c79ULL, 0xccb759768c2aa066ULL, 0x3f7c20218ae9a5beULL }},
+  {{ 0xd683ca945fcd93b1ULL, 0x919556851918ed54ULL, 0x9a73db5f9e81f157ULL, 0x5a21da5c5fe7ab9aULL }},
+  {{ 0xe0f97e903553ccc4ULL, 0xe44691e24c56aa9dULL, 0x3f39ba0c2b524a08ULL, 0x6452e21c38b8231aULL }},
+  {{ 0xcea7b2f1ba17ce00ULL, 0x0605aa4ebd92bce8ULL, 0x4116a6ccc17b07aaULL, 0x07936b6fef78bf0aULL }},
+  {{ 0x310c6d43dc456ccdULL, 0x21e9aaba49d094e2ULL, 0xbb9f00ccf4850bfdULL, 0x1b109f98218986f4ULL }},
+  {{ 0x2d1a421d29784552ULL, 0x4099e563ae3183dfULL, 0xc76390859e4f390eULL, 0x12f076d40a69fcc4ULL }},
+  {{ 0xb53d26c97c8eea7fULL, 0x5e2ead07dd417201ULL, 0xe7656f9d427aa779ULL, 0x48abd6fe1f6fea42ULL }},
+  {{ 0xa5d2d1e473551a1eULL, 0x5eac20673bfc03abULL, 0x345147ee4f194bf2ULL, 0x0b1cfd86ad965ce3ULL }},
+  {{ 0xf57dbb598e4e1bbaULL, 0x2341f9c4cbbba629ULL, 0x23aae8d080bad720ULL, 0x1f7037e79e93a1d1ULL }},
+  {{ 0x4a5b8c7f6e874b1bULL, 0x174f3f41fc7a24eeULL, 0x726014d69df23a37ULL, 0x35056b465f28328cULL }},
+  {{ 0x81e86c194d4c8b80ULL, 0xde2ae530acf4d22bULL, 0xd5e89e808c74fec2ULL, 0x4ff78e41866aedc3ULL }},
+  {{ 0x69bdb7ccd11265a4ULL, 0x36b062e35ae9b7aaULL, 0xd7419870dcb1be00ULL, 0x6b86943b84aa0c6dULL }},
+  {{ 0x438d915a42edc417ULL, 0x469ab9fe0bb94841ULL, 0x342c7f35df16ac18ULL, 0x022ee710545086aeULL }},
+  {{ 0x4debc84ddd096d97ULL, 0x42f103f4245d7c8eULL, 0xe29de93387a05aaeULL, 0x2365bbb040fdaa39ULL }},
+  {{ 0x99254cbb6b8803efULL, 0x07c406c417eeed5dULL, 0x3847cc98ccd11a2bULL, 0x142bcc50a35f9c5dULL }},
+  {{ 0xa69b63d686972910ULL, 0x5bf951dcc232802fULL, 0x9dc8e3176b8c02c4ULL, 0x1bfc97d0b3f6cb07ULL }},
+  {{ 0x7b3e01e6e0f9170bULL, 0xa7aed5d1b6605c5eULL, 0x82d2c6388199e04eULL, 0x2c4a78f14f734ce3ULL }},
+  {{ 0xe9181055a9d43046ULL, 0xa80e4f594d216320ULL, 0x8f6f692f628bd2deULL, 0x6c8b4515ce8d47bbULL }},
+  {{ 0x3a5f76afce35650bULL, 0x818c7a6fc10c6af1ULL, 0xa1221d0f8c72936dULL, 0x734a05a059468ffeULL }},
+  {{ 0x869609cdb0aed1efULL, 0xfe7baf7965e83128ULL, 0x9237f6b11599bf1bULL, 0x687af3367cc8a92dULL }},
+  {{ 0xed92e7457b610234ULL, 0x34b10eef56dc1f5fULL, 0x20a2866b2ec10d6dULL, 0x63984ab28da620cbULL }},
+  {{ 0x8a06c9d36f6c2431ULL, 0xfa3a8b86a2a69dc2ULL, 0x1e80a9a8eb028c0fULL, 0x33a74cc17c77f4faULL }},
+  {{ 0x519aeafb9fc6457aULL, 0x68a98dc41d548b02ULL, 0x063f762004ba8949ULL, 0x25edf73e194b08baULL }},
+  {{ 0x1004025edaed4f35ULL, 0xefe12e280f7c3a3fULL, 0x97a01d52c94fdf1fULL, 0x46c949e8805408adULL }},
+  {{ 0x9d4f47558c981640ULL, 0x892b230f7f04719eULL, 0x767b69b9eb5ed2f7ULL, 0x0fb13cde5c659be7ULL }},
+  {{ 0xecb222e15fe30ad8ULL, 0x09b23d25ae28a9d9ULL, 0xa5e2ea32d6266eabULL, 0x0d39d9f999b8dd8aULL }},
+  {{ 0x3641a4cc6e92297aULL, 0x2c276c49bec812a6ULL, 0x74901fb16b198ccdULL, 0x5b0e3b5c79ac42ceULL }},
+  {{ 0x0a5d3152f464a2fdULL, 0x3fc899a8db59b59cULL, 0x20328ad5bf6b068fULL, 0x0ef18f5739a76174ULL }},
+  {{ 0x939d2d64838d2c81ULL, 0x84e96fd462830f5bULL, 0x3ea7d14ea9c48555ULL, 0x3c402882cb6dd3f5ULL }},
+  {{ 0xd2b35cbd9793c351ULL, 0xfed70c7bdab7c064ULL, 0xda4268587f9084deULL, 0x645847504f58a408ULL }},
+  {{ 0x95f02ff8730019f5ULL, 0x7efd1322e447c967ULL, 0x0b25c03e86e3809cULL, 0x5a85ec4e5e0f2db0ULL }},
+  {{ 0xc3fd2f2a66c14eb9ULL, 0xec1a47fd333ffe4fULL, 0x0e75c705791541f8ULL, 0x3343e473b7843b9cULL }},
+  {{ 0x3a70f0425a3d6a58ULL, 0x074988cdfd35b6daULL, 0xb8475ff00bc500f3ULL, 0x2b0cdf95d8c92285ULL }},
+};
+
+/* t = 3 */
+static const unsigned P2_T3_ME_DIAG[3] = { 1, 1, 1 };   // ME[i][i] - 1
+static const unsigned P2_T3_MI_DIAG[3] = { 1, 1, 1 };   // MI[i][i] - 1
+static const p2_fe P2_T3_RC_EXT[P2_RF][3] = {
+  { {{ 0x996cd1797fa81b71ULL, 0x777f5fa470f8c3e6ULL, 0x97d62aa17c654e98ULL, 0x40f8df6f6f6265b1ULL }}, {{ 0x2d900ac097469949ULL, 0xb28b1f5bbafa4007ULL, 0x2fb64e6fbc1b1313ULL, 0x2ae97eadb6bbe3e1ULL }}, {{ 0x15862097e59d5969ULL, 0x1aaeb8d9c42c32f5ULL, 0x03802924f535027aULL, 0x090f86762aee28c8ULL }} },
+  { {{ 0x4ef41a41d2766f17ULL, 0x6e7c5345c9193a1cULL, 0x70c31698e6807429ULL, 0x25b1ebacf691aaaaULL }}, {{ 0x4646d6dd977e7a38ULL, 0x8953df592eae053aULL, 0x1b05bd5b676ce5b2ULL, 0x3522fbc5fd58ce20ULL }}, {{ 0xdacb02dbc8489cf1ULL, 0x8535c3334ba7092dULL, 0xba5ff10068e6468dULL, 0x1fdfa008e7d1a5cfULL }} },
+  { {{ 0x6db61b4e8d9d683eULL, 0xd475d431bb8db50bULL, 0x999b5953eaac9333ULL, 0x6f7e6ef2d7ce9215ULL }}, {{ 0x41c5e4d6b7541edaULL, 0x2aee21a7a3dc19b0ULL, 0xba9b62c01037fd3dULL, 0x44d128de53fd59bcULL }}, {{ 0x4334938a3f14505cULL, 0x67d4ddb9665d8354ULL, 0x562bb96970bc5c78ULL, 0x011d48d6fb4d8982ULL }} },
+  { {{ 0xecdd3a6d1dd8bfdeULL, 0x2fd279cf03c55f24ULL, 0x0da080310e71fb34ULL, 0x6165bcefdbb29dcfULL }}, {{ 0x7951eb8bddc8962bULL, 0xac257fa9959f31eaULL, 0xf398265e05b65e4fULL, 0x0981ea21943185e7ULL }}, {{ 0x8f50eeece9314d55ULL, 0xafc5e06a88caf6d1ULL, 0x4ca2d7ba9c0ed13aULL, 0x354f2381ca543402ULL }} },
+  { {{ 0xe6f54deaa618fde6ULL, 0x27f1b4af434278e6ULL, 0x76871c19085abeb3ULL, 0x638e72ad7ed74aa7ULL }}, {{ 0x02a04b51cdd4da48ULL, 0x149b3515d353caf8ULL, 0x86ab0b785b9291d8ULL, 0x032170b0ad810c0bULL }}, {{ 0x09c0baf5beefffc8ULL, 0x1bff8a1648d6d89eULL, 0x51076a6f5eb79094ULL, 0x25753cdbd98f6d00ULL }} },
+  { {{ 0x80fc516da39a3be6ULL, 0xe809be3fe09bb924ULL, 0x79f160b532af715cULL, 0x605f406a180de01dULL }}, {{ 0x07028ce3dac354eeULL, 0x0d2bfdc10eee2df4ULL, 0x4e06c83204a8fd54ULL, 0x4c33c6b885339fddULL }}, {{ 0x59366da72d89d308ULL, 0xb609dbb47b0622f4ULL, 0x381c015b6213f9a3ULL, 0x149adc9bf07fc0f6ULL }} },
+  { {{ 0xb29935bbf6809684ULL, 0x7728dbe1112cf04cULL, 0xcead09afb847e3f5ULL, 0x090fa3779d9b38acULL }}, {{ 0xc4710f19cc0a5b97ULL, 0x591d5815ede5ad3aULL, 0x35852e41ad4e937fULL, 0x431627f436ed80d9ULL }}, {{ 0x8f892dccf48e910cULL, 0x0e0199c1166a5baaULL, 0x8b60f60ecd416fd6ULL, 0x2f71bafc21c9d66fULL }} },
+  { {{ 0x5849fe67e85ec42eULL, 0x93b5f5584a7fc324ULL, 0x8f9f8cc85fba6db8ULL, 0x44891ec3816060baULL }}, {{ 0x4bdb9c06c4202e28ULL, 0xcb7485d30a915b5cULL, 0xe628a228a6da3fc6ULL, 0x134f8c2a09bbbc6bULL }}, {{ 0x3b5fe4846bf72324ULL, 0x9c0482d6ddef3bbbULL, 0x709020f991d2c48cULL, 0x59aa5933b45cff29ULL }} },
+};
+static const p2_fe P2_T3_RC_INT[P2_RP] = {
+  {{ 0x5363d04010b2f85dULL, 0xb93e1e31a6d0955aULL, 0xdc313d4b9cd8cac5ULL, 0x24731169266e1208ULL }},
+  {{ 0xd573613bf9f8f171ULL, 0xa32bd27ed3e43599ULL, 0x858bffb2fd28e1b9ULL, 0x12f8635f798292f3ULL }},
+  {{ 0xc62524a1b03eeff0ULL, 0x6797649156639412ULL, 0x5a788dd24daab8d7ULL, 0x370a45fc13450d98ULL }},
+  {{ 0xa48349af2a486e10ULL, 0xcaa4c0dbb7b11f3eULL, 0x9385e0d8acd57ee1ULL, 0x3304d9723f1a9660ULL }},
+  {{ 0xe53a646c108e3d57ULL, 0x243678fbe26d95e3ULL, 0x602d4406af5839a9ULL, 0x27660b3166a4fc80ULL }},
+  {{ 0x94ce29396751de68ULL, 0xaed7fd0dc068f55cULL, 0xe464a399281d9cefULL, 0x262cd7c4f84df97cULL }},
+  {{ 0xf61d563b3b04da3aULL, 0x08c15787592d45d5ULL, 0x7bfae080a5055a18ULL, 0x5b75672fae51aa50ULL }},
+  {{ 0x2370115fe4fe7b67ULL, 0x970681830b3d8b3fULL, 0x21f0ae0f82119f20ULL, 0x371254b2d66951feULL }},
+  {{ 0x038fd480c558ef85ULL, 0xd6c705293478de4dULL, 0x4227eb974f568e89ULL, 0x200c3fad335b8cd2ULL }},
+  {{ 0x334df6b28564f2c7ULL, 0x3dff91e7b436b202ULL, 0xf55defb40f324281ULL, 0x09989e755d10b029ULL }},
+  {{ 0x782ee305ab1f9ae8ULL, 0x828e25434f03e69eULL, 0x680970ac308fc087ULL, 0x6de345e488a309b0ULL }},
+  {{ 0xfd49244ad8ef7876ULL, 0xbb56fa3ab77c640fULL, 0x29f9016b1218c10dULL, 0x577e7d591f2859fbULL }},
+  {{ 0xedd64252688b5622ULL, 0x0791ab2268ace03bULL, 0x214dad145cd5c8ecULL, 0x21d7772683554cf1ULL }},
+  {{ 0x76f977faa8f7bb09ULL, 0x2d5f97d70301c423ULL, 0x79a1f73028cf2532ULL, 0x26b622d6bcefc649ULL }},
+  {{ 0xf2dd8f10d210c051ULL, 0xdd3637ca6ac97c55ULL, 0x467219153b9aa13bULL, 0x204bd0d38183eb71ULL }},
+  {{ 0x428ed4c7362fcb97ULL, 0x050cac659707ea79ULL, 0x57754c89f596b30fULL, 0x65924cff7b4bcc32ULL }},
+  {{ 0x1aae8ce4a964a714ULL, 0x281202a13baee890ULL, 0xe2e2cdae8a899808ULL, 0x085555dfbd764ff2ULL }},
+  {{ 0xd8f75bc831e715e0ULL, 0x19ad4480405acfb5ULL, 0x2ca859040b7a6fb3ULL, 0x1aaa99f70f923cbcULL }},
+  {{ 0x5118ceabf6071828ULL, 0x14764f527a270a69ULL, 0x6847d4d2c9279dd0ULL, 0x15cd495ee7886cc0ULL }},
+  {{ 0x8e2f9461bb095a6eULL, 0xd8d70b600c37a45fULL, 0x13a7b71f859f7202ULL, 0x5f09d6cf22cf3b7eULL }},
+  {{ 0x60aa626469f93c32ULL, 0x40b93eec42c8991eULL, 0x6cc9dd156392da79ULL, 0x3a3f67ccf6edc4f5ULL }},
+  {{ 0xe2a547e1b0ca0fe7ULL, 0xe2a8d3573f91b301ULL, 0x03ec47d7fd56589eULL, 0x59d28f91aa835a28ULL }},
+  {{ 0xf4b41602d61b6bddULL, 0xaffa324bd4e995c1ULL, 0x3b78e9700f191a36ULL, 0x6b657e50b3ef3c05ULL }},
+  {{ 0x94de2c71bd42b514ULL, 0x69ea8952577d9c4aULL, 0x054e1d50388752f6ULL, 0x3c17a0c571465892ULL }},
+  {{ 0xc5bab36ea9081b9cULL, 0xc1c34c20b33b746fULL, 0x086cbabf2392024fULL, 0x1168973a46346dfcULL }},
+  {{ 0xedb8bfac047d29f4ULL, 0x3f4797ba8334b341ULL, 0xb68972c1e59eba1bULL, 0x2795c7fa7ae8ce03ULL }},
+  {{ 0x99dc5ee2c30ac96eULL, 0x1b757916140d07fcULL, 0x7ea6f42c5947afbfULL, 0x3c143fda4d80248cULL }},
+  {{ 0xc62402418f809ea6ULL, 0x3f37451bfbd531ceULL, 0x162f8e3af148a67eULL, 0x5824ab5b69064e5dULL }},
+  {{ 0x7f646d80490a05c5ULL, 0x9c863d935dd5ad97ULL, 0x110380bf81353162ULL, 0x5035734359a85ffcULL }},
+  {{ 0x5115c54d4a0d2335ULL, 0xb9d1eb4bc241564aULL, 0xdab4037ad9de9193ULL, 0x414731b306cb83baULL }},
+  {{ 0x4ad93868026ba479ULL, 0xd1d62d17f78e744cULL, 0x4ef550e4d4fb7940ULL, 0x00560ae3ef95b554ULL }},
+  {{ 0xbbab25a9d42da9d6ULL, 0xc0bbdcc3911c8fceULL, 0x3b2c5452cfd40579ULL, 0x5390aa260f588d97ULL }},
+  {{ 0xc2ce79c398289e86ULL, 0x589504841e7d4c2eULL, 0x2474fbbfac21eec0ULL, 0x3af4206dcd9c29deULL }},
+  {{ 0xe168c87860ee0896ULL, 0x2ecea16ec1c3a81eULL, 0x2d8f66db7a5d6cc3ULL, 0x6fa22b99ef6a6937ULL }},
+  {{ 0x4bb8f485f4e62620ULL, 0x683aa91cd8afdf7dULL, 0x91a70770818ba8c7ULL, 0x1c3af9adb51c5eceULL }},
+  {{ 0xbccef14dce58d480ULL, 0xe8e37bd888dc0433ULL, 0xdeb42964f8f3d2e2ULL, 0x3c34b990820e7fdcULL }},
+  {{ 0x7558f6db364881dfULL, 0xcf523233efa46fe4ULL, 0xc7b089bec222ca72ULL, 0x148fb86855fdc1f0ULL }},
+  {{ 0xc92e93794934f606ULL, 0xa4cbb64f2dffee4eULL, 0x8a5107b854e5b246ULL, 0x1bd4f4d600b8c943ULL }},
+  {{ 0x4855223bd6feac7dULL, 0xd9d4c55f1d8f17d8ULL, 0x8040f17237eaca17ULL, 0x21b2fc3326ae5a5eULL }},
+  {{ 0x6e486d895d09cdf9ULL, 0x023b3166a363772bULL, 0x3592636f7772e472ULL, 0x2653c5b664f363d0ULL }},
+  {{ 0x24e9dff20377a666ULL, 0x887b895c93bfbc01ULL, 0x4b8593b04c0800a0ULL, 0x4e298c8feb507adbULL }},
+  {{ 0x15f4a676a4a27e68ULL, 0xa297b15c70293f80ULL, 0x9dd78f9214555235ULL, 0x44c0f1322bc14938ULL }},
+  {{ 0x5592a5affbeb2bffULL, 0xa045a4a7b627fb6dULL, 0x2ec03908479e1456ULL, 0x4c00d5969bd809bbULL }},
+  {{ 0x7246060e7eb35202ULL, 0x92683ffcaf472835ULL, 0xd22e4a994882a608ULL, 0x6e174d6616812942ULL }},
+  {{ 0x368976791dbd68f0ULL, 0x841bd8e2e0841df9ULL, 0xdc4ece3dfcfdcfd0ULL, 0x3eeb540d073f0d7eULL }},
+  {{ 0xff646c2bf45d90ffULL, 0x6ebc4a2775eda4efULL, 0x9cf6d51b4de0e2a4ULL, 0x6f90b44cf3082a7fULL }},
+  {{ 0x94725f5ac69984a0ULL, 0x5184ff3713d9964cULL, 0x13ffba4e9c79bad5ULL, 0x422cfb266b1f2d3fULL }},
+  {{ 0x2a1871b02b4c6a17ULL, 0x544f652a3253d01aULL, 0x435fe5ae62838f7dULL, 0x3310eae1839564f7ULL }},
+  {{ 0xbb91db5a5dccea09ULL, 0xc0b2b5235ac8c6baULL, 0x17885a1bb16ee552ULL, 0x45aa6703da21d12dULL }},
+  {{ 0x1bb9ab3c507ddb66ULL, 0x151f9636557b01c0ULL, 0x0e379da9056182e8ULL, 0x27ec1f4978693efaULL }},
+  {{ 0x57cc545b3b5ab3c9ULL, 0x261813daca95f531ULL, 0x164b6817d1bdfecfULL, 0x169b6c78d0253fb7ULL }},
+  {{ 0x5c4b61e698ed0309ULL, 0x428b1edb165d4fd0ULL, 0x97b78ea9b7d43b20ULL, 0x44d91faa1dfae166ULL }},
+  {{ 0x9062e45b93ceb2adULL, 0x7e4420fa983e1435ULL, 0xf1bf9f75f8bb1619ULL, 0x15519694589ddc51ULL }},
+  {{ 0x06a6e6584a18293bULL, 0x4e01914cc56df745ULL, 0xd4fd606f49225020ULL, 0x07ec100885de91f1ULL }},
+  {{ 0xac0007025381320eULL, 0x125b35c987999bc1ULL, 0x87c4814ab127cd5fULL, 0x1b668a2d537af309ULL }},
+  {{ 0xf6f6ce254e9bf375ULL, 0xd86b2b0facc3c34fULL, 0xf9c9c02cad395a4cULL, 0x584f7fcade6506f2ULL }},
+};
+
+/* radix 2^52，R' = 2^260（poseidon2_ifma.c） */
+static const uint64_t P2_MOD52[5]  = { 0xfffff00000001ULL, 0x02fffe5bfefffULL, 0x9a1d80553bda4ULL, 0x7d483339d8080ULL, 0x073eda753299dULL };
+static const uint64_t P2_M0INV52   = 0xffffeffffffffULL;
+static const uint64_t P2_TO52[5]   = { 0x00234fffffdcbULL, 0x61039ef635000ULL, 0xdce3c3e2e7505ULL, 0x7fa6f1563642bULL, 0x0247db575276aULL };   // 2^264 mod p: x*2^256 -> x*2^260
+static const uint64_t P2_FROM52[5] = { 0x00001fffffffeULL, 0xfa00034802000ULL, 0xcbc4ff55884b7ULL, 0x056f998c4fefeULL, 0x01824b159acc5ULL };   // 2^256 mod p: x*2^260 -> x*2^256
+static const uint64_t P2_T3_RC_EXT52[P2_RF][3][5] = {
+  { { 0xd179ffa81b708ULL, 0x2f0f995e7196cULL, 0x946295cda08daULL, 0x70d7e393e9d77ULL, 0x07020bc5da93aULL }, { 0x0ac0e7469948bULL, 0xacafac3477d90ULL, 0x187f92085fdc1ULL, 0xcba9fb43aed39ULL, 0x06af3a63b9baaULL }, { 0x2097f59d5968fULL, 0x9942c4d352586ULL, 0x9ae4f9c572de9ULL, 0x0f3804c8ba474ULL, 0x01d0ac00f8545ULL } },
+  { { 0x1a4222766f16bULL, 0x4d919bd5c9ef4ULL, 0x7de0a7c451100ULL, 0x383e0c1031663ULL, 0x0177a762f9907ULL }, { 0xd6de077e7a379ULL, 0x7deaebcfab646ULL, 0x36173034b0e79ULL, 0x750849c6ed7e3ULL, 0x026b02919b23eULL }, { 0x02dc08489cf0cULL, 0x28ba7722e1acbULL, 0x7dd08c30465a3ULL, 0x67dad917afe66ULL, 0x02e436341d6a4ULL } },
+  { { 0x1b4f7d9d683d1ULL, 0xeeb8f3ecc5db6ULL, 0xa4d8aed5f40a6ULL, 0xca1e9951ecc61ULL, 0x02cfa214e0caeULL }, { 0xe4d747541ed97ULL, 0x5f3dd05f0d1c5ULL, 0xccf3ba2bd3756ULL, 0x3441dcad93b8aULL, 0x039b7abf8c94cULL }, { 0x938a3f14505c0ULL, 0x9665d83544334ULL, 0xbc5c7867d4ddbULL, 0x982562bb96970ULL, 0x011d48d6fb4d8ULL } },
+  { { 0x3a6dedd8bfdd3ULL, 0xc93c6b465bcddULL, 0x9e7bafdbc8648ULL, 0x804640180aa86ULL, 0x0334a4fc49e2aULL }, { 0xeb8bedc8962afULL, 0x9659f4c2a8951ULL, 0x1c40cf56e9a56ULL, 0xe13706488dd85ULL, 0x02430fac6197aULL }, { 0xeeed59314d549ULL, 0x938cbae91ff50ULL, 0xd802b85b22e8aULL, 0xd32b639893717ULL, 0x02972a4d681f4ULL } },
+  { { 0x4deb7618fde53ULL, 0xcd343ce27b6f5ULL, 0x873f2ed3e79f6ULL, 0x4dccce81c9280ULL, 0x055d5ab9ed075ULL }, { 0x4b51cdd4da480ULL, 0x5d353caf802a0ULL, 0x9291d8149b351ULL, 0xc0b86ab0b785bULL, 0x032170b0ad810ULL }, { 0xbaf60eefffc7bULL, 0x558d75bde59c0ULL, 0xb4fd1271d446dULL, 0x5d9c10556ecdbULL, 0x013af891dc8e3ULL } },
+  { { 0x516e739a3be53ULL, 0xd709d0e6550fcULL, 0xdbf1d893ffa8fULL, 0xa52d052612eaaULL, 0x022e2876863deULL }, { 0x8ce47ac354ed6ULL, 0xf2eef3474a702ULL, 0xa3d650b8d5773ULL, 0x1902e02a12cfeULL, 0x03bf3e248b313ULL }, { 0x6da74d89d307eULL, 0x41b0657747936ULL, 0xdfbea30b92273ULL, 0x14d31b4c65a60ULL, 0x061d27b18b4c1ULL } },
+  { { 0x35bc06809683fULL, 0x0e12d0a8cc299ULL, 0xadc67521ed01aULL, 0x0d84b796c2f37ULL, 0x01d0c9026b016ULL }, { 0x0f1a5c0a5b967ULL, 0x43de6997b5471ULL, 0xe389fc5a02abdULL, 0xa6098b4a4bd27ULL, 0x01e079d56f84eULL }, { 0x2dcd548e910baULL, 0xff66af92aef89ULL, 0xa4bed40e9a7c3ULL, 0x774782b450bc9ULL, 0x03f89c3cf22ecULL } },
+  { { 0xfe68785ec42d7ULL, 0x69a80af64e849ULL, 0x4f6435949b491ULL, 0xa41f2cf0343daULL, 0x035370a4b9f7cULL }, { 0x9c06e4202e27eULL, 0x2aa918fdc6bdbULL, 0xa604c620fcd15ULL, 0xcc2dfc16727a5ULL, 0x04d1d73fa4880ULL }, { 0xe4852bf723234ULL, 0x49df076bbfb5fULL, 0x9962889d3647dULL, 0x1334a24bef38aULL, 0x02b81bb55526eULL } },
+};
+static const uint64_t P2_T3_RC_INT52[P2_RP][5] = {
+  { 0xd04060b2f85cbULL, 0x0b6d1189aa363ULL, 0xd637440f12dafULL, 0xae24c2f29c919ULL, 0x0038cd1f296cdULL },
+  { 0x613c19f8f170eULL, 0xe73e46a19f573ULL, 0xf4a6b8f8b41dfULL, 0x34a7f24c4b1fbULL, 0x047aae75144eeULL },
+  { 0x24a2203eefef9ULL, 0x006644bd33625ULL, 0x73ea5512f46cdULL, 0x6c8c40f3f4ec9ULL, 0x04524cc7b1102ULL },
+  { 0x49af9a486e0f9ULL, 0xa67b1d6ff1483ULL, 0x9eb05f7601c91ULL, 0xf90fd1c925528ULL, 0x004ce03ddce5aULL },
+  { 0x646c608e3d56bULL, 0xaf26e1924353aULL, 0x55a6277a0b35bULL, 0x559d02b30842cULL, 0x032bc6e769a3cULL },
+  { 0x2939b751de67bULL, 0xcd069789ce4ceULL, 0x1b096e04acb9cULL, 0x25654629016a5ULL, 0x01f2937afb4ccULL },
+  { 0x563bfb04da394ULL, 0x5192e80d6b61dULL, 0xcbf81409f31c8ULL, 0xc5a558f7e7a9dULL, 0x048329b14f1b8ULL },
+  { 0x116054fe7b669ULL, 0x1bb3e42ff9370ULL, 0xdad09e426389cULL, 0xb2e8b875f8bfdULL, 0x045a5b7e74346ULL },
+  { 0xd4810558ef84cULL, 0x87479474d438fULL, 0xee188881d79c2ULL, 0xd80355975954cULL, 0x0310d5d868f42ULL },
+  { 0xf6b29564f2c6fULL, 0x78436cc42434dULL, 0x982500e8c3b7aULL, 0x855722a52338eULL, 0x0259c4002a76dULL },
+  { 0xe3069b1f9ae71ULL, 0x07f05705f682eULL, 0x880602840c5b8ULL, 0x43cb8033624a7ULL, 0x01347906919f6ULL },
+  { 0x244b98ef78754ULL, 0x8777d9f10bd49ULL, 0xdf5f09bc88bf3ULL, 0xc05038d9f650aULL, 0x008c3fdabff23ULL },
+  { 0x4252a88b5621cULL, 0x1a8ad493c2dd6ULL, 0x6d52eab2a2422ULL, 0xd9f147f37125aULL, 0x04dc0d51b8edeULL },
+  { 0x77faf8f7bb08bULL, 0x613024763c6f9ULL, 0xcc91b08334549ULL, 0xf22e99fe3ada5ULL, 0x027bde8cbfee8ULL },
+  { 0x8f111210c050cULL, 0x9aac9e55632ddULL, 0x322b3a8846cecULL, 0xc1f39a3a31339ULL, 0x035066feb71c8ULL },
+  { 0xd4c8162fcb962ULL, 0x2f70959fa228eULL, 0x29160a5bc6bceULL, 0xe932aa2af82edULL, 0x00225a96b6e1fULL },
+  { 0x8ce4b964a713fULL, 0x10baf02d02aaeULL, 0xef7a87d2d6286ULL, 0x81e5faf302e09ULL, 0x01167b6a8adc7ULL },
+  { 0x5bc861e715dfdULL, 0xfb05b1e7608f7ULL, 0xac173219f9b5bULL, 0x53ea30d808289ULL, 0x04ee0a9777c4bULL },
+  { 0xceac26071827dULL, 0x1ea2759298118ULL, 0x59454f14c2c09ULL, 0x542deacfc5147ULL, 0x0010b9ff4fbaeULL },
+  { 0x94628b095a6d3ULL, 0xd9c38f9a05e2fULL, 0xcbf27e84ccf61ULL, 0x5b36a08b798fdULL, 0x00d8bedb90ff4ULL },
+  { 0x6264e9f93c318ULL, 0xac2c96b1ee0aaULL, 0xc1ee7696da6ceULL, 0x651532cf1115eULL, 0x00489423621f0ULL },
+  { 0x47e270ca0fe64ULL, 0x4ff92ee02a2a5ULL, 0x1cf69ae3da985ULL, 0xc31dd80e5d1f6ULL, 0x02e052134b4d3ULL },
+  { 0x1603b61b6bdc2ULL, 0x934eb0542d4b4ULL, 0xab7d3206b442cULL, 0xe660ea64c6906ULL, 0x05f58be7ef856ULL },
+  { 0x2c723d42b5138ULL, 0x0d77e6e4b14deULL, 0xb666f3c00bb75ULL, 0x9edebb1314c33ULL, 0x0220cd1bdc779ULL },
+  { 0xb36ec9081b9beULL, 0x0533ba8efe5baULL, 0x5dc74f174b97aULL, 0xe5302057fbe22ULL, 0x02eae24fe100bULL },
+  { 0xbfac547d29f3bULL, 0x9933536823db8ULL, 0x9c2699951c547ULL, 0x6dd26875f3f62ULL, 0x035b83b07de79ULL },
+  { 0x5ee3430ac96d8ULL, 0x4940dd9fd19dcULL, 0x76c3bc7196a71ULL, 0x5e8650a082854ULL, 0x021d6c30b8b16ULL },
+  { 0x02424f809ea54ULL, 0x9bbd66ccf8624ULL, 0x0f447a40690a1ULL, 0x066efc42c34eaULL, 0x01326ddd09d03ULL },
+  { 0x6d80f90a05c45ULL, 0x14dd6ce582f64ULL, 0x95ecdef2f3dcdULL, 0x9da6dcbbc39faULL, 0x0082103a2d0c1ULL },
+  { 0xc54dda0d23347ULL, 0xa1242428ae115ULL, 0x738810bab73f0ULL, 0xd423de379f654ULL, 0x001183943f62eULL },
+  { 0x3868026ba4790ULL, 0x7f78e744c4ad9ULL, 0xfb7940d1d62d1ULL, 0x5544ef550e4d4ULL, 0x00560ae3ef95bULL },
+  { 0x25aa842da9d55ULL, 0x1811db08f6babULL, 0x34c0f617297c0ULL, 0x77597f48fcd49ULL, 0x03dd471ce2bc4ULL },
+  { 0x79c418289e858ULL, 0x29e7e1e2f42ceULL, 0x5102bdaeb6328ULL, 0xb3a0ad80fbba7ULL, 0x00fd4cc438cd6ULL },
+  { 0xc87950ee08951ULL, 0xbf1c531dfd168ULL, 0x55b23e304cd7aULL, 0x3c37d892c53f1ULL, 0x02f35ebbf866cULL },
+  { 0xf48624e6261fdULL, 0xc48b02e3d7bb8ULL, 0xbd504668871a5ULL, 0x751080c2eeeffULL, 0x067e6a4e1d4edULL },
+  { 0xf14e4e58d47f8ULL, 0x708dcd6343cceULL, 0x22e6e03f04a9dULL, 0x138c5173d60f4ULL, 0x023de5e6ed3fcULL },
+  { 0xf6db564881deeULL, 0x38fa4a4649558ULL, 0xee8f7224da7dbULL, 0x247c1494ebdc0ULL, 0x0612037df0ca1ULL },
+  { 0x93797934f605dULL, 0xe9e003d0ef92eULL, 0x1759c5a518278ULL, 0x1c600b62f36d3ULL, 0x0618657668eb4ULL },
+  { 0x223c16feac7ccULL, 0xe5d8f80d88855ULL, 0x82541684e55c5ULL, 0xb0c73727b7035ULL, 0x04b7925e5c46fULL },
+  { 0x6d89ad09cdf8bULL, 0x5b363fa6bbe48ULL, 0x7050f0580fee2ULL, 0xca9a5904fecf4ULL, 0x0219816c67f22ULL },
+  { 0xdff2a377a6656ULL, 0xab3c0c281c4e9ULL, 0x02d99d342502dULL, 0xc8e2b816cab46ULL, 0x05b503fbf14e0ULL },
+  { 0xa67734a27e677ULL, 0xac02a2bc0a5f4ULL, 0xea48b2a37d051ULL, 0x2c00107060d8eULL, 0x038b43136458bULL },
+  { 0xa5b09beb2bfe6ULL, 0x5d62901edf592ULL, 0x98ed534bef1e2ULL, 0xb6e0ebc120341ULL, 0x038c4d02a1d59ULL },
+  { 0x060f6eb352011ULL, 0x9df48b1f66246ULL, 0x7aeb8393e6763ULL, 0x3cf22281011bfULL, 0x016880881f7d8ULL },
+  { 0x76799dbd68ef8ULL, 0x16084eff9b689ULL, 0x2ce3cdda3d06eULL, 0xedac2b1e239f8ULL, 0x04f4806372704ULL },
+  { 0x6c2ce45d90fe1ULL, 0x4a5ef2eb0ef64ULL, 0xd9281f703a806ULL, 0x50becf09a93c4ULL, 0x02e1e76efc048ULL },
+  { 0x5f5b5699849f7ULL, 0x563da828d2472ULL, 0x0eb152526a52fULL, 0x6c6772f30ca17ULL, 0x00f74d07a3b69ULL },
+  { 0x71b09b4c6a169ULL, 0x8e25487da9a18ULL, 0x4cc0faffac6d6ULL, 0xe27acf6972adeULL, 0x0058f1ad21607ULL },
+  { 0xdb5aedccea087ULL, 0x1aac9b2fb4b91ULL, 0x03dbcfc19808eULL, 0xab47ab7d0972cULL, 0x0474b8e512b93ULL },
+  { 0xab3ca07ddb65bULL, 0x5657b85006bb9ULL, 0x5eef666af452fULL, 0x7d37e358a2682ULL, 0x03b1daff7b680ULL },
+  { 0x545b6b5ab3c8dULL, 0xa3a9643f187ccULL, 0xefa64e2664851ULL, 0x8398cb08f964fULL, 0x00dedd193857bULL },
+  { 0x61e728ed03087ULL, 0x9665e3c10ec4bULL, 0x69319d4370729ULL, 0xaedfae7052532ULL, 0x03a3718b56924ULL },
+  { 0xe45bb3ceb2aceULL, 0xa383e48b5b062ULL, 0x86db18d3cc6c7ULL, 0xca8eb586474f7ULL, 0x06d3e1a9f36a2ULL },
+  { 0xe6585a18293afULL, 0xc956e118516a6ULL, 0x88329ff8c5b70ULL, 0xa1d51c9c2eec8ULL, 0x00ad35935344bULL },
+  { 0x07028381320ddULL, 0x8f799ea81dc00ULL, 0x5974de12a7a70ULL, 0xb8bfe29a8c92fULL, 0x05a9facdbbad6ULL },
+  { 0xce260e9bf3744ULL, 0xd6cc4fe50b6f6ULL, 0xfff848d99cf00ULL, 0x8fcd35e5e26a5ULL, 0x015d424c7f2eeULL },
+};
+
+#endif
@@ -0,0 +1,526 @@
+pragma circom 2.2.2;
+// generated by gen_poseidon2_circom.py from poseidon2_t2.json / poseidon2_t3.json, do not edit
+// 域为 BLS12-381 标量域，编译时加 --prime bls12381
+
+// x^5：x2 = in², x4 = x2², out = x4·in（3 个约束）
+template Pow5() {
+    signal input in;
+    signal output out;
+    signal x2;
+    signal x4;
+    x2 <== in * in;
+    x4 <== x2 * x2;
+    out <== x4 * in;
+}
+
+// t = 2：线性层只在 var 中累积线性组合，不单独成约束；每个 S-box 3 个乘法约束，共 72 个 S-box
+template Poseidon2Perm_t2() {
+    signal input in[2];
+    signal output out[2];
+
+    var RC_EXT[8][2] = [
+        [28190638184273239630947439084195856085921000439146840783584026567815066165439, 23146689049395223273367083048852910554079089497058095885506954026537886531810],
+        [911160006391871914410543126818296927026095846189530853657892075540214077515, 27202533394301850560167963843327746668672554670052606738436749945277244353172],
+        [44944980911306516781131672448901792878697036811988302507719932173419205433388, 19001684455661569566229517914344076522845713257318233511896883373554868215442],
+        [47371723582938090571682136516979038196004246736634499318038604830892875267213, 14451021715352241013390445210290125685780410256293035225089951924558220097591],
+        [26072799126958157134832901403092723391044956913761881884147972489398927880978, 50929713509578750424613236889197435789856876885008168984648260474765264214802],
+        [11861063765783342387127823031145344912357038656633001403755731315260121346573, 40627237836096381086172736546614304504195602158441793958946677557825265875492],
+        [32784596225251533830089892884419870886611260668015879844360808523509749954110, 20535812275592068792288147847670212683650965787655588990970419572712489514995],
+        [4828536038299758562001334217462295754488675753797715556809008068327566159353, 19295234669611537581022897489292893764184418070253517225300740270796025621699]
+    ];
+    var RC_INT[56] = [
+        3965561560783351624388523263160503770393509095856008843003113265219797160326,
+        14112297029953315310955313538776547970661362928250732236597183502065241621481,
+        8999564996403015728933836812096111119705152275405960418656823529611591475848,
+        34946059665841708560025869744875025219082751845572015735010361459238249543081,
+        12887558264246606662432585169182027646856850266472117340889020685420070178852,
+        39997257894796915777849321169782001125355695543134466448307086624624867240811,
+        11757388543857375580896687765044135203665318841832431260702026920261040407906,
+        51906305906318589804271261420986098804139677734703530443794529168231686284988,
+        38210236747844479125696836812526274885720923201831471616600568165687573456428,
+        9412806315626774107358156185572186074959750528842554487871015688278294011622,
+        51394524809882035901539072103966414218735376037764535770263717493476631811656,
+        4703693786077848058781313142074498584400637151983945486655871752632666221723,
+        45813926300621208663356251914366404796694685456553681281631074402432185641777,
+        51375895340934137880575885957889635527410352803933951349266257191653300958665,
+        29575416573877850110282207604956810435517651560195688305899509498696620010244,
+        14847878889267284097154680303894682118691851458994231947614265728994942994070,
+        20429418212820354632928804765237872038510012037866211443904617760234782885379,
+        7574458101605872720978248880901475402425915871207588302331738915750399818261,
+        17360302429409236303124571274007129505347750088252746835134820320174075520568,
+        20122427392775899467650607998293541689910499355918263514348107768635186687919,
+        18022365643591774667447071040313575800878977019496768303243777020897646736874,
+        42682904958995471665752763815684581078942869689433650503799087880739308564702,
+        8311028598936182576772814661082414479477218007574344890050002746768692005970,
+        11834100503021893301264828237505544515364347987616919114208850934500303732233,
+        18046126371581924783215864207899591546767333112918007785778666716568442660984,
+        1362877564723239165752771189528340892063990475602476957032889996975241123667,
+        4563845355537414757443397067272882389964729249915601612595216558085202590500,
+        30502727030418717897978103541346525197375893813632933838302759224100706107886,
+        8605988708095722628145323800897732590850815151622107403000823325100623493248,
+        18637524393639130967704755019214044238927068733847916591243744190769559790437,
+        49284615515095037001608002713963661246711893076893997813456286181084511633495,
+        27754763074752431002698059009524676077423673854064872414563029035093584354925,
+        17709218511002901033310816953780802422290609645352861277441133006662612047615,
+        28989046264996993540519301353330134228293312233381620293948667113436043059282,
+        9886514852243032789735778941090704644227989959664705634306331912148873731183,
+        399525974815042390165012176649363643564290019283262720768720480879836747576,
+        32744014752599485360698494609284829428554899650571301383017924596914155976071,
+        26243554760402457028706078926774991722399155096518979202853290491980883544161,
+        14978761659661414392881458826397191292619114106912202773554922669143353009737,
+        39688695730538436901905176049580954642535616035595985469616672374082249948500,
+        11390674602383445799868967529125275520501876152621509291997422074162834829282,
+        1850119824753141528712583000709930232152275963223523030291205373418363310050,
+        19230352238274579347163566331944478063829552351135117332109531797277752986865,
+        45417546516929672200918510626411152493957544765200582237171240993231593010327,
+        17241894819534262073141788101470006121951392951479084915224727071422538939264,
+        26379801594673522732703027201081785115475053877182516690761044546775707362210,
+        43124415120212656751926898361682566402256170000693407938598751646387036429077,
+        5716904699326037731443010364050683313812362140790676946527379298161440472470,
+        24601091654965291257542371691906926253856297898526491084094659751660591329004,
+        8373483812133491274380639067314337692499954984201473884399086539799941645425,
+        36042458118759391272071558199018489455027673463786176939975905162502232719029,
+        37795526692757509830313699804303781026003725412051470014910385450548652147747,
+        2043256027196199272739661437630782119741893934683122493239698681237369017493,
+        15758544501645911987330922931747883163879332603143748927727242710999041497903,
+        12623230470836743350233749114721002025016393199853000434969002998122866445265,
+        19042134348893401819653791384757419114985975303629705113266975766417483283050
+    ];
+    var ME_DIAG[2] = [1, 1];   // ME[i][i] - 1
+    var MI_DIAG[2] = [1, 1];   // MI[i][i] - 1
+
+    signal x2[72];
+    signal x4[72];
+    signal y[72];
+    var k = 0;
+    var acc;
+    var s[2];
+    for (var i = 0; i < 2; i++) s[i] = in[i];
+
+    // 初始 ME：s_i = Σs + (μ_i - 1)·s_i
+    acc = 0;
+    for (var i = 0; i < 2; i++) acc += s[i];
+    for (var i = 0; i < 2; i++) s[i] = acc + ME_DIAG[i] * s[i];
+
+    for (var r = 0; r < 8; r++) {
+        if (r == 4) {
+            // 内部轮：只有 state[0] 加常数、过 S-box；MI 同样化为求和加对角项
+            for (var j = 0; j < 56; j++) {
+                var a = s[0] + RC_INT[j];
+                x2[k] <== a * a;
+                x4[k] <== x2[k] * x2[k];
+                y[k] <== x4[k] * a;
+                s[0] = y[k];
+                k++;
+                acc = 0;
+                for (var i = 0; i < 2; i++) acc += s[i];
+                for (var i = 0; i < 2; i++) s[i] = acc + MI_DIAG[i] * s[i];
+            }
+        }
+        // 外部轮
+        for (var i = 0; i < 2; i++) {
+            var a = s[i] + RC_EXT[r][i];
+            x2[k] <== a * a;
+            x4[k] <== x2[k] * x2[k];
+            y[k] <== x4[k] * a;
+            s[i] = y[k];
+            k++;
+        }
+        acc = 0;
+        for (var i = 0; i < 2; i++) acc += s[i];
+        for (var i = 0; i < 2; i++) s[i] = acc + ME_DIAG[i] * s[i];
+    }
+
+    for (var i = 0; i < 2; i++) out[i] <== s[i];
+}
+
+// t = 2，对照组：每个线性层输出、每次加常数都落成信号（与旧模板同样的写法，参数正确）
+template Poseidon2PermNaive_t2() {
+    signal input in[2];
+    signal output out[2];
+
+    var RC_EXT[8][2] = [
+        [28190638184273239630947439084195856085921000439146840783584026567815066165439, 23146689049395223273367083048852910554079089497058095885506954026537886531810],
+        [911160006391871914410543126818296927026095846189530853657892075540214077515, 27202533394301850560167963843327746668672554670052606738436749945277244353172],
+        [44944980911306516781131672448901792878697036811988302507719932173419205433388, 19001684455661569566229517914344076522845713257318233511896883373554868215442],
+        [47371723582938090571682136516979038196004246736634499318038604830892875267213, 14451021715352241013390445210290125685780410256293035225089951924558220097591],
+        [26072799126958157134832901403092723391044956913761881884147972489398927880978, 50929713509578750424613236889197435789856876885008168984648260474765264214802],
+        [11861063765783342387127823031145344912357038656633001403755731315260121346573, 40627237836096381086172736546614304504195602158441793958946677557825265875492],
+        [32784596225251533830089892884419870886611260668015879844360808523509749954110, 20535812275592068792288147847670212683650965787655588990970419572712489514995],
+        [4828536038299758562001334217462295754488675753797715556809008068327566159353, 19295234669611537581022897489292893764184418070253517225300740270796025621699]
+    ];
+    var RC_INT[56] = [
+        3965561560783351624388523263160503770393509095856008843003113265219797160326,
+        14112297029953315310955313538776547970661362928250732236597183502065241621481,
+        8999564996403015728933836812096111119705152275405960418656823529611591475848,
+        34946059665841708560025869744875025219082751845572015735010361459238249543081,
+        12887558264246606662432585169182027646856850266472117340889020685420070178852,
+        39997257894796915777849321169782001125355695543134466448307086624624867240811,
+        11757388543857375580896687765044135203665318841832431260702026920261040407906,
+        51906305906318589804271261420986098804139677734703530443794529168231686284988,
+        38210236747844479125696836812526274885720923201831471616600568165687573456428,
+        9412806315626774107358156185572186074959750528842554487871015688278294011622,
+        51394524809882035901539072103966414218735376037764535770263717493476631811656,
+        4703693786077848058781313142074498584400637151983945486655871752632666221723,
+        45813926300621208663356251914366404796694685456553681281631074402432185641777,
+        51375895340934137880575885957889635527410352803933951349266257191653300958665,
+        29575416573877850110282207604956810435517651560195688305899509498696620010244,
+        14847878889267284097154680303894682118691851458994231947614265728994942994070,
+        20429418212820354632928804765237872038510012037866211443904617760234782885379,
+        7574458101605872720978248880901475402425915871207588302331738915750399818261,
+        17360302429409236303124571274007129505347750088252746835134820320174075520568,
+        20122427392775899467650607998293541689910499355918263514348107768635186687919,
+        18022365643591774667447071040313575800878977019496768303243777020897646736874,
+        42682904958995471665752763815684581078942869689433650503799087880739308564702,
+        8311028598936182576772814661082414479477218007574344890050002746768692005970,
+        11834100503021893301264828237505544515364347987616919114208850934500303732233,
+        18046126371581924783215864207899591546767333112918007785778666716568442660984,
+        1362877564723239165752771189528340892063990475602476957032889996975241123667,
+        4563845355537414757443397067272882389964729249915601612595216558085202590500,
+        30502727030418717897978103541346525197375893813632933838302759224100706107886,
+        8605988708095722628145323800897732590850815151622107403000823325100623493248,
+        18637524393639130967704755019214044238927068733847916591243744190769559790437,
+        49284615515095037001608002713963661246711893076893997813456286181084511633495,
+        27754763074752431002698059009524676077423673854064872414563029035093584354925,
+        17709218511002901033310816953780802422290609645352861277441133006662612047615,
+        28989046264996993540519301353330134228293312233381620293948667113436043059282,
+        9886514852243032789735778941090704644227989959664705634306331912148873731183,
+        399525974815042390165012176649363643564290019283262720768720480879836747576,
+        32744014752599485360698494609284829428554899650571301383017924596914155976071,
+        26243554760402457028706078926774991722399155096518979202853290491980883544161,
+        14978761659661414392881458826397191292619114106912202773554922669143353009737,
+        39688695730538436901905176049580954642535616035595985469616672374082249948500,
+        11390674602383445799868967529125275520501876152621509291997422074162834829282,
+        1850119824753141528712583000709930232152275963223523030291205373418363310050,
+        19230352238274579347163566331944478063829552351135117332109531797277752986865,
+        45417546516929672200918510626411152493957544765200582237171240993231593010327,
+        17241894819534262073141788101470006121951392951479084915224727071422538939264,
+        26379801594673522732703027201081785115475053877182516690761044546775707362210,
+        43124415120212656751926898361682566402256170000693407938598751646387036429077,
+        5716904699326037731443010364050683313812362140790676946527379298161440472470,
+        24601091654965291257542371691906926253856297898526491084094659751660591329004,
+        8373483812133491274380639067314337692499954984201473884399086539799941645425,
+        36042458118759391272071558199018489455027673463786176939975905162502232719029,
+        37795526692757509830313699804303781026003725412051470014910385450548652147747,
+        2043256027196199272739661437630782119741893934683122493239698681237369017493,
+        15758544501645911987330922931747883163879332603143748927727242710999041497903,
+        12623230470836743350233749114721002025016393199853000434969002998122866445265,
+        19042134348893401819653791384757419114985975303629705113266975766417483283050
+    ];
+    var ME_DIAG[2] = [1, 1];   // ME[i][i] - 1
+    var MI_DIAG[2] = [1, 1];   // MI[i][i] - 1
+
+    signal st[65][2];
+    signal ac[72];
+    component sb[72];
+    var cur[2];
+    var k = 0;
+    var n = 0;
+    var acc;
+
+    acc = 0;
+    for (var i = 0; i < 2; i++) acc += in[i];
+    for (var i = 0; i < 2; i++) st[0][i] <== acc + ME_DIAG[i] * in[i];
+
+    for (var r = 0; r < 8; r++) {
+        if (r == 4) {
+            for (var j = 0; j < 56; j++) {
+                ac[k] <== st[n][0] + RC_INT[j];
+                sb[k] = Pow5();
+                sb[k].in <== ac[k];
+                cur[0] = sb[k].out;
+                for (var i = 1; i < 2; i++) cur[i] = st[n][i];
+                k++;
+                acc = 0;
+                for (var i = 0; i < 2; i++) acc += cur[i];
+                for (var i = 0; i < 2; i++) st[n + 1][i] <== acc + MI_DIAG[i] * cur[i];
+                n++;
+            }
+        }
+        for (var i = 0; i < 2; i++) {
+            ac[k] <== st[n][i] + RC_EXT[r][i];
+            sb[k] = Pow5();
+            sb[k].in <== ac[k];
+            cur[i] = sb[k].out;
+            k++;
+        }
+        acc = 0;
+        for (var i = 0; i < 2; i++) acc += cur[i];
+        for (var i = 0; i < 2; i++) st[n + 1][i] <== acc + ME_DIAG[i] * cur[i];
+        n++;
+    }
+
+    for (var i = 0; i < 2; i++) out[i] <== st[n][i];
+}
+
+template Poseidon2Hash_t2() {
+    signal input in[2];
+    signal output out;
+    component perm = Poseidon2Perm_t2();
+    for (var i = 0; i < 2; i++) perm.in[i] <== in[i];
+    out <== perm.out[0];
+}
+
+template Poseidon2HashNaive_t2() {
+    signal input in[2];
+    signal output out;
+    component perm = Poseidon2PermNaive_t2();
+    for (var i = 0; i < 2; i++) perm.in[i] <== in[i];
+    out <== perm.out[0];
+}
+
+// t = 3：线性层只在 var 中累积线性组合，不单独成约束；每个 S-box 3 个乘法约束，共 80 个 S-box
+template Poseidon2Perm_t3() {
+    signal input in[3];
+    signal output out[3];
+
+    var RC_EXT[8][3] = [
+        [8576445555774142305196503372132521687982781286419432064546817138350462730699, 16706796720092762530609910630991498768545338736782689969857617594017321232213, 966279062232068801680385367245802595272536498857561243520510811978985039805],
+        [38352206374927859959625269398505920460443539004767176241069442943624364607115, 51114136518013011559748794071460044436249312671886904541271807933243578074619, 48708969585343205218642982562621766453793391091540515111135132728183682517332],
+        [22639346042330050018469845851371906394458030871697054018362480920568353465450, 35275567653246092315816097229808269184891933702471386951804144060883075907738, 14413260213660533260188809681111983501541329837982695449007063984766825346895],
+        [30109536003469295043057217017043191688188070434448552710855812269935971332596, 24982581915313906303348166114265029166898813370477217857954599333360343722256, 30173115683286745008990957167720827014107655266593706441890797927810096053852],
+        [14745265487811102303628374435329326697786681946989278760659814984018841383088, 9075630254222736050695774817237123780978655467750650202531894840232295456382, 8727621552129867073563526725233908754050064335093199711124959848250775803730],
+        [26355672463087949953167932525000309943054499110749669922875308291364246888141, 35682228875676140703179456399924166169540805296316319552724088792600356736318, 41853649091319910008572999196931114814080084468786754619406597509165999793308],
+        [14681434115902655115606782421038323368317828475107436242161541398136668019797, 37455244905742282031985287344982040293963816469355164614516346051352317588671, 19089943468140444621241123500969927166062583059910550880242423128641036240904],
+        [9211468196173412510200585404691780551338172901047406839951291022421259747923, 19083584400603592858128372324850886952243976199210060696516897208596563141828, 29134897266706967396634115921545632849339195338777438849671676831258989814659]
+    ];
+    var RC_INT[56] = [
+        9664715812125901106024758766171858126641554939950449144246925601594064546508,
+        12548733636122301673252131482662457236396424305916334341515731708674310468485,
+        48360128011101534829525906481291401092185062318511750803285485802065621510381,
+        20609771454000370097956401519137533916157151305351559081051001431138928648526,
+        34257448287130529778577704855890867862880183189918517769605371287651730835882,
+        8537857248961944824907963909774192660030567681200741652120924924334839978027,
+        27572131965217410976994783798050430622663221678476600514387555915344152560146,
+        20839870808952100510398644577981418403688442478867779953588774644348920489991,
+        45296827289290358537426111139115484275681329283617836251525572636166926683757,
+        44101002784396131148605444833455562265754960667998121758186864755615483476134,
+        16290877690163295250462373665419373362323950380942514787037935106475189215372,
+        50976640383380122780956821883751287451525626079017810314095713928088127324107,
+        3586558688495150788667677437714787510069188457316193993595329800601507905351,
+        49100415367021980599206571275971985070720216548044742875477112998100782482874,
+        18175898121411743786320477633066718408730109419757228753878737877446443304933,
+        51345937755322250578497382996074070382930494423557689461475373567990082243741,
+        38590132262284497311896486471228586193051707621984878514942062480119742229660,
+        35765363297918384205819719499911792834458757947319079788708031096440424175779,
+        20970509544538709772621269664698678205720910073016034436966396536724605449428,
+        27108879539611589303689692318693649507202977895818716940314813630637917260332,
+        24225532935396487186259798676051599322621856435331129480195271066429467229325,
+        18424894239660864763217781853700233077693883323242010472188937427836437876003,
+        42184469040257339761684310136753170090023393212777704581716061760599101967566,
+        17387578009773338735828453453746766341413485651154514581712786530254355137733,
+        32998009142518864775840683364830779935063838936125586023642315339613954536204,
+        16625369760136834755193967066779572501959688519567079144663157103920012037728,
+        29069302151433952722714779294251940481347422334447329917748844711573330985106,
+        24165327437826795442754562759585141460935444382494262249351973818874656826149,
+        48798466945686802757521911290665309078303836342496276993582566011024986003485,
+        3581188285106397879211009283211146111519386420800782589903933063338684703703,
+        14990607991262214090239808961771105652021084435310379291961932226243942737121,
+        15686757209654374908414609841315215713249553993132810363850610712315794216916,
+        31377753483531844732042048845150505210863322142273646725186275781469093007852,
+        24932297007870441522379082065964781536561184336470248249039239297485086953454,
+        32589318266302725281133410450658194823165754650749677052102277694457437610909,
+        28973575065500672241929409148857583134130671347731083493426202026143657272059,
+        17332163191550800940833867904564374161308301758964146454010358008541823119635,
+        3544362227792400009779734349531529283682585666374031110960342632642804299324,
+        42281768082460318222944152976772997268383540708604136752947395988716239953005,
+        5198634003538237293949562663074175378073484387624833158658127320407495098946,
+        47515632716427617844396296551920853908121795699179298471007882282711402219027,
+        3365292109681792621229799921590117801177233949140692173465496449776036797647,
+        46187510147885456894196005366313714634592389485893788711283128065274798785790,
+        4958192016756100218307770220158268426596072218583884600306754159591823475099,
+        12418677909222859515046732177042222420632274098402770454009637935787741874576,
+        28923866037719096527338929425416259200994180291721501834393930964167496640867,
+        50431193735448640449823307258868504214468087370177559953537305945090853809698,
+        20117340624687041371627328733610487090105803721352665611715511634571867480134,
+        44193939139505713049101361178901639342175123927735549302866343173234792932371,
+        22406060067723941597709376985360343711370329970241343818415725872081198607839,
+        35992262033042890487487402285620720357870801828122896158692228786009982346232,
+        4380924687731111942830039178580867505046168999652617211238656877876747010030,
+        34453048850164078372985311203359743250555339353585984087628695162039324743281,
+        43611396879309156547740033484008232770170782232572065522675872880604100573569,
+        40789454457581685564228048552865085980089564160038739176939904223842801162975,
+        20390872725471008361341144059290940691430539871461664502737888500245726172147
+    ];
+    var ME_DIAG[3] = [1, 1, 1];   // ME[i][i] - 1
+    var MI_DIAG[3] = [1, 1, 1];   // MI[i][i] - 1
+
+    signal x2[80];
+    signal x4[80];
+    signal y[80];
+    var k = 0;
+    var acc;
+    var s[3];
+    for (var i = 0; i < 3; i++) s[i] = in[i];
+
+    // 初始 ME：s_i = Σs + (μ_i - 1)·s_i
+    acc = 0;
+    for (var i = 0; i < 3; i++) acc += s[i];
+    for (var i = 0; i < 3; i++) s[i] = acc + ME_DIAG[i] * s[i];
+
+    for (var r = 0; r < 8; r++) {
+        if (r == 4) {
+            // 内部轮：只有 state[0] 加常数、过 S-box；MI 同样化为求和加对角项
+            for (var j = 0; j < 56; j++) {
+                var a = s[0] + RC_INT[j];
+                x2[k] <== a * a;
+                x4[k] <== x2[k] * x2[k];
+                y[k] <== x4[k] * a;
+                s[0] = y[k];
+                k++;
+                acc = 0;
+                for (var i = 0; i < 3; i++) acc += s[i];
+                for (var i = 0; i < 3; i++) s[i] = acc + MI_DIAG[i] * s[i];
+            }
+        }
+        // 外部轮
+        for (var i = 0; i < 3; i++) {
+            var a = s[i] + RC_EXT[r][i];
+            x2[k] <== a * a;
+            x4[k] <== x2[k] * x2[k];
+            y[k] <== x4[k] * a;
+            s[i] = y[k];
+            k++;
+        }
+        acc = 0;
+        for (var i = 0; i < 3; i++) acc += s[i];
+        for (var i = 0; i < 3; i++) s[i] = acc + ME_DIAG[i] * s[i];
+    }
+
+    for (var i = 0; i < 3; i++) out[i] <== s[i];
+}
+
+// t = 3，对照组：每个线性层输出、每次加常数都落成信号（与旧模板同样的写法，参数正确）
+template Poseidon2PermNaive_t3() {
+    signal input in[3];
+    signal output out[3];
+
+    var RC_EXT[8][3] = [
+        [8576445555774142305196503372132521687982781286419432064546817138350462730699, 16706796720092762530609910630991498768545338736782689969857617594017321232213, 966279062232068801680385367245802595272536498857561243520510811978985039805],
+        [38352206374927859959625269398505920460443539004767176241069442943624364607115, 51114136518013011559748794071460044436249312671886904541271807933243578074619, 48708969585343205218642982562621766453793391091540515111135132728183682517332],
+        [22639346042330050018469845851371906394458030871697054018362480920568353465450, 35275567653246092315816097229808269184891933702471386951804144060883075907738, 14413260213660533260188809681111983501541329837982695449007063984766825346895],
+        [30109536003469295043057217017043191688188070434448552710855812269935971332596, 24982581915313906303348166114265029166898813370477217857954599333360343722256, 30173115683286745008990957167720827014107655266593706441890797927810096053852],
+        [14745265487811102303628374435329326697786681946989278760659814984018841383088, 9075630254222736050695774817237123780978655467750650202531894840232295456382, 8727621552129867073563526725233908754050064335093199711124959848250775803730],
+        [26355672463087949953167932525000309943054499110749669922875308291364246888141, 35682228875676140703179456399924166169540805296316319552724088792600356736318, 41853649091319910008572999196931114814080084468786754619406597509165999793308],
+        [14681434115902655115606782421038323368317828475107436242161541398136668019797, 37455244905742282031985287344982040293963816469355164614516346051352317588671, 19089943468140444621241123500969927166062583059910550880242423128641036240904],
+        [9211468196173412510200585404691780551338172901047406839951291022421259747923, 19083584400603592858128372324850886952243976199210060696516897208596563141828, 29134897266706967396634115921545632849339195338777438849671676831258989814659]
+    ];
+    var RC_INT[56] = [
+        9664715812125901106024758766171858126641554939950449144246925601594064546508,
+        12548733636122301673252131482662457236396424305916334341515731708674310468485,
+        48360128011101534829525906481291401092185062318511750803285485802065621510381,
+        20609771454000370097956401519137533916157151305351559081051001431138928648526,
+        34257448287130529778577704855890867862880183189918517769605371287651730835882,
+        8537857248961944824907963909774192660030567681200741652120924924334839978027,
+        27572131965217410976994783798050430622663221678476600514387555915344152560146,
+        20839870808952100510398644577981418403688442478867779953588774644348920489991,
+        45296827289290358537426111139115484275681329283617836251525572636166926683757,
+        44101002784396131148605444833455562265754960667998121758186864755615483476134,
+        16290877690163295250462373665419373362323950380942514787037935106475189215372,
+        50976640383380122780956821883751287451525626079017810314095713928088127324107,
+        3586558688495150788667677437714787510069188457316193993595329800601507905351,
+        49100415367021980599206571275971985070720216548044742875477112998100782482874,
+        18175898121411743786320477633066718408730109419757228753878737877446443304933,
+        51345937755322250578497382996074070382930494423557689461475373567990082243741,
+        38590132262284497311896486471228586193051707621984878514942062480119742229660,
+        35765363297918384205819719499911792834458757947319079788708031096440424175779,
+        20970509544538709772621269664698678205720910073016034436966396536724605449428,
+        27108879539611589303689692318693649507202977895818716940314813630637917260332,
+        24225532935396487186259798676051599322621856435331129480195271066429467229325,
+        18424894239660864763217781853700233077693883323242010472188937427836437876003,
+        42184469040257339761684310136753170090023393212777704581716061760599101967566,
+        17387578009773338735828453453746766341413485651154514581712786530254355137733,
+        32998009142518864775840683364830779935063838936125586023642315339613954536204,
+        16625369760136834755193967066779572501959688519567079144663157103920012037728,
+        29069302151433952722714779294251940481347422334447329917748844711573330985106,
+        24165327437826795442754562759585141460935444382494262249351973818874656826149,
+        48798466945686802757521911290665309078303836342496276993582566011024986003485,
+        3581188285106397879211009283211146111519386420800782589903933063338684703703,
+        14990607991262214090239808961771105652021084435310379291961932226243942737121,
+        15686757209654374908414609841315215713249553993132810363850610712315794216916,
+        31377753483531844732042048845150505210863322142273646725186275781469093007852,
+        24932297007870441522379082065964781536561184336470248249039239297485086953454,
+        32589318266302725281133410450658194823165754650749677052102277694457437610909,
+        28973575065500672241929409148857583134130671347731083493426202026143657272059,
+        17332163191550800940833867904564374161308301758964146454010358008541823119635,
+        3544362227792400009779734349531529283682585666374031110960342632642804299324,
+        42281768082460318222944152976772997268383540708604136752947395988716239953005,
+        5198634003538237293949562663074175378073484387624833158658127320407495098946,
+        47515632716427617844396296551920853908121795699179298471007882282711402219027,
+        3365292109681792621229799921590117801177233949140692173465496449776036797647,
+        46187510147885456894196005366313714634592389485893788711283128065274798785790,
+        4958192016756100218307770220158268426596072218583884600306754159591823475099,
+        12418677909222859515046732177042222420632274098402770454009637935787741874576,
+        28923866037719096527338929425416259200994180291721501834393930964167496640867,
+        50431193735448640449823307258868504214468087370177559953537305945090853809698,
+        20117340624687041371627328733610487090105803721352665611715511634571867480134,
+        44193939139505713049101361178901639342175123927735549302866343173234792932371,
+        22406060067723941597709376985360343711370329970241343818415725872081198607839,
+        35992262033042890487487402285620720357870801828122896158692228786009982346232,
+        4380924687731111942830039178580867505046168999652617211238656877876747010030,
+        34453048850164078372985311203359743250555339353585984087628695162039324743281,
+        43611396879309156547740033484008232770170782232572065522675872880604100573569,
+        40789454457581685564228048552865085980089564160038739176939904223842801162975,
+        20390872725471008361341144059290940691430539871461664502737888500245726172147
+    ];
+    var ME_DIAG[3] = [1, 1, 1];   // ME[i][i] - 1
+    var MI_DIAG[3] = [1, 1, 1];   // MI[i][i] - 1
+
+    signal st[65][3];
+    signal ac[80];
+    component sb[80];
+    var cur[3];
+    var k = 0;
+    var n = 0;
+    var acc;
+
+    acc = 0;
+    for (var i = 0; i < 3; i++) acc += in[i];
+    for (var i = 0; i < 3; i++) st[0][i] <== acc + ME_DIAG[i] * in[i];
+
+    for (var r = 0; r < 8; r++) {
+        if (r == 4) {
+            for (var j = 0; j < 56; j++) {
+                ac[k] <== st[n][0] + RC_INT[j];
+                sb[k] = Pow5();
+                sb[k].in <== ac[k];
+                cur[0] = sb[k].out;
+                for (var i = 1; i < 3; i++) cur[i] = st[n][i];
+                k++;
+                acc = 0;
+                for (var i = 0; i < 3; i++) acc += cur[i];
+                for (var i = 0; i < 3; i++) st[n + 1][i] <== acc + MI_DIAG[i] * cur[i];
+                n++;
+            }
+        }
+        for (var i = 0; i < 3; i++) {
+            ac[k] <== st[n][i] + RC_EXT[r][i];
+            sb[k] = Pow5();
+            sb[k].in <== ac[k];
+            cur[i] = sb[k].out;
+            k++;
+        }
+        acc = 0;
+        for (var i = 0; i < 3; i++) acc += cur[i];
+        for (var i = 0; i < 3; i++) st[n + 1][i] <== acc + ME_DIAG[i] * cur[i];
+        n++;
+    }
+
+    for (var i = 0; i < 3; i++) out[i] <== st[n][i];
+}
+
+template Poseidon2Hash_t3() {
+    signal input in[3];
+    signal output out;
+    component perm = Poseidon2Perm_t3();
+    for (var i = 0; i < 3; i++) perm.in[i] <== in[i];
+    out <== perm.out[0];
+}
+
+template Poseidon2HashNaive_t3() {
+    signal input in[3];
+    signal output out;
+    component perm = Poseidon2PermNaive_t3();
+    for (var i = 0; i < 3; i++) perm.in[i] <== in[i];
+    out <== perm.out[0];
+}
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Poseidon2 reference permutation in pure Python, driven by poseidon2_t2.json / poseidon2_t3.json.
+
+Round structure (Poseidon2 paper, Sect. 4):
+  state = ME * state                                   # initial linear layer
+  RF/2 external rounds: state += rc_ext[r]; state = state^5 (all lanes); state = ME * state
+  RP   internal rounds: state[0] += rc_int[i]; state[0] = state[0]^5;    state = MI * state
+  RF/2 external rounds: as above with rc_ext[RF/2 + r]
+
+Sponge (rate t-1, capacity = state[t-1], no extra block for full final chunks):
+  capacity starts at out_len * 2^64; all chunks but the last are absorbed (added to the rate lanes)
+  and permuted; the last chunk is added and then either padded with a single 1 (fewer than t-1
+  elements, including the empty message) or marked by adding 1 to the capacity (exactly t-1);
+  one more permutation, then outputs are read from the rate lanes, permuting between blocks.
+
+2-to-1 compression (t=3, feed-forward): compress(l, r) = perm(l, r, 0)[0] + l.
+Merkle tree: leaves padded with zero subtrees up to 2^depth (depth defaults to ceil(log2 n)),
+zero[0] = 0, zero[k+1] = compress(zero[k], zero[k]).
+
+Usage:
+  python3 poseidon2_ref.py <t> <x_0> ... <x_{t-1}>     inputs in decimal or 0x-hex, prints outputs in hex
+  python3 poseidon2_ref.py sponge <t> <out_len> <x>...  sponge hash, prints out_len elements
+  python3 poseidon2_ref.py merkle <leaf>...             prints the Merkle root
+"""
+
+import json
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+def load_params(t):
+    with open(os.path.join(HERE, f"poseidon2_t{t}.json"), encoding="utf-8") as f:
+        P = json.load(f)
+    P["p"] = int(P["field_modulus_hex"], 16)
+    return P
+
+def matmul(M, x, p):
+    return [sum(M[i][j] * x[j] for j in range(len(x))) % p for i in range(len(x))]
+
+def permute(state, P):
+    p, d, rf, rp = P["p"], P["d"], P["RF"], P["RP"]
+    ME, MI = P["matrix_ME"], P["matrix_MI"]
+    ext, inn = P["round_constants_external"], P["round_constants_internal_c0"]
+    x = [v % p for v in state]
+    x = matmul(ME, x, p)
+    for r in range(rf // 2):
+        x = [pow((x[i] + ext[r][i]) % p, d, p) for i in range(len(x))]
+        x = matmul(ME, x, p)
+    for i in range(rp):
+        x[0] = pow((x[0] + inn[i]) % p, d, p)
+        x = matmul(MI, x, p)
+    for r in range(rf // 2, rf):
+        x = [pow((x[i] + ext[r][i]) % p, d, p) for i in range(len(x))]
+        x = matmul(ME, x, p)
+    return x
+
+def sponge(inputs, P, out_len=1):
+    p, t = P["p"], P["t"]
+    r = t - 1
+    x = [0] * t
+    x[t - 1] = out_len << 64
+    chunks = [inputs[i:i + r] for i in range(0, len(inputs), r)] or [[]]
+    for c in chunks[:-1]:
+        x = permute([(x[i] + c[i]) % p if i < r else x[i] for i in range(t)], P)
+    last = chunks[-1]
+    for i, v in enumerate(last):
+        x[i] = (x[i] + v) % p
+    if len(last) < r:
+        x[len(last)] = (x[len(last)] + 1) % p
+    else:
+        x[t - 1] = (x[t - 1] + 1) % p
+    x = permute(x, P)
+    out = []
+    while True:
+        out += x[:r]
+        if len(out) >= out_len:
+            return out[:out_len]
+        x = permute(x, P)
+
+def compress(l, r, P):
+    return (permute([l, r, 0], P)[0] + l) % P["p"]
+
+def merkle_levels(leaves, P, depth=None):
+    if depth is None:
+        depth = max(0, (len(leaves) - 1).bit_length())
+    zero = 0
+    levels = [[v % P["p"] for v in leaves]]
+    for _ in range(depth):
+        cur = levels[-1]
+        if len(cur) % 2:
+            cur = cur + [zero]
+        levels.append([compress(cur[i], cur[i + 1], P) for i in range(0, len(cur), 2)])
+        zero = compress(zero, zero, P)
+    return levels
+
+def merkle_root(leaves, P, depth=None):
+    return merkle_levels(leaves, P, depth)[-1][0]
+
+def main():
+    if len(sys.argv) >= 4 and sys.argv[1] == "sponge":
+        t, out_len = int(sys.argv[2]), int(sys.argv[3])
+        out = sponge([int(a, 0) for a in sys.argv[4:]], load_params(t), out_len)
+        print(" ".join("%064x" % v for v in out))
+        return 0
+    if len(sys.argv) >= 3 and sys.argv[1] == "merkle":
+        print("%064x" % merkle_root([int(a, 0) for a in sys.argv[2:]], load_params(3)))
+        return 0
+    if len(sys.argv) < 2 or sys.argv[1] not in ("2", "3"):
+        print(__doc__)
+        return 1
+    t = int(sys.argv[1])
+    if len(sys.argv) != 2 + t:
+        print("need exactly %d inputs" % t)
+        return 1
+    P = load_params(t)
+    out = permute([int(a, 0) for a in sys.argv[2:]], P)
+    print(" ".join("%064x" % v for v in out))
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,64 @@
+// poseidon2_sponge.c
+#include <string.h>
+#include "poseidon2.h"
+
+static void permute(p2_sponge *sp){
+    if(sp->t == 2) poseidon2_permute_t2(sp->s); else poseidon2_permute_t3(sp->s);
+}
+
+void p2_sponge_init(p2_sponge *sp, int t, unsigned out_len){
+    uint8_t iv[32] = {0};
+    memset(sp, 0, sizeof(*sp));
+    sp->t = t;
+    for(int i=0;i<4;i++) iv[20 + i] = (uint8_t)(out_len >> (24 - 8*i));   // out_len·2^64，大端
+    for(int i=0;i<t-1;i++) p2_fe_from_u64(&sp->s[i], 0);
+    p2_fe_from_bytes(&sp->s[t-1], iv);
+}
+
+void p2_sponge_absorb(p2_sponge *sp, const p2_fe *in, size_t n){
+    unsigned rate = (unsigned)sp->t - 1;
+    for(size_t i=0;i<n;i++){
+        if(sp->pos == rate){            // 确认还有后续输入才置换，最后一块留给 squeeze 填充
+            permute(sp);
+            sp->pos = 0;
+        }
+        p2_fe_add(&sp->s[sp->pos], &sp->s[sp->pos], &in[i]);
+        sp->pos++;
+    }
+}
+
+void p2_sponge_squeeze(p2_sponge *sp, p2_fe *out, size_t n){
+    unsigned rate = (unsigned)sp->t - 1;
+    if(!sp->squeezing){
+        p2_fe one;
+        p2_fe_from_u64(&one, 1);
+        if(sp->pos < rate) p2_fe_add(&sp->s[sp->pos], &sp->s[sp->pos], &one);
+        else               p2_fe_add(&sp->s[sp->t-1], &sp->s[sp->t-1], &one);
+        permute(sp);
+        sp->squeezing = 1;
+        sp->pos = 0;
+    }
+    for(size_t i=0;i<n;i++){
+        if(sp->pos == rate){
+            permute(sp);
+            sp->pos = 0;
+        }
+        out[i] = sp->s[sp->pos++];
+    }
+}
+
+void p2_hash(p2_fe *out, const p2_fe *in, size_t n){
+    p2_sponge sp;
+    p2_sponge_init(&sp, 3, 1);
+    p2_sponge_absorb(&sp, in, n);
+    p2_sponge_squeeze(&sp, out, 1);
+}
+
+void p2_compress(p2_fe *out, const p2_fe *l, const p2_fe *r){
+    p2_fe s[3];
+    s[0] = *l;
+    s[1] = *r;
+    p2_fe_from_u64(&s[2], 0);
+    poseidon2_permute_t3(s);
+    p2_fe_add(out, &s[0], l);
+}
@@ -0,0 +1,345 @@
+// cdc.c
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "sm3_mb.h"
+#include "cdc.h"
+
+/*
+  切分器按窗口推进：scanned 之前的位置都已扫描，其中的候选位置（bit 63 为“高 bits_s 位也为 0”）
+  按位置顺序存在 cand 里。要决定从 start 开始的块在哪里结束，只需扫描到 start + max，
+  所以 cand 里同时存在的候选不超过 max + CDC_WINDOW 个。
+  GEAR 表由固定种子的 splitmix64 生成，与版本无关地固定下来，切点才能跨程序复现。
+*/
+
+#define CAND_S ((uint64_t)1 << 63)
+
+typedef struct {
+    const uint8_t *data;
+    size_t len;
+    uint32_t min, avg, max;
+    uint64_t mask_s, mask_l;
+    size_t start, scanned;
+    uint64_t *cand;
+    size_t ncand, cpos, cap;
+} cutter_t;
+
+static uint64_t GEAR[256];
+static int gear_ready;
+
+static void gear_init(void){
+    if(__atomic_load_n(&gear_ready, __ATOMIC_ACQUIRE)) return;
+    uint64_t x = 0x5343445f53334d31ULL;        // "SCD_S3M1"
+    for(int i=0;i<256;i++){
+        uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        GEAR[i] = z ^ (z >> 31);
+    }
+    __atomic_store_n(&gear_ready, 1, __ATOMIC_RELEASE);    // 多个线程同时生成时写入的值相同
+}
+
+static int params_ok(const cdc_params *p, int *bits){
+    if(!p || p->min < 64 || p->min >= p->avg || p->avg >= p->max) return 0;
+    if(p->avg & (p->avg - 1)) return 0;
+    int b = 0;
+    while(((uint32_t)1 << b) < p->avg) b++;
+    if(b < 6 || b > 28) return 0;
+    *bits = b;
+    return 1;
+}
+
+static int cutter_init(cutter_t *c, const uint8_t *data, size_t len, const cdc_params *p){
+    int b;
+    if(!params_ok(p, &b)){ errno = EINVAL; return -1; }
+    gear_init();
+    memset(c, 0, sizeof(*c));
+    c->data = data;
+    c->len = len;
+    c->min = p->min; c->avg = p->avg; c->max = p->max;
+    c->mask_s = ~(uint64_t)0 << (64 - (b + 2));
+    c->mask_l = ~(uint64_t)0 << (64 - (b - 2));
+    c->cap = (size_t)p->max + CDC_WINDOW;
+    c->cand = malloc(c->cap * sizeof(uint64_t));
+    if(!c->cand){ errno = ENOMEM; return -1; }
+    return 0;
+}
+
+/* ---------------- 扫描 ---------------- */
+
+/* 位置 pos 之前 63 个字节（不足时从 0 开始）算出的 h，即 h_{pos-1} */
+static inline uint64_t warm(const uint8_t *d, size_t pos){
+    uint64_t h = 0;
+    for(size_t i = pos > 63 ? pos - 63 : 0; i < pos; i++) h = (h << 1) + GEAR[d[i]];
+    return h;
+}
+
+static size_t scan_scalar(const cutter_t *c, size_t from, size_t to, uint64_t *out){
+    const uint8_t *d = c->data;
+    uint64_t h = warm(d, from);
+    size_t n = 0;
+    for(size_t i=from;i<to;i++){
+        h = (h << 1) + GEAR[d[i]];
+        if(!(h & c->mask_l)) out[n++] = i | (h & c->mask_s ? 0 : CAND_S);
+    }
+    return n;
+}
+
+#ifdef __AVX2__
+#include <immintrin.h>
+
+/* [from, to) 切成 4 段，每段一个 64 位通道；每 8 字节一次 64 位 gather 取数据，再逐字节 gather 查 GEAR */
+static size_t scan_avx2(const cutter_t *c, size_t from, size_t to, uint64_t *out){
+    size_t q = ((to - from) / 4) & ~(size_t)7;
+    if(q < 64) return scan_scalar(c, from, to, out);
+    const uint8_t *d = c->data;
+    size_t seg[4], cnt[4] = { 0 };
+    _Alignas(32) uint64_t h0[4];
+    for(int k=0;k<4;k++){
+        seg[k] = from + (size_t)k * q;
+        h0[k] = warm(d, seg[k]);
+    }
+    __m256i h = _mm256_load_si256((const __m256i*)h0);
+    __m256i off = _mm256_set_epi64x((long long)seg[3], (long long)seg[2], (long long)seg[1], (long long)seg[0]);
+    const __m256i ml = _mm256_set1_epi64x((long long)c->mask_l), ff = _mm256_set1_epi64x(0xff);
+    const __m256i eight = _mm256_set1_epi64x(8), zero = _mm256_setzero_si256();
+    for(size_t j=0;j<q;j+=8){
+        __m256i raw = _mm256_i64gather_epi64((const long long*)d, off, 1);
+        off = _mm256_add_epi64(off, eight);
+        int hits[8];
+        __m256i hs[8];
+        for(int b=0;b<8;b++){
+            __m256i idx = _mm256_and_si256(_mm256_srli_epi64(raw, 8*b), ff);
+            __m256i g = _mm256_i64gather_epi64((const long long*)GEAR, idx, 8);
+            h = _mm256_add_epi64(_mm256_add_epi64(h, h), g);
+            hs[b] = h;
+            hits[b] = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(h, ml), zero)));
+        }
+        if(!(hits[0] | hits[1] | hits[2] | hits[3] | hits[4] | hits[5] | hits[6] | hits[7])) continue;
+        // 候选很稀疏（约 1/2^bits_l），命中时再逐个取出；各通道先写进自己那 q 个位置的区域
+        for(int b=0;b<8;b++){
+            if(!hits[b]) continue;
+            _Alignas(32) uint64_t hv[4];
+            _mm256_store_si256((__m256i*)hv, hs[b]);
+            for(int k=0;k<4;k++)
+                if(hits[b] >> k & 1)
+                    out[(size_t)k * q + cnt[k]++] = (seg[k] + j + (size_t)b) | (hv[k] & c->mask_s ? 0 : CAND_S);
+        }
+    }
+    size_t n = cnt[0];
+    for(int k=1;k<4;k++){
+        memmove(out + n, out + (size_t)k * q, cnt[k] * sizeof(uint64_t));
+        n += cnt[k];
+    }
+    return n + scan_scalar(c, from + 4*q, to, out + n);
+}
+#endif
+
+static void scan_window(cutter_t *c){
+    // 丢掉已经用不到的候选
+    memmove(c->cand, c->cand + c->cpos, (c->ncand - c->cpos) * sizeof(uint64_t));
+    c->ncand -= c->cpos;
+    c->cpos = 0;
+    size_t from = c->scanned, to = c->len - from < CDC_WINDOW ? c->len : from + CDC_WINDOW;
+#ifdef __AVX2__
+    c->ncand += scan_avx2(c, from, to, c->cand + c->ncand);
+#else
+    c->ncand += scan_scalar(c, from, to, c->cand + c->ncand);
+#endif
+    c->scanned = to;
+}
+
+/* 返回下一块的结束位置，没有数据时返回 0 */
+static size_t cutter_next(cutter_t *c){
+    size_t s = c->start;
+    if(s >= c->len) return 0;
+    size_t limit = c->len - s < c->max ? c->len : s + c->max;
+    while(c->scanned < limit) scan_window(c);
+    size_t cut = limit;
+    if(c->len - s > c->min){
+        while(c->cpos < c->ncand && (c->cand[c->cpos] & ~CAND_S) + 1 < s + c->min) c->cpos++;
+        for(size_t k=c->cpos;k<c->ncand;k++){
+            size_t i = (size_t)(c->cand[k] & ~CAND_S), L = i + 1 - s;
+            if(i >= limit) break;
+            if(L >= c->avg || (c->cand[k] & CAND_S)){ cut = i + 1; break; }
+        }
+    }else cut = c->len;
+    while(c->cpos < c->ncand && (c->cand[c->cpos] & ~CAND_S) < cut) c->cpos++;
+    c->start = cut;
+    return cut;
+}
+
+size_t cdc_split(const uint8_t *data, size_t len, const cdc_params *p, size_t *ends, size_t max_chunks){
+    cutter_t c;
+    if(cutter_init(&c, data, len, p) != 0) return (size_t)-1;
+    size_t n = 0, e;
+    while(n < max_chunks && (e = cutter_next(&c))) ends[n++] = e;
+    free(c.cand);
+    return n;
+}
+
+/* ---------------- 去重索引 ---------------- */
+
+struct cdc_index {
+    uint64_t *keys;                     // 摘要前 8 字节；0 表示空槽，前缀恰为 0 的存成 1
+    uint32_t *ids;
+    size_t cap;                         // 2 的幂
+    cdc_entry *ent;
+    size_t n, ent_cap;
+};
+
+static inline uint64_t key_of(const uint8_t d[32]){
+    uint64_t k;
+    memcpy(&k, d, 8);
+    return k ? k : 1;
+}
+
+static int index_grow(cdc_index *x, size_t cap){
+    uint64_t *keys = calloc(cap, sizeof(uint64_t));
+    uint32_t *ids = malloc(cap * sizeof(uint32_t));
+    if(!keys || !ids){ free(keys); free(ids); return -1; }
+    for(size_t i=0;i<x->n;i++){
+        uint64_t k = key_of(x->ent[i].digest);
+        size_t j = (size_t)k & (cap - 1);
+        while(keys[j]) j = (j + 1) & (cap - 1);
+        keys[j] = k;
+        ids[j] = (uint32_t)i;
+    }
+    free(x->keys); free(x->ids);
+    x->keys = keys; x->ids = ids; x->cap = cap;
+    return 0;
+}
+
+cdc_index *cdc_index_create(size_t hint){
+    cdc_index *x = calloc(1, sizeof(*x));
+    if(!x) return NULL;
+    size_t cap = 1024;
+    while(cap < hint + hint / 2) cap <<= 1;
+    x->ent_cap = hint ? hint : 256;
+    x->ent = malloc(x->ent_cap * sizeof(cdc_entry));
+    if(!x->ent || index_grow(x, cap) != 0){ free(x->ent); free(x); return NULL; }
+    return x;
+}
+
+void cdc_index_free(cdc_index *x){
+    if(!x) return;
+    free(x->keys); free(x->ids); free(x->ent);
+    free(x);
+}
+
+uint32_t cdc_index_find(const cdc_index *x, const uint8_t digest[32]){
+    uint64_t k = key_of(digest);
+    for(size_t j=(size_t)k & (x->cap - 1); x->keys[j]; j=(j + 1) & (x->cap - 1))
+        if(x->keys[j] == k && memcmp(x->ent[x->ids[j]].digest, digest, 32) == 0) return x->ids[j];
+    return UINT32_MAX;
+}
+
+uint32_t cdc_index_insert(cdc_index *x, const uint8_t digest[32], uint64_t off, uint32_t len, int *is_new){
+    uint64_t k = key_of(digest);
+    size_t j = (size_t)k & (x->cap - 1);
+    for(; x->keys[j]; j=(j + 1) & (x->cap - 1)){
+        if(x->keys[j] == k && memcmp(x->ent[x->ids[j]].digest, digest, 32) == 0){
+            x->ent[x->ids[j]].refs++;
+            if(is_new) *is_new = 0;
+            return x->ids[j];
+        }
+    }
+    if(x->n >= UINT32_MAX - 1) return UINT32_MAX;
+    if(x->n == x->ent_cap){
+        cdc_entry *e = realloc(x->ent, 2 * x->ent_cap * sizeof(cdc_entry));
+        if(!e) return UINT32_MAX;
+        x->ent = e;
+        x->ent_cap *= 2;
+    }
+    // 装载率超过 0.7 时翻倍，重新找空槽
+    if((x->n + 1) * 10 > x->cap * 7){
+        if(index_grow(x, x->cap * 2) != 0) return UINT32_MAX;
+        for(j=(size_t)k & (x->cap - 1); x->keys[j]; j=(j + 1) & (x->cap - 1)) ;
+    }
+    cdc_entry *e = &x->ent[x->n];
+    memcpy(e->digest, digest, 32);
+    e->off = off;
+    e->len = len;
+    e->refs = 1;
+    x->keys[j] = k;
+    x->ids[j] = (uint32_t)x->n;
+    if(is_new) *is_new = 1;
+    return (uint32_t)x->n++;
+}
+
+const cdc_entry *cdc_index_entry(const cdc_index *x, uint32_t id){
+    return id < x->n ? &x->ent[id] : NULL;
+}
+
+size_t cdc_index_count(const cdc_index *x){ return x->n; }
+
+/* ---------------- 流水线 ---------------- */
+
+int cdc_dedup(const uint8_t *data, size_t len, uint64_t base, const cdc_params *p,
+              cdc_index *idx, cdc_chunk_fn cb, void *arg, cdc_stats *st){
+    cutter_t c;
+    if(!idx){ errno = EINVAL; return -1; }
+    if(cutter_init(&c, data, len, p) != 0) return -1;
+    const uint8_t *msg[CDC_BATCH];
+    size_t mlen[CDC_BATCH], moff[CDC_BATCH];
+    uint8_t dig[CDC_BATCH][32];
+    size_t n = 0, prev = 0, e;
+    int rc = 0;
+    for(;;){
+        e = cutter_next(&c);
+        if(e){
+            msg[n] = data + prev;
+            mlen[n] = e - prev;
+            moff[n] = prev;
+            n++;
+            prev = e;
+        }
+        if(n == CDC_BATCH || (!e && n)){
+            sm3_mb_hash(msg, mlen, n, dig);
+            for(size_t k=0;k<n;k++){
+                int is_new;
+                cdc_chunk ch;
+                ch.off = base + moff[k];
+                ch.len = (uint32_t)mlen[k];
+                memcpy(ch.digest, dig[k], 32);
+                uint32_t id = cdc_index_insert(idx, dig[k], ch.off, ch.len, &is_new);
+                if(id == UINT32_MAX){ errno = ENOMEM; rc = -1; break; }
+                if(st){
+                    st->bytes += ch.len;
+                    st->chunks++;
+                    if(is_new){ st->unique_bytes += ch.len; st->unique_chunks++; }
+                }
+                if(cb) cb(arg, &ch, id, is_new);
+            }
+            n = 0;
+            if(rc) break;
+        }
+        if(!e) break;
+    }
+    free(c.cand);
+    return rc;
+}
+
+int cdc_dedup_file(const char *path, uint64_t base, const cdc_params *p,
+                   cdc_index *idx, cdc_chunk_fn cb, void *arg, cdc_stats *st){
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) return -1;
+    struct stat sb;
+    if(fstat(fd, &sb) != 0){ int e = errno; close(fd); errno = e; return -1; }
+    size_t len = (size_t)sb.st_size;
+    if(len == 0){ close(fd); return cdc_dedup(NULL, 0, base, p, idx, cb, arg, st); }
+    void *m = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(m == MAP_FAILED) return -1;
+    madvise(m, len, MADV_SEQUENTIAL);
+    int rc = cdc_dedup(m, len, base, p, idx, cb, arg, st);
+    int e = errno;
+    munmap(m, len);
+    errno = e;
+    return rc;
+}
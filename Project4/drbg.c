@@ -0,0 +1,241 @@
+// drbg.c
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/random.h>
+#include "sm3.h"
+#include "sm3_mb.h"
+#include "drbg.h"
+
+/*
+  V、C 和各种加法都按 55 字节大端整数处理，模 2^440。
+  Hashgen 一批最多 DRBG_MB_BATCH 个 V+i，各 55 字节，正好一个 SM3 分组加填充，8 个通道并行压缩。
+  每线程缓冲：buf[pos..) 是还没用过的输出；pos == DRBG_BUF_BYTES 表示空。
+*/
+
+#define RESEED_LIMIT (1ull << 48)
+
+static void wipe(void *p, size_t n){
+    explicit_bzero(p, n);
+}
+
+/* V = (V + x) mod 2^440，x 为 xlen 字节的大端整数（xlen <= 55） */
+static void add_be(uint8_t V[DRBG_SEEDLEN], const uint8_t *x, size_t xlen){
+    unsigned carry = 0;
+    for(size_t i=0;i<DRBG_SEEDLEN;i++){
+        size_t k = DRBG_SEEDLEN - 1 - i;
+        carry += V[k] + (i < xlen ? x[xlen - 1 - i] : 0);
+        V[k] = (uint8_t)carry;
+        carry >>= 8;
+    }
+}
+
+static void add_u64(uint8_t V[DRBG_SEEDLEN], uint64_t v){
+    uint8_t b[8];
+    for(int i=0;i<8;i++) b[i] = (uint8_t)(v >> (56 - 8*i));
+    add_be(V, b, 8);
+}
+
+/* Hash_df：out = 前 seedlen 位 of Hash(1 || 440 || input) || Hash(2 || 440 || input)，input 为各段的拼接 */
+static void hash_df(uint8_t out[DRBG_SEEDLEN], const uint8_t *const *part, const size_t *plen, int np){
+    uint8_t hdr[5] = { 1, 0, 0, (uint8_t)(DRBG_SEEDLEN * 8 >> 8), (uint8_t)(DRBG_SEEDLEN * 8) };
+    uint8_t h[32];
+    for(size_t off=0; off<DRBG_SEEDLEN; off+=32, hdr[0]++){
+        sm3_ctx c;
+        sm3_init(&c);
+        sm3_update(&c, hdr, sizeof(hdr));
+        for(int i=0;i<np;i++) if(plen[i]) sm3_update(&c, part[i], plen[i]);
+        sm3_final(&c, h);
+        memcpy(out + off, h, DRBG_SEEDLEN - off < 32 ? DRBG_SEEDLEN - off : 32);
+        wipe(&c, sizeof(c));
+    }
+    wipe(h, sizeof(h));
+}
+
+/* C = Hash_df(0x00 || V)，reseed_counter = 1 */
+static void derive_c(hash_drbg *d){
+    static const uint8_t zero = 0;
+    const uint8_t *part[2] = { &zero, d->V };
+    size_t plen[2] = { 1, DRBG_SEEDLEN };
+    hash_df(d->C, part, plen, 2);
+    d->reseed_counter = 1;
+}
+
+int hash_drbg_instantiate(hash_drbg *d, const uint8_t *entropy, size_t elen, const uint8_t *nonce, size_t nlen,
+                          const uint8_t *pers, size_t plen){
+    if(elen < 32 || elen > DRBG_MAX_ADDITIONAL || nlen > DRBG_MAX_ADDITIONAL || plen > DRBG_MAX_ADDITIONAL) return -1;
+    const uint8_t *part[3] = { entropy, nonce, pers };
+    size_t len[3] = { elen, nlen, plen };
+    hash_df(d->V, part, len, 3);
+    derive_c(d);
+    return 0;
+}
+
+int hash_drbg_reseed(hash_drbg *d, const uint8_t *entropy, size_t elen, const uint8_t *add, size_t alen){
+    static const uint8_t one = 1;
+    if(elen < 32 || elen > DRBG_MAX_ADDITIONAL || alen > DRBG_MAX_ADDITIONAL) return -1;
+    uint8_t V[DRBG_SEEDLEN];
+    memcpy(V, d->V, DRBG_SEEDLEN);
+    const uint8_t *part[4] = { &one, V, entropy, add };
+    size_t len[4] = { 1, DRBG_SEEDLEN, elen, alen };
+    hash_df(d->V, part, len, 4);
+    wipe(V, sizeof(V));
+    derive_c(d);
+    return 0;
+}
+
+/* Hashgen：out = Hash(V) || Hash(V+1) || ...，每批 DRBG_MB_BATCH 条消息 */
+static void hashgen(const uint8_t V[DRBG_SEEDLEN], uint8_t *out, size_t len){
+    uint8_t data[DRBG_MB_BATCH][DRBG_SEEDLEN], h[DRBG_MB_BATCH][32];
+    const uint8_t *msg[DRBG_MB_BATCH];
+    size_t mlen[DRBG_MB_BATCH];
+    static const uint8_t one = 1;
+    uint8_t cur[DRBG_SEEDLEN];
+    memcpy(cur, V, DRBG_SEEDLEN);
+    while(len){
+        size_t m = (len + 31) / 32;
+        if(m > DRBG_MB_BATCH) m = DRBG_MB_BATCH;
+        for(size_t i=0;i<m;i++){
+            memcpy(data[i], cur, DRBG_SEEDLEN);
+            add_be(cur, &one, 1);
+            msg[i] = data[i];
+            mlen[i] = DRBG_SEEDLEN;
+        }
+        sm3_mb_hash(msg, mlen, m, h);
+        size_t n = m * 32 < len ? m * 32 : len;
+        memcpy(out, h, n);
+        out += n;
+        len -= n;
+    }
+    wipe(data, sizeof(data));
+    wipe(h, sizeof(h));
+    wipe(cur, sizeof(cur));
+}
+
+int hash_drbg_generate(hash_drbg *d, uint8_t *out, size_t len, const uint8_t *add, size_t alen){
+    static const uint8_t two = 2, three = 3;
+    uint8_t h[32];
+    sm3_ctx c;
+    if(len > DRBG_MAX_REQUEST || alen > DRBG_MAX_ADDITIONAL || d->reseed_counter > RESEED_LIMIT) return -1;
+    if(alen){
+        sm3_init(&c);
+        sm3_update(&c, &two, 1);
+        sm3_update(&c, d->V, DRBG_SEEDLEN);
+        sm3_update(&c, add, alen);
+        sm3_final(&c, h);
+        add_be(d->V, h, 32);
+    }
+    hashgen(d->V, out, len);
+    sm3_init(&c);
+    sm3_update(&c, &three, 1);
+    sm3_update(&c, d->V, DRBG_SEEDLEN);
+    sm3_final(&c, h);
+    add_be(d->V, h, 32);
+    add_be(d->V, d->C, DRBG_SEEDLEN);
+    add_u64(d->V, d->reseed_counter);
+    d->reseed_counter++;
+    wipe(h, sizeof(h));
+    wipe(&c, sizeof(c));
+    return 0;
+}
+
+void hash_drbg_wipe(hash_drbg *d){
+    wipe(d, sizeof(*d));
+}
+
+/* ---------------- 每线程缓冲 ---------------- */
+
+typedef struct {
+    hash_drbg d;
+    uint8_t buf[DRBG_BUF_BYTES];
+    size_t pos;
+    unsigned refills;                   // 上次播种以来的 generate 次数
+    unsigned gen;                       // 播种时的 fork 代数
+    int ready;
+} tls_drbg;
+
+static __thread tls_drbg tls;
+static atomic_uint fork_gen;
+static pthread_once_t atfork_once = PTHREAD_ONCE_INIT;
+
+static void on_fork_child(void){
+    atomic_fetch_add_explicit(&fork_gen, 1, memory_order_relaxed);
+}
+
+static void register_atfork(void){
+    pthread_atfork(NULL, NULL, on_fork_child);
+}
+
+static int get_entropy(uint8_t *p, size_t n){
+    while(n){
+        ssize_t r = getrandom(p, n, 0);
+        if(r < 0 && errno == EINTR) continue;
+        if(r <= 0) return -1;
+        p += r; n -= (size_t)r;
+    }
+    return 0;
+}
+
+/* 首次使用、fork 之后或到达重播种间隔时调用 */
+static int seed(tls_drbg *t){
+    uint8_t e[48];                      // 32 字节熵 + 16 字节 nonce
+    struct { const void *self; pthread_t tid; unsigned gen; } pers = { t, pthread_self(), 0 };
+    pthread_once(&atfork_once, register_atfork);
+    unsigned gen = atomic_load_explicit(&fork_gen, memory_order_relaxed);
+    pers.gen = gen;
+    if(get_entropy(e, sizeof(e)) != 0) return -1;
+    int rc = t->ready && t->gen == gen
+           ? hash_drbg_reseed(&t->d, e, 32, NULL, 0)
+           : hash_drbg_instantiate(&t->d, e, 32, e + 32, 16, (const uint8_t *)&pers, sizeof(pers));
+    wipe(e, sizeof(e));
+    if(rc != 0) return -1;
+    wipe(t->buf, sizeof(t->buf));
+    t->pos = DRBG_BUF_BYTES;
+    t->refills = 0;
+    t->gen = gen;
+    t->ready = 1;
+    return 0;
+}
+
+/* 生成 len 字节到 out，计入重播种间隔 */
+static int generate(tls_drbg *t, uint8_t *out, size_t len){
+    if(t->refills >= DRBG_RESEED_REFILLS && seed(t) != 0) return -1;
+    t->refills++;
+    return hash_drbg_generate(&t->d, out, len, NULL, 0);
+}
+
+int drbg_random(void *out, size_t len){
+    tls_drbg *t = &tls;
+    uint8_t *o = out;
+    if(!t->ready || t->gen != atomic_load_explicit(&fork_gen, memory_order_relaxed))
+        if(seed(t) != 0) return -1;
+    size_t have = DRBG_BUF_BYTES - t->pos;
+    if(len <= have){                    // 快路径
+        memcpy(o, t->buf + t->pos, len);
+        wipe(t->buf + t->pos, len);
+        t->pos += len;
+        return 0;
+    }
+    memcpy(o, t->buf + t->pos, have);
+    wipe(t->buf + t->pos, have);
+    t->pos = DRBG_BUF_BYTES;
+    o += have; len -= have;
+    while(len >= DRBG_BUF_BYTES){       // 大请求直接生成，不经过缓冲
+        size_t n = len < DRBG_MAX_REQUEST ? len : DRBG_MAX_REQUEST;
+        if(generate(t, o, n) != 0) return -1;
+        o += n; len -= n;
+    }
+    if(len){
+        if(generate(t, t->buf, DRBG_BUF_BYTES) != 0) return -1;
+        memcpy(o, t->buf, len);
+        wipe(t->buf, len);
+        t->pos = len;
+    }
+    return 0;
+}
+
+int drbg_reseed(void){
+    return seed(&tls);
+}
@@ -0,0 +1,53 @@
+// drbg.h
+#ifndef DRBG_H
+#define DRBG_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  Hash_DRBG（NIST SP 800-90A Rev.1 §10.1.1），哈希函数为 SM3：outlen = 256，seedlen = 440 位（55 字节）。
+    实例化：V = Hash_df(entropy || nonce || pers)，C = Hash_df(0x00 || V)
+    重播种：V = Hash_df(0x01 || V || entropy || add)，C = Hash_df(0x00 || V)
+    生成：  (有 add 时 V += Hash(0x02 || V || add)) 输出 Hash(V) || Hash(V+1) || ...，
+           然后 V += Hash(0x03 || V) + C + reseed_counter
+  Hashgen 的各个 Hash(V+i) 互不相关，每 DRBG_MB_BATCH 个一起交给 sm3_mb_hash。
+  上层是每线程一个实例的缓冲接口 drbg_random：一次生成 DRBG_BUF_BYTES 字节放在线程局部缓冲里，
+  小请求只做一次拷贝；用过的字节立即清零。熵与 nonce 取自 getrandom，
+  每生成 DRBG_RESEED_REFILLS 次缓冲后重播种，fork 之后子进程的第一次调用也会重播种。
+  编译：gcc -O2 -mavx2 drbg.c sm3_mb.c sm3.c -pthread
+*/
+
+#define DRBG_SEEDLEN        55
+#define DRBG_MAX_REQUEST    65536           // 单次生成的上限（2^19 位）
+#define DRBG_MAX_ADDITIONAL 4096            // 附加输入/个性化串的上限
+#define DRBG_MB_BATCH       64
+#define DRBG_BUF_BYTES      4096            // 每线程预生成的字节数
+#define DRBG_RESEED_REFILLS (1u << 14)      // 64 MiB 输出后重播种
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t V[DRBG_SEEDLEN], C[DRBG_SEEDLEN];
+    uint64_t reseed_counter;
+} hash_drbg;
+
+/* 以下三个函数直接实现标准中的算法，entropy 由调用方提供；长度超限返回 -1 */
+int hash_drbg_instantiate(hash_drbg *d, const uint8_t *entropy, size_t elen, const uint8_t *nonce, size_t nlen,
+                          const uint8_t *pers, size_t plen);
+int hash_drbg_reseed(hash_drbg *d, const uint8_t *entropy, size_t elen, const uint8_t *add, size_t alen);
+/* out 最多 DRBG_MAX_REQUEST 字节；add 可为 NULL。reseed_counter 超过 2^48 时返回 -1（需要先重播种） */
+int hash_drbg_generate(hash_drbg *d, uint8_t *out, size_t len, const uint8_t *add, size_t alen);
+void hash_drbg_wipe(hash_drbg *d);
+
+/* 每线程缓冲接口：任意长度，成功返回 0；getrandom 失败返回 -1 并保留 errno */
+int drbg_random(void *out, size_t len);
+/* 立即用 getrandom 重播种本线程的实例，并丢弃已缓冲的输出 */
+int drbg_reseed(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Generate secp256k1_tables.h: precomputed multiples of the secp256k1 base point G and the
+GLV endomorphism constants (curve parameters identical to Project5/sign.py).
+
+  - SECP256K1_COMB[b][j]  fixed-base comb (Lim-Lee), TEETH=6, SPACING=43, two blocks of 22 columns,
+                          with offset points O_b exactly as in gen_sm2_tables.py.
+  - SECP256K1_COMB_CORR   -(2^22 - 1) * (O_0 + O_1), added once at the end of the comb.
+  - SECP256K1_G_ODD[i]    (2i+1) * G for i < 64, the wNAF window-8 table used by verification.
+  - SECP256K1_G_ODD_LAM   lambda * SECP256K1_G_ODD[i] = (beta * x, y).
+  - GLV constants: beta (cube root of unity mod p), lambda (cube root of unity mod n), the rounding
+    multipliers g1 = round(2^384 * b2 / n), g2 = round(2^384 * (-b1) / n) and the lattice basis
+    entries -b1, -b2 (in Montgomery form mod n, so that a Montgomery product with a plain scalar
+    yields a plain result).
+
+Field elements are stored as 5 little-endian 52-bit limbs (normalized); scalars as 4 x 64-bit limbs.
+Every constant is checked here before it is written out.
+Usage: python3 gen_secp256k1_tables.py  (writes secp256k1_tables.h next to this script)
+"""
+
+import hashlib
+import os
+import random
+
+p = 2**256 - 2**32 - 977
+n = 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141
+Gx = 0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798
+Gy = 0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8
+G = (Gx, Gy)
+
+TEETH, SPACING, BLOCKS, BLOCKLEN = 6, 43, 2, 22
+WNAF_G = 8
+
+BETA = 0x7AE96A2B657C07106E64479EAC3434E99CF0497512F58995C1396C28719501EE
+LAMBDA = 0x5363AD4CC05C30E0A5261C028812645A122E22EA20816678DF02967C1B23BD72
+# short lattice basis (a1, b1), (a2, b2) with a_i + b_i * lambda = 0 (mod n)
+A1 = 0x3086D221A7D46BCDE86C90E49284EB15
+B1 = -0xE4437ED6010E88286F547FA90ABFE4C3
+A2 = 0x114CA50F7A8E2F3F657C1108D9D44CFD8
+B2 = A1
+
+# ---------- affine arithmetic (None = point at infinity) ----------
+
+def add(P, Q):
+    if P is None: return Q
+    if Q is None: return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0: return None
+        lam = 3 * P[0] * P[0] * pow(2 * P[1], -1, p) % p
+    else:
+        lam = (Q[1] - P[1]) * pow(Q[0] - P[0], -1, p) % p
+    x = (lam * lam - P[0] - Q[0]) % p
+    return (x, (lam * (P[0] - x) - P[1]) % p)
+
+def neg(P):
+    return None if P is None else (P[0], (-P[1]) % p)
+
+def mul(k, P):
+    R = None
+    while k:
+        if k & 1: R = add(R, P)
+        P = add(P, P); k >>= 1
+    return R
+
+def endo(P):
+    return (BETA * P[0] % p, P[1])
+
+# ---------- GLV checks ----------
+
+def split(k, g1, g2):
+    c1 = (k * g1 + (1 << 383)) >> 384
+    c2 = (k * g2 + (1 << 383)) >> 384
+    r2 = (c1 * -B1 + c2 * -B2) % n
+    r1 = (k - r2 * LAMBDA) % n
+    return r1, r2
+
+def check_glv(g1, g2):
+    assert pow(BETA, 3, p) == 1 and BETA != 1
+    assert pow(LAMBDA, 3, n) == 1 and LAMBDA != 1
+    assert (A1 + B1 * LAMBDA) % n == 0 and (A2 + B2 * LAMBDA) % n == 0
+    assert mul(LAMBDA, G) == endo(G)
+    rnd = random.Random(1)
+    ks = [0, 1, n - 1, n // 2, (n + 1) // 2, LAMBDA, n - LAMBDA] + [rnd.randrange(n) for _ in range(20000)]
+    for k in ks:
+        r1, r2 = split(k, g1, g2)
+        assert (r1 + r2 * LAMBDA) % n == k
+        for r in (r1, r2):
+            assert min(r, n - r) < 2**128, hex(k)
+
+# ---------- tables ----------
+
+def offset(b):
+    h = hashlib.sha256(b"secp256k1 comb offset %d" % b).digest()
+    return mul(int.from_bytes(h, "big") % n, G)
+
+def comb_tables():
+    tabs, offs = [], []
+    for b in range(BLOCKS):
+        base = [mul(pow(2, i * SPACING + b * BLOCKLEN), G) for i in range(TEETH)]
+        O = offset(b)
+        offs.append(O)
+        row = []
+        for j in range(1 << TEETH):
+            P = O
+            for i in range(TEETH):
+                if (j >> i) & 1: P = add(P, base[i])
+            assert P is not None
+            row.append(P)
+        tabs.append(row)
+    O = None
+    for o in offs: O = add(O, o)
+    corr = neg(mul((1 << BLOCKLEN) - 1, O))
+    return tabs, corr
+
+def g_odd():
+    G2 = add(G, G)
+    out, P = [], G
+    for _ in range(1 << (WNAF_G - 2)):
+        out.append(P); P = add(P, G2)
+    return out
+
+# ---------- output ----------
+
+def fe(x):
+    return "{{ " + ", ".join("0x%013xULL" % ((x >> (52 * i)) & (2**52 - 1)) for i in range(5)) + " }}"
+
+def sc(x):
+    return "{{ " + ", ".join("0x%016xULL" % ((x >> (64 * i)) & (2**64 - 1)) for i in range(4)) + " }}"
+
+def point(P):
+    return "{ %s, %s }" % (fe(P[0]), fe(P[1]))
+
+def main():
+    g1 = ((B2 << 384) + n // 2) // n
+    g2 = ((-B1 << 384) + n // 2) // n
+    check_glv(g1, g2)
+    R = 1 << 256
+    tabs, corr = comb_tables()
+    odd = g_odd()
+    out = []
+    out.append("// secp256k1_tables.h -- generated by gen_secp256k1_tables.py, do not edit")
+    out.append("#ifndef SECP256K1_TABLES_H")
+    out.append("#define SECP256K1_TABLES_H")
+    out.append('#include "secp256k1.h"')
+    out.append("")
+    out.append("#define SECP256K1_COMB_TEETH    %d" % TEETH)
+    out.append("#define SECP256K1_COMB_SPACING  %d" % SPACING)
+    out.append("#define SECP256K1_COMB_BLOCKS   %d" % BLOCKS)
+    out.append("#define SECP256K1_COMB_BLOCKLEN %d" % BLOCKLEN)
+    out.append("#define SECP256K1_WNAF_G        %d" % WNAF_G)
+    out.append("")
+    out.append("/* GLV: beta^3 = 1 (mod p), lambda^3 = 1 (mod n), lambda*(x, y) = (beta*x, y) */")
+    out.append("static const secp256k1_fe SECP256K1_BETA = %s;" % fe(BETA))
+    out.append("static const secp256k1_scalar SECP256K1_GLV_G1 = %s;" % sc(g1))
+    out.append("static const secp256k1_scalar SECP256K1_GLV_G2 = %s;" % sc(g2))
+    out.append("/* Montgomery form mod n: lambda, -b1, -b2 */")
+    out.append("static const secp256k1_scalar SECP256K1_LAMBDA_MONT = %s;" % sc(LAMBDA * R % n))
+    out.append("static const secp256k1_scalar SECP256K1_GLV_MB1_MONT = %s;" % sc(-B1 * R % n))
+    out.append("static const secp256k1_scalar SECP256K1_GLV_MB2_MONT = %s;" % sc(-B2 * R % n))
+    out.append("")
+    out.append("static const secp256k1_affine SECP256K1_COMB[SECP256K1_COMB_BLOCKS][1 << SECP256K1_COMB_TEETH] = {")
+    for row in tabs:
+        out.append("  {")
+        out.extend("    %s," % point(P) for P in row)
+        out.append("  },")
+    out.append("};")
+    out.append("")
+    out.append("static const secp256k1_affine SECP256K1_COMB_CORR = %s;" % point(corr))
+    out.append("")
+    out.append("static const secp256k1_affine SECP256K1_G_ODD[1 << (SECP256K1_WNAF_G - 2)] = {")
+    out.extend("  %s," % point(P) for P in odd)
+    out.append("};")
+    out.append("")
+    out.append("static const secp256k1_affine SECP256K1_G_ODD_LAM[1 << (SECP256K1_WNAF_G - 2)] = {")
+    out.extend("  %s," % point(endo(P)) for P in odd)
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "secp256k1_tables.h")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("Wrote", path)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Generate sm2_tables.h: precomputed multiples of the SM2 base point G
+(curve parameters identical to Project5/sm2_basic.py).
+
+  - SM2_COMB[b][j]   fixed-base comb (Lim-Lee), TEETH=6, SPACING=43, two blocks of 22 columns:
+                     SM2_COMB[b][j] = O_b + sum_i bit_i(j) * 2^(i*43 + b*22) * G
+                     The offsets O_b make every entry (including j=0) a finite point, so the
+                     constant-time comb never has to branch on a zero digit.
+  - SM2_COMB_CORR    -(2^22 - 1) * (O_0 + O_1), added once at the end of the comb.
+  - SM2_G_ODD[i]     (2i+1) * G for i < 64, the wNAF window-8 table used by verification.
+
+All coordinates are stored in Montgomery form (x * 2^256 mod p) as 4 little-endian 64-bit limbs.
+Usage: python3 gen_sm2_tables.py  (writes sm2_tables.h next to this script)
+"""
+
+import hashlib
+import os
+
+p = int("8542D69E4C044F18E8B92435BF6FF7DE457283915C45517D722EDB8B08F1DFC3", 16)
+a = int("787968B4FA32C3FD2417842E73BBFEFF2F3C848B6831D7E0EC65228B3937E498", 16)
+n = int("8542D69E4C044F18E8B92435BF6FF7DD297720630485628D5AE74EE7C32E79B7", 16)
+Gx = int("421DEBD61B62EAB6746434EBC3CC315E32220B3BADD50BDC4C4E6C147FEDD43D", 16)
+Gy = int("0680512BCBB42C07D47349D2153B70C4E5D7FDFCBFA36EA1A85841B9E46E09A2", 16)
+G = (Gx, Gy)
+
+TEETH, SPACING, BLOCKS, BLOCKLEN = 6, 43, 2, 22
+WNAF_G = 8
+
+# ---------- affine arithmetic (None = point at infinity) ----------
+
+def add(P, Q):
+    if P is None: return Q
+    if Q is None: return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0: return None
+        lam = (3 * P[0] * P[0] + a) * pow(2 * P[1], -1, p) % p
+    else:
+        lam = (Q[1] - P[1]) * pow(Q[0] - P[0], -1, p) % p
+    x = (lam * lam - P[0] - Q[0]) % p
+    return (x, (lam * (P[0] - x) - P[1]) % p)
+
+def neg(P):
+    return None if P is None else (P[0], (-P[1]) % p)
+
+def mul(k, P):
+    R = None
+    while k:
+        if k & 1: R = add(R, P)
+        P = add(P, P); k >>= 1
+    return R
+
+# ---------- tables ----------
+
+def offset(b):
+    h = hashlib.sha256(b"SM2 comb offset %d" % b).digest()
+    return mul(int.from_bytes(h, "big") % n, G)
+
+def comb_tables():
+    tabs, offs = [], []
+    for b in range(BLOCKS):
+        base = [mul(pow(2, i * SPACING + b * BLOCKLEN), G) for i in range(TEETH)]
+        O = offset(b)
+        offs.append(O)
+        row = []
+        for j in range(1 << TEETH):
+            P = O
+            for i in range(TEETH):
+                if (j >> i) & 1: P = add(P, base[i])
+            assert P is not None
+            row.append(P)
+        tabs.append(row)
+    O = None
+    for o in offs: O = add(O, o)
+    corr = neg(mul((1 << BLOCKLEN) - 1, O))
+    return tabs, corr
+
+def g_odd():
+    G2 = add(G, G)
+    out, P = [], G
+    for _ in range(1 << (WNAF_G - 2)):
+        out.append(P); P = add(P, G2)
+    return out
+
+# ---------- output ----------
+
+def limbs(x):
+    x = x * (1 << 256) % p
+    return "{ " + ", ".join("0x%016xULL" % ((x >> (64 * i)) & (2**64 - 1)) for i in range(4)) + " }"
+
+def point(P):
+    return "{ {%s}, {%s} }" % (limbs(P[0]), limbs(P[1]))
+
+def main():
+    tabs, corr = comb_tables()
+    odd = g_odd()
+    out = []
+    out.append("// sm2_tables.h -- generated by gen_sm2_tables.py, do not edit")
+    out.append("#ifndef SM2_TABLES_H")
+    out.append("#define SM2_TABLES_H")
+    out.append('#include "sm2.h"')
+    out.append("")
+    out.append("#define SM2_COMB_TEETH    %d" % TEETH)
+    out.append("#define SM2_COMB_SPACING  %d" % SPACING)
+    out.append("#define SM2_COMB_BLOCKS   %d" % BLOCKS)
+    out.append("#define SM2_COMB_BLOCKLEN %d" % BLOCKLEN)
+    out.append("#define SM2_WNAF_G        %d" % WNAF_G)
+    out.append("")
+    out.append("static const sm2_affine SM2_COMB[SM2_COMB_BLOCKS][1 << SM2_COMB_TEETH] = {")
+    for row in tabs:
+        out.append("  {")
+        out.extend("    %s," % point(P) for P in row)
+        out.append("  },")
+    out.append("};")
+    out.append("")
+    out.append("static const sm2_affine SM2_COMB_CORR = %s;" % point(corr))
+    out.append("")
+    out.append("static const sm2_affine SM2_G_ODD[1 << (SM2_WNAF_G - 2)] = {")
+    out.extend("  %s," % point(P) for P in odd)
+    out.append("};")
+    out.append("")
+    out.append("#endif")
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "sm2_tables.h")
+    with open(path, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("Wrote", path)
+
+if __name__ == "__main__":
+    main()
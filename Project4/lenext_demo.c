@@ -3,8 +3,8 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
-#include <time.h>
 #include "sm3.h"
+#include "drbg.h"
 
 /*
   目标：验证 SM3 的 length-extension 攻击
@@ -72,7 +72,7 @@ typedef struct {
 static void server_init(server_t *svr, size_t sec_len){
     svr->secret = (uint8_t*)malloc(sec_len);
     svr->secret_len = sec_len;
-    for(size_t i=0;i<sec_len;i++) svr->secret[i] = (uint8_t)(rand() & 0xFF);
+    if(drbg_random(svr->secret, sec_len) != 0){ perror("drbg_random"); exit(1); }
 }
 
 static void server_free(server_t *svr){
@@ -165,11 +165,11 @@ static void free_attack_result(attack_result_t *r){
 
 /* 演示主程序 */
 int main(void){
-    srand((unsigned)time(NULL));
-
-    // 1) 初始化一个“服务器”，随机 secret 长度（攻击者未知）
+    // 1) 初始化一个“服务器”，随机 secret 长度（攻击者未知）；secret 与长度都取自 Hash_DRBG（drbg.c）
     server_t svr;
-    size_t real_secret_len = 8 + (rand() % 25); // 8..32 字节
+    uint8_t r;
+    if(drbg_random(&r, 1) != 0){ perror("drbg_random"); return 1; }
+    size_t real_secret_len = 8 + (r % 25); // 8..32 字节
     server_init(&svr, real_secret_len);
 
     // 2) 攻击者已知的消息与其 MAC
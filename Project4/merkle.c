@@ -0,0 +1,218 @@
+// merkle.c
+#include <stdlib.h>
+#include <string.h>
+#include "sm3.h"
+#include "merkle.h"
+
+void merkle_hash_leaf(const void *leaf, size_t len, uint8_t out[HASHLEN]){
+    uint8_t *buf = malloc(len + 1);
+    buf[0] = 0x00;
+    memcpy(buf+1, leaf, len);
+    sm3_hash(buf, len+1, out);
+    free(buf);
+}
+
+void merkle_hash_node(const uint8_t left[HASHLEN], const uint8_t right[HASHLEN], uint8_t out[HASHLEN]){
+    uint8_t buf[1 + HASHLEN + HASHLEN];
+    buf[0] = 0x01;
+    memcpy(buf+1, left, HASHLEN);
+    memcpy(buf+1+HASHLEN, right, HASHLEN);
+    sm3_hash(buf, 1 + HASHLEN + HASHLEN, out);
+}
+
+/* Build full tree levels.
+   Input: array of pointers to leaf bytes and lengths.
+   We will store tree as vector of levels; each level is array of hashes.
+   Returns pointer to levels array and number of levels via out_levels.
+   Caller should free levels and each level array.
+*/
+level_t *merkle_build(uint8_t **leaf_bufs, size_t *leaf_lens, size_t n_leaves, size_t *out_levels){
+    if(n_leaves == 0) return NULL;
+    // maximum levels = ceil(log2(n_leaves)) + 1
+    size_t max_levels = 0;
+    size_t t = n_leaves;
+    while(t){ max_levels++; t >>= 1; }
+    max_levels += 2;
+
+    level_t *levels = calloc(max_levels, sizeof(level_t));
+    size_t level_idx = 0;
+
+    // level 0: leaves hashed
+    levels[level_idx].nodes = n_leaves;
+    levels[level_idx].data = malloc(HASHLEN * n_leaves);
+    for(size_t i=0;i<n_leaves;i++){
+        merkle_hash_leaf(leaf_bufs[i], leaf_lens[i], levels[level_idx].data + i*HASHLEN);
+    }
+
+    // build upper levels
+    while(levels[level_idx].nodes > 1){
+        size_t cur_nodes = levels[level_idx].nodes;
+        size_t next_nodes = (cur_nodes + 1) / 2;
+        levels[level_idx+1].nodes = next_nodes;
+        levels[level_idx+1].data = malloc(HASHLEN * next_nodes);
+
+        uint8_t *cur = levels[level_idx].data;
+        uint8_t *next = levels[level_idx+1].data;
+        for(size_t i=0;i<next_nodes;i++){
+            size_t left_idx = i*2;
+            size_t right_idx = left_idx + 1;
+            uint8_t left[HASHLEN], right[HASHLEN], out[HASHLEN];
+            memcpy(left, cur + left_idx*HASHLEN, HASHLEN);
+            if(right_idx < cur_nodes){
+                memcpy(right, cur + right_idx*HASHLEN, HASHLEN);
+            } else {
+                // duplicate last if odd
+                memcpy(right, left, HASHLEN);
+            }
+            merkle_hash_node(left, right, out);
+            memcpy(next + i*HASHLEN, out, HASHLEN);
+        }
+        level_idx++;
+    }
+
+    *out_levels = level_idx + 1;
+    return levels;
+}
+
+/* free levels */
+void merkle_free(level_t *levels, size_t nlevels){
+    if(!levels) return;
+    for(size_t i=0;i<nlevels;i++){
+        if(levels[i].data) free(levels[i].data);
+    }
+    free(levels);
+}
+
+/* get root */
+void merkle_root(level_t *levels, size_t nlevels, uint8_t out[HASHLEN]){
+    memcpy(out, levels[nlevels-1].data, HASHLEN);
+}
+
+/* Inclusion proof:
+   For leaf index idx (0-based), produce an array of sibling hashes (each HASHLEN bytes) and directions.
+   directions: 0 means sibling is right node (i.e., current node was left), 1 means sibling is left.
+   Proof length is equal to nlevels-1 (but trailing levels may not be needed). We'll collect exactly the path length.
+   Returns malloc'd proof_hashes pointer (proof_len * HASHLEN) and malloc'd directions (proof_len bytes). Caller frees.
+*/
+int merkle_inclusion_proof(level_t *levels, size_t nlevels, size_t leaf_index,
+                           uint8_t **out_proof_hashes, uint8_t **out_dirs, size_t *out_len){
+    if(!levels || nlevels==0) return -1;
+    if(leaf_index >= levels[0].nodes) return -2;
+    size_t idx = leaf_index;
+    size_t max_proof_len = nlevels - 1;
+    uint8_t *proof = malloc(HASHLEN * max_proof_len);
+    uint8_t *dirs = malloc(max_proof_len);
+    size_t plen = 0;
+    for(size_t level=0; level < nlevels - 1; level++){
+        size_t sibling;
+        if(idx % 2 == 0){ // even -> sibling is idx+1 (right) if exists
+            sibling = idx + 1;
+            if(sibling >= levels[level].nodes){
+                // no sibling -> duplicate ourselves; proof element is our hash (same)
+                memcpy(proof + plen*HASHLEN, levels[level].data + idx*HASHLEN, HASHLEN);
+                dirs[plen] = 0; // treat as sibling on right
+            } else {
+                memcpy(proof + plen*HASHLEN, levels[level].data + sibling*HASHLEN, HASHLEN);
+                dirs[plen] = 0; // sibling is right
+            }
+        } else { // odd -> sibling is idx-1 (left)
+            sibling = idx - 1;
+            memcpy(proof + plen*HASHLEN, levels[level].data + sibling*HASHLEN, HASHLEN);
+            dirs[plen] = 1; // sibling is left
+        }
+        plen++;
+        idx = idx / 2;
+    }
+    *out_proof_hashes = proof;
+    *out_dirs = dirs;
+    *out_len = plen;
+    return 0;
+}
+
+/* Verify inclusion:
+   Given root, leaf bytes, proof_hashes (array of proof_len*HASHLEN), dirs (proof_len bytes), leaf_index
+*/
+int merkle_verify_inclusion(const uint8_t root[HASHLEN],
+                            const void *leaf, size_t leaf_len,
+                            const uint8_t *proof_hashes, const uint8_t *dirs, size_t proof_len,
+                            size_t leaf_index){
+    uint8_t cur[HASHLEN];
+    merkle_hash_leaf(leaf, leaf_len, cur);
+    size_t idx = leaf_index;
+    for(size_t i=0;i<proof_len;i++){
+        uint8_t left[HASHLEN], right[HASHLEN], out[HASHLEN];
+        if(dirs[i] == 0){
+            // sibling is right -> cur is left
+            memcpy(left, cur, HASHLEN);
+            memcpy(right, proof_hashes + i*HASHLEN, HASHLEN);
+        } else {
+            // sibling is left
+            memcpy(left, proof_hashes + i*HASHLEN, HASHLEN);
+            memcpy(right, cur, HASHLEN);
+        }
+        merkle_hash_node(left, right, out);
+        memcpy(cur, out, HASHLEN);
+        idx /= 2;
+    }
+    // compare cur and root
+    if(memcmp(cur, root, HASHLEN)==0) return 1;
+    return 0;
+}
+
+/* Non-membership proof for a sorted list of leaves (lexicographic on their raw bytes):
+   If value exists -> return membership (found flag).
+   If not found -> find insertion position pos (0..n), and return inclusion proofs for neighbors:
+     - if pos==0: provide proof for leaf 0 (first) to show target < first
+     - if pos==n: provide proof for leaf n-1 (last) to show target > last
+     - else: provide proofs for leaf pos-1 and pos (neighbors). Verifier sees neighbors and concludes target not present.
+   The function outputs the neighbor indices and their proofs.
+   Note: This assumes the tree was constructed on the same *sorted* sequence of leaves.
+*/
+nm_proof_t merkle_non_membership_proof(uint8_t **leaf_bufs, size_t *leaf_lens, size_t n_leaves,
+                                       level_t *levels, size_t nlevels,
+                                       const void *target, size_t target_len){
+    nm_proof_t out;
+    memset(&out, 0, sizeof(out));
+    out.left_index = out.right_index = SIZE_MAX;
+
+    // binary search on byte arrays (lexicographic)
+    size_t lo = 0, hi = n_leaves;
+    while(lo < hi){
+        size_t mid = (lo + hi) / 2;
+        int cmp = memcmp(leaf_bufs[mid], target, (leaf_lens[mid] < target_len) ? leaf_lens[mid] : target_len);
+        if(cmp == 0){
+            if(leaf_lens[mid] == target_len) { // equal length and contents equal
+                out.found = 1; out.found_index = mid; return out;
+            }
+            // else cmp==0 but lengths differ -> decide by lengths
+            if(leaf_lens[mid] < target_len) cmp = -1; else cmp = 1;
+        }
+        if(cmp < 0) lo = mid + 1; else hi = mid;
+    }
+    // insertion position is lo
+    if(lo == 0){
+        out.left_index = SIZE_MAX;
+        out.right_index = 0;
+        // provide proof for right (first)
+        merkle_inclusion_proof(levels, nlevels, 0, &out.right_proof_hashes, &out.right_dirs, &out.right_proof_len);
+    } else if(lo == n_leaves){
+        out.left_index = n_leaves - 1;
+        out.right_index = SIZE_MAX;
+        merkle_inclusion_proof(levels, nlevels, n_leaves-1, &out.left_proof_hashes, &out.left_dirs, &out.left_proof_len);
+    } else {
+        out.left_index = lo - 1;
+        out.right_index = lo;
+        merkle_inclusion_proof(levels, nlevels, out.left_index, &out.left_proof_hashes, &out.left_dirs, &out.left_proof_len);
+        merkle_inclusion_proof(levels, nlevels, out.right_index, &out.right_proof_hashes, &out.right_dirs, &out.right_proof_len);
+    }
+    out.found = 0;
+    return out;
+}
+
+void free_nm_proof(nm_proof_t *p){
+    if(!p) return;
+    if(p->left_proof_hashes) free(p->left_proof_hashes);
+    if(p->left_dirs) free(p->left_dirs);
+    if(p->right_proof_hashes) free(p->right_proof_hashes);
+    if(p->right_dirs) free(p->right_dirs);
+}
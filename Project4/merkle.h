@@ -0,0 +1,56 @@
+// merkle.h
+#ifndef MERKLE_H
+#define MERKLE_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  Merkle tree helper using SM3 with RFC6962-style domain separation:
+    LeafHash = H(0x00 || leaf_bytes)
+    NodeHash = H(0x01 || left_hash || right_hash)
+  For odd nodes at a level we duplicate the last node when pairing.
+*/
+
+#define HASHLEN 32
+
+typedef struct {
+    uint8_t *data; // contiguous array of (node_count * HASHLEN) bytes
+    size_t nodes;
+} level_t;
+
+typedef struct {
+    int found; // 1 if found
+    size_t found_index;
+    // if not found:
+    size_t left_index;  // may be SIZE_MAX if none
+    size_t right_index; // may be SIZE_MAX if none
+    // proofs:
+    uint8_t *left_proof_hashes; uint8_t *left_dirs; size_t left_proof_len;
+    uint8_t *right_proof_hashes; uint8_t *right_dirs; size_t right_proof_len;
+} nm_proof_t;
+
+void merkle_hash_leaf(const void *leaf, size_t len, uint8_t out[HASHLEN]);
+void merkle_hash_node(const uint8_t left[HASHLEN], const uint8_t right[HASHLEN], uint8_t out[HASHLEN]);
+
+level_t *merkle_build(uint8_t **leaf_bufs, size_t *leaf_lens, size_t n_leaves, size_t *out_levels);
+/* Same tree as merkle_build, with leaf and node hashing spread over the first `width`
+   workers of a thread pool (thread_pool.h; NULL pool runs serially). Lives in merkle_par.c. */
+struct tp_pool;
+level_t *merkle_build_par(uint8_t **leaf_bufs, size_t *leaf_lens, size_t n_leaves, size_t *out_levels,
+                          struct tp_pool *pool, int width);
+void merkle_free(level_t *levels, size_t nlevels);
+void merkle_root(level_t *levels, size_t nlevels, uint8_t out[HASHLEN]);
+
+int merkle_inclusion_proof(level_t *levels, size_t nlevels, size_t leaf_index,
+                           uint8_t **out_proof_hashes, uint8_t **out_dirs, size_t *out_len);
+int merkle_verify_inclusion(const uint8_t root[HASHLEN],
+                            const void *leaf, size_t leaf_len,
+                            const uint8_t *proof_hashes, const uint8_t *dirs, size_t proof_len,
+                            size_t leaf_index);
+
+nm_proof_t merkle_non_membership_proof(uint8_t **leaf_bufs, size_t *leaf_lens, size_t n_leaves,
+                                       level_t *levels, size_t nlevels,
+                                       const void *target, size_t target_len);
+void free_nm_proof(nm_proof_t *p);
+
+#endif
@@ -0,0 +1,87 @@
+// merkle_par.c
+#include <stdlib.h>
+#include <string.h>
+#include "sm3.h"
+#include "merkle.h"
+#include "thread_pool.h"
+
+/*
+  Parallel Merkle build on the shared thread pool.
+  Each level is one tp_parallel_for: leaves in chunks of LEAF_GRAIN, inner nodes in chunks
+  of NODE_GRAIN parents. Levels smaller than PAR_MIN_NODES are hashed inline, since waking
+  the pool costs more than a few thousand SM3 compressions.
+  Level buffers come from malloc so merkle_free works unchanged; at these sizes glibc hands
+  out fresh pages, and they are first written by the worker that hashes into them.
+*/
+
+#define LEAF_GRAIN    256
+#define NODE_GRAIN    1024
+#define PAR_MIN_NODES 4096
+
+typedef struct {
+    uint8_t **bufs;
+    size_t *lens;
+    const uint8_t *cur;     // child level
+    size_t cur_nodes;
+    uint8_t *out;
+} par_t;
+
+static void hash_leaves(void *arg, size_t lo, size_t hi, int worker){
+    (void)worker;
+    par_t *a = arg;
+    static const uint8_t prefix = 0x00;
+    for(size_t i=lo;i<hi;i++){
+        sm3_ctx c;
+        sm3_init(&c);
+        sm3_update(&c, &prefix, 1);
+        sm3_update(&c, a->bufs[i], a->lens[i]);
+        sm3_final(&c, a->out + i*HASHLEN);
+    }
+}
+
+static void hash_nodes(void *arg, size_t lo, size_t hi, int worker){
+    (void)worker;
+    par_t *a = arg;
+    for(size_t i=lo;i<hi;i++){
+        const uint8_t *left = a->cur + 2*i*HASHLEN;
+        // duplicate last if odd
+        const uint8_t *right = 2*i + 1 < a->cur_nodes ? left + HASHLEN : left;
+        merkle_hash_node(left, right, a->out + i*HASHLEN);
+    }
+}
+
+level_t *merkle_build_par(uint8_t **leaf_bufs, size_t *leaf_lens, size_t n_leaves, size_t *out_levels,
+                          struct tp_pool *pool, int width){
+    if(n_leaves == 0) return NULL;
+    size_t max_levels = 0;
+    size_t t = n_leaves;
+    while(t){ max_levels++; t >>= 1; }
+    max_levels += 2;
+
+    level_t *levels = calloc(max_levels, sizeof(level_t));
+    if(!levels) return NULL;
+    size_t level_idx = 0;
+    par_t a = { leaf_bufs, leaf_lens, NULL, 0, NULL };
+
+    levels[0].nodes = n_leaves;
+    levels[0].data = malloc(HASHLEN * n_leaves);
+    if(!levels[0].data){ free(levels); return NULL; }
+    a.out = levels[0].data;
+    tp_parallel_for(pool, width, n_leaves, LEAF_GRAIN, hash_leaves, &a);
+
+    while(levels[level_idx].nodes > 1){
+        size_t cur_nodes = levels[level_idx].nodes;
+        size_t next_nodes = (cur_nodes + 1) / 2;
+        levels[level_idx+1].nodes = next_nodes;
+        levels[level_idx+1].data = malloc(HASHLEN * next_nodes);
+        if(!levels[level_idx+1].data){ merkle_free(levels, level_idx + 1); return NULL; }
+        a.cur = levels[level_idx].data;
+        a.cur_nodes = cur_nodes;
+        a.out = levels[level_idx+1].data;
+        tp_parallel_for(next_nodes >= PAR_MIN_NODES ? pool : NULL, width, next_nodes, NODE_GRAIN, hash_nodes, &a);
+        level_idx++;
+    }
+
+    *out_levels = level_idx + 1;
+    return levels;
+}
@@ -0,0 +1,216 @@
+// merkle_server.c
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "merkle_server.h"
+
+/*
+  存储布局：
+    level[L] 是第 L 层的预分配数组，只写入“完整”节点——即其子树的 2^L 个叶子都已到齐，
+    (idx+1) << L <= n。完整节点以后不会再变，写者写入后读者即可随意读取。
+    每层至多最后一个节点不完整，它的值随追加变化，因此放在快照自己的 edge[L] 里。
+  于是一个快照只有 ~2KB（n、根、各层右边缘），追加时复制一份、补齐新完整的节点、
+  重算 O(log n) 个右边缘节点，再原子替换指针发布，读者看到的永远是一棵自洽的树。
+*/
+
+typedef struct mt_snapshot {
+    size_t  n_leaves;
+    size_t  nlevels;
+    uint8_t root[HASHLEN];
+    uint8_t edge[MT_MAX_LEVELS][HASHLEN];   // 各层不完整的最后一个节点
+    uint64_t retire_epoch;
+    struct mt_snapshot *next;               // 写者私有的待回收链表
+} mt_snapshot;
+
+/* 读者槽：epoch==0 表示不在读临界区；按 cache line 对齐避免伪共享 */
+typedef struct {
+    _Alignas(64) _Atomic uint64_t epoch;
+    atomic_int used;
+} mt_reader_slot;
+
+struct merkle_server {
+    size_t max_leaves;
+    size_t nlevels_cap;
+    uint8_t *level[MT_MAX_LEVELS];
+    _Atomic(mt_snapshot *) cur;
+    _Atomic uint64_t global_epoch;
+    mt_reader_slot *readers;
+    int max_readers;
+    mt_snapshot *retired;
+};
+
+static inline const uint8_t *node_at(const merkle_server *s, const mt_snapshot *sn, size_t level, size_t idx){
+    if(((idx + 1) << level) <= sn->n_leaves) return s->level[level] + idx*HASHLEN;
+    return sn->edge[level];
+}
+
+merkle_server *merkle_server_create(size_t max_leaves, int max_readers){
+    if(max_leaves == 0 || max_readers <= 0) return NULL;
+    merkle_server *s = calloc(1, sizeof(*s));
+    if(!s) return NULL;
+    s->max_leaves = max_leaves;
+    size_t cap = max_leaves, L = 0;
+    for(;;){
+        s->level[L] = malloc(cap * HASHLEN);
+        if(!s->level[L]){ s->nlevels_cap = L; merkle_server_destroy(s); return NULL; }
+        L++;
+        if(cap == 1) break;
+        cap = (cap + 1) / 2;
+    }
+    s->nlevels_cap = L;
+    s->readers = aligned_alloc(64, sizeof(mt_reader_slot) * (size_t)max_readers);
+    mt_snapshot *sn = calloc(1, sizeof(*sn));
+    if(!s->readers || !sn){ free(sn); merkle_server_destroy(s); return NULL; }
+    for(int i=0;i<max_readers;i++){
+        atomic_init(&s->readers[i].epoch, 0);
+        atomic_init(&s->readers[i].used, 0);
+    }
+    s->max_readers = max_readers;
+    atomic_init(&s->global_epoch, 1);
+    atomic_init(&s->cur, sn);
+    return s;
+}
+
+void merkle_server_destroy(merkle_server *s){
+    if(!s) return;
+    mt_snapshot *p = s->retired;
+    while(p){ mt_snapshot *nx = p->next; free(p); p = nx; }
+    free(atomic_load(&s->cur));
+    for(size_t i=0;i<s->nlevels_cap;i++) free(s->level[i]);
+    free(s->readers);
+    free(s);
+}
+
+/* ---------------- 写者 ---------------- */
+
+/* 把一个叶子接到 sn 上：写 level[0]，并像二进制进位一样向上补齐刚变完整的父节点。
+   每个完整节点只会被计算一次，批量追加摊还 O(1) 次哈希 */
+static void mt_push(merkle_server *s, mt_snapshot *sn, const void *leaf, size_t len){
+    size_t c = sn->n_leaves++;
+    merkle_hash_leaf(leaf, len, s->level[0] + c*HASHLEN);
+    for(size_t level = 0; c & 1; level++){
+        c >>= 1;
+        merkle_hash_node(s->level[level] + (2*c)*HASHLEN, s->level[level] + (2*c+1)*HASHLEN,
+                         s->level[level+1] + c*HASHLEN);
+    }
+}
+
+/* 一批叶子推完后，自底向上重算各层不完整的最后一个节点（写入 edge）并更新根 */
+static void mt_fix_edge(merkle_server *s, mt_snapshot *sn){
+    size_t n = sn->n_leaves, level = 0, nodes = n;
+    while(nodes > 1){
+        size_t j = (nodes - 1) / 2;             // 上一层的最后一个节点
+        if(((j + 1) << (level + 1)) > n){
+            size_t left = 2*j, right = left + 1;
+            const uint8_t *l = node_at(s, sn, level, left);
+            const uint8_t *r = (right < nodes) ? node_at(s, sn, level, right) : l; // 奇数复制自身
+            merkle_hash_node(l, r, sn->edge[level+1]);
+        }
+        level++;
+        nodes = (nodes + 1) / 2;
+    }
+    sn->nlevels = level + 1;
+    memcpy(sn->root, node_at(s, sn, level, 0), HASHLEN);
+}
+
+/* 释放所有活跃读者都已离开的旧快照 */
+static void mt_reclaim(merkle_server *s){
+    uint64_t min_active = UINT64_MAX;
+    for(int i=0;i<s->max_readers;i++){
+        uint64_t e = atomic_load(&s->readers[i].epoch);
+        if(e && e < min_active) min_active = e;
+    }
+    mt_snapshot **pp = &s->retired;
+    while(*pp){
+        mt_snapshot *p = *pp;
+        if(p->retire_epoch < min_active){ *pp = p->next; free(p); }
+        else pp = &p->next;
+    }
+}
+
+static void mt_publish(merkle_server *s, mt_snapshot *sn){
+    mt_snapshot *old = atomic_exchange(&s->cur, sn);
+    // 在 old 被替换之前进入的读者，其 epoch 不会超过这里取到的值
+    old->retire_epoch = atomic_fetch_add(&s->global_epoch, 1);
+    old->next = s->retired;
+    s->retired = old;
+    mt_reclaim(s);
+}
+
+int merkle_server_append_batch(merkle_server *s, const void *const *leaves, const size_t *lens, size_t n){
+    // 只有写者会替换/释放 cur，这里可以直接读
+    mt_snapshot *cur = atomic_load_explicit(&s->cur, memory_order_relaxed);
+    if(n > s->max_leaves - cur->n_leaves) return -1;
+    if(n == 0) return 0;
+    mt_snapshot *sn = malloc(sizeof(*sn));
+    if(!sn) return -1;
+    memcpy(sn, cur, sizeof(*sn));
+    sn->next = NULL;
+    for(size_t i=0;i<n;i++) mt_push(s, sn, leaves[i], lens[i]);
+    mt_fix_edge(s, sn);
+    mt_publish(s, sn);
+    return 0;
+}
+
+int merkle_server_append(merkle_server *s, const void *leaf, size_t len){
+    return merkle_server_append_batch(s, &leaf, &len, 1);
+}
+
+/* ---------------- 读者 ---------------- */
+
+int merkle_server_reader_register(merkle_server *s){
+    for(int i=0;i<s->max_readers;i++){
+        int expect = 0;
+        if(atomic_compare_exchange_strong(&s->readers[i].used, &expect, 1)) return i;
+    }
+    return -1;
+}
+
+void merkle_server_reader_unregister(merkle_server *s, int reader){
+    atomic_store(&s->readers[reader].epoch, 0);
+    atomic_store(&s->readers[reader].used, 0);
+}
+
+static inline const mt_snapshot *mt_enter(merkle_server *s, int reader){
+    atomic_store(&s->readers[reader].epoch, atomic_load(&s->global_epoch));
+    return atomic_load(&s->cur);
+}
+
+static inline void mt_exit(merkle_server *s, int reader){
+    atomic_store_explicit(&s->readers[reader].epoch, 0, memory_order_release);
+}
+
+size_t merkle_server_snapshot(merkle_server *s, int reader, uint8_t root[HASHLEN]){
+    const mt_snapshot *sn = mt_enter(s, reader);
+    size_t n = sn->n_leaves;
+    if(root) memcpy(root, sn->root, HASHLEN);
+    mt_exit(s, reader);
+    return n;
+}
+
+int merkle_server_prove(merkle_server *s, int reader, size_t leaf_index, mt_proof_t *out){
+    const mt_snapshot *sn = mt_enter(s, reader);
+    if(leaf_index >= sn->n_leaves){ mt_exit(s, reader); return -2; }
+    out->n_leaves = sn->n_leaves;
+    memcpy(out->root, sn->root, HASHLEN);
+
+    size_t idx = leaf_index, nodes = sn->n_leaves, plen = 0;
+    for(size_t level=0; nodes > 1; level++){
+        const uint8_t *sib;
+        if(idx % 2 == 0){
+            // 右兄弟不存在时复制自身，方向仍记为“兄弟在右”
+            sib = node_at(s, sn, level, (idx + 1 < nodes) ? idx + 1 : idx);
+            out->dirs[plen] = 0;
+        } else {
+            sib = node_at(s, sn, level, idx - 1);
+            out->dirs[plen] = 1;
+        }
+        memcpy(out->hashes + plen*HASHLEN, sib, HASHLEN);
+        plen++;
+        idx /= 2;
+        nodes = (nodes + 1) / 2;
+    }
+    out->len = plen;
+    mt_exit(s, reader);
+    return 0;
+}
@@ -0,0 +1,50 @@
+// merkle_server.h
+#ifndef MERKLE_SERVER_H
+#define MERKLE_SERVER_H
+#include <stdint.h>
+#include <stddef.h>
+#include "merkle.h"
+
+/*
+  可嵌入的 Merkle 证明服务：
+    - 单写者 merkle_server_append() 追加叶子，每次追加只重算右边缘 O(log n) 个节点，
+      然后以 RCU 方式发布新的根快照（原子指针替换）；
+    - 多读者 merkle_server_prove() 无锁读取当前快照生成存在性证明，不会被追加阻塞；
+    - 旧快照通过 epoch 回收：所有活跃读者都离开旧 epoch 后才释放。
+  树形与 merkle_build() 完全一致（奇数节点复制自身配对），证明可直接用
+  merkle_verify_inclusion() 验证。
+*/
+
+#define MT_MAX_LEVELS 64
+
+typedef struct merkle_server merkle_server;
+
+/* 一次证明的结果：定长缓冲，读路径上不做 malloc */
+typedef struct {
+    size_t  n_leaves;                          // 证明所对应快照的叶子数
+    uint8_t root[HASHLEN];                     // 该快照的根
+    uint8_t hashes[MT_MAX_LEVELS * HASHLEN];   // 兄弟节点
+    uint8_t dirs[MT_MAX_LEVELS];               // 0: 兄弟在右, 1: 兄弟在左
+    size_t  len;
+} mt_proof_t;
+
+/* max_leaves: 叶子容量（各层存储一次性预分配，追加时不会搬迁）
+   max_readers: 可同时注册的读者线程数 */
+merkle_server *merkle_server_create(size_t max_leaves, int max_readers);
+void merkle_server_destroy(merkle_server *s);
+
+/* 写者接口（仅允许一个线程调用）。成功返回 0，容量不足返回 -1 */
+int merkle_server_append(merkle_server *s, const void *leaf, size_t len);
+int merkle_server_append_batch(merkle_server *s, const void *const *leaves, const size_t *lens, size_t n);
+
+/* 读者接口：每个读者线程先注册拿到 reader id */
+int  merkle_server_reader_register(merkle_server *s);
+void merkle_server_reader_unregister(merkle_server *s, int reader);
+
+/* 当前快照的叶子数与根 */
+size_t merkle_server_snapshot(merkle_server *s, int reader, uint8_t root[HASHLEN]);
+
+/* 对当前快照生成 leaf_index 的存在性证明。成功返回 0，越界返回 -2 */
+int merkle_server_prove(merkle_server *s, int reader, size_t leaf_index, mt_proof_t *out);
+
+#endif
@@ -0,0 +1,192 @@
+// merkle_server_demo.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "merkle_server.h"
+
+/*
+  进程内压测：
+    - 先用 append_batch 灌入 N 个叶子，并与 merkle_build 的根比对；
+    - 1 个写者线程持续追加叶子并发布新根；
+    - R 个读者线程随机生成存在性证明，抽样用 merkle_verify_inclusion 校验；
+    - 结束后报告 proofs/sec、p50/p99 延迟与追加速率。
+  用法: ./merkle_server_demo [N=100000] [readers=4] [seconds=3]
+*/
+
+#define MAX_SAMPLES (1u << 20)
+
+static void print_hex(const uint8_t *p, size_t n){
+    for(size_t i=0;i<n;i++) printf("%02x", p[i]);
+    printf("\n");
+}
+
+static inline uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int make_leaf(size_t i, char buf[32]){
+    return snprintf(buf, 32, "leaf-%08zu", i);
+}
+
+typedef struct {
+    merkle_server *srv;
+    atomic_int *stop;
+    uint64_t seed;
+    uint64_t proofs;
+    uint64_t verify_fail;
+    uint32_t *samples;   // 延迟样本 (ns)
+    size_t nsamples;
+} reader_arg;
+
+typedef struct {
+    merkle_server *srv;
+    atomic_int *stop;
+    size_t next;         // 下一个叶子编号
+    size_t limit;
+} writer_arg;
+
+static void *reader_main(void *p){
+    reader_arg *a = p;
+    int rid = merkle_server_reader_register(a->srv);
+    if(rid < 0){ fprintf(stderr, "no reader slot\n"); return NULL; }
+    uint64_t x = a->seed;
+    mt_proof_t proof;
+    char leaf[32];
+    size_t n = merkle_server_snapshot(a->srv, rid, NULL);
+    while(!atomic_load_explicit(a->stop, memory_order_relaxed)){
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        size_t idx = (size_t)(x % n);
+        uint64_t t0 = now_ns();
+        merkle_server_prove(a->srv, rid, idx, &proof);
+        uint64_t t1 = now_ns();
+        if(a->nsamples < MAX_SAMPLES) a->samples[a->nsamples++] = (uint32_t)(t1 - t0);
+        n = proof.n_leaves;  // 顺带拿到最新叶子数
+        if((a->proofs & 1023) == 0){
+            int l = make_leaf(idx, leaf);
+            if(!merkle_verify_inclusion(proof.root, leaf, (size_t)l, proof.hashes, proof.dirs, proof.len, idx))
+                a->verify_fail++;
+        }
+        a->proofs++;
+    }
+    merkle_server_reader_unregister(a->srv, rid);
+    return NULL;
+}
+
+static void *writer_main(void *p){
+    writer_arg *a = p;
+    char leaf[32];
+    while(!atomic_load_explicit(a->stop, memory_order_relaxed) && a->next < a->limit){
+        int l = make_leaf(a->next, leaf);
+        if(merkle_server_append(a->srv, leaf, (size_t)l) != 0) break;
+        a->next++;
+    }
+    return NULL;
+}
+
+static int cmp_u32(const void *a, const void *b){
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/* 用 merkle_build 从头建树，核对服务端的根 */
+static int check_root(merkle_server *srv, size_t n){
+    uint8_t **bufs = calloc(n, sizeof(uint8_t*));
+    size_t *lens = calloc(n, sizeof(size_t));
+    char tmp[32];
+    for(size_t i=0;i<n;i++){
+        lens[i] = (size_t)make_leaf(i, tmp);
+        bufs[i] = malloc(lens[i]);
+        memcpy(bufs[i], tmp, lens[i]);
+    }
+    size_t nlevels;
+    level_t *levels = merkle_build(bufs, lens, n, &nlevels);
+    uint8_t want[HASHLEN], got[HASHLEN];
+    merkle_root(levels, nlevels, want);
+    int rid = merkle_server_reader_register(srv);
+    size_t have = merkle_server_snapshot(srv, rid, got);
+    merkle_server_reader_unregister(srv, rid);
+    merkle_free(levels, nlevels);
+    for(size_t i=0;i<n;i++) free(bufs[i]);
+    free(bufs); free(lens);
+    return have == n && memcmp(want, got, HASHLEN) == 0;
+}
+
+int main(int argc, char **argv){
+    size_t N = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000;
+    int R = argc > 2 ? atoi(argv[2]) : 4;
+    double secs = argc > 3 ? atof(argv[3]) : 3.0;
+    if(N == 0 || R <= 0){ fprintf(stderr, "bad args\n"); return 1; }
+    size_t cap = N * 8;
+
+    merkle_server *srv = merkle_server_create(cap, R + 1);
+    if(!srv){ fprintf(stderr, "alloc fail\n"); return 1; }
+
+    // 1) 批量灌入
+    printf("Preloading %zu leaves...\n", N);
+    const void **leaves = malloc(N * sizeof(void*));
+    size_t *lens = malloc(N * sizeof(size_t));
+    char (*names)[32] = malloc(N * sizeof(*names));
+    for(size_t i=0;i<N;i++){ lens[i] = (size_t)make_leaf(i, names[i]); leaves[i] = names[i]; }
+    uint64_t t0 = now_ns();
+    merkle_server_append_batch(srv, leaves, lens, N);
+    uint64_t t1 = now_ns();
+    free(leaves); free(lens); free(names);
+    uint8_t root[HASHLEN];
+    int rid = merkle_server_reader_register(srv);
+    merkle_server_snapshot(srv, rid, root);
+    merkle_server_reader_unregister(srv, rid);
+    printf("Merkle root: "); print_hex(root, HASHLEN);
+    printf("Preload: %.1f ms, matches merkle_build: %s\n", (t1 - t0) / 1e6, check_root(srv, N) ? "OK" : "FAIL");
+
+    // 2) 并发压测
+    atomic_int stop;
+    atomic_init(&stop, 0);
+    pthread_t wt, *rt = calloc((size_t)R, sizeof(pthread_t));
+    reader_arg *ra = calloc((size_t)R, sizeof(reader_arg));
+    writer_arg wa = { srv, &stop, N, cap };
+    for(int i=0;i<R;i++){
+        ra[i].srv = srv; ra[i].stop = &stop;
+        ra[i].seed = 0x9e3779b97f4a7c15ull * (uint64_t)(i + 1);
+        ra[i].samples = malloc(MAX_SAMPLES * sizeof(uint32_t));
+        pthread_create(&rt[i], NULL, reader_main, &ra[i]);
+    }
+    pthread_create(&wt, NULL, writer_main, &wa);
+    struct timespec ts = { (time_t)secs, (long)((secs - (time_t)secs) * 1e9) };
+    uint64_t b0 = now_ns();
+    nanosleep(&ts, NULL);
+    atomic_store(&stop, 1);
+    for(int i=0;i<R;i++) pthread_join(rt[i], NULL);
+    pthread_join(wt, NULL);
+    double el = (now_ns() - b0) / 1e9;
+
+    uint64_t proofs = 0, fails = 0;
+    size_t ns = 0;
+    for(int i=0;i<R;i++){ proofs += ra[i].proofs; fails += ra[i].verify_fail; ns += ra[i].nsamples; }
+    uint32_t *all = malloc((ns ? ns : 1) * sizeof(uint32_t));
+    size_t k = 0;
+    for(int i=0;i<R;i++){
+        memcpy(all + k, ra[i].samples, ra[i].nsamples * sizeof(uint32_t));
+        k += ra[i].nsamples;
+        free(ra[i].samples);
+    }
+    qsort(all, ns, sizeof(uint32_t), cmp_u32);
+
+    printf("Readers: %d, duration: %.2f s\n", R, el);
+    printf("Proofs: %llu (%.0f proofs/sec), sampled verify failures: %llu\n",
+           (unsigned long long)proofs, proofs / el, (unsigned long long)fails);
+    if(ns) printf("Latency: p50 %.2f us, p99 %.2f us, max %.2f us\n",
+                  all[ns/2] / 1e3, all[(size_t)(ns*0.99)] / 1e3, all[ns-1] / 1e3);
+    printf("Appends during run: %zu (%.0f appends/sec)\n", wa.next - N, (wa.next - N) / el);
+    printf("Final tree (%zu leaves) matches merkle_build: %s\n", wa.next, check_root(srv, wa.next) ? "OK" : "FAIL");
+
+    free(all); free(ra); free(rt);
+    merkle_server_destroy(srv);
+    return 0;
+}
@@ -0,0 +1,479 @@
+// merkle_sync.c
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "merkle_sync.h"
+
+/*
+  比对计划：na、nb 为两边的叶子数，nmin = min(na, nb)。第 k 层共有 ceil(n / 2^k) 个节点，
+  两边都有的是 j < ceil(nmin / 2^k)。从 top = 两棵树层数的较小值 − 1 开始，
+  初始列表为该层两边都有的全部节点；之后每层的列表是上一层不同节点的孩子（两边都有的）。
+  na != nb 时，(j+1)·2^k > nmin 的节点含有只在一边存在或被复制补齐的叶子，直接算作不同。
+  服务端与客户端用同一份计划推出各层列表，线路上只传哈希和位图。
+  一层的列表超过一帧时按 HASHES_PER_FRAME 分段，每段一个 HASHES/BITMAP 来回，
+  双方把各段的位图拼成整层的位图后再推出下一层。
+*/
+
+#if MS_MAX_FRAME < 4096
+#error "MS_MAX_FRAME too small"
+#endif
+
+/* 每帧的哈希数与区间数：留出层号/起始下标、区间数的 varint，哈希数取 8 的倍数使各段位图按字节对齐 */
+#define HASHES_PER_FRAME (((MS_MAX_FRAME - 32) / HASHLEN) & ~(size_t)7)
+#define RANGES_PER_FRAME ((MS_MAX_FRAME - 16) / 20)
+
+typedef struct {
+    size_t na, nb, nmin, nmax;
+    size_t top;
+    size_t level;                       // 下一轮要比较的层
+    size_t *list, cnt, cap;             // 该层待比较的节点
+    size_t *next;
+    merkle_range *out;                  // 差异区间
+    size_t nout, outcap;
+    int done;
+} plan_t;
+
+static size_t nodes_at(size_t n, size_t k){
+    return n == 0 ? 0 : k >= 8 * sizeof(size_t) ? 1 : ((n - 1) >> k) + 1;
+}
+
+static size_t levels_of(size_t n){
+    size_t l = 1;
+    while(n > 1){ n = (n + 1) / 2; l++; }
+    return l;
+}
+
+static int add_range(plan_t *p, size_t lo, size_t hi){
+    if(p->nout && p->out[p->nout - 1].hi == lo){ p->out[p->nout - 1].hi = hi; return 0; }
+    if(p->nout == p->outcap){
+        size_t cap = p->outcap ? 2 * p->outcap : 16;
+        merkle_range *o = realloc(p->out, cap * sizeof(merkle_range));
+        if(!o) return -1;
+        p->out = o;
+        p->outcap = cap;
+    }
+    p->out[p->nout].lo = lo;
+    p->out[p->nout].hi = hi;
+    p->nout++;
+    return 0;
+}
+
+static int reserve(plan_t *p, size_t n){
+    if(n <= p->cap) return 0;
+    size_t *a = realloc(p->list, n * sizeof(size_t)), *b;
+    if(!a) return -1;
+    p->list = a;
+    b = realloc(p->next, n * sizeof(size_t));
+    if(!b) return -1;
+    p->next = b;
+    p->cap = n;
+    return 0;
+}
+
+/* same_root：两边叶子数相同且根相同（HELLO 里已经比较过） */
+static int plan_init(plan_t *p, size_t na, size_t nb, int same_root){
+    memset(p, 0, sizeof(*p));
+    p->na = na; p->nb = nb;
+    p->nmin = na < nb ? na : nb;
+    p->nmax = na < nb ? nb : na;
+    if(p->nmin == 0 || (na == nb && same_root)){
+        p->done = 1;
+        return p->nmin < p->nmax ? add_range(p, p->nmin, p->nmax) : 0;
+    }
+    size_t la = levels_of(na), lb = levels_of(nb);
+    p->top = p->level = (la < lb ? la : lb) - 1;
+    p->cnt = nodes_at(p->nmin, p->top);
+    if(reserve(p, p->cnt) != 0) return -1;
+    for(size_t j=0;j<p->cnt;j++) p->list[j] = j;
+    return 0;
+}
+
+static int forced(const plan_t *p, size_t k, size_t j){
+    return p->na != p->nb && (k >= 8 * sizeof(size_t) - 1 || ((j + 1) << k) > p->nmin);
+}
+
+/* 按本层的比较结果推出下一层的列表；比较到叶子层后收尾 */
+static int plan_advance(plan_t *p, const uint8_t *bitmap){
+    size_t k = p->level, n = 0, lim = k ? nodes_at(p->nmin, k - 1) : 0;
+    if(k && reserve(p, 2 * p->cnt) != 0) return -1;
+    for(size_t i=0;i<p->cnt;i++){
+        if(!(bitmap[i >> 3] >> (i & 7) & 1)) continue;
+        size_t j = p->list[i];
+        if(k == 0){ if(add_range(p, j, j + 1) != 0) return -1; continue; }
+        if(2*j < lim) p->next[n++] = 2*j;
+        if(2*j + 1 < lim) p->next[n++] = 2*j + 1;
+    }
+    if(k == 0){
+        p->done = 1;
+        if(p->nmin < p->nmax && add_range(p, p->nmin, p->nmax) != 0) return -1;
+        return 0;
+    }
+    size_t *t = p->list; p->list = p->next; p->next = t;
+    p->cnt = n;
+    p->level = k - 1;
+    if(n == 0){                         // 共有部分没有差异
+        p->done = 1;
+        if(p->nmin < p->nmax && add_range(p, p->nmin, p->nmax) != 0) return -1;
+    }
+    return 0;
+}
+
+static void plan_free(plan_t *p){
+    free(p->list); free(p->next); free(p->out);
+}
+
+/* 本层列表第 i0 起 n 个节点的位图（从 bitmap 的第 0 比特写起）：哈希不同或被强制展开的置 1 */
+static void compare_level(const plan_t *p, size_t i0, size_t n, const uint8_t *mine, const uint8_t *theirs,
+                          uint8_t *bitmap){
+    memset(bitmap, 0, (n + 7) / 8);
+    for(size_t i=0;i<n;i++){
+        size_t j = p->list[i0 + i];
+        if(forced(p, p->level, j) || memcmp(mine + j*HASHLEN, theirs + i*HASHLEN, HASHLEN) != 0)
+            bitmap[i >> 3] |= (uint8_t)(1u << (i & 7));
+    }
+}
+
+long merkle_diff(level_t *a, size_t nla, level_t *b, size_t nlb, merkle_range **out, size_t *compared){
+    size_t na = nla ? a[0].nodes : 0, nb = nlb ? b[0].nodes : 0, cmp = 0;
+    int same = na == nb && na && memcmp(a[nla-1].data, b[nlb-1].data, HASHLEN) == 0;
+    plan_t p;
+    if(plan_init(&p, na, nb, same) != 0){ plan_free(&p); return -1; }
+    if(na && nb) cmp++;                 // 根
+    uint8_t *bitmap = NULL, *theirs = NULL;
+    while(!p.done){
+        uint8_t *bm = realloc(bitmap, (p.cnt + 7) / 8), *th = realloc(theirs, p.cnt * HASHLEN);
+        if(bm) bitmap = bm;
+        if(th) theirs = th;
+        if(!bm || !th){ free(bitmap); free(theirs); plan_free(&p); return -1; }
+        for(size_t i=0;i<p.cnt;i++) memcpy(theirs + i*HASHLEN, b[p.level].data + p.list[i]*HASHLEN, HASHLEN);
+        compare_level(&p, 0, p.cnt, a[p.level].data, theirs, bitmap);
+        cmp += p.cnt;
+        if(plan_advance(&p, bitmap) != 0){ free(bitmap); free(theirs); plan_free(&p); return -1; }
+    }
+    free(bitmap); free(theirs);
+    if(compared) *compared = cmp;
+    *out = p.out;
+    p.out = NULL;
+    long n = (long)p.nout;
+    plan_free(&p);
+    return n;
+}
+
+/* ---------------- 线路 ---------------- */
+
+typedef struct {
+    uint8_t *p;
+    size_t n, cap;
+} buf_t;
+
+static int buf_put(buf_t *b, const void *d, size_t n){
+    if(b->n + n > b->cap){
+        size_t cap = b->cap ? b->cap : 256;
+        while(cap < b->n + n) cap *= 2;
+        uint8_t *q = realloc(b->p, cap);
+        if(!q) return -1;
+        b->p = q;
+        b->cap = cap;
+    }
+    memcpy(b->p + b->n, d, n);
+    b->n += n;
+    return 0;
+}
+
+static int put_varint(buf_t *b, uint64_t v){
+    uint8_t t[10];
+    int n = 0;
+    do{ t[n++] = (uint8_t)((v & 0x7f) | (v >= 0x80 ? 0x80 : 0)); v >>= 7; }while(v);
+    return buf_put(b, t, (size_t)n);
+}
+
+/* 从 *p 读一个 varint，越界或超过 64 位返回 -1 */
+static int get_varint(const uint8_t **p, const uint8_t *end, uint64_t *v){
+    uint64_t r = 0;
+    for(int s=0; s<64; s+=7){
+        if(*p >= end) return -1;
+        uint8_t c = *(*p)++;
+        r |= (uint64_t)(c & 0x7f) << s;
+        if(!(c & 0x80)){ *v = r; return 0; }
+    }
+    return -1;
+}
+
+/* 对端已关闭时 send 返回 EPIPE 而不是发出 SIGPIPE；fd 不是套接字（ENOTSOCK）时改用 write */
+static int write_full(int fd, const uint8_t *p, size_t n){
+    int sock = 1;
+    while(n){
+        ssize_t r = sock ? send(fd, p, n, MSG_NOSIGNAL) : write(fd, p, n);
+        if(r < 0 && sock && errno == ENOTSOCK){ sock = 0; continue; }
+        if(r < 0 && errno == EINTR) continue;
+        if(r <= 0) return -1;
+        p += r; n -= (size_t)r;
+    }
+    return 0;
+}
+
+static int read_full(int fd, uint8_t *p, size_t n){
+    while(n){
+        ssize_t r = read(fd, p, n);
+        if(r < 0 && errno == EINTR) continue;
+        if(r <= 0){ if(r == 0) errno = ECONNRESET; return -1; }
+        p += r; n -= (size_t)r;
+    }
+    return 0;
+}
+
+static int send_frame(int fd, int type, const buf_t *payload, merkle_sync_stats *st){
+    uint8_t h[11];
+    size_t hn = 0, n = payload ? payload->n : 0;
+    uint64_t v = n;
+    h[hn++] = (uint8_t)type;
+    do{ h[hn++] = (uint8_t)((v & 0x7f) | (v >= 0x80 ? 0x80 : 0)); v >>= 7; }while(v);
+    if(write_full(fd, h, hn) != 0 || (n && write_full(fd, payload->p, n) != 0)) return -1;
+    if(st) st->bytes_sent += hn + n;
+    return 0;
+}
+
+/* 读一帧，负载放进 b（覆盖原内容）。对端在帧边界关闭时返回 1 */
+static int recv_frame(int fd, int *type, buf_t *b, merkle_sync_stats *st){
+    uint8_t t, c;
+    ssize_t r;
+    while((r = read(fd, &t, 1)) < 0 && errno == EINTR) ;
+    if(r == 0) return 1;
+    if(r < 0) return -1;
+    uint64_t len = 0;
+    size_t hdr = 1;
+    for(int s=0;;s+=7){
+        if(s >= 63 || read_full(fd, &c, 1) != 0) return -1;
+        hdr++;
+        len |= (uint64_t)(c & 0x7f) << s;
+        if(!(c & 0x80)) break;
+    }
+    if(len > MS_MAX_FRAME){ errno = EMSGSIZE; return -1; }
+    b->n = 0;
+    if(len > b->cap){
+        uint8_t *q = realloc(b->p, (size_t)len);
+        if(!q) return -1;
+        b->p = q;
+        b->cap = (size_t)len;
+    }
+    if(read_full(fd, b->p, (size_t)len) != 0) return -1;
+    b->n = (size_t)len;
+    *type = t;
+    if(st) st->bytes_recv += hdr + len;
+    return 0;
+}
+
+static int send_hello(int fd, level_t *levels, size_t nlevels, merkle_sync_stats *st){
+    static const uint8_t zero[HASHLEN];
+    buf_t b = { 0 };
+    size_t n = nlevels ? levels[0].nodes : 0;
+    int rc = put_varint(&b, n) || buf_put(&b, n ? levels[nlevels-1].data : zero, HASHLEN) ? -1
+             : send_frame(fd, MS_HELLO, &b, st);
+    free(b.p);
+    return rc;
+}
+
+static int parse_hello(const buf_t *b, size_t *n, const uint8_t **root){
+    const uint8_t *p = b->p, *end = b->p + b->n;
+    uint64_t v;
+    if(get_varint(&p, end, &v) != 0 || (size_t)(end - p) != HASHLEN) return -1;
+    *n = (size_t)v;
+    *root = p;
+    return 0;
+}
+
+/* ---------------- 服务端 ---------------- */
+
+/* 先完整校验请求，再逐个叶子写进 LEAVES 帧，装不下时先发出已装好的部分；至少发一帧 */
+static int serve_fetch(int fd, const buf_t *req, size_t n_leaves, uint8_t **leaf_bufs, size_t *leaf_lens,
+                       merkle_sync_stats *st){
+    const uint8_t *p = req->p, *end = req->p + req->n;
+    uint64_t nr, gap = 0, len = 0;
+    size_t pos = 0;
+    buf_t out = { 0 };
+    int rc = -1, sent = 0;
+    if(!leaf_bufs || get_varint(&p, end, &nr) != 0) goto done;
+    for(uint64_t k=0;k<nr;k++){
+        if(get_varint(&p, end, &gap) != 0 || get_varint(&p, end, &len) != 0) goto done;
+        if(gap > n_leaves - pos || len > n_leaves - pos - gap) goto done;
+        pos += (size_t)(gap + len);
+    }
+    if(p != end) goto done;
+    p = req->p;
+    pos = 0;
+    get_varint(&p, end, &nr);
+    for(uint64_t k=0;k<nr;k++){
+        get_varint(&p, end, &gap);
+        get_varint(&p, end, &len);
+        pos += (size_t)gap;
+        for(size_t i=pos;i<pos+len;i++){
+            size_t mark = out.n;
+            if(put_varint(&out, leaf_lens[i]) != 0 || buf_put(&out, leaf_bufs[i], leaf_lens[i]) != 0) goto done;
+            if(out.n <= MS_MAX_FRAME) continue;
+            if(mark == 0){ errno = EMSGSIZE; goto done; }
+            buf_t head = { out.p, mark, 0 };
+            if(send_frame(fd, MS_LEAVES, &head, st) != 0) goto done;
+            sent = 1;
+            memmove(out.p, out.p + mark, out.n - mark);
+            out.n -= mark;
+        }
+        pos += (size_t)len;
+    }
+    rc = out.n || !sent ? send_frame(fd, MS_LEAVES, &out, st) : 0;
+done:
+    free(out.p);
+    if(rc != 0 && errno == 0) errno = EPROTO;
+    return rc;
+}
+
+int merkle_sync_serve(int fd, level_t *levels, size_t nlevels, uint8_t **leaf_bufs, size_t *leaf_lens,
+                      merkle_sync_stats *st){
+    size_t n = nlevels ? levels[0].nodes : 0;
+    buf_t in = { 0 };
+    plan_t p;
+    uint8_t *bits = NULL;               // 本层已收到各段的位图
+    size_t got = 0;                     // 本层已比较的节点数
+    int have_plan = 0, rc = -1, type;
+    memset(&p, 0, sizeof(p));
+    for(;;){
+        errno = 0;
+        int r = recv_frame(fd, &type, &in, st);
+        if(r == 1){ rc = 0; break; }
+        if(r != 0) break;
+        if(type == MS_BYE){ rc = 0; break; }
+        if(type == MS_HELLO){
+            size_t peer;
+            const uint8_t *root;
+            if(parse_hello(&in, &peer, &root) != 0) break;
+            int same = peer == n && n && memcmp(root, levels[nlevels-1].data, HASHLEN) == 0;
+            if(have_plan) plan_free(&p);
+            have_plan = 1;
+            got = 0;
+            if(plan_init(&p, n, peer, same) != 0 || send_hello(fd, levels, nlevels, st) != 0) break;
+            continue;
+        }
+        if(type == MS_HASHES){
+            const uint8_t *q = in.p, *end = in.p + in.n;
+            uint64_t k, start;
+            if(!have_plan || p.done || get_varint(&q, end, &k) != 0 || k != p.level ||
+               get_varint(&q, end, &start) != 0 || start != got || (size_t)(end - q) % HASHLEN) break;
+            size_t m = (size_t)(end - q) / HASHLEN;
+            if(m == 0 || m > p.cnt - got || (got + m < p.cnt && m % 8)) break;
+            if(got == 0){
+                uint8_t *b = realloc(bits, (p.cnt + 7) / 8);
+                if(!b) break;
+                bits = b;
+            }
+            compare_level(&p, got, m, levels[p.level].data, q, bits + got / 8);
+            buf_t reply = { bits + got / 8, (m + 7) / 8, 0 };
+            if(send_frame(fd, MS_BITMAP, &reply, st) != 0) break;
+            if(st){ st->rounds++; st->compared += m; }
+            got += m;
+            if(got == p.cnt){
+                got = 0;
+                if(plan_advance(&p, bits) != 0) break;
+            }
+            continue;
+        }
+        if(type == MS_FETCH){
+            if(serve_fetch(fd, &in, n, leaf_bufs, leaf_lens, st) != 0) break;
+            continue;
+        }
+        errno = EPROTO;
+        break;
+    }
+    if(have_plan) plan_free(&p);
+    free(in.p); free(bits);
+    return rc;
+}
+
+/* ---------------- 客户端 ---------------- */
+
+int merkle_sync_diff(int fd, level_t *levels, size_t nlevels, merkle_range **out, size_t *nout,
+                     merkle_sync_stats *st){
+    size_t n = nlevels ? levels[0].nodes : 0, peer;
+    const uint8_t *root;
+    buf_t in = { 0 }, msg = { 0 };
+    plan_t p;
+    uint8_t *bits = NULL;
+    int type, rc = -1;
+    memset(&p, 0, sizeof(p));
+    if(send_hello(fd, levels, nlevels, st) != 0 || recv_frame(fd, &type, &in, st) != 0) goto done;
+    if(type != MS_HELLO || parse_hello(&in, &peer, &root) != 0){ errno = EPROTO; goto done; }
+    int same = peer == n && n && memcmp(root, levels[nlevels-1].data, HASHLEN) == 0;
+    if(plan_init(&p, n, peer, same) != 0) goto done;
+    if(n && peer && st) st->compared++;
+    while(!p.done){
+        uint8_t *b = realloc(bits, (p.cnt + 7) / 8);
+        if(!b) goto done;
+        bits = b;
+        for(size_t i0=0, m; i0<p.cnt; i0+=m){
+            m = p.cnt - i0 < HASHES_PER_FRAME ? p.cnt - i0 : HASHES_PER_FRAME;
+            msg.n = 0;
+            if(put_varint(&msg, p.level) != 0 || put_varint(&msg, i0) != 0) goto done;
+            for(size_t i=i0;i<i0+m;i++)
+                if(buf_put(&msg, levels[p.level].data + p.list[i]*HASHLEN, HASHLEN) != 0) goto done;
+            if(send_frame(fd, MS_HASHES, &msg, st) != 0 || recv_frame(fd, &type, &in, st) != 0) goto done;
+            if(type != MS_BITMAP || in.n != (m + 7) / 8){ errno = EPROTO; goto done; }
+            memcpy(bits + i0 / 8, in.p, in.n);
+            if(st){ st->rounds++; st->compared += m; }
+        }
+        if(plan_advance(&p, bits) != 0) goto done;
+    }
+    *out = p.out;
+    *nout = p.nout;
+    p.out = NULL;
+    rc = 0;
+done:
+    plan_free(&p);
+    free(in.p); free(msg.p); free(bits);
+    return rc;
+}
+
+int merkle_sync_fetch(int fd, const merkle_range *r, size_t nr, uint8_t **bufs, size_t *lens,
+                      merkle_sync_stats *st){
+    buf_t msg = { 0 }, in = { 0 };
+    size_t got = 0, k = 0;
+    int type, rc = -1;
+    for(size_t i=0;i<nr;i++)
+        if(r[i].hi < r[i].lo || (i && r[i].lo < r[i-1].hi)){ errno = EINVAL; goto done; }
+    do{                                 // 每批最多 RANGES_PER_FRAME 个区间，一个 FETCH
+        size_t kn = nr - k < RANGES_PER_FRAME ? nr - k : RANGES_PER_FRAME, prev = 0, want = got;
+        msg.n = 0;
+        if(put_varint(&msg, kn) != 0) goto done;
+        for(size_t e=k+kn; k<e; k++){
+            if(put_varint(&msg, r[k].lo - prev) != 0 || put_varint(&msg, r[k].hi - r[k].lo) != 0) goto done;
+            prev = r[k].hi;
+            want += r[k].hi - r[k].lo;
+        }
+        if(send_frame(fd, MS_FETCH, &msg, st) != 0) goto done;
+        do{                             // 收齐这一批的叶子，可能分在多个 LEAVES 帧里
+            if(recv_frame(fd, &type, &in, st) != 0) goto done;
+            if(type != MS_LEAVES){ errno = EPROTO; goto done; }
+            const uint8_t *p = in.p, *end = in.p + in.n;
+            while(p < end){
+                uint64_t len;
+                if(got == want || get_varint(&p, end, &len) != 0 || len > (uint64_t)(end - p)){
+                    errno = EPROTO;
+                    goto done;
+                }
+                bufs[got] = malloc(len ? (size_t)len : 1);
+                if(!bufs[got]) goto done;
+                memcpy(bufs[got], p, (size_t)len);
+                lens[got++] = (size_t)len;
+                p += len;
+            }
+        }while(got < want);
+    }while(k < nr);
+    rc = 0;
+done:
+    if(rc != 0) while(got) free(bufs[--got]);
+    free(msg.p); free(in.p);
+    return rc;
+}
+
+int merkle_sync_bye(int fd, merkle_sync_stats *st){
+    return send_frame(fd, MS_BYE, NULL, st);
+}
@@ -0,0 +1,72 @@
+// merkle_sync.h
+#ifndef MERKLE_SYNC_H
+#define MERKLE_SYNC_H
+#include <stdint.h>
+#include <stddef.h>
+#include "merkle.h"
+
+/*
+  副本之间的 Merkle 树比对与反熵同步（树形与 merkle_build() 一致）：
+    - 自顶向下逐层比较，只展开哈希不同的节点的两个孩子，d 个不同叶子共比较 O(d·log n) 个节点；
+    - 叶子数不同也能比：只有整棵子树都落在两边共有的 [0, min(n)) 内的节点，哈希相同才算相同，
+      跨过 min(n) 的右边缘节点一律展开；[min(n), max(n)) 直接算作差异；
+    - 线路协议每层至少一个来回：客户端发出本层待比较节点的哈希，服务端回一个位图（1 = 不同）。
+      待比较的节点列表由双方根据上一层的位图各自推出，不在线路上传输，
+      因此每个被比较的节点只花 32 字节 + 1 比特；
+    - 找到差异区间后可以用 FETCH 取回对端的这些叶子。
+  帧格式：类型（1 字节）‖ 负载长度（varint）‖ 负载，整数都用 LEB128 varint，负载不超过 MS_MAX_FRAME：
+    HELLO   叶子数 ‖ 根（32 字节，空树为全 0）       双方各发一次；叶子数和根都相同时不再逐层比较
+    HASHES  层号 ‖ 起始下标 ‖ 哈希（各 32 字节）       客户端 → 服务端。一层的列表按顺序分成若干帧，
+                                                      起始下标是 8 的倍数，每帧等到 BITMAP 再发下一帧
+    BITMAP  该帧每个节点 1 比特，低位在前              服务端 → 客户端
+    FETCH   区间数 ‖ 各区间（与上一区间末尾的间隔, 长度），间隔从本帧的 0 算起；区间多时分成若干个 FETCH
+    LEAVES  各叶子（长度 ‖ 内容）                     每个 FETCH 回一个或多个 LEAVES，每帧只放完整的叶子，
+                                                      客户端按请求的叶子数收齐；单个叶子放不进一帧时出错
+    BYE     结束会话
+*/
+
+#define MS_HELLO   1
+#define MS_HASHES  2
+#define MS_BITMAP  3
+#define MS_FETCH   4
+#define MS_LEAVES  5
+#define MS_BYE     6
+
+#ifndef MS_MAX_FRAME
+#define MS_MAX_FRAME (64u << 20)        // 单帧负载上限：发送方按它分帧，接收方拒绝更大的帧
+#endif
+
+typedef struct {
+    size_t lo, hi;                      // 叶子区间 [lo, hi)
+} merkle_range;
+
+typedef struct {
+    uint64_t bytes_sent, bytes_recv;
+    size_t rounds;                      // HASHES/BITMAP 来回次数
+    size_t compared;                    // 比较过的节点数
+} merkle_sync_stats;
+
+/* 本地比较两棵树。返回差异区间数（相邻区间已合并，*out 由调用方 free），内存不足返回 -1。
+   compared 非 NULL 时写入比较的节点数 */
+long merkle_diff(level_t *a, size_t nla, level_t *b, size_t nlb, merkle_range **out, size_t *compared);
+
+/* 以下函数在套接字上用 send(MSG_NOSIGNAL) 发送，对端断开时返回 -1（errno = EPIPE），不会收到 SIGPIPE；
+   fd 不是套接字时退回 write，此时 SIGPIPE 由调用方处理。
+
+   服务端：在 fd 上应答，直到收到 BYE（返回 0）、对端关闭（返回 0）或协议/IO 错误（返回 -1）。
+   leaf_bufs 为 NULL 时不支持 FETCH。levels 为 NULL、nlevels 为 0 表示空树 */
+int merkle_sync_serve(int fd, level_t *levels, size_t nlevels, uint8_t **leaf_bufs, size_t *leaf_lens,
+                      merkle_sync_stats *st);
+
+/* 客户端：与对端比较，成功返回 0，*out / *nout 与 merkle_diff 相同；出错返回 -1 */
+int merkle_sync_diff(int fd, level_t *levels, size_t nlevels, merkle_range **out, size_t *nout,
+                     merkle_sync_stats *st);
+
+/* 取回对端 r[0..nr) 内的全部叶子，按区间顺序依次写入 bufs[k]（malloc 得到）与 lens[k]，
+   两个数组需能容纳 Σ(hi - lo) 项。成功返回 0 */
+int merkle_sync_fetch(int fd, const merkle_range *r, size_t nr, uint8_t **bufs, size_t *lens,
+                      merkle_sync_stats *st);
+
+int merkle_sync_bye(int fd, merkle_sync_stats *st);
+
+#endif
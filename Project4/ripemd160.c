@@ -0,0 +1,123 @@
+// ripemd160.c
+#include "ripemd160.h"
+#include <string.h>
+
+#define ROTL32(x,n) ((uint32_t)(((x) << (n)) | ((x) >> (32 - (n)))))
+
+/* 左右两条线各 5 轮，每轮 16 步：消息字下标、循环左移位数、轮常量 */
+static const uint8_t RL[80] = {
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+    7,4,13,1,10,6,15,3,12,0,9,5,2,14,11,8,
+    3,10,14,4,9,15,8,1,2,7,0,6,13,11,5,12,
+    1,9,11,10,0,8,12,4,13,3,7,15,14,5,6,2,
+    4,0,5,9,7,12,2,10,14,1,3,8,11,6,15,13
+};
+static const uint8_t RR[80] = {
+    5,14,7,0,9,2,11,4,13,6,15,8,1,10,3,12,
+    6,11,3,7,0,13,5,10,14,15,8,12,4,9,1,2,
+    15,5,1,3,7,14,6,9,11,8,12,2,10,0,4,13,
+    8,6,4,1,3,11,15,0,5,12,2,13,9,7,10,14,
+    12,15,10,4,1,5,8,7,6,2,13,14,0,3,9,11
+};
+static const uint8_t SL[80] = {
+    11,14,15,12,5,8,7,9,11,13,14,15,6,7,9,8,
+    7,6,8,13,11,9,7,15,7,12,15,9,11,7,13,12,
+    11,13,6,7,14,9,13,15,14,8,13,6,5,12,7,5,
+    11,12,14,15,14,15,9,8,9,14,5,6,8,6,5,12,
+    9,15,5,11,6,8,13,12,5,12,13,14,11,8,5,6
+};
+static const uint8_t SR[80] = {
+    8,9,9,11,13,15,15,5,7,7,8,11,14,14,12,6,
+    9,13,15,7,12,8,9,11,7,7,12,7,6,15,13,11,
+    9,7,15,11,8,6,6,14,12,13,5,14,13,13,7,5,
+    15,5,8,11,14,14,6,14,6,9,12,9,12,5,15,8,
+    8,5,12,9,12,5,14,6,8,13,6,5,15,13,11,11
+};
+static const uint32_t KL[5] = { 0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e };
+static const uint32_t KR[5] = { 0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000 };
+
+static inline uint32_t f(int j, uint32_t x, uint32_t y, uint32_t z){
+    switch(j){
+    case 0:  return x ^ y ^ z;
+    case 1:  return (x & y) | (~x & z);
+    case 2:  return (x | ~y) ^ z;
+    case 3:  return (x & z) | (y & ~z);
+    default: return x ^ (y | ~z);
+    }
+}
+
+static void ripemd160_compress(uint32_t st[5], const uint8_t block[64]){
+    uint32_t X[16];
+    // 小端读取
+    for(int i=0;i<16;i++){
+        X[i] = ((uint32_t)block[4*i])|((uint32_t)block[4*i+1]<<8)|
+               ((uint32_t)block[4*i+2]<<16)|((uint32_t)block[4*i+3]<<24);
+    }
+    uint32_t al=st[0],bl=st[1],cl=st[2],dl=st[3],el=st[4];
+    uint32_t ar=al,br=bl,cr=cl,dr=dl,er=el;
+#pragma GCC unroll 80
+    for(int j=0;j<80;j++){
+        int r = j >> 4;
+        uint32_t t = ROTL32(al + f(r, bl, cl, dl) + X[RL[j]] + KL[r], SL[j]) + el;
+        al = el; el = dl; dl = ROTL32(cl, 10); cl = bl; bl = t;
+        t = ROTL32(ar + f(4 - r, br, cr, dr) + X[RR[j]] + KR[r], SR[j]) + er;
+        ar = er; er = dr; dr = ROTL32(cr, 10); cr = br; br = t;
+    }
+    uint32_t t = st[1] + cl + dr;
+    st[1] = st[2] + dl + er;
+    st[2] = st[3] + el + ar;
+    st[3] = st[4] + al + br;
+    st[4] = st[0] + bl + cr;
+    st[0] = t;
+}
+
+void ripemd160_init(ripemd160_ctx *ctx){
+    static const uint32_t IV[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+    memcpy(ctx->state, IV, sizeof(IV));
+    ctx->bitlen = 0;
+    ctx->buffer_len = 0;
+}
+
+void ripemd160_update(ripemd160_ctx *ctx, const void *data, size_t len){
+    const uint8_t *p = (const uint8_t*)data;
+    ctx->bitlen += (uint64_t)len * 8;
+    if(ctx->buffer_len){
+        size_t take = 64 - ctx->buffer_len;
+        if(take > len) take = len;
+        memcpy(ctx->buffer + ctx->buffer_len, p, take);
+        ctx->buffer_len += take; p += take; len -= take;
+        if(ctx->buffer_len < 64) return;
+        ripemd160_compress(ctx->state, ctx->buffer);
+        ctx->buffer_len = 0;
+    }
+    for(; len >= 64; p += 64, len -= 64) ripemd160_compress(ctx->state, p);
+    memcpy(ctx->buffer, p, len);
+    ctx->buffer_len = len;
+}
+
+void ripemd160_final(ripemd160_ctx *ctx, uint8_t out[20]){
+    uint64_t bitlen = ctx->bitlen;
+    size_t n = ctx->buffer_len;
+    ctx->buffer[n++] = 0x80;
+    if(n > 56){
+        memset(ctx->buffer + n, 0, 64 - n);
+        ripemd160_compress(ctx->state, ctx->buffer);
+        n = 0;
+    }
+    memset(ctx->buffer + n, 0, 56 - n);
+    for(int i=0;i<8;i++) ctx->buffer[56+i] = (uint8_t)(bitlen >> (8*i));   // 长度小端
+    ripemd160_compress(ctx->state, ctx->buffer);
+    for(int i=0;i<5;i++){
+        out[4*i]   = (uint8_t)(ctx->state[i]);
+        out[4*i+1] = (uint8_t)(ctx->state[i] >> 8);
+        out[4*i+2] = (uint8_t)(ctx->state[i] >> 16);
+        out[4*i+3] = (uint8_t)(ctx->state[i] >> 24);
+    }
+}
+
+void ripemd160_hash(const void *data, size_t len, uint8_t out[20]){
+    ripemd160_ctx c;
+    ripemd160_init(&c);
+    ripemd160_update(&c, data, len);
+    ripemd160_final(&c, out);
+}
@@ -0,0 +1,20 @@
+// ripemd160.h
+#ifndef RIPEMD160_H
+#define RIPEMD160_H
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+    uint32_t state[5];
+    uint64_t bitlen;     // 已处理的比特数
+    uint8_t  buffer[64]; // 分组缓冲
+    size_t   buffer_len;
+} ripemd160_ctx;
+
+void ripemd160_init(ripemd160_ctx *ctx);
+void ripemd160_update(ripemd160_ctx *ctx, const void *data, size_t len);
+void ripemd160_final(ripemd160_ctx *ctx, uint8_t out[20]);
+
+void ripemd160_hash(const void *data, size_t len, uint8_t out[20]);
+
+#endif
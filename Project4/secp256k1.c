@@ -0,0 +1,787 @@
+// secp256k1.c
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+#include "sha256.h"
+#include "secp256k1.h"
+
+typedef unsigned __int128 u128;
+
+/* ---------------- 域运算 mod p（5×52 位 limb） ----------------
+   p = 2^256 - 0x1000003D1，于是 2^256 ≡ 0x1000003D1、2^260 ≡ 0x1000003D10 (mod p)。
+   乘法先算出 9 列部分积并进位成 52 位数字，高 5 个数字乘 2^260 的余数折回低位，
+   再把 2^256 以上的几位乘 0x1000003D1 折回一次，结果量级 1。
+   limb 留有 12 位余量，加法与取负只做逐 limb 运算，由调用方按量级决定何时弱约化。 */
+
+#define M52   0xFFFFFFFFFFFFFULL
+#define M48   0xFFFFFFFFFFFFULL
+#define FE_R4 0x1000003D1ULL            // 2^256 mod p
+#define FE_R  0x1000003D10ULL           // 2^260 mod p
+
+static const uint64_t FE_P[5] = { 0xFFFFEFFFFFC2FULL, M52, M52, M52, M48 };
+
+const secp256k1_affine SECP256K1_G = {
+    {{ 0x2815b16f81798ULL, 0xdb2dce28d959fULL, 0xe870b07029bfcULL, 0xbbac55a06295cULL, 0x079be667ef9dcULL }},
+    {{ 0x7d08ffb10d4b8ULL, 0x48a68554199c4ULL, 0xe1108a8fd17b4ULL, 0xc4655da4fbfc0ULL, 0x0483ada7726a3ULL }}
+};
+
+#define FE_INLINE static inline __attribute__((always_inline))
+
+/* 9 列部分积 -> 量级 1 */
+FE_INLINE void fe_reduce_wide(uint64_t r[5], const u128 c[9]){
+    uint64_t d[10];
+    u128 acc = 0;
+#pragma GCC unroll 9
+    for(int k=0;k<9;k++){ acc += c[k]; d[k] = (uint64_t)acc & M52; acc >>= 52; }
+    d[9] = (uint64_t)acc;
+    acc = 0;
+#pragma GCC unroll 5
+    for(int k=0;k<5;k++){ acc += (u128)d[k] + (u128)d[k+5] * FE_R; r[k] = (uint64_t)acc & M52; acc >>= 52; }
+    uint64_t t = (r[4] >> 48) + ((uint64_t)acc << 4);   // 2^256 以上的部分
+    r[4] &= M48;
+    acc = (u128)r[0] + (u128)t * FE_R4; r[0] = (uint64_t)acc & M52; acc >>= 52;
+    acc += r[1]; r[1] = (uint64_t)acc & M52; acc >>= 52;
+    acc += r[2]; r[2] = (uint64_t)acc & M52; acc >>= 52;
+    acc += r[3]; r[3] = (uint64_t)acc & M52; acc >>= 52;
+    r[4] += (uint64_t)acc;
+}
+
+void secp256k1_fe_mul(secp256k1_fe *r, const secp256k1_fe *a, const secp256k1_fe *b){
+    u128 c[9] = { 0 };
+#pragma GCC unroll 5
+    for(int i=0;i<5;i++)
+#pragma GCC unroll 5
+        for(int j=0;j<5;j++) c[i+j] += (u128)a->n[i] * b->n[j];
+    fe_reduce_wide(r->n, c);
+}
+
+void secp256k1_fe_sqr(secp256k1_fe *r, const secp256k1_fe *a){
+    u128 c[9] = { 0 };
+#pragma GCC unroll 5
+    for(int i=0;i<5;i++){
+        c[2*i] += (u128)a->n[i] * a->n[i];
+        uint64_t a2 = a->n[i] * 2;
+#pragma GCC unroll 4
+        for(int j=i+1;j<5;j++) c[i+j] += (u128)a2 * a->n[j];
+    }
+    fe_reduce_wide(r->n, c);
+}
+
+void secp256k1_fe_add(secp256k1_fe *r, const secp256k1_fe *a, const secp256k1_fe *b){
+    for(int i=0;i<5;i++) r->n[i] = a->n[i] + b->n[i];
+}
+
+/* r = 2(m+1)·p - a：每个 limb 都不会借位，输出量级 m+1 */
+void secp256k1_fe_negate(secp256k1_fe *r, const secp256k1_fe *a, int m){
+    uint64_t k = 2 * (uint64_t)(m + 1);
+    for(int i=0;i<5;i++) r->n[i] = k * FE_P[i] - a->n[i];
+}
+
+void secp256k1_fe_mul_int(secp256k1_fe *r, const secp256k1_fe *a, unsigned k){
+    for(int i=0;i<5;i++) r->n[i] = a->n[i] * k;
+}
+
+void secp256k1_fe_normalize_weak(secp256k1_fe *r){
+    uint64_t t0 = r->n[0], t1 = r->n[1], t2 = r->n[2], t3 = r->n[3], t4 = r->n[4];
+    uint64_t x = t4 >> 48;
+    t4 &= M48;
+    t0 += x * FE_R4;
+    t1 += t0 >> 52; t0 &= M52;
+    t2 += t1 >> 52; t1 &= M52;
+    t3 += t2 >> 52; t2 &= M52;
+    t4 += t3 >> 52; t3 &= M52;
+    r->n[0] = t0; r->n[1] = t1; r->n[2] = t2; r->n[3] = t3; r->n[4] = t4;
+}
+
+/* 弱约化后值 < 2^256 + 小量；>= p 时再加一次 2^256 - p 并丢掉第 256 位，无分支 */
+void secp256k1_fe_normalize(secp256k1_fe *r){
+    secp256k1_fe_normalize_weak(r);
+    uint64_t t0 = r->n[0], t1 = r->n[1], t2 = r->n[2], t3 = r->n[3], t4 = r->n[4];
+    uint64_t x = (t4 >> 48) | ((uint64_t)(t4 == M48) & (uint64_t)((t1 & t2 & t3) == M52)
+                               & (uint64_t)(t0 >= FE_P[0]));
+    t0 += x * FE_R4;
+    t1 += t0 >> 52; t0 &= M52;
+    t2 += t1 >> 52; t1 &= M52;
+    t3 += t2 >> 52; t2 &= M52;
+    t4 += t3 >> 52; t3 &= M52;
+    t4 &= M48;
+    r->n[0] = t0; r->n[1] = t1; r->n[2] = t2; r->n[3] = t3; r->n[4] = t4;
+}
+
+static void fe_sqr_n(secp256k1_fe *r, const secp256k1_fe *a, int k){
+    secp256k1_fe_sqr(r, a);
+    for(int i=1;i<k;i++) secp256k1_fe_sqr(r, r);
+}
+
+/* x_k = a^(2^k - 1) 的加法链，p - 2 与 (p+1)/4 共用前半段（255 次平方 + 15 次乘法） */
+static void fe_pow_x223(secp256k1_fe *x2, secp256k1_fe *x22, secp256k1_fe *x223, const secp256k1_fe *a){
+    secp256k1_fe x3, x6, x9, x11, x44, x88, x176, x220, t;
+    secp256k1_fe_sqr(x2, a);           secp256k1_fe_mul(x2, x2, a);
+    secp256k1_fe_sqr(&x3, x2);         secp256k1_fe_mul(&x3, &x3, a);
+    fe_sqr_n(&x6, &x3, 3);             secp256k1_fe_mul(&x6, &x6, &x3);
+    fe_sqr_n(&x9, &x6, 3);             secp256k1_fe_mul(&x9, &x9, &x3);
+    fe_sqr_n(&x11, &x9, 2);            secp256k1_fe_mul(&x11, &x11, x2);
+    fe_sqr_n(x22, &x11, 11);           secp256k1_fe_mul(x22, x22, &x11);
+    fe_sqr_n(&x44, x22, 22);           secp256k1_fe_mul(&x44, &x44, x22);
+    fe_sqr_n(&x88, &x44, 44);          secp256k1_fe_mul(&x88, &x88, &x44);
+    fe_sqr_n(&x176, &x88, 88);         secp256k1_fe_mul(&x176, &x176, &x88);
+    fe_sqr_n(&x220, &x176, 44);        secp256k1_fe_mul(&x220, &x220, &x44);
+    fe_sqr_n(&t, &x220, 3);            secp256k1_fe_mul(x223, &t, &x3);
+}
+
+/* a^(p-2)：p - 2 的二进制是 223 个 1、1 个 0、22 个 1、4 个 0、1、1 个 0、2 个 1、1 个 0、1，按段拼出 */
+void secp256k1_fe_inv(secp256k1_fe *r, const secp256k1_fe *a){
+    secp256k1_fe x2, x22, x223, t;
+    fe_pow_x223(&x2, &x22, &x223, a);
+    fe_sqr_n(&t, &x223, 23); secp256k1_fe_mul(&t, &t, &x22);
+    fe_sqr_n(&t, &t, 5);     secp256k1_fe_mul(&t, &t, a);
+    fe_sqr_n(&t, &t, 3);     secp256k1_fe_mul(&t, &t, &x2);
+    fe_sqr_n(&t, &t, 2);     secp256k1_fe_mul(r, &t, a);
+}
+
+/* p ≡ 3 (mod 4)：sqrt(a) = a^((p+1)/4)，再平方核对 */
+int secp256k1_fe_sqrt(secp256k1_fe *r, const secp256k1_fe *a){
+    secp256k1_fe x2, x22, x223, t, c;
+    fe_pow_x223(&x2, &x22, &x223, a);
+    fe_sqr_n(&t, &x223, 23); secp256k1_fe_mul(&t, &t, &x22);
+    fe_sqr_n(&t, &t, 6);     secp256k1_fe_mul(&t, &t, &x2);
+    fe_sqr_n(&t, &t, 2);
+    secp256k1_fe_sqr(&c, &t);
+    if(!secp256k1_fe_equal(&c, a)) return -1;
+    *r = t;
+    return 0;
+}
+
+/* Montgomery 联合求逆：一次求逆 + 3(n-1) 次乘法。输入不能为 0；out 可以与 in 相同 */
+void secp256k1_fe_batch_inv(secp256k1_fe *out, const secp256k1_fe *in, size_t n, secp256k1_fe *scratch){
+    if(n == 0) return;
+    scratch[0] = in[0];
+    for(size_t i=1;i<n;i++) secp256k1_fe_mul(&scratch[i], &scratch[i-1], &in[i]);
+    secp256k1_fe inv, t;
+    secp256k1_fe_inv(&inv, &scratch[n-1]);
+    for(size_t i=n-1;i>0;i--){
+        secp256k1_fe_mul(&t, &inv, &scratch[i-1]);      // 1/in[i]
+        secp256k1_fe_mul(&inv, &inv, &in[i]);           // 1/(in[0]..in[i-1])
+        out[i] = t;
+    }
+    out[0] = inv;
+}
+
+int secp256k1_fe_is_zero(const secp256k1_fe *a){
+    secp256k1_fe t = *a;
+    secp256k1_fe_normalize(&t);
+    return (t.n[0] | t.n[1] | t.n[2] | t.n[3] | t.n[4]) == 0;
+}
+
+int secp256k1_fe_equal(const secp256k1_fe *a, const secp256k1_fe *b){
+    secp256k1_fe t;
+    secp256k1_fe_negate(&t, a, 8);
+    secp256k1_fe_add(&t, &t, b);
+    return secp256k1_fe_is_zero(&t);
+}
+
+int secp256k1_fe_is_odd(const secp256k1_fe *a){
+    secp256k1_fe t = *a;
+    secp256k1_fe_normalize(&t);
+    return (int)(t.n[0] & 1);
+}
+
+int secp256k1_fe_from_bytes(secp256k1_fe *r, const uint8_t in[32]){
+    uint64_t w[4];
+    for(int j=0;j<4;j++){
+        uint64_t v = 0;
+        for(int i=0;i<8;i++) v = (v << 8) | in[(3-j)*8 + i];
+        w[j] = v;
+    }
+    r->n[0] = w[0] & M52;
+    r->n[1] = (w[0] >> 52 | w[1] << 12) & M52;
+    r->n[2] = (w[1] >> 40 | w[2] << 24) & M52;
+    r->n[3] = (w[2] >> 28 | w[3] << 36) & M52;
+    r->n[4] = w[3] >> 16;
+    return (r->n[4] == M48 && (r->n[1] & r->n[2] & r->n[3]) == M52 && r->n[0] >= FE_P[0]) ? -1 : 0;
+}
+
+void secp256k1_fe_to_bytes(uint8_t out[32], const secp256k1_fe *a){
+    secp256k1_fe t = *a;
+    secp256k1_fe_normalize(&t);
+    uint64_t w[4] = {
+        t.n[0] | t.n[1] << 52,
+        t.n[1] >> 12 | t.n[2] << 40,
+        t.n[2] >> 24 | t.n[3] << 28,
+        t.n[3] >> 36 | t.n[4] << 16
+    };
+    for(int j=0;j<4;j++)
+        for(int i=0;i<8;i++) out[(3-j)*8 + i] = (uint8_t)(w[j] >> (56 - 8*i));
+}
+
+/* ---------------- 标量运算 mod n（Montgomery，R = 2^256） ----------------
+   与 sm2.c 相同的 CIOS；n 是满 256 位的素数（2n > 2^256），保留第 5 个进位字 */
+
+typedef struct {
+    uint64_t m[4];
+    uint64_t m0inv;     // -m^{-1} mod 2^64
+    uint64_t rr[4];     // R^2 mod m
+    uint64_t one[4];    // R mod m
+} mont_ctx;
+
+static const mont_ctx SECP_N = {
+    { 0xbfd25e8cd0364141ULL, 0xbaaedce6af48a03bULL, 0xfffffffffffffffeULL, 0xffffffffffffffffULL },
+    0x4b0dff665588b13fULL,
+    { 0x896cf21467d7d140ULL, 0x741496c20e7cf878ULL, 0xe697f5e45bcd07c6ULL, 0x9d671cd581c69bc5ULL },
+    { 0x402da1732fc9bebfULL, 0x4551231950b75fc4ULL, 0x0000000000000001ULL, 0x0000000000000000ULL }
+};
+
+/* (n-1)/2：低 S 的上界 */
+static const secp256k1_scalar HALF_N = {{ 0xdfe92f46681b20a0ULL, 0x5d576e7357a4501dULL, 0xffffffffffffffffULL, 0x7fffffffffffffffULL }};
+
+#define MONT_INLINE static inline __attribute__((always_inline))
+
+MONT_INLINE void mont_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const mont_ctx *c){
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5;
+#pragma GCC unroll 4
+    for(int i=0;i<4;i++){
+        u128 x;
+        uint64_t bi = b[i], m;
+        x = (u128)a[0]*bi + t0;             t0 = (uint64_t)x;
+        x = (u128)a[1]*bi + t1 + (x >> 64); t1 = (uint64_t)x;
+        x = (u128)a[2]*bi + t2 + (x >> 64); t2 = (uint64_t)x;
+        x = (u128)a[3]*bi + t3 + (x >> 64); t3 = (uint64_t)x;
+        x = (u128)t4 + (x >> 64);           t4 = (uint64_t)x; t5 = (uint64_t)(x >> 64);
+
+        m = t0 * c->m0inv;
+        x = (u128)m*c->m[0] + t0;
+        x = (u128)m*c->m[1] + t1 + (x >> 64); t0 = (uint64_t)x;
+        x = (u128)m*c->m[2] + t2 + (x >> 64); t1 = (uint64_t)x;
+        x = (u128)m*c->m[3] + t3 + (x >> 64); t2 = (uint64_t)x;
+        x = (u128)t4 + (x >> 64);             t3 = (uint64_t)x;
+        t4 = t5 + (uint64_t)(x >> 64);
+    }
+    // t < 2m，按需减一次 m（常量时间选择）
+    uint64_t s0, s1, s2, s3;
+    unsigned char bw = 0;
+    bw = _subborrow_u64(bw, t0, c->m[0], (unsigned long long*)&s0);
+    bw = _subborrow_u64(bw, t1, c->m[1], (unsigned long long*)&s1);
+    bw = _subborrow_u64(bw, t2, c->m[2], (unsigned long long*)&s2);
+    bw = _subborrow_u64(bw, t3, c->m[3], (unsigned long long*)&s3);
+    uint64_t keep = -(uint64_t)(bw & (t4 == 0));   // 全 1: 保留 t
+    r[0] = (t0 & keep) | (s0 & ~keep);
+    r[1] = (t1 & keep) | (s1 & ~keep);
+    r[2] = (t2 & keep) | (s2 & ~keep);
+    r[3] = (t3 & keep) | (s3 & ~keep);
+}
+
+MONT_INLINE void mont_add(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const mont_ctx *c){
+    unsigned long long s[4], d[4];
+    unsigned char cy = 0, bw = 0;
+    cy = _addcarry_u64(cy, a[0], b[0], &s[0]);
+    cy = _addcarry_u64(cy, a[1], b[1], &s[1]);
+    cy = _addcarry_u64(cy, a[2], b[2], &s[2]);
+    cy = _addcarry_u64(cy, a[3], b[3], &s[3]);
+    bw = _subborrow_u64(bw, s[0], c->m[0], &d[0]);
+    bw = _subborrow_u64(bw, s[1], c->m[1], &d[1]);
+    bw = _subborrow_u64(bw, s[2], c->m[2], &d[2]);
+    bw = _subborrow_u64(bw, s[3], c->m[3], &d[3]);
+    uint64_t keep = -(uint64_t)(bw & (cy ^ 1));
+    for(int j=0;j<4;j++) r[j] = (s[j] & keep) | (d[j] & ~keep);
+}
+
+MONT_INLINE void mont_sub(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const mont_ctx *c){
+    unsigned long long d[4], o[4];
+    unsigned char bw = 0, cy = 0;
+    bw = _subborrow_u64(bw, a[0], b[0], &d[0]);
+    bw = _subborrow_u64(bw, a[1], b[1], &d[1]);
+    bw = _subborrow_u64(bw, a[2], b[2], &d[2]);
+    bw = _subborrow_u64(bw, a[3], b[3], &d[3]);
+    uint64_t mask = -(uint64_t)bw;
+    cy = _addcarry_u64(cy, d[0], c->m[0] & mask, &o[0]);
+    cy = _addcarry_u64(cy, d[1], c->m[1] & mask, &o[1]);
+    cy = _addcarry_u64(cy, d[2], c->m[2] & mask, &o[2]);
+    cy = _addcarry_u64(cy, d[3], c->m[3] & mask, &o[3]);
+    r[0] = o[0]; r[1] = o[1]; r[2] = o[2]; r[3] = o[3];
+}
+
+/* r = a^e，指数公开，4 位固定窗口 */
+static void mont_pow(uint64_t r[4], const uint64_t a[4], const uint64_t e[4], const mont_ctx *c){
+    uint64_t acc[4], pw[16][4];
+    memcpy(pw[0], c->one, sizeof(pw[0]));
+    memcpy(pw[1], a, sizeof(pw[1]));
+    for(int i=2;i<16;i++) mont_mul(pw[i], pw[i-1], a, c);
+    memcpy(acc, pw[e[3] >> 60], sizeof(acc));
+    for(int i=62;i>=0;i--){
+        for(int j=0;j<4;j++) mont_mul(acc, acc, acc, c);
+        unsigned w = (unsigned)(e[i/16] >> ((i%16)*4)) & 0xF;
+        if(w) mont_mul(acc, acc, pw[w], c);
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+/* a < m ? */
+static inline int lt_mod(const uint64_t a[4], const mont_ctx *c){
+    uint64_t bw = 0;
+    for(int j=0;j<4;j++){
+        u128 x = (u128)a[j] - c->m[j] - bw;
+        bw = (uint64_t)(x >> 64) & 1;
+    }
+    return (int)bw;
+}
+
+void secp256k1_fn_mul(secp256k1_scalar *r, const secp256k1_scalar *a, const secp256k1_scalar *b){ mont_mul(r->v, a->v, b->v, &SECP_N); }
+void secp256k1_fn_add(secp256k1_scalar *r, const secp256k1_scalar *a, const secp256k1_scalar *b){ mont_add(r->v, a->v, b->v, &SECP_N); }
+void secp256k1_fn_sub(secp256k1_scalar *r, const secp256k1_scalar *a, const secp256k1_scalar *b){ mont_sub(r->v, a->v, b->v, &SECP_N); }
+
+/* r = a^(n-2)：Fermat 求逆 */
+void secp256k1_fn_inv(secp256k1_scalar *r, const secp256k1_scalar *a){
+    uint64_t e[4];
+    memcpy(e, SECP_N.m, sizeof(e));
+    e[0] -= 2;                      // n 为奇素数，低位不会借位
+    mont_pow(r->v, a->v, e, &SECP_N);
+}
+
+void secp256k1_fn_to_mont(secp256k1_scalar *r, const secp256k1_scalar *a){ mont_mul(r->v, a->v, SECP_N.rr, &SECP_N); }
+void secp256k1_fn_from_mont(secp256k1_scalar *r, const secp256k1_scalar *a){
+    static const uint64_t one[4] = {1,0,0,0};
+    mont_mul(r->v, a->v, one, &SECP_N);
+}
+
+void secp256k1_fn_reduce(secp256k1_scalar *r, const secp256k1_scalar *a){
+    // 2n > 2^256，最多减一次
+    uint64_t d[4], bw = 0;
+    for(int j=0;j<4;j++){
+        u128 x = (u128)a->v[j] - SECP_N.m[j] - bw;
+        d[j] = (uint64_t)x; bw = (uint64_t)(x >> 64) & 1;
+    }
+    uint64_t keep = -bw;
+    for(int j=0;j<4;j++) r->v[j] = (a->v[j] & keep) | (d[j] & ~keep);
+}
+
+int secp256k1_fn_valid(const secp256k1_scalar *a){ return lt_mod(a->v, &SECP_N); }
+
+void secp256k1_scalar_from_bytes(secp256k1_scalar *r, const uint8_t in[32]){
+    for(int j=0;j<4;j++){
+        uint64_t w = 0;
+        for(int i=0;i<8;i++) w = (w << 8) | in[(3-j)*8 + i];
+        r->v[j] = w;
+    }
+}
+
+void secp256k1_scalar_to_bytes(uint8_t out[32], const secp256k1_scalar *a){
+    for(int j=0;j<4;j++)
+        for(int i=0;i<8;i++) out[(3-j)*8 + i] = (uint8_t)(a->v[j] >> (56 - 8*i));
+}
+
+int secp256k1_scalar_is_zero(const secp256k1_scalar *a){
+    return (a->v[0] | a->v[1] | a->v[2] | a->v[3]) == 0;
+}
+
+/* ---------------- 点运算（Jacobian，a = 0） ----------------
+   所有输出坐标都弱约化到量级 1；输入坐标量级不超过 2（查表时取负的 y 为 2）。 */
+
+static const secp256k1_fe FE_ONE = {{ 1, 0, 0, 0, 0 }};
+
+void secp256k1_point_from_affine(secp256k1_point *r, const secp256k1_affine *a){
+    r->X = a->x; r->Y = a->y; r->Z = FE_ONE;
+}
+
+static void to_affine_with(secp256k1_affine *r, const secp256k1_point *p, const secp256k1_fe *zi){
+    secp256k1_fe zi2, zi3;
+    secp256k1_fe_sqr(&zi2, zi);
+    secp256k1_fe_mul(&zi3, &zi2, zi);
+    secp256k1_fe_mul(&r->x, &p->X, &zi2);
+    secp256k1_fe_mul(&r->y, &p->Y, &zi3);
+    secp256k1_fe_normalize(&r->x);
+    secp256k1_fe_normalize(&r->y);
+}
+
+int secp256k1_point_to_affine(secp256k1_affine *r, const secp256k1_point *p){
+    if(secp256k1_fe_is_zero(&p->Z)) return -1;
+    secp256k1_fe zi;
+    secp256k1_fe_inv(&zi, &p->Z);
+    to_affine_with(r, p, &zi);
+    return 0;
+}
+
+/* 批量转仿射：所有 Z 共用一次求逆。含无穷远点时对应输出置 0 并返回 -1 */
+int secp256k1_point_batch_to_affine(secp256k1_affine *out, const secp256k1_point *in, size_t n){
+    secp256k1_fe *z = malloc(2 * n * sizeof(secp256k1_fe));
+    if(!z) return -1;
+    int inf = 0;
+    for(size_t i=0;i<n;i++){
+        if(secp256k1_fe_is_zero(&in[i].Z)){ z[i] = FE_ONE; inf = 1; }
+        else z[i] = in[i].Z;
+    }
+    secp256k1_fe_batch_inv(z, z, n, z + n);
+    for(size_t i=0;i<n;i++){
+        if(secp256k1_fe_is_zero(&in[i].Z)){ memset(&out[i], 0, sizeof(out[i])); continue; }
+        to_affine_with(&out[i], &in[i], &z[i]);
+    }
+    free(z);
+    return inf ? -1 : 0;
+}
+
+/* a = 0：S = 4XY^2，M = 3X^2，X3 = M^2 - 2S，Y3 = M(S - X3) - 8Y^4，Z3 = 2YZ（3M + 4S）；
+   Z=0 时结果仍为 Z=0 */
+void secp256k1_point_double(secp256k1_point *r, const secp256k1_point *p){
+    secp256k1_fe YY, S, M, T, t0, t1;
+    secp256k1_fe_sqr(&YY, &p->Y);
+    secp256k1_fe_mul(&S, &p->X, &YY);
+    secp256k1_fe_mul_int(&S, &S, 4);                    // 4
+    secp256k1_fe_sqr(&M, &p->X);
+    secp256k1_fe_mul_int(&M, &M, 3);                    // 3
+    secp256k1_fe_mul(&r->Z, &p->Y, &p->Z);
+    secp256k1_fe_mul_int(&r->Z, &r->Z, 2);
+    secp256k1_fe_normalize_weak(&r->Z);
+    secp256k1_fe_sqr(&T, &M);
+    secp256k1_fe_mul_int(&t0, &S, 2);                   // 8
+    secp256k1_fe_negate(&t0, &t0, 8);                   // 9
+    secp256k1_fe_add(&T, &T, &t0);                      // X3 = M^2 - 2S
+    secp256k1_fe_normalize_weak(&T);
+    secp256k1_fe_negate(&t0, &T, 1);                    // 2
+    secp256k1_fe_add(&t0, &S, &t0);                     // 6
+    secp256k1_fe_mul(&t0, &M, &t0);
+    secp256k1_fe_sqr(&t1, &YY);
+    secp256k1_fe_mul_int(&t1, &t1, 8);                  // 8
+    secp256k1_fe_negate(&t1, &t1, 8);                   // 9
+    secp256k1_fe_add(&r->Y, &t0, &t1);                  // Y3 = M(S-X3) - 8Y^4
+    secp256k1_fe_normalize_weak(&r->Y);
+    r->X = T;
+}
+
+/* 公共尾部：给定 H = U2 - U1、R = S2 - S1（量级不超过 4）、U1、S1，算出 X3、Y3；Z3 由调用方给出 */
+static void add_tail(secp256k1_point *r, const secp256k1_fe *H, const secp256k1_fe *R,
+                     const secp256k1_fe *U1, const secp256k1_fe *S1){
+    secp256k1_fe H2, H3, V, t0, t1;
+    secp256k1_fe_sqr(&H2, H);
+    secp256k1_fe_mul(&H3, H, &H2);
+    secp256k1_fe_mul(&V, U1, &H2);
+    secp256k1_fe_sqr(&t0, R);
+    secp256k1_fe_negate(&t1, &H3, 1);
+    secp256k1_fe_add(&t0, &t0, &t1);
+    secp256k1_fe_mul_int(&t1, &V, 2);
+    secp256k1_fe_negate(&t1, &t1, 2);
+    secp256k1_fe_add(&t0, &t0, &t1);                    // X3 = R^2 - H^3 - 2·U1·H^2
+    secp256k1_fe_normalize_weak(&t0);
+    secp256k1_fe_negate(&t1, &t0, 1);
+    secp256k1_fe_add(&V, &V, &t1);
+    secp256k1_fe_mul(&V, R, &V);
+    secp256k1_fe_mul(&t1, S1, &H3);
+    secp256k1_fe_negate(&t1, &t1, 1);
+    secp256k1_fe_add(&r->Y, &V, &t1);                   // Y3 = R(U1·H^2 - X3) - S1·H^3
+    secp256k1_fe_normalize_weak(&r->Y);
+    r->X = t0;
+}
+
+/* add-1998-cmo-2（12M + 4S）；处理无穷远点与 P == ±Q */
+void secp256k1_point_add(secp256k1_point *r, const secp256k1_point *p, const secp256k1_point *q){
+    if(secp256k1_fe_is_zero(&p->Z)){ *r = *q; return; }
+    if(secp256k1_fe_is_zero(&q->Z)){ *r = *p; return; }
+    secp256k1_fe Z1Z1, Z2Z2, U1, U2, S1, S2, H, R, t;
+    secp256k1_fe_sqr(&Z1Z1, &p->Z);
+    secp256k1_fe_sqr(&Z2Z2, &q->Z);
+    secp256k1_fe_mul(&U1, &p->X, &Z2Z2);
+    secp256k1_fe_mul(&U2, &q->X, &Z1Z1);
+    secp256k1_fe_mul(&S1, &p->Y, &q->Z);
+    secp256k1_fe_mul(&S1, &S1, &Z2Z2);
+    secp256k1_fe_mul(&S2, &q->Y, &p->Z);
+    secp256k1_fe_mul(&S2, &S2, &Z1Z1);
+    secp256k1_fe_negate(&t, &U1, 1);
+    secp256k1_fe_add(&H, &U2, &t);
+    secp256k1_fe_negate(&t, &S1, 1);
+    secp256k1_fe_add(&R, &S2, &t);
+    if(secp256k1_fe_is_zero(&H)){
+        if(secp256k1_fe_is_zero(&R)){ secp256k1_point_double(r, p); return; }
+        memset(r, 0, sizeof(*r));
+        return;
+    }
+    secp256k1_fe Z3;
+    secp256k1_fe_mul(&Z3, &p->Z, &q->Z);
+    secp256k1_fe_mul(&Z3, &Z3, &H);
+    add_tail(r, &H, &R, &U1, &S1);
+    r->Z = Z3;
+}
+
+/* madd-2004-hmv（8M + 3S）：q 为仿射点 */
+void secp256k1_point_add_affine(secp256k1_point *r, const secp256k1_point *p, const secp256k1_affine *q){
+    if(secp256k1_fe_is_zero(&p->Z)){ secp256k1_point_from_affine(r, q); return; }
+    secp256k1_fe Z1Z1, U2, S2, H, R, t;
+    secp256k1_fe_sqr(&Z1Z1, &p->Z);
+    secp256k1_fe_mul(&U2, &q->x, &Z1Z1);
+    secp256k1_fe_mul(&S2, &q->y, &p->Z);
+    secp256k1_fe_mul(&S2, &S2, &Z1Z1);
+    secp256k1_fe_negate(&t, &p->X, 2);
+    secp256k1_fe_add(&H, &U2, &t);
+    secp256k1_fe_negate(&t, &p->Y, 2);
+    secp256k1_fe_add(&R, &S2, &t);
+    if(secp256k1_fe_is_zero(&H)){
+        if(secp256k1_fe_is_zero(&R)){ secp256k1_point_double(r, p); return; }
+        memset(r, 0, sizeof(*r));
+        return;
+    }
+    secp256k1_fe Z3;
+    secp256k1_fe_mul(&Z3, &p->Z, &H);
+    add_tail(r, &H, &R, &p->X, &p->Y);
+    r->Z = Z3;
+}
+
+int secp256k1_affine_on_curve(const secp256k1_affine *a){
+    static const secp256k1_fe seven = {{ 7, 0, 0, 0, 0 }};
+    secp256k1_fe y2, rhs;
+    secp256k1_fe_sqr(&y2, &a->y);
+    secp256k1_fe_sqr(&rhs, &a->x);
+    secp256k1_fe_mul(&rhs, &rhs, &a->x);
+    secp256k1_fe_add(&rhs, &rhs, &seven);               // x^3 + 7
+    return secp256k1_fe_equal(&y2, &rhs);
+}
+
+int secp256k1_affine_from_bytes(secp256k1_affine *r, const uint8_t in[64]){
+    if(secp256k1_fe_from_bytes(&r->x, in) != 0 || secp256k1_fe_from_bytes(&r->y, in + 32) != 0) return -1;
+    return secp256k1_affine_on_curve(r) ? 0 : -1;
+}
+
+void secp256k1_affine_to_bytes(uint8_t out[64], const secp256k1_affine *a){
+    secp256k1_fe_to_bytes(out, &a->x);
+    secp256k1_fe_to_bytes(out + 32, &a->y);
+}
+
+/* ---------------- HMAC-SHA256 与 RFC 6979 ---------------- */
+
+typedef struct { sha256_ctx in, out; } hmac_sha256_ctx;
+
+static void hmac_sha256_init(hmac_sha256_ctx *h, const uint8_t key[32]){
+    uint8_t ipad[64], opad[64];
+    for(int i=0;i<64;i++){
+        uint8_t k = i < 32 ? key[i] : 0;
+        ipad[i] = k ^ 0x36; opad[i] = k ^ 0x5c;
+    }
+    sha256_init(&h->in);  sha256_update(&h->in, ipad, 64);
+    sha256_init(&h->out); sha256_update(&h->out, opad, 64);
+}
+
+static void hmac_sha256_final(hmac_sha256_ctx *h, uint8_t out[32]){
+    uint8_t inner[32];
+    sha256_final(&h->in, inner);
+    sha256_update(&h->out, inner, 32);
+    sha256_final(&h->out, out);
+}
+
+/* RFC 6979 3.2 b-f：x 为私钥，h1 为已约化到 [0, n) 的摘要 */
+static void rfc6979_init(uint8_t K[32], uint8_t V[32], const uint8_t x[32], const uint8_t h1[32]){
+    hmac_sha256_ctx h;
+    memset(V, 0x01, 32);
+    memset(K, 0x00, 32);
+    for(uint8_t sep = 0; sep < 2; sep++){
+        hmac_sha256_init(&h, K);
+        sha256_update(&h.in, V, 32);
+        sha256_update(&h.in, &sep, 1);
+        sha256_update(&h.in, x, 32);
+        sha256_update(&h.in, h1, 32);
+        hmac_sha256_final(&h, K);
+        hmac_sha256_init(&h, K); sha256_update(&h.in, V, 32); hmac_sha256_final(&h, V);
+    }
+}
+
+static void rfc6979_next(uint8_t K[32], uint8_t V[32], uint8_t T[32]){
+    hmac_sha256_ctx h;
+    hmac_sha256_init(&h, K); sha256_update(&h.in, V, 32); hmac_sha256_final(&h, V);
+    memcpy(T, V, 32);
+}
+
+static void rfc6979_retry(uint8_t K[32], uint8_t V[32]){
+    hmac_sha256_ctx h;
+    uint8_t zero = 0;
+    hmac_sha256_init(&h, K); sha256_update(&h.in, V, 32); sha256_update(&h.in, &zero, 1); hmac_sha256_final(&h, K);
+    hmac_sha256_init(&h, K); sha256_update(&h.in, V, 32); hmac_sha256_final(&h, V);
+}
+
+/* ---------------- 签名 / 验签 ---------------- */
+
+static int load_priv(secp256k1_scalar *k, const uint8_t d[32]){
+    secp256k1_scalar_from_bytes(k, d);
+    return (secp256k1_scalar_is_zero(k) || !secp256k1_fn_valid(k)) ? -1 : 0;
+}
+
+int secp256k1_keygen(const uint8_t d[32], uint8_t pub[64]){
+    secp256k1_scalar k;
+    if(load_priv(&k, d) != 0) return -1;
+    secp256k1_point P;
+    secp256k1_affine A;
+    secp256k1_point_mul_g(&P, &k);
+    secp256k1_point_to_affine(&A, &P);
+    secp256k1_affine_to_bytes(pub, &A);
+    return 0;
+}
+
+/* a > (n-1)/2 ? */
+static int scalar_is_high(const secp256k1_scalar *a){
+    for(int j=3;j>=0;j--)
+        if(a->v[j] != HALF_N.v[j]) return a->v[j] > HALF_N.v[j];
+    return 0;
+}
+
+int secp256k1_sign_digest(const uint8_t d[32], const uint8_t z[32], uint8_t sig[64], int *recid){
+    secp256k1_scalar dk, zn, dm, zm;
+    if(load_priv(&dk, d) != 0) return -1;
+    secp256k1_scalar_from_bytes(&zn, z);
+    secp256k1_fn_reduce(&zn, &zn);
+    uint8_t h1[32];
+    secp256k1_scalar_to_bytes(h1, &zn);
+    secp256k1_fn_to_mont(&dm, &dk);
+    secp256k1_fn_to_mont(&zm, &zn);
+
+    uint8_t K[32], V[32], T[32];
+    rfc6979_init(K, V, d, h1);
+    for(;;){
+        secp256k1_scalar k, r, s, km, rm, t;
+        rfc6979_next(K, V, T);
+        secp256k1_scalar_from_bytes(&k, T);
+        if(secp256k1_scalar_is_zero(&k) || !secp256k1_fn_valid(&k)){ rfc6979_retry(K, V); continue; }
+
+        secp256k1_point P;
+        secp256k1_affine A;
+        uint8_t xb[32];
+        secp256k1_point_mul_g(&P, &k);
+        secp256k1_point_to_affine(&A, &P);
+        secp256k1_fe_to_bytes(xb, &A.x);
+        secp256k1_scalar_from_bytes(&r, xb);
+        int over = !secp256k1_fn_valid(&r);
+        secp256k1_fn_reduce(&r, &r);
+        if(secp256k1_scalar_is_zero(&r)){ rfc6979_retry(K, V); continue; }
+
+        // s = k^{-1}·(z + r·d)
+        secp256k1_fn_to_mont(&km, &k);
+        secp256k1_fn_inv(&km, &km);
+        secp256k1_fn_to_mont(&rm, &r);
+        secp256k1_fn_mul(&t, &rm, &dm);
+        secp256k1_fn_add(&t, &t, &zm);
+        secp256k1_fn_mul(&s, &km, &t);
+        secp256k1_fn_from_mont(&s, &s);
+        if(secp256k1_scalar_is_zero(&s)){ rfc6979_retry(K, V); continue; }
+
+        int odd = (int)(A.y.n[0] & 1);
+        if(scalar_is_high(&s)){                 // 低 S：s -> n - s，对应 R 取负
+            secp256k1_scalar zero = {{ 0 }};
+            secp256k1_fn_sub(&s, &zero, &s);
+            odd ^= 1;
+        }
+        secp256k1_scalar_to_bytes(sig, &r);
+        secp256k1_scalar_to_bytes(sig + 32, &s);
+        if(recid) *recid = odd | over << 1;
+        return 0;
+    }
+}
+
+int secp256k1_sign(const uint8_t d[32], const uint8_t *msg, size_t len, uint8_t sig[64]){
+    uint8_t z[32];
+    sha256_hash(msg, len, z);
+    return secp256k1_sign_digest(d, z, sig, NULL);
+}
+
+/* p - n：r + n < p 时 x1 也可能是 r + n */
+static const secp256k1_scalar P_MINUS_N = {{ 0x402da1722fc9baeeULL, 0x4551231950b75fc4ULL, 0x1, 0x0 }};
+
+int secp256k1_verify_digest(const uint8_t pub[64], const uint8_t z[32], const uint8_t sig[64]){
+    secp256k1_scalar r, s, zn, w, u1, u2;
+    secp256k1_affine P;
+    secp256k1_scalar_from_bytes(&r, sig);
+    secp256k1_scalar_from_bytes(&s, sig + 32);
+    if(secp256k1_scalar_is_zero(&r) || !secp256k1_fn_valid(&r)) return 0;
+    if(secp256k1_scalar_is_zero(&s) || !secp256k1_fn_valid(&s)) return 0;
+    if(secp256k1_affine_from_bytes(&P, pub) != 0) return 0;
+    secp256k1_scalar_from_bytes(&zn, z);
+    secp256k1_fn_reduce(&zn, &zn);
+
+    // w = s^{-1}（Montgomery 形式），普通形式 × Montgomery 形式 = 普通形式的积
+    secp256k1_fn_to_mont(&w, &s);
+    secp256k1_fn_inv(&w, &w);
+    secp256k1_fn_mul(&u1, &zn, &w);
+    secp256k1_fn_mul(&u2, &r, &w);
+
+    secp256k1_point Q;
+    secp256k1_point_mul2_vartime(&Q, &u1, &u2, &P);
+    if(secp256k1_fe_is_zero(&Q.Z)) return 0;
+
+    // 不求逆，直接检查 X == x·Z^2，x ∈ {r, r+n}
+    secp256k1_fe zz, c;
+    uint8_t rb[32];
+    secp256k1_fe_sqr(&zz, &Q.Z);
+    secp256k1_scalar_to_bytes(rb, &r);
+    secp256k1_fe_from_bytes(&c, rb);
+    secp256k1_fe_mul(&c, &c, &zz);
+    if(secp256k1_fe_equal(&c, &Q.X)) return 1;
+    for(int j=3;j>=0;j--){
+        if(r.v[j] != P_MINUS_N.v[j]){
+            if(r.v[j] > P_MINUS_N.v[j]) return 0;
+            break;
+        }
+        if(j == 0) return 0;                    // r == p - n
+    }
+    unsigned char cy = 0;
+    for(int j=0;j<4;j++) cy = _addcarry_u64(cy, r.v[j], SECP_N.m[j], (unsigned long long*)&r.v[j]);
+    secp256k1_scalar_to_bytes(rb, &r);
+    secp256k1_fe_from_bytes(&c, rb);
+    secp256k1_fe_mul(&c, &c, &zz);
+    return secp256k1_fe_equal(&c, &Q.X);
+}
+
+int secp256k1_verify(const uint8_t pub[64], const uint8_t *msg, size_t len, const uint8_t sig[64]){
+    uint8_t z[32];
+    sha256_hash(msg, len, z);
+    return secp256k1_verify_digest(pub, z, sig);
+}
+
+/* ---------------- 编码 ---------------- */
+
+/* 整数 i 的 DER 内容：去前导零，最高位为 1 时补 0x00 */
+static size_t der_int(uint8_t *out, const uint8_t b[32]){
+    size_t i = 0;
+    while(i < 32 && b[i] == 0) i++;
+    size_t len = 0;
+    out[len++] = 0x02;
+    size_t n = 32 - i + (i < 32 && (b[i] & 0x80));
+    out[len++] = (uint8_t)n;
+    if(i < 32 && (b[i] & 0x80)) out[len++] = 0;
+    memcpy(out + len, b + i, 32 - i);
+    return len + 32 - i;
+}
+
+size_t secp256k1_sig_to_der(const uint8_t sig[64], uint8_t out[72]){
+    size_t len = 2;
+    len += der_int(out + len, sig);
+    len += der_int(out + len, sig + 32);
+    out[0] = 0x30;
+    out[1] = (uint8_t)(len - 2);
+    return len;
+}
+
+size_t secp256k1_pub_serialize(const uint8_t pub[64], int compressed, uint8_t *out){
+    if(compressed){
+        out[0] = 0x02 | (pub[63] & 1);
+        memcpy(out + 1, pub, 32);
+        return 33;
+    }
+    out[0] = 0x04;
+    memcpy(out + 1, pub, 64);
+    return 65;
+}
+
+int secp256k1_pub_parse(const uint8_t *in, size_t len, uint8_t pub[64]){
+    secp256k1_affine A;
+    if(len == 65 && in[0] == 0x04){
+        if(secp256k1_affine_from_bytes(&A, in + 1) != 0) return -1;
+        memcpy(pub, in + 1, 64);
+        return 0;
+    }
+    if(len != 33 || (in[0] != 0x02 && in[0] != 0x03)) return -1;
+    static const secp256k1_fe seven = {{ 7, 0, 0, 0, 0 }};
+    secp256k1_fe rhs;
+    if(secp256k1_fe_from_bytes(&A.x, in + 1) != 0) return -1;
+    secp256k1_fe_sqr(&rhs, &A.x);
+    secp256k1_fe_mul(&rhs, &rhs, &A.x);
+    secp256k1_fe_add(&rhs, &rhs, &seven);
+    if(secp256k1_fe_sqrt(&A.y, &rhs) != 0) return -1;
+    if(secp256k1_fe_is_odd(&A.y) != (in[0] & 1)){
+        secp256k1_fe_negate(&A.y, &A.y, 1);
+        secp256k1_fe_normalize(&A.y);
+    }
+    secp256k1_affine_to_bytes(pub, &A);
+    return 0;
+}
@@ -0,0 +1,127 @@
+// secp256k1.h
+#ifndef SECP256K1_H
+#define SECP256K1_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  secp256k1 ECDSA / WIF / 地址（原生实现），曲线参数与 Project5/sign.py 完全相同：
+    p = 2^256 - 2^32 - 977,  y^2 = x^3 + 7
+    n = FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE BAAEDCE6 AF48A03B BFD25E8C D0364141
+  字节接口一律大端：私钥 d 32 字节，公钥 x||y 64 字节，签名 r||s 64 字节。
+  消息摘要与 sign.py 相同，为单次 SHA-256(M)；签名的 k 按 RFC 6979（HMAC-SHA256）确定性生成，
+  s 取低值（s <= n/2）。sign.py 的 k 是随机的，两边的签名互相验证即可。
+*/
+
+/* ---------------- 字节接口 ---------------- */
+
+/* d ∈ [1, n-1]，输出 P = dG。成功返回 0 */
+int  secp256k1_keygen(const uint8_t d[32], uint8_t pub[64]);
+
+/* 签名 SHA-256(M)。成功返回 0 */
+int  secp256k1_sign(const uint8_t d[32], const uint8_t *msg, size_t len, uint8_t sig[64]);
+/* z 为 32 字节摘要；recid 可为 NULL，否则输出 (y1 & 1) | (x1 >= n) << 1（低 S 翻转后） */
+int  secp256k1_sign_digest(const uint8_t d[32], const uint8_t z[32], uint8_t sig[64], int *recid);
+
+/* 验签：通过返回 1，否则 0。高 S 签名同样接受（与 sign.py 一致） */
+int  secp256k1_verify(const uint8_t pub[64], const uint8_t *msg, size_t len, const uint8_t sig[64]);
+int  secp256k1_verify_digest(const uint8_t pub[64], const uint8_t z[32], const uint8_t sig[64]);
+
+/* DER 编码（与 sign.py 的 signature_to_der 相同），返回长度，最多 72 字节 */
+size_t secp256k1_sig_to_der(const uint8_t sig[64], uint8_t out[72]);
+
+/* SEC1 编码：压缩 33 字节（02/03||x），非压缩 65 字节（04||x||y）；返回长度 */
+size_t secp256k1_pub_serialize(const uint8_t pub[64], int compressed, uint8_t *out);
+/* 解析 33/65 字节 SEC1 公钥，失败返回 -1 */
+int  secp256k1_pub_parse(const uint8_t *in, size_t len, uint8_t pub[64]);
+
+/* ---------------- WIF 与地址（secp256k1_addr.c） ----------------
+   地址 = Base58Check(0x00 || RIPEMD160(SHA256(SEC1 公钥)))，WIF = Base58Check(0x80 || d [|| 01])，
+   与 sign.py 的 public_key_to_address / private_key_to_wif 相同。输出为 '\0' 结尾的字符串。 */
+#define SECP256K1_ADDR_MAX 36
+#define SECP256K1_WIF_MAX  54
+
+void secp256k1_address(const uint8_t pub[64], int compressed, char out[SECP256K1_ADDR_MAX]);
+void secp256k1_wif(const uint8_t d[32], int compressed, char out[SECP256K1_WIF_MAX]);
+
+/* 批量派生：priv 为 n 个连续的 32 字节私钥，addr[i] 为对应地址；pub 非 NULL 时同时输出 n×64 字节公钥。
+   私钥无效的条目地址置为空串。每块私钥的 k·G 结果共用一次求逆转成仿射坐标；
+   nthreads <= 1 时在调用线程内完成，否则用共享线程池 tp_default() 的前 nthreads 个 worker。返回有效私钥条数 */
+size_t secp256k1_address_batch(const uint8_t *priv, size_t n, int compressed,
+                               char (*addr)[SECP256K1_ADDR_MAX], uint8_t *pub, int nthreads);
+
+/* ---------------- 底层运算（供标量乘、地址派生等模块使用） ----------------
+   secp256k1_fe 是 5×52 位小端 limb（每个 limb 放在 64 位字里，留 12 位余量，加法不必马上进位），
+   secp256k1_scalar 是 4×64 位小端 limb。secp256k1_fe_* 对 p 运算，结果只做弱约化；
+   secp256k1_fn_* 在 Montgomery 域 (mod n) 上运算，标量乘使用的标量是普通整数形式。
+
+   量级（magnitude）m 表示每个 limb 不超过 2m·(2^52-1)（最高 limb 为 2m·(2^48-1)）。
+   mul/sqr 的输入量级不超过 8，输出量级 1；add 的量级相加；negate(a, m) 输出量级 m+1。 */
+
+typedef struct { uint64_t n[5]; } secp256k1_fe;
+typedef struct { uint64_t v[4]; } secp256k1_scalar;
+typedef struct { secp256k1_fe X, Y, Z; } secp256k1_point;    // Jacobian, Z=0 表示无穷远点
+typedef struct { secp256k1_fe x, y; } secp256k1_affine;      // 仿射坐标（已完全约化）
+
+extern const secp256k1_affine SECP256K1_G;
+
+void secp256k1_fe_mul(secp256k1_fe *r, const secp256k1_fe *a, const secp256k1_fe *b);
+void secp256k1_fe_sqr(secp256k1_fe *r, const secp256k1_fe *a);
+void secp256k1_fe_add(secp256k1_fe *r, const secp256k1_fe *a, const secp256k1_fe *b);
+void secp256k1_fe_negate(secp256k1_fe *r, const secp256k1_fe *a, int m);
+void secp256k1_fe_mul_int(secp256k1_fe *r, const secp256k1_fe *a, unsigned k);
+void secp256k1_fe_normalize_weak(secp256k1_fe *r);            // 量级降到 1
+void secp256k1_fe_normalize(secp256k1_fe *r);                 // 完全约化到 [0, p)
+void secp256k1_fe_inv(secp256k1_fe *r, const secp256k1_fe *a);
+/* 平方根（p ≡ 3 mod 4），a 不是二次剩余时返回 -1 */
+int  secp256k1_fe_sqrt(secp256k1_fe *r, const secp256k1_fe *a);
+/* 联合求逆：out[i] = 1/in[i]，in 不能含 0，scratch 至少 n 个元素；out 可与 in 相同 */
+void secp256k1_fe_batch_inv(secp256k1_fe *out, const secp256k1_fe *in, size_t n, secp256k1_fe *scratch);
+/* 以下三个函数接受任意量级，按模 p 的值判断 */
+int  secp256k1_fe_is_zero(const secp256k1_fe *a);
+int  secp256k1_fe_equal(const secp256k1_fe *a, const secp256k1_fe *b);
+int  secp256k1_fe_is_odd(const secp256k1_fe *a);
+/* 大端 32 字节；from_bytes 在值 >= p 时返回 -1 */
+int  secp256k1_fe_from_bytes(secp256k1_fe *r, const uint8_t in[32]);
+void secp256k1_fe_to_bytes(uint8_t out[32], const secp256k1_fe *a);
+
+void secp256k1_fn_mul(secp256k1_scalar *r, const secp256k1_scalar *a, const secp256k1_scalar *b);
+void secp256k1_fn_add(secp256k1_scalar *r, const secp256k1_scalar *a, const secp256k1_scalar *b);
+void secp256k1_fn_sub(secp256k1_scalar *r, const secp256k1_scalar *a, const secp256k1_scalar *b);
+void secp256k1_fn_inv(secp256k1_scalar *r, const secp256k1_scalar *a);
+void secp256k1_fn_to_mont(secp256k1_scalar *r, const secp256k1_scalar *a);
+void secp256k1_fn_from_mont(secp256k1_scalar *r, const secp256k1_scalar *a);
+/* 把任意 256 位整数约化到 [0, n) */
+void secp256k1_fn_reduce(secp256k1_scalar *r, const secp256k1_scalar *a);
+/* a < n ? */
+int  secp256k1_fn_valid(const secp256k1_scalar *a);
+
+void secp256k1_scalar_from_bytes(secp256k1_scalar *r, const uint8_t in[32]);
+void secp256k1_scalar_to_bytes(uint8_t out[32], const secp256k1_scalar *a);
+int  secp256k1_scalar_is_zero(const secp256k1_scalar *a);
+
+void secp256k1_point_from_affine(secp256k1_point *r, const secp256k1_affine *a);
+int  secp256k1_point_to_affine(secp256k1_affine *r, const secp256k1_point *p);   // 无穷远点返回 -1
+/* n 个点共用一次求逆转成仿射坐标；含无穷远点时对应输出置 0 并返回 -1 */
+int  secp256k1_point_batch_to_affine(secp256k1_affine *out, const secp256k1_point *in, size_t n);
+void secp256k1_point_double(secp256k1_point *r, const secp256k1_point *p);
+void secp256k1_point_add(secp256k1_point *r, const secp256k1_point *p, const secp256k1_point *q);
+void secp256k1_point_add_affine(secp256k1_point *r, const secp256k1_point *p, const secp256k1_affine *q);
+int  secp256k1_affine_on_curve(const secp256k1_affine *a);
+
+/* 标量乘（secp256k1_mul.c），标量均为普通整数形式且 < n */
+/* R = k·G，固定基 comb 预计算表，常量时间 */
+void secp256k1_point_mul_g(secp256k1_point *r, const secp256k1_scalar *k);
+/* GLV 分解：k ≡ k1 + k2·λ (mod n)，|k1|、|k2| < 2^128；输出绝对值与符号（1 表示取负） */
+void secp256k1_scalar_split_lambda(secp256k1_scalar *k1, int *neg1, secp256k1_scalar *k2, int *neg2,
+                                   const secp256k1_scalar *k);
+/* R = s·G + t·P：s、t 各自 GLV 分解成两个 128 位标量，四路 wNAF + Straus 交错，
+   非常量时间，只能用于公开数据 */
+void secp256k1_point_mul2_vartime(secp256k1_point *r, const secp256k1_scalar *s, const secp256k1_scalar *t,
+                                  const secp256k1_affine *p);
+
+/* 公钥字节 <-> 仿射点；坐标越界或不在曲线上返回 -1 */
+int  secp256k1_affine_from_bytes(secp256k1_affine *r, const uint8_t in[64]);
+void secp256k1_affine_to_bytes(uint8_t out[64], const secp256k1_affine *a);
+
+#endif
@@ -0,0 +1,209 @@
+// secp256k1_demo.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "secp256k1.h"
+
+/*
+  用法:
+    ./secp256k1_demo                        已知答案测试 + 标量乘互相核对 + 性能测试
+    ./secp256k1_demo kat <d_hex> <msg> [r_hex s_hex]
+        输出 "pub_hex wif 压缩地址 非压缩地址 sig_hex der_hex verify [给定签名的 verify]"
+    ./secp256k1_demo addr <compressed> [nthreads]
+        从标准输入逐行读私钥（hex），批量派生地址逐行输出，无效私钥输出 "-"
+    后两种模式供 Project5/secp256k1_crosscheck.py 与 sign.py 逐项比对
+*/
+
+/* 由 Project5/sign.py 生成：d 固定，M 为创世区块消息，签名为 RFC 6979 + 低 S */
+static const char *KAT_D    = "1e99423a4ed27608a15a2616a2b0e9e52ced330ac530edcc32c8ffc6a526aedd";
+static const char *KAT_PUB  = "f028892bad7ed57d2fb57bf33081d5cfcf6f9ed3d3d7f159c2e2fff579dc341a"
+                              "07cf33da18bd734c600b96a72bbc4749d5141c90ec8ac328ae52ddfe2e505bdb";
+static const char *KAT_WIF  = "KxFC1jmwwCoACiCAWZ3eXa96mBM6tb3TYzGmf6YwgdGWZgawvrtJ";
+static const char *KAT_ADDR = "1J7mdg5rbQyUHENYdx39WVWK7fsLpEoXZy";
+static const char *KAT_SIG  = "de09e13f35d9d69ad2e6b3ac33e463a1989caa2a6bebecffcd09fe3aa1749022"
+                              "58b8a638738ca4c71dd46b9ea310202249ec84127585f2f42521556f33de98ba";
+static const char *KAT_MSG  = "The Times 03/Jan/2009 Chancellor on brink of second bailout for banks";
+
+static void print_hex(const uint8_t *p, size_t n){
+    for(size_t i=0;i<n;i++) printf("%02x", p[i]);
+}
+
+static int parse_hex(const char *s, uint8_t *out, size_t n){
+    if(strlen(s) != 2*n) return -1;
+    for(size_t i=0;i<n;i++){
+        unsigned v;
+        if(sscanf(s + 2*i, "%2x", &v) != 1) return -1;
+        out[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int run_kat(int argc, char **argv){
+    uint8_t d[32], pub[64], sig[64], der[72];
+    char wif[SECP256K1_WIF_MAX], ac[SECP256K1_ADDR_MAX], au[SECP256K1_ADDR_MAX];
+    const uint8_t *msg = (const uint8_t*)argv[3];
+    size_t len = strlen(argv[3]);
+    if(parse_hex(argv[2], d, 32) != 0 || secp256k1_keygen(d, pub) != 0){ fprintf(stderr, "bad d\n"); return 1; }
+    if(secp256k1_sign(d, msg, len, sig) != 0) return 1;
+    secp256k1_wif(d, 1, wif);
+    secp256k1_address(pub, 1, ac);
+    secp256k1_address(pub, 0, au);
+    size_t dl = secp256k1_sig_to_der(sig, der);
+    print_hex(pub, 64); printf(" %s %s %s ", wif, ac, au);
+    print_hex(sig, 64); printf(" "); print_hex(der, dl);
+    printf(" %d", secp256k1_verify(pub, msg, len, sig));
+    if(argc == 6){
+        uint8_t other[64];
+        if(parse_hex(argv[4], other, 32) != 0 || parse_hex(argv[5], other + 32, 32) != 0){ fprintf(stderr, "bad sig\n"); return 1; }
+        printf(" %d", secp256k1_verify(pub, msg, len, other));
+    }
+    printf("\n");
+    return 0;
+}
+
+static int run_addr(int compressed, int nthreads){
+    size_t n = 0, cap = 1024;
+    uint8_t *priv = malloc(cap * 32);
+    char line[256];
+    while(priv && fgets(line, sizeof(line), stdin)){
+        line[strcspn(line, "\r\n")] = '\0';
+        if(!line[0]) continue;
+        if(n == cap){
+            uint8_t *np = realloc(priv, (cap *= 2) * 32);
+            if(!np){ free(priv); priv = NULL; break; }
+            priv = np;
+        }
+        if(parse_hex(line, priv + 32*n, 32) != 0){ fprintf(stderr, "bad key: %s\n", line); free(priv); return 1; }
+        n++;
+    }
+    char (*addr)[SECP256K1_ADDR_MAX] = malloc((n ? n : 1) * sizeof(*addr));
+    if(!priv || !addr){ fprintf(stderr, "out of memory\n"); free(priv); free(addr); return 1; }
+    secp256k1_address_batch(priv, n, compressed, addr, NULL, nthreads);
+    for(size_t i=0;i<n;i++) printf("%s\n", addr[i][0] ? addr[i] : "-");
+    free(priv);
+    free(addr);
+    return 0;
+}
+
+static int same_point(const secp256k1_point *a, const secp256k1_point *b){
+    secp256k1_affine x, y;
+    if(secp256k1_point_to_affine(&x, a) != 0 || secp256k1_point_to_affine(&y, b) != 0) return 0;
+    return secp256k1_fe_equal(&x.x, &y.x) && secp256k1_fe_equal(&x.y, &y.y);
+}
+
+int main(int argc, char **argv){
+    if((argc == 4 || argc == 6) && strcmp(argv[1], "kat") == 0) return run_kat(argc, argv);
+    if(argc >= 3 && strcmp(argv[1], "addr") == 0) return run_addr(atoi(argv[2]), argc > 3 ? atoi(argv[3]) : 1);
+
+    const uint8_t *msg = (const uint8_t*)KAT_MSG;
+    size_t len = strlen(KAT_MSG);
+    uint8_t d[32], pub[64], sig[64], want_pub[64], want_sig[64];
+    char wif[SECP256K1_WIF_MAX], addr[SECP256K1_ADDR_MAX];
+    parse_hex(KAT_D, d, 32);
+    parse_hex(KAT_PUB, want_pub, 64);
+    parse_hex(KAT_SIG, want_sig, 64);
+
+    secp256k1_keygen(d, pub);
+    secp256k1_sign(d, msg, len, sig);
+    secp256k1_wif(d, 1, wif);
+    secp256k1_address(pub, 1, addr);
+    printf("pub:  "); print_hex(pub, 64); printf("\n");
+    printf("sig:  "); print_hex(sig, 64); printf("\n");
+    printf("wif:  %s\naddr: %s\n", wif, addr);
+    printf("pub matches sign.py: %s\n", memcmp(pub, want_pub, 64) == 0 ? "OK" : "FAIL");
+    printf("wif/address match sign.py: %s\n", strcmp(wif, KAT_WIF) == 0 && strcmp(addr, KAT_ADDR) == 0 ? "OK" : "FAIL");
+    printf("sig matches RFC 6979 reference: %s\n", memcmp(sig, want_sig, 64) == 0 ? "OK" : "FAIL");
+    printf("verify: %s\n", secp256k1_verify(pub, msg, len, sig) ? "OK" : "FAIL");
+    sig[63] ^= 1;
+    printf("verify (tampered s): %s\n", secp256k1_verify(pub, msg, len, sig) ? "ACCEPTED (FAIL)" : "rejected (OK)");
+    sig[63] ^= 1;
+
+    uint8_t enc[65], back[64];
+    int sec_ok = 1;
+    for(int c=0;c<2;c++){
+        size_t el = secp256k1_pub_serialize(pub, c, enc);
+        if(secp256k1_pub_parse(enc, el, back) != 0 || memcmp(back, pub, 64) != 0) sec_ok = 0;
+    }
+    printf("SEC1 compressed/uncompressed round trip: %s\n", sec_ok ? "OK" : "FAIL");
+
+    // comb k·G 与 GLV-Straus 互相核对，并检查 GLV 分解 k1 + k2·λ == k 且两半都不超过 128 位
+    int agree = 1;
+    secp256k1_scalar k = {{ 0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x1234 }}, one = {{ 1 }}, zero = {{ 0 }};
+    secp256k1_affine P;
+    secp256k1_affine_from_bytes(&P, pub);
+    for(int i=0;i<64;i++){
+        secp256k1_point A, B, C, D;
+        k.v[0] += (uint64_t)i * 0x9e3779b97f4a7c15ULL;
+        k.v[3] = (k.v[3] * 6364136223846793005ULL + i) >> (i & 1);
+        secp256k1_fn_reduce(&k, &k);
+        secp256k1_point_mul_g(&A, &k);
+        secp256k1_point_mul2_vartime(&B, &k, &zero, &P);
+        secp256k1_point_mul2_vartime(&C, &zero, &k, &SECP256K1_G);
+        if(!same_point(&A, &B) || !same_point(&A, &C)) agree = 0;
+        // s·G + t·P == (s + t·d)·G
+        secp256k1_scalar dk, t, td;
+        secp256k1_scalar_from_bytes(&dk, d);
+        secp256k1_fn_to_mont(&t, &k);
+        secp256k1_fn_mul(&td, &dk, &t);             // 普通形式
+        secp256k1_fn_add(&td, &td, &one);
+        secp256k1_point_mul_g(&A, &td);
+        secp256k1_point_mul2_vartime(&D, &one, &k, &P);
+        if(!same_point(&A, &D)) agree = 0;
+
+        secp256k1_scalar k1, k2;
+        int n1, n2;
+        secp256k1_scalar_split_lambda(&k1, &n1, &k2, &n2, &k);
+        if(k1.v[2] | k1.v[3] | k2.v[2] | k2.v[3]) agree = 0;
+    }
+    printf("scalar mul (comb / GLV straus) agree: %s\n", agree ? "OK" : "FAIL");
+
+    // 性能
+    const int N = 2000;
+    uint8_t z[32] = { 0 };
+    double t0 = now_sec();
+    for(int i=0;i<N;i++){ z[0] = (uint8_t)i; z[1] = (uint8_t)(i >> 8); secp256k1_sign_digest(d, z, sig, NULL); }
+    double t1 = now_sec();
+    int ok = 0;
+    for(int i=0;i<N;i++) ok += secp256k1_verify_digest(pub, z, sig);
+    double t2 = now_sec();
+    printf("sign:   %.1f us/op (%.0f ops/s)\n", (t1 - t0) / N * 1e6, N / (t1 - t0));
+    printf("verify: %.1f us/op (%.0f ops/s), ok=%d/%d\n", (t2 - t1) / N * 1e6, N / (t2 - t1), ok, N);
+
+    secp256k1_point R;
+    double t3 = now_sec();
+    for(int i=0;i<N;i++){ k.v[0] += i; secp256k1_point_mul_g(&R, &k); }
+    double t4 = now_sec();
+    printf("k*G comb: %.1f us/op\n", (t4 - t3) / N * 1e6);
+
+    // 地址派生：逐个（keygen + address） vs 批量（联合求逆）
+    const size_t M = 20000;
+    uint8_t *priv = malloc(M * 32);
+    char (*addrs)[SECP256K1_ADDR_MAX] = malloc(M * sizeof(*addrs));
+    if(!priv || !addrs){ free(priv); free(addrs); return 1; }
+    for(size_t i=0;i<M;i++){
+        memcpy(priv + 32*i, d, 32);
+        priv[32*i + 31] = (uint8_t)i; priv[32*i + 30] = (uint8_t)(i >> 8); priv[32*i + 29] = (uint8_t)(i >> 16);
+    }
+    double t5 = now_sec();
+    for(size_t i=0;i<M;i++){ secp256k1_keygen(priv + 32*i, pub); secp256k1_address(pub, 1, addrs[i]); }
+    double t6 = now_sec();
+    char last[SECP256K1_ADDR_MAX];
+    strcpy(last, addrs[M-1]);
+    size_t valid = secp256k1_address_batch(priv, M, 1, addrs, NULL, 1);
+    double t7 = now_sec();
+    printf("address one by one: %.1f us/key (%.0f keys/s)\n", (t6 - t5) / M * 1e6, M / (t6 - t5));
+    printf("address batch:      %.1f us/key (%.0f keys/s), %zu valid, %s\n", (t7 - t6) / M * 1e6, M / (t7 - t6),
+           valid, strcmp(last, addrs[M-1]) == 0 ? "same as one by one" : "MISMATCH");
+    free(priv);
+    free(addrs);
+    return 0;
+}
@@ -0,0 +1,180 @@
+// secp256k1_mul.c
+#include <string.h>
+#include "secp256k1.h"
+#include "secp256k1_tables.h"
+
+typedef unsigned __int128 u128;
+
+/*
+  标量乘：
+    secp256k1_point_mul_g         k·G，固定基 comb（6 齿、间隔 43、两块各 22 列），查表全表扫描，常量时间
+    secp256k1_scalar_split_lambda GLV 分解 k = k1 + k2·λ，k1、k2 约 128 位
+    secp256k1_point_mul2_vartime  s·G + t·P = s1·G + s2·(λG) + t1·P + t2·(λP)，
+                                  四路 wNAF（G 窗口 8 / P 窗口 5）+ Straus 交错，倍点次数减半，仅用于公开数据
+  λ·(x, y) = (β·x, y)，所以 λG 的奇数倍点表是静态的，λP 的表只需把 P 表的 X 乘一次 β。
+  预计算表与 GLV 常量由 gen_secp256k1_tables.py 生成并校验（secp256k1_tables.h）。
+*/
+
+#define WNAF_P 5
+#define WNAF_P_TABLE (1 << (WNAF_P - 2))
+
+/* 全 1 当且仅当 a == b */
+static inline uint64_t ct_eq_mask(uint64_t a, uint64_t b){
+    uint64_t x = a ^ b;
+    return ((x | (0 - x)) >> 63) - 1;
+}
+
+static inline unsigned scalar_bit(const secp256k1_scalar *k, int pos){
+    return pos < 256 ? (unsigned)(k->v[pos >> 6] >> (pos & 63)) & 1 : 0;
+}
+
+/* r = tab[idx]，逐项读取整张表 */
+static void ct_lookup_affine(secp256k1_affine *r, const secp256k1_affine *tab, int n, unsigned idx){
+    uint64_t o[10] = {0};
+    for(int i=0;i<n;i++){
+        uint64_t m = ct_eq_mask((uint64_t)i, idx);
+        const uint64_t *t = (const uint64_t*)&tab[i];
+        for(int j=0;j<10;j++) o[j] |= t[j] & m;
+    }
+    memcpy(r, o, sizeof(o));
+}
+
+/* ---------------- k·G：固定基 comb ----------------
+   第 b 块第 col 列的齿位为 k 的第 i·43 + b·22 + col 位 (i = 0..5)。
+   表项都带偏移点 O_b（下标 0 也不是无穷远点），循环中没有零位分支；
+   偏移总和在最后由 SECP256K1_COMB_CORR 抵消。 */
+void secp256k1_point_mul_g(secp256k1_point *r, const secp256k1_scalar *k){
+    secp256k1_point acc;
+    secp256k1_affine t;
+    for(int col = SECP256K1_COMB_BLOCKLEN - 1; col >= 0; col--){
+        if(col != SECP256K1_COMB_BLOCKLEN - 1) secp256k1_point_double(&acc, &acc);
+        for(int b=0;b<SECP256K1_COMB_BLOCKS;b++){
+            int off = b*SECP256K1_COMB_BLOCKLEN + col;
+            unsigned idx = 0;
+            if(off < SECP256K1_COMB_SPACING)        // 最后一块多出的一列，只加偏移点
+                for(int i=0;i<SECP256K1_COMB_TEETH;i++) idx |= scalar_bit(k, i*SECP256K1_COMB_SPACING + off) << i;
+            ct_lookup_affine(&t, SECP256K1_COMB[b], 1 << SECP256K1_COMB_TEETH, idx);
+            if(col == SECP256K1_COMB_BLOCKLEN - 1 && b == 0) secp256k1_point_from_affine(&acc, &t);
+            else secp256k1_point_add_affine(&acc, &acc, &t);
+        }
+    }
+    secp256k1_point_add_affine(r, &acc, &SECP256K1_COMB_CORR);
+}
+
+/* ---------------- GLV 分解 ----------------
+   c1 = round(k·b2 / n)、c2 = round(k·(-b1) / n)，用 g = round(2^384·b / n) 换成乘法加移位；
+   k2 = c1·(-b1) + c2·(-b2)，k1 = k - k2·λ（均 mod n）。结果落在 (-2^128, 2^128)，
+   大于 n/2 的一半按负数处理。常量 -b1、-b2、λ 以 Montgomery 形式存放，
+   与普通形式的标量做一次 Montgomery 乘法即得普通形式的积。 */
+
+/* r = round(a·g / 2^384)，结果不超过 128 位 */
+static void mul_shift_384(secp256k1_scalar *r, const secp256k1_scalar *a, const secp256k1_scalar *g){
+    uint64_t l[8] = {0};
+    for(int i=0;i<4;i++){
+        u128 c = 0;
+        for(int j=0;j<4;j++){
+            c += (u128)a->v[i] * g->v[j] + l[i+j];
+            l[i+j] = (uint64_t)c;
+            c >>= 64;
+        }
+        l[i+4] = (uint64_t)c;
+    }
+    u128 c = (u128)l[6] + (l[5] >> 63);
+    r->v[0] = (uint64_t)c;
+    r->v[1] = l[7] + (uint64_t)(c >> 64);
+    r->v[2] = r->v[3] = 0;
+}
+
+void secp256k1_scalar_split_lambda(secp256k1_scalar *k1, int *neg1, secp256k1_scalar *k2, int *neg2,
+                                   const secp256k1_scalar *k){
+    static const secp256k1_scalar zero = {{ 0 }};
+    secp256k1_scalar c1, c2, t;
+    mul_shift_384(&c1, k, &SECP256K1_GLV_G1);
+    mul_shift_384(&c2, k, &SECP256K1_GLV_G2);
+    secp256k1_fn_mul(k2, &c1, &SECP256K1_GLV_MB1_MONT);
+    secp256k1_fn_mul(&t, &c2, &SECP256K1_GLV_MB2_MONT);
+    secp256k1_fn_add(k2, k2, &t);
+    secp256k1_fn_mul(&t, k2, &SECP256K1_LAMBDA_MONT);
+    secp256k1_fn_sub(k1, k, &t);
+    // |k_i| < 2^128：高两个字非零说明是 n - |k_i|
+    *neg1 = (k1->v[2] | k1->v[3]) != 0;
+    *neg2 = (k2->v[2] | k2->v[3]) != 0;
+    if(*neg1) secp256k1_fn_sub(k1, &zero, k1);
+    if(*neg2) secp256k1_fn_sub(k2, &zero, k2);
+}
+
+/* ---------------- s·G + t·P：GLV + wNAF + Straus（非常量时间） ---------------- */
+
+/* 宽度 w 的 NAF，返回位数（最多 257） */
+static int wnaf(int8_t out[257], const secp256k1_scalar *k, int w){
+    uint64_t x[5] = { k->v[0], k->v[1], k->v[2], k->v[3], 0 };
+    int len = 0;
+    memset(out, 0, 257);
+    while(x[0] | x[1] | x[2] | x[3] | x[4]){
+        if(x[0] & 1){
+            int v = (int)(x[0] & ((1u << w) - 1));
+            if(v >= 1 << (w - 1)) v -= 1 << w;
+            out[len] = (int8_t)v;
+            if(v > 0){
+                uint64_t b = (uint64_t)v;
+                for(int j=0;j<5 && b;j++){ uint64_t o = x[j]; x[j] -= b; b = o < b; }
+            }else{
+                uint64_t c = (uint64_t)(-v);
+                for(int j=0;j<5 && c;j++){ x[j] += c; c = x[j] < c; }
+            }
+        }
+        for(int j=0;j<4;j++) x[j] = (x[j] >> 1) | (x[j+1] << 63);
+        x[4] >>= 1;
+        len++;
+    }
+    return len;
+}
+
+static void add_g_digit(secp256k1_point *acc, const secp256k1_affine *tab, int v){
+    secp256k1_affine a = tab[(v > 0 ? v : -v) >> 1];
+    if(v < 0) secp256k1_fe_negate(&a.y, &a.y, 1);
+    secp256k1_point_add_affine(acc, acc, &a);
+}
+
+static void add_p_digit(secp256k1_point *acc, const secp256k1_point *tab, int v){
+    secp256k1_point q = tab[(v > 0 ? v : -v) >> 1];
+    if(v < 0) secp256k1_fe_negate(&q.Y, &q.Y, 1);
+    secp256k1_point_add(acc, acc, &q);
+}
+
+void secp256k1_point_mul2_vartime(secp256k1_point *r, const secp256k1_scalar *s, const secp256k1_scalar *t,
+                                  const secp256k1_affine *p){
+    secp256k1_scalar s1, s2, t1, t2;
+    int ns1, ns2, nt1, nt2;
+    secp256k1_scalar_split_lambda(&s1, &ns1, &s2, &ns2, s);
+    secp256k1_scalar_split_lambda(&t1, &nt1, &t2, &nt2, t);
+
+    // P, 3P, ..., 15P 及其 λ 像
+    secp256k1_point tp[WNAF_P_TABLE], tl[WNAF_P_TABLE], p2;
+    secp256k1_point_from_affine(&tp[0], p);
+    secp256k1_point_double(&p2, &tp[0]);
+    for(int i=1;i<WNAF_P_TABLE;i++) secp256k1_point_add(&tp[i], &tp[i-1], &p2);
+    for(int i=0;i<WNAF_P_TABLE;i++){
+        tl[i] = tp[i];
+        secp256k1_fe_mul(&tl[i].X, &tp[i].X, &SECP256K1_BETA);
+    }
+
+    int8_t d[4][257];
+    int len = 0, l;
+    if((l = wnaf(d[0], &s1, SECP256K1_WNAF_G)) > len) len = l;
+    if((l = wnaf(d[1], &s2, SECP256K1_WNAF_G)) > len) len = l;
+    if((l = wnaf(d[2], &t1, WNAF_P)) > len) len = l;
+    if((l = wnaf(d[3], &t2, WNAF_P)) > len) len = l;
+
+    secp256k1_point acc;
+    memset(&acc, 0, sizeof(acc));
+    int started = 0;
+    for(int i=len-1;i>=0;i--){
+        if(started) secp256k1_point_double(&acc, &acc);
+        if(d[0][i]){ add_g_digit(&acc, SECP256K1_G_ODD,     ns1 ? -d[0][i] : d[0][i]); started = 1; }
+        if(d[1][i]){ add_g_digit(&acc, SECP256K1_G_ODD_LAM, ns2 ? -d[1][i] : d[1][i]); started = 1; }
+        if(d[2][i]){ add_p_digit(&acc, tp, nt1 ? -d[2][i] : d[2][i]); started = 1; }
+        if(d[3][i]){ add_p_digit(&acc, tl, nt2 ? -d[3][i] : d[3][i]); started = 1; }
+    }
+    *r = acc;
+}
@@ -0,0 +1,292 @@
+// secp256k1_tables.h -- generated by gen_secp256k1_tables.py, do not edit
+#ifndef SECP256K1_TABLES_H
+#define SECP256K1_TABLES_H
+#include "secp256k1.h"
+
+#define SECP256K1_COMB_TEETH    6
+#define SECP256K1_COMB_SPACING  43
+#define SECP256K1_COMB_BLOCKS   2
+#define SECP256K1_COMB_BLOCKLEN 22
+#define SECP256K1_WNAF_G        8
+
+/* GLV: beta^3 = 1 (mod p), lambda^3 = 1 (mod n), lambda*(x, y) = (beta*x, y) */
+static const secp256k1_fe SECP256K1_BETA = {{ 0x96c28719501eeULL, 0x7512f58995c13ULL, 0xc3434e99cf049ULL, 0x07106e64479eaULL, 0x07ae96a2b657cULL }};
+static const secp256k1_scalar SECP256K1_GLV_G1 = {{ 0xe893209a45dbb031ULL, 0x3daa8a1471e8ca7fULL, 0xe86c90e49284eb15ULL, 0x3086d221a7d46bcdULL }};
+static const secp256k1_scalar SECP256K1_GLV_G2 = {{ 0x1571b4ae8ac47f71ULL, 0x221208ac9df506c6ULL, 0x6f547fa90abfe4c4ULL, 0xe4437ed6010e8828ULL }};
+/* Montgomery form mod n: lambda, -b1, -b2 */
+static const secp256k1_scalar SECP256K1_LAMBDA_MONT = {{ 0xf07deb3dc9926c9eULL, 0x2c93e7ad83c6944cULL, 0x73a9660652697d91ULL, 0x532840178558d639ULL }};
+static const secp256k1_scalar SECP256K1_GLV_MB1_MONT = {{ 0xc50468d00ad9263cULL, 0x1b1c8205faa6ed42ULL, 0x1571b4ae8ac47f71ULL, 0x221208ac9df506c6ULL }};
+static const secp256k1_scalar SECP256K1_GLV_MB2_MONT = {{ 0x0cac5e506a144696ULL, 0x1e8a8dc5f3ba5939ULL, 0x176cdf65ba244fceULL, 0xc25575eb8e173580ULL }};
+
+static const secp256k1_affine SECP256K1_COMB[SECP256K1_COMB_BLOCKS][1 << SECP256K1_COMB_TEETH] = {
+  {
+    { {{ 0x0946ea6ab3823ULL, 0x83cdd6e4234c8ULL, 0xb3907926d6d1dULL, 0x4f8d031a37be6ULL, 0x08ec271c68f57ULL }}, {{ 0x50c06900b004dULL, 0x1acffc0a6bc2dULL, 0xe229947b5086cULL, 0xb58619b662599ULL, 0x0fa8ba4efac5dULL }} },
+    { {{ 0x9dfc5903b6d86ULL, 0x6a1027b40159cULL, 0xec4d30646582aULL, 0xc6a8130dac83fULL, 0x0076d1b6bb4a1ULL }}, {{ 0x5f7bb884cd004ULL, 0x13e072b6a9d90ULL, 0x43c27015ce94aULL, 0xa2b975f1c21a8ULL, 0x00bad71c2f287ULL }} },
+    { {{ 0xaaf2ac774ccd0ULL, 0x84b4c084e232aULL, 0x70d798e537c4bULL, 0x6c919dd2baef7ULL, 0x0048554360e26ULL }}, {{ 0x9309d1cf5d887ULL, 0x7fc205295312fULL, 0xe2f53f741cc03ULL, 0xb52b817ecf7c7ULL, 0x09a26ead5feaeULL }} },
+    { {{ 0xb359f435fd233ULL, 0x479323ea5e55fULL, 0xfcce8f6659930ULL, 0x217ce878c533bULL, 0x0fc07fa37d4fcULL }}, {{ 0x089bb2d7ba85fULL, 0x3d2e89ad5d67bULL, 0xc048fc3633903ULL, 0xb2d3c025aba2aULL, 0x00578fcdd5878ULL }} },
+    { {{ 0x162ba5aa15dd4ULL, 0x745aa89b66cabULL, 0x4c36c3daae0aaULL, 0x8200684627fa2ULL, 0x04ce8757f9d38ULL }}, {{ 0x03d44f5cd5c08ULL, 0x96cc38fa9f053ULL, 0x8615df9671368ULL, 0x6216941ae60ccULL, 0x0378d68509e15ULL }} },
+    { {{ 0x336dfd6304a01ULL, 0x289ef029106daULL, 0xa3eedafae4ed0ULL, 0x7fe7564d1d133ULL, 0x03f1c56a2b82fULL }}, {{ 0x9b54161e99494ULL, 0x1254720c878f0ULL, 0x55537b0e0c3c5ULL, 0x6ee7f8cdb2776ULL, 0x04bd0535be054ULL }} },
+    { {{ 0x8e524f880fa86ULL, 0xb534cdf4a732eULL, 0x3b79842760f43ULL, 0xa76e990879ee2ULL, 0x090ae35880235ULL }}, {{ 0x9ae285b873a2bULL, 0xeec645dc33cfeULL, 0xeba1c90a0bc9fULL, 0xbdf160dadcee1ULL, 0x0c170008475ddULL }} },
+    { {{ 0xac7fdefb01af9ULL, 0x1683ae81a374aULL, 0x30c6559a12cafULL, 0x72886af626e3cULL, 0x0fbd953794a3dULL }}, {{ 0x75cefd6b074c5ULL, 0x6edb3344c3c7bULL, 0xd4092a3350ab8ULL, 0x37e4726813b73ULL, 0x0f80e75778d49ULL }} },
+    { {{ 0x031b2feb14069ULL, 0x82818ca89c309ULL, 0x25fb09e244294ULL, 0x3397c02be697aULL, 0x0638a0c1587deULL }}, {{ 0xee239a5e858ebULL, 0x8ad27881ee53fULL, 0x21961478e20dcULL, 0x1e22951f88639ULL, 0x0db4a85ab7346ULL }} },
+    { {{ 0xf699220a1996cULL, 0x3870acfdea8bcULL, 0x31e6dfa575596ULL, 0x249510ce0d91bULL, 0x0930bb87593caULL }}, {{ 0xf5324b867a3cbULL, 0x11a891367d934ULL, 0xa4793c253fb14ULL, 0x91cb850660274ULL, 0x071742a9d4037ULL }} },
+    { {{ 0x24ebe6965aaefULL, 0xee977770ddc3aULL, 0xa975b3c275ef3ULL, 0x0191401a03c3cULL, 0x02e4e4cf9a27dULL }}, {{ 0x827c6e18a1b45ULL, 0xc89b23cc38e19ULL, 0x2a4f4febc56c2ULL, 0xa5700a1ab541eULL, 0x0ba05fce8a16eULL }} },
+    { {{ 0xd4c47a86d2618ULL, 0xaae258fdb1bb1ULL, 0x16fb4f55df188ULL, 0xb9f99e6e765a8ULL, 0x0b3deacfa9533ULL }}, {{ 0xdf414f0f000e3ULL, 0x7e921ceb888f8ULL, 0x1172b8934e8d2ULL, 0x8006910bf6807ULL, 0x00bbde09976b5ULL }} },
+    { {{ 0x88aa17631ccf8ULL, 0xd396a59fcfcf4ULL, 0x931eab7c1a7f2ULL, 0x90fedbdf21284ULL, 0x007c0e53760fbULL }}, {{ 0xcd6368fc60266ULL, 0x9d779791bada3ULL, 0xc499be7fecb15ULL, 0xd6eb86b1948d0ULL, 0x083026ca3a65eULL }} },
+    { {{ 0xcf43a108f20b4ULL, 0x44af5cf24ef4bULL, 0x8f8eeb4832ee0ULL, 0x13b650440fb03ULL, 0x02405723839abULL }}, {{ 0xf26b2f46c0009ULL, 0x1c01bb429a04aULL, 0x37286758da2aeULL, 0xa5926dee10e80ULL, 0x025e9210a1882ULL }} },
+    { {{ 0x11e913621c74fULL, 0x65da75bb9ddafULL, 0x3945a1e18a38fULL, 0x81d14309ae2fcULL, 0x0e4e996741e0dULL }}, {{ 0xaa95907bcac04ULL, 0x43acb756efffbULL, 0xeff4ac70d2203ULL, 0x10245e5f13421ULL, 0x02bd9d52edd8bULL }} },
+    { {{ 0x7f8a39be1d2e0ULL, 0x37d550b29f285ULL, 0x26e2cb88f0a2eULL, 0xc3e5bb8f26c35ULL, 0x06dcdac2d967eULL }}, {{ 0x2b6e844a36bfeULL, 0xf7e6a756e347aULL, 0x27ef3ab672d73ULL, 0x974b03b4fc6cdULL, 0x00128616b49c8ULL }} },
+    { {{ 0x5ac9bec424367ULL, 0x6ea5da395e0cfULL, 0x98eb10752e13aULL, 0x402a05ca13d3eULL, 0x0b8407cff8dbeULL }}, {{ 0xe7e5dadd61b60ULL, 0x0bbd0a9dc7fb2ULL, 0x2fb85cd05f250ULL, 0x266394dc93f28ULL, 0x0b5e98fe9fc6aULL }} },
+    { {{ 0x2748586318f40ULL, 0x290fddaaef69cULL, 0x36e2702f1cc69ULL, 0x765c8263df1f2ULL, 0x06847977825a0ULL }}, {{ 0xe9f0f32e1fb43ULL, 0x537c722cd575cULL, 0xf00e1b29d583eULL, 0x45288c3cedacaULL, 0x0f3468fd26744ULL }} },
+    { {{ 0x380f2ce9e1ce0ULL, 0x90e60e3706a7cULL, 0x214fef3d3cb53ULL, 0xb51779aca5004ULL, 0x0cc19c404f2caULL }}, {{ 0xb21da381229f6ULL, 0xec21f99bfb628ULL, 0xd75ebc4c8feb4ULL, 0x16d4484f49dd0ULL, 0x01360b9b83ba1ULL }} },
+    { {{ 0xf6c322fd476e8ULL, 0x10869287e717fULL, 0xfca28f923cfd6ULL, 0x7598132792d24ULL, 0x0d4d547008823ULL }}, {{ 0x0fb41ee1abe31ULL, 0xd50cd9b85b764ULL, 0xf4c7c0217245dULL, 0x7af1d69c086aaULL, 0x0639a2d746eb9ULL }} },
+    { {{ 0x015643c0e5181ULL, 0xc7cfecdaabe54ULL, 0x7a1f072101384ULL, 0xd1c53cf2c5a35ULL, 0x06e32eb88626fULL }}, {{ 0xbe63aecbe3bcaULL, 0xddd3762aaff71ULL, 0x6396082f8468bULL, 0xac4b6690e63b9ULL, 0x0a957cd165396ULL }} },
+    { {{ 0x3e390b61cce7eULL, 0xe2111efad2fcbULL, 0x7489cc18b5b0eULL, 0x8d5a869359ebcULL, 0x0cd9b8250c6feULL }}, {{ 0x4c194eb3f0539ULL, 0x67da9bd5e78e7ULL, 0x16df695087340ULL, 0xf591ae6cfaa47ULL, 0x04ce4656a5f3aULL }} },
+    { {{ 0x120172cb403aeULL, 0xf870705b544acULL, 0xa9b3cd275fcceULL, 0xf8ff5a886d733ULL, 0x0a2b2f5e6d60fULL }}, {{ 0xa9cbad622c403ULL, 0xbe68cc647ae99ULL, 0x2438047344d38ULL, 0xd4b23e83137c2ULL, 0x020373a84ed26ULL }} },
+    { {{ 0xfac516f7527e1ULL, 0x5056b68aad217ULL, 0x0d537b9118dc0ULL, 0x8166a683fd2c1ULL, 0x042207fdf4f98ULL }}, {{ 0x1a8ed404c264eULL, 0xe1c6aa4307781ULL, 0xb5024cc78c2dbULL, 0xf1fc456f91bdcULL, 0x0081ab6189bcaULL }} },
+    { {{ 0x67b3b94a9eab5ULL, 0xdc029593c5979ULL, 0x5ac743739802bULL, 0x86a11e3186dfbULL, 0x0db4bd0d37df3ULL }}, {{ 0x6f29ff919165bULL, 0x95cde49366fe6ULL, 0x0b992a729f86dULL, 0x18c72cc24ac1fULL, 0x0a370a6df148cULL }} },
+    { {{ 0xed4630f09c2ddULL, 0x82d666b256d19ULL, 0x9ff6f7fa47fa1ULL, 0x31eadd3ccaf7eULL, 0x027bc9382502cULL }}, {{ 0x9dfe1e080473fULL, 0x4a4e2c57cfdebULL, 0xf6b343d26bb62ULL, 0x6b7cbd2964583ULL, 0x060b34b89281eULL }} },
+    { {{ 0xc10ec3d8e3920ULL, 0x3d3e3fcdbcd03ULL, 0x36890e5cd7fa9ULL, 0x8eb5eb89e3ccdULL, 0x0b5850a1df9dfULL }}, {{ 0x5c20d82e7fda4ULL, 0x8c73927fa464aULL, 0xe5fc2203cbc0fULL, 0x2318dd6dae7f4ULL, 0x02d8bf326f21cULL }} },
+    { {{ 0xaa5644f14b47aULL, 0x3520a3c22ea90ULL, 0x044dec39fd630ULL, 0x9d52f33ae0372ULL, 0x06c3aa1cba1b5ULL }}, {{ 0x0de8c5a0f7b47ULL, 0xaae9d28c77635ULL, 0x635c8068e8ed6ULL, 0x8d9eab242728eULL, 0x08122df99f5b4ULL }} },
+    { {{ 0xe804eb3152e62ULL, 0x90c1c55f366b0ULL, 0x994ae2118f64eULL, 0x9c0cf9c1ec86aULL, 0x07e059cd3be80ULL }}, {{ 0x3826231b60ed3ULL, 0x844c69e240ab7ULL, 0x297e37eb5a359ULL, 0xb4451a8068020ULL, 0x0de5256ea8931ULL }} },
+    { {{ 0x57f423e9cfdabULL, 0x0333d80b74f48ULL, 0x229e32ef8a9b5ULL, 0x79564ed67c5a6ULL, 0x0a130a4c2a1a6ULL }}, {{ 0xdc78aba4740d5ULL, 0xce10417baf2a7ULL, 0xb5ec7e29c4a30ULL, 0xeb869a3b903afULL, 0x0c9a4ef3b881bULL }} },
+    { {{ 0x4a567f32225fbULL, 0xcd8feffe5a449ULL, 0x68aa166db15f9ULL, 0x8f6ca6915481fULL, 0x0fb1f49a3a0e1ULL }}, {{ 0xc514327901124ULL, 0x35f29e4ce020cULL, 0xa16cabb97110aULL, 0x17b3a89a00e7eULL, 0x0c3a3ea00d211ULL }} },
+    { {{ 0x6150a1aad6807ULL, 0x2267e3941bf9cULL, 0xf90474c22315dULL, 0xed6239077f015ULL, 0x0da406f9bdb4eULL }}, {{ 0x28df94a9aee0cULL, 0x4caa89160c009ULL, 0xa8b85593a1d43ULL, 0x66c62b94cb268ULL, 0x0764647430ab5ULL }} },
+    { {{ 0x36bdf80d75afaULL, 0xeabc7520b3447ULL, 0x3e8993e33b75cULL, 0x6ee822322e449ULL, 0x04ecfb2b54cd3ULL }}, {{ 0xeaf698ca1e407ULL, 0x48fa6f4ec8370ULL, 0xef493cad60da0ULL, 0x372badbd5a24cULL, 0x00c8070a97b6fULL }} },
+    { {{ 0x00a96ed9bcd64ULL, 0x325574fde7c3cULL, 0xe48df3068c036ULL, 0x3d16c6fe78d78ULL, 0x06bdb525bc574ULL }}, {{ 0xea0640d67cebeULL, 0x82fdfbc8bfbb3ULL, 0x7a4ffd4b50133ULL, 0xbca130c008fd5ULL, 0x0d0b10ad8febaULL }} },
+    { {{ 0x400df33def4d6ULL, 0x295d200ff4d30ULL, 0x334e815fed0b1ULL, 0x6c7f817922ff5ULL, 0x0b13633278064ULL }}, {{ 0x398ba6d7ed818ULL, 0x9ca69143a282bULL, 0xfb5c7a73aaf04ULL, 0x7d62a207c02b1ULL, 0x0f9ff68171651ULL }} },
+    { {{ 0x29128e0716fd1ULL, 0xeffb638f6bcd8ULL, 0xe00115f6c3315ULL, 0x46fe4ee797a57ULL, 0x0767483d2f6aaULL }}, {{ 0x4d76278fdc723ULL, 0x6087308e7c03aULL, 0x4165651a1d8aaULL, 0x04c192c26cf43ULL, 0x050abd898815aULL }} },
+    { {{ 0x9238ccc87a077ULL, 0xc4048d6a72b15ULL, 0xe3c86a5c7a4b0ULL, 0x44fe520072d2fULL, 0x0fe5234b98c29ULL }}, {{ 0x31cd13b9331a0ULL, 0xe9a7d38641141ULL, 0x2dc4a1d58ae3cULL, 0x29a078390ab7bULL, 0x05d6f636682feULL }} },
+    { {{ 0xa4d985c8fee6eULL, 0x9f778f99442b9ULL, 0x7e5de28d75b91ULL, 0x5a83c2cb60f2eULL, 0x00e3840d1ad4aULL }}, {{ 0xeea66f9acf424ULL, 0x9b1027de417adULL, 0x67c64c34a72cbULL, 0x550835f2c5331ULL, 0x0b3b5faf0a1d4ULL }} },
+    { {{ 0xc39b8c026f30fULL, 0x50a47a0c9c952ULL, 0x0953ed4b14fbcULL, 0xf0f09a319d545ULL, 0x01c6a7386c264ULL }}, {{ 0xd474e4d5dcbd5ULL, 0x7fe58d4b7fedcULL, 0xb1887fc2ca27eULL, 0x1b7fe153acf4bULL, 0x0327039aa45f8ULL }} },
+    { {{ 0x24f1a0522919cULL, 0xaa305b97df4bdULL, 0xd4b17e3619458ULL, 0x0d0107c266ac8ULL, 0x0515547d0a43cULL }}, {{ 0x96b7345636190ULL, 0x9e4741383cc30ULL, 0x89a4bf6bebd9eULL, 0xa1bc70d5b1a9aULL, 0x03171a6832a66ULL }} },
+    { {{ 0xac2f27022cffaULL, 0xedeca0ec850cdULL, 0x09799682cf837ULL, 0xdc8fd57c9cc8bULL, 0x0b3fda08e47daULL }}, {{ 0xefaf035897279ULL, 0x63db0403cf36aULL, 0xbf08cdd5505ebULL, 0x5efb5da303113ULL, 0x0220df9fb780cULL }} },
+    { {{ 0x6dbe179ea99d5ULL, 0x891bb2823419aULL, 0x102c8ca2ea762ULL, 0xf5a13eb93578bULL, 0x04053ac7096c0ULL }}, {{ 0x510a83085d490ULL, 0x0d78326159aaaULL, 0xa0894dcc92829ULL, 0x5dad63d2d11adULL, 0x026bd009a3c8aULL }} },
+    { {{ 0x679a627059082ULL, 0xbc0c961c548ebULL, 0xd355e3e2bc36cULL, 0xa9e50b2ae82a8ULL, 0x04bc913288829ULL }}, {{ 0x1e1cbcfb2ad5eULL, 0x03bbaefb98aebULL, 0x6fb1e67af6f86ULL, 0x9cea6bd0fe54bULL, 0x001fff686de33ULL }} },
+    { {{ 0xfb3c920a26023ULL, 0xc4c65b6696b0fULL, 0xa7da554e52bc9ULL, 0x8d88dda3a44d7ULL, 0x033b93a515c95ULL }}, {{ 0x446cc8080e9bfULL, 0x09b5683386ab6ULL, 0x70e6f81d03c08ULL, 0xab3709f2f27faULL, 0x0c889eb8bb647ULL }} },
+    { {{ 0xc16619cfa043cULL, 0x9f0b72716c633ULL, 0x1cd434562e5a6ULL, 0x317e0eaf7d613ULL, 0x0d56e8fa23e5aULL }}, {{ 0x6c8b373466008ULL, 0x08ff7f0f890a2ULL, 0x0e2c2686d0b7fULL, 0x67fc52efdaf57ULL, 0x01ec782fd5d75ULL }} },
+    { {{ 0xaff801c500d49ULL, 0xcdd710897df52ULL, 0xcac18f612e1c8ULL, 0x0653fe4db9bbbULL, 0x0b63cebe1fea3ULL }}, {{ 0x314f3aea816d9ULL, 0x18e2a17f61564ULL, 0x5fac4aacf8183ULL, 0xc7078a784013aULL, 0x07b29604d78e9ULL }} },
+    { {{ 0xd29a63eedd4afULL, 0x362435358142eULL, 0xc5f0963593bcaULL, 0xd97e1dce8ce9aULL, 0x012977568c195ULL }}, {{ 0x26ad3416114abULL, 0x075fa22617358ULL, 0xe7a1c0eedf5dbULL, 0x9a1521af7ed73ULL, 0x04bd6279e4e5bULL }} },
+    { {{ 0x16983b1bfe5e2ULL, 0xd27a0b4575d79ULL, 0x2755811103c76ULL, 0x416f7a309c065ULL, 0x04267f660e6c5ULL }}, {{ 0xcad2108b97ff6ULL, 0x5b85096893e2fULL, 0x6999bbf0a5313ULL, 0x2b988342613c0ULL, 0x03affa551850aULL }} },
+    { {{ 0xa947da9ddd741ULL, 0x851a95a32c1e0ULL, 0x021b11c01f399ULL, 0x3c79d0d064130ULL, 0x029b9b0193c32ULL }}, {{ 0x35bbf33a902c2ULL, 0xed4a72873cbf4ULL, 0x6c119794abc10ULL, 0x81d11893042f2ULL, 0x0b79c2dcd32d0ULL }} },
+    { {{ 0x446be7a72d604ULL, 0xccbf36f9b8143ULL, 0x2d6956510a015ULL, 0xd316614df5c74ULL, 0x0a557290f2387ULL }}, {{ 0x1a69f06567deaULL, 0x3ba0cbd54d37cULL, 0x4e9cfd5c04198ULL, 0x5a6cfb2afc865ULL, 0x0f9fee9449f69ULL }} },
+    { {{ 0x363711e250c9aULL, 0xc56aec1472bd5ULL, 0xc05a61eeb57c5ULL, 0x1eff43766bee3ULL, 0x0f40a62166eaeULL }}, {{ 0xf6a9696592ca0ULL, 0xcffdce63d9a30ULL, 0xdaa26d133fdf2ULL, 0xb31214fd96212ULL, 0x071a34e899f4cULL }} },
+    { {{ 0xda3999b434af7ULL, 0xf199dcbdc871bULL, 0x468f24205e90bULL, 0x215a31d12216dULL, 0x096942e044785ULL }}, {{ 0xfa7591396069dULL, 0x4709b90328e2eULL, 0x3c078e562bcdaULL, 0xb4ea0ce412a0aULL, 0x0ea289a70539bULL }} },
+    { {{ 0x67299625e0d69ULL, 0x75ebd371f95b2ULL, 0x9b60b15e3f7acULL, 0x8a29a0248e5c3ULL, 0x0ed69efd6fcf0ULL }}, {{ 0xa8850377cbf95ULL, 0xe21fc344fd1eaULL, 0x96cbb82b2b9b7ULL, 0x99756397ad489ULL, 0x012af2d23ac77ULL }} },
+    { {{ 0x52b37fd0bdd37ULL, 0xe142c48e64a44ULL, 0xcb879c43e3c63ULL, 0x1a4aa97556457ULL, 0x0b7b4c467e089ULL }}, {{ 0xb4c725d1803b5ULL, 0xf6669f56013b7ULL, 0x80a1f915e810eULL, 0x12937fb7a0606ULL, 0x0524def7ce163ULL }} },
+    { {{ 0x754643627feb8ULL, 0x051fc833984b7ULL, 0x1ea5e79612520ULL, 0x5a9fc68d3a82aULL, 0x0842920ef4a3aULL }}, {{ 0x7ddf969276b03ULL, 0xddc9f5598ce63ULL, 0x48cbba76cb9e3ULL, 0x582c6fe8f0715ULL, 0x06724b40a1a39ULL }} },
+    { {{ 0x3a1f4ec93465dULL, 0x337e23f512171ULL, 0xb45a896195806ULL, 0xce51def6613afULL, 0x0f62f5172f36aULL }}, {{ 0xf5706c52a3e2eULL, 0x171f9c9dd68feULL, 0x8cf8e1928a2a8ULL, 0x27fe928cc3d6eULL, 0x054d492531324ULL }} },
+    { {{ 0xed7a9036e6d8dULL, 0x91382fba28fd0ULL, 0xcbe22d0a277a1ULL, 0xa9136e75d069eULL, 0x0eb307ee6cd3dULL }}, {{ 0xbb8a2c7e263ecULL, 0x6389100766c5eULL, 0xb4e24c5f7c980ULL, 0xb79d743afb89dULL, 0x09a046a12be00ULL }} },
+    { {{ 0x288103e958fcaULL, 0x34ecf29a322f1ULL, 0x477d17b3e45a2ULL, 0x201670593d707ULL, 0x0627988073dd7ULL }}, {{ 0xdb8c9783f2e45ULL, 0x728e8a6b0c9f7ULL, 0x1fbb0636b0546ULL, 0xa4da27839dcfeULL, 0x0405b36a8d894ULL }} },
+    { {{ 0x5d4c1d61a11d7ULL, 0x3519fbcfa20bcULL, 0xfb5b2ef91be79ULL, 0x9d9eba4fa180eULL, 0x00c94531fd55fULL }}, {{ 0x62bc6ac450cbbULL, 0x4a6e703f7a465ULL, 0x39969240fc50fULL, 0xfe7a2a2c93187ULL, 0x0757349a511ccULL }} },
+    { {{ 0x533ebea49e380ULL, 0x6d6eb24b8e72cULL, 0xb6af9b5b1bc90ULL, 0x00d9214ea2d66ULL, 0x04e04be9d2b5aULL }}, {{ 0xbbdb54e7aaad3ULL, 0x6f88e40371d0eULL, 0x3bdc147df2108ULL, 0x223f38b919fffULL, 0x00d4e57564239ULL }} },
+    { {{ 0x7d8985beaabbbULL, 0xf715df0630766ULL, 0x3c6c8da3e32d1ULL, 0xc38a7aa326311ULL, 0x0a4ff807dfd9dULL }}, {{ 0x03461ff855339ULL, 0xeec4ee9aeb81cULL, 0x7284ab5558df3ULL, 0xaa10121d891fcULL, 0x03c8055863584ULL }} },
+    { {{ 0xbb4aff34af7b3ULL, 0x82b9ead28c63dULL, 0x846a5d63ddaa2ULL, 0x5150a19f9710aULL, 0x0c8c5ac0ae891ULL }}, {{ 0x3c220a401b9a7ULL, 0xe537cdb56be32ULL, 0x30b177e030eebULL, 0x03230a257c55cULL, 0x0a12a51ae1eecULL }} },
+    { {{ 0x4452185cdf7d6ULL, 0xa0a88f50f1ecaULL, 0xf426b5ef15483ULL, 0xfb3b01e0758deULL, 0x03e3be19d5c1fULL }}, {{ 0x02de6b59df8e3ULL, 0x450cb417df3cdULL, 0x3b61648745837ULL, 0xf6dd0f6991403ULL, 0x01d8f9fd02303ULL }} },
+    { {{ 0x23e0f16b53020ULL, 0x684cbf7474cb4ULL, 0x1d85c17751cfdULL, 0x7e6f818e3cd2dULL, 0x020569a863d9bULL }}, {{ 0x3616f9c4ed7a2ULL, 0x6c1ff8988d33dULL, 0xbea456492cc66ULL, 0x33b4ac0bf2243ULL, 0x04ba89e4bf91eULL }} },
+  },
+  {
+    { {{ 0x29d5577fc6944ULL, 0xc5dde85594566ULL, 0xf487453e68b94ULL, 0x05f78288b3850ULL, 0x0c55ea7e82a9bULL }}, {{ 0x296d7c001daeeULL, 0x5fe3c36e4af8dULL, 0x1eb70196baa8aULL, 0xfbb0a00b620c0ULL, 0x0b2d6863e5c4bULL }} },
+    { {{ 0xe65e8d42abc99ULL, 0xeb2fa60dfa887ULL, 0xc443fded63993ULL, 0x7633d5c64a8f0ULL, 0x01bd7eacb6cd3ULL }}, {{ 0xa0687a4403af4ULL, 0x9f6762b6df8f1ULL, 0xde49b7f6aa72cULL, 0x9247633eaf30fULL, 0x0927d4eed587bULL }} },
+    { {{ 0x8b3074e149505ULL, 0x420317e8e0917ULL, 0xc6be24ed7452fULL, 0x8784ef1d3b525ULL, 0x0c477244ec361ULL }}, {{ 0xdc71d7247e9d7ULL, 0x7493fb5c335e8ULL, 0x8a5016c634553ULL, 0x79c14246882a1ULL, 0x01bb7b8783171ULL }} },
+    { {{ 0xa10bc62d8da56ULL, 0xb681e935820ffULL, 0x7ab57e7de5977ULL, 0xa9e28140c64c5ULL, 0x0466266e24fe9ULL }}, {{ 0x5a65cf48dfa8aULL, 0xc2121b65cf89cULL, 0x5b565d3b02cbfULL, 0x4b09745335140ULL, 0x0c625dc87d711ULL }} },
+    { {{ 0xac05676ce56baULL, 0xfdf5180ea45b5ULL, 0xb2a30d4806016ULL, 0x9c3b8dc531742ULL, 0x0b8243e3c0e47ULL }}, {{ 0xae69728c118b6ULL, 0x72310cef1bd34ULL, 0xb00b0c1d5ee11ULL, 0xc0dd612a3aa56ULL, 0x0f6a3c3b80551ULL }} },
+    { {{ 0x37f849708dbdcULL, 0x60f31b982122eULL, 0x009e008dda81cULL, 0x10de43923d433ULL, 0x05cdc0de2ffd5ULL }}, {{ 0x4b298e6858a1cULL, 0xb7dbd39d3967dULL, 0x91fd591dd2e29ULL, 0x872170c25c5d6ULL, 0x0480bc12fd521ULL }} },
+    { {{ 0xea1fa7a3f838eULL, 0xf69d1c67caeefULL, 0x0ff730a02266fULL, 0xa63ef1759e25eULL, 0x082b3358719edULL }}, {{ 0x18b38b48e1ddbULL, 0xb2009fba9c18aULL, 0xf8e711c2fe520ULL, 0xe5faf0a4be775ULL, 0x0d5c478690b38ULL }} },
+    { {{ 0x9e4bfa1f5bb59ULL, 0xf3021f6da2a0fULL, 0x3b7290020f995ULL, 0xd7f5362d8d9c1ULL, 0x06ee5bad5e982ULL }}, {{ 0x6693402fbd66fULL, 0x29d922cdab0fdULL, 0xed02eec5c0bc3ULL, 0xed7cc99a97e71ULL, 0x082b621338b67ULL }} },
+    { {{ 0x7bf3ff083bc0bULL, 0x0b2bad59daf02ULL, 0x114e3536e8064ULL, 0x209a17b0feffcULL, 0x03984b7816295ULL }}, {{ 0x155f452df1addULL, 0x669425ea1b075ULL, 0x65ed35e2d42b8ULL, 0x5a6f5bfd67f52ULL, 0x0c101f3f21aa7ULL }} },
+    { {{ 0x02a57f61197f3ULL, 0xc684d16091227ULL, 0x340ec188971ffULL, 0x10530cf6e82d0ULL, 0x08d0eead5b284ULL }}, {{ 0x811e38f17d660ULL, 0x3390979e35333ULL, 0xe2b65bcdba475ULL, 0x96ef6c8e4fd7dULL, 0x0baad9080a799ULL }} },
+    { {{ 0xb623869397ec2ULL, 0x347824807a5e5ULL, 0x31561ede67c04ULL, 0x343fbaf385f15ULL, 0x06e5d756567d7ULL }}, {{ 0x8caf2822f3fc6ULL, 0x1f81812ded52cULL, 0x614577bf4d321ULL, 0xb5fcf33bfc036ULL, 0x061432c67566eULL }} },
+    { {{ 0x14047ce75d779ULL, 0xbf020749eb8c7ULL, 0x9e7faa4d562b5ULL, 0x8640cd62689f3ULL, 0x0593a70ca4421ULL }}, {{ 0x48f0bd0c9485dULL, 0xaa79d94266c38ULL, 0xc55af551402dcULL, 0xef0b55bf39f1fULL, 0x0fb9c914d35edULL }} },
+    { {{ 0xa513423755bb1ULL, 0xa1e631b5d0543ULL, 0x4c494ab612397ULL, 0xe1ba3d4dc5598ULL, 0x0d409c6cf7228ULL }}, {{ 0xf68bdc3b30e87ULL, 0xbabbdafedf6c8ULL, 0x4fbc54a549a30ULL, 0xadae4282a9574ULL, 0x01524ce9f3a6eULL }} },
+    { {{ 0x6007d57044473ULL, 0xf053a1509a7d9ULL, 0x6282a3f157b01ULL, 0xf7c72e2a515ffULL, 0x0ace0e5c3a8c0ULL }}, {{ 0x76ebf11f7c473ULL, 0x44fe22a45614eULL, 0x592e108d17002ULL, 0x132254bc21380ULL, 0x0e647a2a95447ULL }} },
+    { {{ 0x3bb4bb813f061ULL, 0x2b4f603433326ULL, 0x4cb2140524f09ULL, 0x6b36220f31823ULL, 0x0e9fa45d9856cULL }}, {{ 0x20c206c999aa3ULL, 0xec663a95a7850ULL, 0x86dc17195be7fULL, 0x715de753aaac2ULL, 0x0ed14b622cf31ULL }} },
+    { {{ 0xa3a8de934300fULL, 0x55d1ca3a43616ULL, 0xa04cf9d852167ULL, 0x99d76ed225252ULL, 0x09134bfa49086ULL }}, {{ 0x0c95d2148517bULL, 0x045816039ed8eULL, 0x7b76af3199c01ULL, 0x26e42f4a85e7eULL, 0x05bad0f84d456ULL }} },
+    { {{ 0x82cc9e53a9c12ULL, 0x0f35e9d6a2033ULL, 0x71b9391e5c743ULL, 0x51750e8850c3cULL, 0x0820eb8b23f5cULL }}, {{ 0x028933fae8fdfULL, 0x2e49c0ca50274ULL, 0xa1b6184cb2bccULL, 0x6bbf8c04de361ULL, 0x0bdf4c6d47d7bULL }} },
+    { {{ 0xdbd55a5a8a403ULL, 0xc811d6254391fULL, 0xa01a56dbbdbfbULL, 0x38bc7edbb3e59ULL, 0x048fac3370ed4ULL }}, {{ 0x36a6750a37070ULL, 0x50bbdf9903629ULL, 0x1de73024a3cc3ULL, 0xe6079470e6324ULL, 0x0d0e6c4339dfdULL }} },
+    { {{ 0xc3bc28fbdcb12ULL, 0x94211000d6632ULL, 0xcd7f9153c18f1ULL, 0xd17a3cdbd0c3eULL, 0x05872eaee169aULL }}, {{ 0x4f2d4b535e7ddULL, 0xa34e31f0dd759ULL, 0x3cdc6fcde0262ULL, 0x5a808c99108d6ULL, 0x0b9fdde03106dULL }} },
+    { {{ 0xb2c191f4f6491ULL, 0x31bd879254456ULL, 0x005318f9fa93fULL, 0x3cffeac602832ULL, 0x0eb791893e140ULL }}, {{ 0x1c80791c31d05ULL, 0x2e2d256584408ULL, 0xa38f4769815baULL, 0x91764cf02c229ULL, 0x02daec2aa974bULL }} },
+    { {{ 0xb8dbaf6293690ULL, 0x107772474cd99ULL, 0x50e4321e8fb64ULL, 0xbd89ccb770eb6ULL, 0x0680b7ba1c6fbULL }}, {{ 0x199004c963b5bULL, 0x22cd011a799c3ULL, 0x0fedaaaab4ffaULL, 0x91d30720bba4dULL, 0x0c8ce9b8e1dcaULL }} },
+    { {{ 0x5bad6218e8a6fULL, 0x6987adc526a95ULL, 0x27370491aa06dULL, 0x22c95d85afc14ULL, 0x0dc1eace988f8ULL }}, {{ 0x5065bc3542ebaULL, 0x934a3660bae6cULL, 0x2b285a57090c0ULL, 0x12f64f9e70c45ULL, 0x07afbdf1f3ee6ULL }} },
+    { {{ 0x50cd0cfec325aULL, 0xc5a7df4d62565ULL, 0x41f076a1f179fULL, 0x780523cff4f3dULL, 0x01757f57bce80ULL }}, {{ 0xd18bcff4e6e9bULL, 0xa0403c5751ef5ULL, 0xedc73af232d59ULL, 0xd7273f5a2b1faULL, 0x008d371e59861ULL }} },
+    { {{ 0x60a2bf59ebb87ULL, 0xb4ef51e85f516ULL, 0x8bec6dc134fabULL, 0xd86abf2f8c4beULL, 0x0edaddce19e80ULL }}, {{ 0xf33e1a4873c7dULL, 0x869e54548b115ULL, 0x525b401fc7eb2ULL, 0xf4c9e762233c1ULL, 0x0021835a64a5dULL }} },
+    { {{ 0x2b1a33c4bce22ULL, 0xbc0f7f3ec84a3ULL, 0x1eeb74e2fd180ULL, 0x9242628d10f13ULL, 0x0ea12b2d103f2ULL }}, {{ 0x77956e0959a32ULL, 0xcd84845f63fdcULL, 0x3206c890f83bcULL, 0xc04c56a8fa9d3ULL, 0x0a0282743c651ULL }} },
+    { {{ 0x8d793d5dd0ca6ULL, 0x60d50aa2348d9ULL, 0xd3cf63ff457a3ULL, 0x095681dc5fb3cULL, 0x06b9f5d5c7bafULL }}, {{ 0x6b7a3ce7b68e9ULL, 0xab1e51c50f8a1ULL, 0x33d3a253bf9bcULL, 0xc934e9f5fb32aULL, 0x05191b79356ecULL }} },
+    { {{ 0xe384188860764ULL, 0xdcd729aeebcd2ULL, 0xea8e2761ea463ULL, 0xa3ab1e522eec1ULL, 0x0620b8cfdd7f1ULL }}, {{ 0xbe11a822015f5ULL, 0xda2604911e553ULL, 0xa2bb2f734e579ULL, 0x11b3931c9448dULL, 0x0937a72d95ccaULL }} },
+    { {{ 0x8dbbbb1e93c72ULL, 0x4c202b3ed8eadULL, 0xc1de85b16bb63ULL, 0x8cb7291b071e7ULL, 0x05db04dc401abULL }}, {{ 0x82ad3e0dd96d2ULL, 0x7e4a5d675f406ULL, 0xdaf21908c3a1fULL, 0xbd03f995f040fULL, 0x037b68f8c349aULL }} },
+    { {{ 0xa7ab5fdd1f3b1ULL, 0x94a67f59ee3ebULL, 0xe09e64073b296ULL, 0xe5ba5979feaaaULL, 0x0135edab3decdULL }}, {{ 0x01b518f4c52b0ULL, 0x74fceb12f5252ULL, 0x0845d2956e9b5ULL, 0x264ca741c10efULL, 0x08ca9abbf3819ULL }} },
+    { {{ 0x5afac2be6ba39ULL, 0x2c503a8421339ULL, 0x4484267414ee6ULL, 0x71d7d5d22204bULL, 0x0f91e125300f6ULL }}, {{ 0x08220b826104bULL, 0x42d579d1c2b28ULL, 0x0151976e70b7aULL, 0xbd9ab4c7a7866ULL, 0x0ff0ed191dc4dULL }} },
+    { {{ 0xb6a2ce1465b0bULL, 0x7c20ceef0587dULL, 0x9452c4ee64019ULL, 0xce080ca8cf18bULL, 0x068553e7c27caULL }}, {{ 0xa785ef8e5a027ULL, 0x9bd8fd44c7816ULL, 0xa9c7dfe1e2a40ULL, 0x2701b61224380ULL, 0x0451ca6d713c7ULL }} },
+    { {{ 0x2735600af860eULL, 0x845afacccf6d3ULL, 0x86f42268f94b4ULL, 0x75b24a0f66c3cULL, 0x03cd9c59d7d09ULL }}, {{ 0xcfbd510627650ULL, 0x903087bde6d92ULL, 0xec698132864ffULL, 0x25b0cdc40672cULL, 0x01d9d565483f1ULL }} },
+    { {{ 0x291956c1d79edULL, 0xc63fbc04120e2ULL, 0x0cde781997cc4ULL, 0x7ebef626b9abbULL, 0x0a59f35ee112fULL }}, {{ 0x6658d9f46a99bULL, 0xd699761aba028ULL, 0x24401a04d7f98ULL, 0x9f9ca4cfd30edULL, 0x0a5ab10c5db20ULL }} },
+    { {{ 0xb35344432462eULL, 0x95cc47697f284ULL, 0xe919484e01057ULL, 0x75d510f2b9cadULL, 0x04b4c6960c318ULL }}, {{ 0x28fa628ce23aaULL, 0x9238d73c2621fULL, 0x6b77fbe40df75ULL, 0x7c8fcfb23d324ULL, 0x0fd84747add9fULL }} },
+    { {{ 0xbf820fa2fe94fULL, 0x0f008358b73e1ULL, 0x994b7adb5b12aULL, 0x76b9a70095810ULL, 0x0d7dd8b9f18b2ULL }}, {{ 0x725ebeb28ffbcULL, 0x3bada8107f1f7ULL, 0x5739f802e41adULL, 0xda8b8218f3711ULL, 0x07b14d12174d8ULL }} },
+    { {{ 0x066ffeccc5b56ULL, 0x4f725230fad32ULL, 0x578928a2209c8ULL, 0x284f5559935a9ULL, 0x0570f9d449a3bULL }}, {{ 0x9df6f83a139eaULL, 0xbd93ab4044afbULL, 0xde3c280192ae6ULL, 0x240ed0ac87583ULL, 0x0eb5df50f2c7fULL }} },
+    { {{ 0x7c2961b8d48afULL, 0x006c89bf664ddULL, 0x49906f94bae30ULL, 0xb4ea48b269c49ULL, 0x0657f9a55bc77ULL }}, {{ 0x785919ee19a11ULL, 0x627a0f2659644ULL, 0xf74910f5db56fULL, 0x7a7d9a0e97b85ULL, 0x0c66ecdce2dc0ULL }} },
+    { {{ 0x66e20fef4ba50ULL, 0xaac440fe978f8ULL, 0x410915857db90ULL, 0x2ead046264af4ULL, 0x06e171a405b9aULL }}, {{ 0xab24e5c17a715ULL, 0xea940963b95b2ULL, 0xd83b93c19388bULL, 0xe21cdb8df3f4eULL, 0x019bf21825b1aULL }} },
+    { {{ 0x2e0cce7e41273ULL, 0x300f02426e6c4ULL, 0xd6b836931fcd1ULL, 0x35fea5022ffbfULL, 0x0ac0d7ffc5f85ULL }}, {{ 0x77906e8cbb296ULL, 0xc2b577747b450ULL, 0x69ed36289e78bULL, 0x364d8be14ff3cULL, 0x004caa88fd4cbULL }} },
+    { {{ 0xe593300ab804cULL, 0x43e28a03a8291ULL, 0x98acf56ca4971ULL, 0x7978b8d929d60ULL, 0x075ca66c87586ULL }}, {{ 0x17c4829ebb650ULL, 0x3fca2ca241ff0ULL, 0xb7a89c3ca6abdULL, 0x63aef81034257ULL, 0x0816737532752ULL }} },
+    { {{ 0x36c0f2cccd195ULL, 0x800654ee20329ULL, 0x2054304f6db81ULL, 0x8c25a22253fa7ULL, 0x0871799b82ed4ULL }}, {{ 0xaa7919e41ae3cULL, 0x3ad4dc702491bULL, 0x955c6ba7fd7fcULL, 0x0b208b5a38c43ULL, 0x0dbdbcadcca32ULL }} },
+    { {{ 0x9dc768515a365ULL, 0xa623f0eae7c45ULL, 0x5935b584f5dedULL, 0xa16fe896a3714ULL, 0x0f2a2abe5f5b1ULL }}, {{ 0x55c65c30b141aULL, 0xcf47d37ac69bdULL, 0x5791961af2421ULL, 0x17cadccece63eULL, 0x07054100e7ac1ULL }} },
+    { {{ 0x8b1a6fe91d826ULL, 0x4d9a40b65028fULL, 0x74023b6d8fc80ULL, 0xfc1726688d63fULL, 0x07d1b0b941c79ULL }}, {{ 0x7e5dccfda1a27ULL, 0x4d455d7f4deb6ULL, 0x9e6dfd521fd97ULL, 0xaacedfd7b1c22ULL, 0x06776474ccbcfULL }} },
+    { {{ 0x20f6ad2d9bc60ULL, 0x097c626e001f6ULL, 0xc367805e22aebULL, 0xef9abac02c060ULL, 0x01963725284acULL }}, {{ 0xc3dc29c8e5434ULL, 0x372b6bb4e05cbULL, 0x0629d899d5d47ULL, 0x6c918105977adULL, 0x0b2a1bff03138ULL }} },
+    { {{ 0x3b94c323e2b2cULL, 0x3207f1e31760bULL, 0x04d78721fb98aULL, 0xb8b708b4108cfULL, 0x08f1d377c8fd8ULL }}, {{ 0x15c2825412ba7ULL, 0x03cb3589cb6f2ULL, 0x5561be5e28481ULL, 0x15d6a3dd771b8ULL, 0x01cc64cc63037ULL }} },
+    { {{ 0xc42e1ecb3c7e4ULL, 0xc293d7654304dULL, 0x521787d9624d7ULL, 0xb291dc959fb52ULL, 0x0e3de6e1c7f26ULL }}, {{ 0x85708ae06f273ULL, 0x8d3e2f5ed7d16ULL, 0x6d5d46ea517b5ULL, 0xc0e5768749fd4ULL, 0x0c419c84b3ce9ULL }} },
+    { {{ 0xc538de7fafc42ULL, 0xdc2bbf771abcdULL, 0x25505c3f84c40ULL, 0xcf8c098cfd09aULL, 0x0b033025bc0d8ULL }}, {{ 0xa826d3562317cULL, 0x2e720ee418427ULL, 0x3b160e7df449aULL, 0xc561c6cc09fb9ULL, 0x066c7870f49eeULL }} },
+    { {{ 0x358e086859879ULL, 0x6dfd31eb6288bULL, 0x6ba00467461f7ULL, 0xac0253866aee9ULL, 0x046736883d30eULL }}, {{ 0x68ac35d4cccd4ULL, 0x56e24b7e63281ULL, 0x60d9562b78f64ULL, 0x62351b0e97c66ULL, 0x03df87e532e97ULL }} },
+    { {{ 0xc671f061d63a3ULL, 0x9595b5861db2eULL, 0x26551e14e9db9ULL, 0xdd39f44c4c93aULL, 0x012f784caa3bcULL }}, {{ 0x837d2fccdcec3ULL, 0x6a479cc7eaae9ULL, 0x5289d0202a263ULL, 0xc6dc4396b9492ULL, 0x07b995721bd4eULL }} },
+    { {{ 0xc04994e0c5d6cULL, 0xd8e1b22370f72ULL, 0x542e28e1ba87bULL, 0x2ff64585ef8f1ULL, 0x0582520f7413eULL }}, {{ 0xfcf2bc7cf5039ULL, 0x83989e9a5ffebULL, 0x87b4dc231961aULL, 0x6e0cd7659601aULL, 0x0d1fd48b05565ULL }} },
+    { {{ 0xcf850e4101a81ULL, 0x8b24e1a8220a0ULL, 0x577b6c8e125c9ULL, 0x4619aec7fb9d4ULL, 0x0a139c50c21a6ULL }}, {{ 0x5ad16c81af607ULL, 0x9a4597a5b0fdbULL, 0x8aa837770fbeaULL, 0x6851471dce6c2ULL, 0x00fba75e91f5dULL }} },
+    { {{ 0x2a915798d8112ULL, 0x239e175b90053ULL, 0xb430fa7198f73ULL, 0xfed5742ef5483ULL, 0x01266a31f75f2ULL }}, {{ 0xd0a40e2faf3f0ULL, 0x4decf593c759fULL, 0x9f8ae99165654ULL, 0x92b3908a979c1ULL, 0x0586ce3aedca9ULL }} },
+    { {{ 0x404cb4b6f537fULL, 0xff7c2ea890f6fULL, 0xf63a971341d52ULL, 0xe16583cfad332ULL, 0x08b8a20cfa8abULL }}, {{ 0xd0aa7d76a1862ULL, 0x719ab22ae2b9bULL, 0xb392653526d3fULL, 0x9244149e88972ULL, 0x0d9b952c76c8aULL }} },
+    { {{ 0x360e76b161ee0ULL, 0xad39e34205630ULL, 0xd43338d107f19ULL, 0xced5dea1d89e5ULL, 0x083c0e37051b7ULL }}, {{ 0x972322738ca38ULL, 0xdc5149e3824f1ULL, 0x7a0af5acf7dddULL, 0x70575388c9c95ULL, 0x0b234ce452056ULL }} },
+    { {{ 0x80d34fd3588f9ULL, 0x955153934075aULL, 0x042ab23d3ea4cULL, 0x40eac47165475ULL, 0x072a37397dd39ULL }}, {{ 0x48163a8f3d9c3ULL, 0x33bddb27d05c2ULL, 0x72ca1e9fd7178ULL, 0xfdfaa30ab404aULL, 0x014ef537480c4ULL }} },
+    { {{ 0x6c219e886a7aeULL, 0x2c96a8c354c37ULL, 0xf5e769dce286cULL, 0xcb3d6af0f309fULL, 0x098ed89f37639ULL }}, {{ 0x6cf44ab9024deULL, 0xe1b337bc23c1fULL, 0x9a5917bd7e26aULL, 0x5c79abbb6d05bULL, 0x034e0177e4f0aULL }} },
+    { {{ 0x5f46167815489ULL, 0x3dcf68215937aULL, 0x65efc776ec2c8ULL, 0xda661a2ae0199ULL, 0x06955f67896f0ULL }}, {{ 0x2cca438bc86b5ULL, 0xd5423bb47f14fULL, 0xf69e7d5091f40ULL, 0x202dc3fc4e209ULL, 0x059cb2385327cULL }} },
+    { {{ 0x853c60de5b9ddULL, 0xc0f9eda759529ULL, 0x1cfee80ddc99eULL, 0xbdf06e38972a6ULL, 0x0152896187715ULL }}, {{ 0xce46c67445712ULL, 0xa15958a5ec5ddULL, 0x3cba3c71aca6bULL, 0xf7c9ec3dd13a3ULL, 0x06c4e2b0a4719ULL }} },
+    { {{ 0x99a81d2b788f9ULL, 0xffe849c2a4248ULL, 0xa276135980604ULL, 0x0fee706572bc7ULL, 0x08db8c34b5fa0ULL }}, {{ 0x7e9a756cc519dULL, 0x787f5029e8a65ULL, 0xe481f5b6dae4bULL, 0x9897b523e52ccULL, 0x0b9afccf3c03dULL }} },
+    { {{ 0xf028147f83eceULL, 0x1f46dd57cef3cULL, 0x7cfe6b46f729cULL, 0x00aa4d2d94cffULL, 0x07c482b3f7d0aULL }}, {{ 0x7f9dc2273fd97ULL, 0x19e90a83935c0ULL, 0xa94b4e896f8d7ULL, 0x2d26781c148eeULL, 0x0a5bd685c02c2ULL }} },
+    { {{ 0xaef56ff5990bbULL, 0x93736f1face6cULL, 0x15315776e1acbULL, 0xf30d13461a10cULL, 0x0adcbb137b500ULL }}, {{ 0xf881c67d72055ULL, 0x13ad28f35a733ULL, 0xfd072327c74eaULL, 0x6135261f7f9fcULL, 0x0fa8bd1591b4dULL }} },
+    { {{ 0x09685b7501256ULL, 0x4e120f5620771ULL, 0x31f66e08c40a1ULL, 0x916f03b458902ULL, 0x0a02348251e00ULL }}, {{ 0xe950b55cfd54cULL, 0x54a555ebf7f41ULL, 0xec995d6d25952ULL, 0xf0b4b7a4797b3ULL, 0x0532175f2a82fULL }} },
+    { {{ 0xeee6ed04efbd4ULL, 0x549d1f461c7c2ULL, 0xaf462fd159e74ULL, 0xbd31cff34ab72ULL, 0x03e62d0fd0a95ULL }}, {{ 0x6cfb5dfed25f6ULL, 0x0980f3e5bb8ffULL, 0x853e843fda160ULL, 0x33add7df567d1ULL, 0x0e4f1ae26c5efULL }} },
+    { {{ 0x7b9ec185987c3ULL, 0xebeb1f8492e56ULL, 0x70d7fad2c05c7ULL, 0xc1723768309ffULL, 0x04b432f93125bULL }}, {{ 0xd9e702486fc24ULL, 0x1911b60f433a3ULL, 0xa4b84163813bdULL, 0x1a0f60c819071ULL, 0x02b6f1b28d01dULL }} },
+  },
+};
+
+static const secp256k1_affine SECP256K1_COMB_CORR = { {{ 0xcab50460d7fd0ULL, 0xaa8904b3f6ca6ULL, 0x061b811a8363eULL, 0xb8e3365d9e734ULL, 0x0969e1d68de1dULL }}, {{ 0xef8029a6c6e64ULL, 0x19d8f0ca06e0eULL, 0x4b8626568d62eULL, 0x7e3b9a9c334ecULL, 0x0f50b928a267eULL }} };
+
+static const secp256k1_affine SECP256K1_G_ODD[1 << (SECP256K1_WNAF_G - 2)] = {
+  { {{ 0x2815b16f81798ULL, 0xdb2dce28d959fULL, 0xe870b07029bfcULL, 0xbbac55a06295cULL, 0x079be667ef9dcULL }}, {{ 0x7d08ffb10d4b8ULL, 0x48a68554199c4ULL, 0xe1108a8fd17b4ULL, 0xc4655da4fbfc0ULL, 0x0483ada7726a3ULL }} },
+  { {{ 0x1f113bce036f9ULL, 0x45836f99b0860ULL, 0x89d5229b531c8ULL, 0xc31049344f85fULL, 0x0f9308a019258ULL }}, {{ 0x9fd7584b8e672ULL, 0x9934c2231b6cbULL, 0xa37f3566500a9ULL, 0xe8140fe337e62ULL, 0x0388f7b0f632dULL }} },
+  { {{ 0x8d569b240efe4ULL, 0xbddc619ab7cbaULL, 0xa5c5128e88b84ULL, 0x209355b4a7250ULL, 0x02f8bde4d1a07ULL }}, {{ 0x87d3aa6ac62d6ULL, 0x1bab0d6840dcaULL, 0x6c9c426f78827ULL, 0xe3d6d4dba9ddaULL, 0x0d8ac222636e5ULL }} },
+  { {{ 0xbddedcac4f9bcULL, 0x7e0330e39ce92ULL, 0x2ea7a0e3d419bULL, 0xb4eaa398f365fULL, 0x05cbdf0646e5dULL }}, {{ 0x82628087264daULL, 0xb813fde7b5a50ULL, 0x61a54dba813d0ULL, 0x5960a3178d6d8ULL, 0x06aebca40ba25ULL }} },
+  { {{ 0xf110dfc27ccbeULL, 0x974c57e714c35ULL, 0xf559abde09796ULL, 0xf65309ad178a9ULL, 0x0acd484e2f0c7ULL }}, {{ 0xc262ac64f9c37ULL, 0xa4375f8e0f05cULL, 0x63b61e9add888ULL, 0xd9fd643809717ULL, 0x0cc338921b0a7ULL }} },
+  { {{ 0xc17895da008cbULL, 0x0be5c17891bbeULL, 0x0c65aac564998ULL, 0x411e5ef4246b7ULL, 0x0774ae7f858a9ULL }}, {{ 0xd74c9c953c61bULL, 0xe2dff9d6a8301ULL, 0x7b7b365372db1ULL, 0x5e190243dd56dULL, 0x0d984a032eb6bULL }} },
+  { {{ 0xddf8f19405aa8ULL, 0xc6610e58cddeeULL, 0x3748651b075fbULL, 0x288bc7d1d205cULL, 0x0f28773c2d975ULL }}, {{ 0x5cb52db03ed81ULL, 0xda521fa91f29bULL, 0x5cdaf473a1a06ULL, 0x0a89758212eb6ULL, 0x00ab0902e8d88ULL }} },
+  { {{ 0xdbcf8e27e080eULL, 0x6f3c85f79e44aULL, 0x95ff41131e594ULL, 0xea965a465ae30ULL, 0x0d7924d4f7d43ULL }}, {{ 0x4dc9ff6a26b58ULL, 0x2bd896d3a5c50ULL, 0x8cc6defea40afULL, 0x72a683842ec22ULL, 0x0581e2872a86cULL }} },
+  { {{ 0x4faa04a2d4a34ULL, 0xae79b9768766eULL, 0x7eacf21eb9898ULL, 0x7750a420fee80ULL, 0x0defdea4cdb67ULL }}, {{ 0x199f69e56eb77ULL, 0xa04a95c0f6cfbULL, 0x2a93daeced1f4ULL, 0x5168e997b0eadULL, 0x04211ab069463ULL }} },
+  { {{ 0x5656138385b6cULL, 0xebd7e86d27747ULL, 0x44f4979f06acfULL, 0x43d293ef5cff4ULL, 0x02b4ea0a797a4ULL }}, {{ 0x0c854e5c09b7aULL, 0x0c50269763b57ULL, 0xa1c86131a01f6ULL, 0x5d93b343083b5ULL, 0x085e89bc03794ULL }} },
+  { {{ 0x40aef25be59d5ULL, 0x0271f81071813ULL, 0xce333301d9ad4ULL, 0x12564f93fa332ULL, 0x0352bbf4a4cddULL }}, {{ 0xd3d8bcf81998cULL, 0x2e71b1039c67bULL, 0xdda3e1f4a1b3bULL, 0xf534d59c18259ULL, 0x0321eb4075348ULL }} },
+  { {{ 0xcdadd4ecacc3fULL, 0xdfeff5ff29dc9ULL, 0x9879124e42ab8ULL, 0xd11b023001055ULL, 0x02fa2104d6b38ULL }}, {{ 0xba76b532b7d67ULL, 0xecfc882648423ULL, 0xbd5dd80181d70ULL, 0xd865b64569335ULL, 0x002de1068295dULL }} },
+  { {{ 0xa0cd7f5453714ULL, 0x84e09572e269cULL, 0x6edda83263c3dULL, 0xd68dab21a9b06ULL, 0x09248279b09b4ULL }}, {{ 0xa32ce97cb3402ULL, 0x2a887912ffe54ULL, 0xea2b1ff3fc0deULL, 0xaade5d1aa71bdULL, 0x073016f7bf234ULL }} },
+  { {{ 0x96d443dee8729ULL, 0x144bf615c07e9ULL, 0x0beb7522f570eULL, 0xbf278e70132fbULL, 0x0daed4f2be3a8ULL }}, {{ 0x0e52290be1c55ULL, 0x30f3afa726ab4ULL, 0xef8d7003f83c2ULL, 0x98e8d4a1aca87ULL, 0x0a69dce4a7d6cULL }} },
+  { {{ 0x3b5e87d22e7dbULL, 0xe9fdf281b0e6aULL, 0xbb19f9011ecd9ULL, 0x812e8acf28d7cULL, 0x0c44d12c7065dULL }}, {{ 0x9063f0e0e6482ULL, 0x861edf61c5a03ULL, 0x982fdac0e106eULL, 0x6cdc76c45926cULL, 0x02119a460ce32ULL }} },
+  { {{ 0xc65cbd269e6b4ULL, 0x5336c28063b61ULL, 0xed60853152b69ULL, 0x8504c89a20cfdULL, 0x06a245bf6dc69ULL }}, {{ 0xe6348100d8a82ULL, 0x48d0423b6efd5ULL, 0x16a24ad8b33baULL, 0x4a708b3f5126fULL, 0x0e022cf42c2bdULL }} },
+  { {{ 0xae57f0d0bd6a5ULL, 0x0b0bec1146f95ULL, 0xe541084ce1330ULL, 0xe627c077e3d2fULL, 0x01697ffa6fd9dULL }}, {{ 0xe9d63d01b2396ULL, 0x009e498ae7adeULL, 0x4557433a2cf15ULL, 0x6f5d27561506eULL, 0x0b9c398f18680ULL }} },
+  { {{ 0x2345ef27a7479ULL, 0x60ffb7f61df98ULL, 0x834cb0d9deb83ULL, 0x718b986d0f07eULL, 0x0605bdb019981ULL }}, {{ 0x1e1e9056b8c49ULL, 0xe84fb14db43b0ULL, 0xc96fe23c26bfaULL, 0xd20681a78d93eULL, 0x002972d2de4f8ULL }} },
+  { {{ 0x1c7e9d87ff33dULL, 0x354959b10cfe3ULL, 0xa215e10dcb01cULL, 0xbf497402fdc45ULL, 0x062d14dab4150ULL }}, {{ 0x5642483b25eafULL, 0x2967ab472235fULL, 0x0eed0db01aa13ULL, 0xb01098088a195ULL, 0x080fc06bd8cc5ULL }} },
+  { {{ 0x55c2f86308b6fULL, 0xf56b9b8b425e5ULL, 0x408e56b2c50e9ULL, 0x27dade5b4b06cULL, 0x080c60ad0040fULL }}, {{ 0x01f56430bd57aULL, 0x4cbe7024eb1aaULL, 0xfe72f70a65eedULL, 0xc30f26e66bad7ULL, 0x01c38303f1cc5ULL }} },
+  { {{ 0xeabb0fa03c8fbULL, 0x9487d847049d5ULL, 0xcc54d344cc5dcULL, 0xad54aa74c6348ULL, 0x07a9375ad6167ULL }}, {{ 0x499ec224dc7f7ULL, 0xa10c70ce2b02dULL, 0x9269046bdc59eULL, 0x726909559e0d7ULL, 0x00d0e3fa9eca8ULL }} },
+  { {{ 0x51f459bc3ffc9ULL, 0xc39b68df504bbULL, 0x5447a79bb408eULL, 0xb54c907a9ed04ULL, 0x0d528ecd9b696ULL }}, {{ 0x465b521409933ULL, 0x405c520dbc063ULL, 0x1fd656ebc4345ULL, 0xe5f99966f2188ULL, 0x0eecf41253136ULL }} },
+  { {{ 0x31808f8b45963ULL, 0x5e4a7ecb13872ULL, 0x8ecdad0526611ULL, 0x3412ea25f514eULL, 0x0049370a4b5f4ULL }}, {{ 0x3052a12949c9aULL, 0xafbb5b6764b65ULL, 0x12fd62a54c3f3ULL, 0xed428b3081b05ULL, 0x0758f3f41afd6ULL }} },
+  { {{ 0x13eb1fc345d74ULL, 0x1e0e1498e2f1cULL, 0x64702ef881d81ULL, 0x8cbbd73df930dULL, 0x077f230936ee8ULL }}, {{ 0xeb3c7671c60d6ULL, 0x30d97077cbbe8ULL, 0xba1b37896c953ULL, 0xb6400a08266e9ULL, 0x0958ef42a7886ULL }} },
+  { {{ 0x8531b7739f530ULL, 0x74ab9d4dbaeb2ULL, 0xc7c0bce58c800ULL, 0xe4b9ea44887e5ULL, 0x0f2dac991cc4cULL }}, {{ 0x17dba703a3c37ULL, 0xeb0598e4fd1a1ULL, 0xc2531df9eb5fbULL, 0x8dad4da1f32deULL, 0x0e0dedc9b3b2fULL }} },
+  { {{ 0xa4850c690d45bULL, 0xdfc9dae3debcbULL, 0xe2520125a216cULL, 0x21fb1b4be8fbbULL, 0x0463b3d9f6626ULL }}, {{ 0x377b01af7307eULL, 0x7c970a1de31cbULL, 0xd8622d7c622e2ULL, 0x6c3543114306dULL, 0x05ed430d78c29ULL }} },
+  { {{ 0x496b49998f247ULL, 0xc14328a2d1a32ULL, 0xf3b59976b98faULL, 0x6e2a09232d4afULL, 0x0f16f804244e4ULL }}, {{ 0x79962c4e31df6ULL, 0xc26e5cce26d65ULL, 0xf4e33d92a6c53ULL, 0x3f7e13d206fcdULL, 0x0cedabd9b8220ULL }} },
+  { {{ 0xe15f7151d41d1ULL, 0x15ace27c65369ULL, 0x4311af55d2453ULL, 0x4563b0352b7a1ULL, 0x0caf754272dc8ULL }}, {{ 0xf908318a04476ULL, 0xb7962232a5c32ULL, 0x5e460575f4fa9ULL, 0xf5f2a41b643faULL, 0x0cb474660ef35ULL }} },
+  { {{ 0x97bc86f082120ULL, 0x07cb86d7c1244ULL, 0x9979d8b44a09cULL, 0xb986f85d0f170ULL, 0x02600ca4b282cULL }}, {{ 0xbe9475a7e4b40ULL, 0x74ab5f0ef44b0ULL, 0xddbb45d5ac6beULL, 0x5bd6a693b03fcULL, 0x04119b88753c1ULL }} },
+  { {{ 0x2a7746998e435ULL, 0x85e24f7dc8c60ULL, 0x12220bc01c486ULL, 0x432c338ec53cdULL, 0x07635ca72d7e8ULL }}, {{ 0x76f302c5b9c61ULL, 0x61d57048bad9eULL, 0xf78e6d74ecfc0ULL, 0x9d613d1d5e590ULL, 0x0091b64960948ULL }} },
+  { {{ 0x50743bf56cc18ULL, 0x3479d468fbc1aULL, 0xeee8a66b7f2b3ULL, 0x570cdbbf4a87dULL, 0x0754e3239f325ULL }}, {{ 0xd98093c536683ULL, 0xd0197a695d0c5ULL, 0x4ea49a023ee33ULL, 0xa30fb3cd0ed30ULL, 0x00673fb86e5bdULL }} },
+  { {{ 0x2694691d9b9e8ULL, 0x661d1c952f9feULL, 0x2d570f0330800ULL, 0xe96aff57859c8ULL, 0x0e3e6bd1071a1ULL }}, {{ 0x02af4920e37f5ULL, 0x3993e90c41670ULL, 0x79a3cb6a5a228ULL, 0xe76f40c0aa583ULL, 0x059c9e0bba394ULL }} },
+  { {{ 0x47fdcf04aa6ebULL, 0xf32ba35f4b4ccULL, 0xf732985c4ccb1ULL, 0x033826ae73d88ULL, 0x0186b483d056aULL }}, {{ 0x797f86e80888bULL, 0x90895138b4a4aULL, 0x04180ab21fb80ULL, 0xf77e2e17446e2ULL, 0x03b952d32c67cULL }} },
+  { {{ 0x321724ce0963fULL, 0xd2b737d9c91a8ULL, 0x4be4f725442e6ULL, 0x6ce544c98561fULL, 0x0df9d70a6b987ULL }}, {{ 0x8c45cf2ba2417ULL, 0x2720ef9da217bULL, 0xdc39d4ab15722ULL, 0x6ccd5f862b785ULL, 0x055eb2dafd84dULL }} },
+  { {{ 0x64c5f34ce7143ULL, 0x4f849ed8995deULL, 0x5dce0f8ab5255ULL, 0xe87a497ca815dULL, 0x05edd5cc23c51ULL }}, {{ 0x706ab7399a868ULL, 0xc0d17a2905cdcULL, 0x0c89ad0c13c66ULL, 0x130661e8cec03ULL, 0x0efae9c8dbc14ULL }} },
+  { {{ 0xd362f84614fbaULL, 0xa1c355b17a722ULL, 0x87e9e777aa3fbULL, 0x6830da12fe022ULL, 0x0290798c2b647ULL }}, {{ 0x03afd41943e7aULL, 0x94db2a23146d0ULL, 0x79af25d5b29c0ULL, 0x0621988d00bcfULL, 0x0e38da76dcd44ULL }} },
+  { {{ 0xfdecef4053b45ULL, 0x2fe360257362dULL, 0x150ac39cd2955ULL, 0xf5b3054754efaULL, 0x0af3c423a95d9ULL }}, {{ 0xfeded498fd9c6ULL, 0xa667a15581bc2ULL, 0x35cfb40c8cd5aULL, 0x2b749a93b0e6fULL, 0x0f98a3fd831ebULL }} },
+  { {{ 0xfed50d884249aULL, 0xb26dcf98df8d2ULL, 0x9bf274906bb66ULL, 0xe745cccaa28c9ULL, 0x0766dbb24d134ULL }}, {{ 0x24f97cbac5996ULL, 0x65fa06cedd2c9ULL, 0x0da38b897584aULL, 0xe5e38dcc88798ULL, 0x0744b1152eacbULL }} },
+  { {{ 0x2e666191abe3eULL, 0x4f6c596a58ce9ULL, 0x784f41645f7b4ULL, 0x759ba21277c33ULL, 0x059dbf46f8c94ULL }}, {{ 0xe216c4a307f6eULL, 0x9a7919798cd85ULL, 0x48309a042ce73ULL, 0xbc300f4ea6ce6ULL, 0x0c534ad44175fULL }} },
+  { {{ 0xdc6018cfd87b8ULL, 0x711a95e73cb62ULL, 0x4e9a4a8dd647eULL, 0x4537305e691e7ULL, 0x0f13ada95103cULL }}, {{ 0x8419bdaf5733dULL, 0x1a6a75c257077ULL, 0x8341f326949e2ULL, 0x4de663bf4bc80ULL, 0x0e13817b44ee1ULL }} },
+  { {{ 0x550015a88522cULL, 0xc06ebadfb6488ULL, 0x59cca4cda1869ULL, 0xced06d4167a2cULL, 0x07754b4fa0e8aULL }}, {{ 0x48b57841163a2ULL, 0x350b6cbcc537aULL, 0x020b8fa8d1e4eULL, 0x9d82224b967c3ULL, 0x030e93e864e66ULL }} },
+  { {{ 0x28c99e2262519ULL, 0x95de8041d2a68ULL, 0xabef9d701858fULL, 0xe048aa3874d46ULL, 0x0948dcadf5990ULL }}, {{ 0xa2cae5347d57eULL, 0xefbd2ef1d2cbbULL, 0x4b1bc25df9154ULL, 0xe597d5d28a322ULL, 0x0e491a42537f6ULL }} },
+  { {{ 0x28a8a3d7c77abULL, 0xf5ac0bfa15703ULL, 0x202ec37fb224cULL, 0x6c1689c7b48f8ULL, 0x07962414450c7ULL }}, {{ 0xfa5b29db83437ULL, 0x051f04ac5760aULL, 0x3ef6f6b12507aULL, 0xb4760d5c1fc13ULL, 0x0100b610ec4ffULL }} },
+  { {{ 0xd085137ec47caULL, 0x7225b8847bb0dULL, 0x4d915485a1697ULL, 0x4b54b15b16064ULL, 0x0351408783496ULL }}, {{ 0xd15a0de293311ULL, 0x7c15c2378b7e7ULL, 0xe8127fc6039e7ULL, 0x05448e1652c48ULL, 0x0ef0afbb20562ULL }} },
+  { {{ 0x43d3f7b527eafULL, 0xeb8df787b4429ULL, 0xd8bc54993e947ULL, 0x3e4bc79ce2c9dULL, 0x0d3cc30ad6b48ULL }}, {{ 0x34db04eede0a4ULL, 0x6290358630afbULL, 0xf9508ae3c2ad4ULL, 0x278d89c5e9be8ULL, 0x08b378a22d827ULL }} },
+  { {{ 0x5ba0ff4847610ULL, 0x3db913f649397ULL, 0xfefe08b2b2982ULL, 0x2860ce1c78fcbULL, 0x01624d8478073ULL }}, {{ 0x6e2a404078575ULL, 0xf5282be4c8cc0ULL, 0xcd9d4ca896878ULL, 0x903e0914448c6ULL, 0x068651cf9b6daULL }} },
+  { {{ 0x7b4fd5fc61cd4ULL, 0x4b5af207da6dfULL, 0x3e62a98519247ULL, 0xa8a26902c9563ULL, 0x0733ce80da955ULL }}, {{ 0x673bc1dc5ea1dULL, 0xe0201e4578c54ULL, 0xdb9fcce3e1ef8ULL, 0xdf7d485a4d8b8ULL, 0x0f5435a2bd2baULL }} },
+  { {{ 0x58dfab81c045cULL, 0x092171e699ef2ULL, 0xbd3b49f8966c5ULL, 0x5064cf1a1c33bULL, 0x015d944125494ULL }}, {{ 0x7bbe9efe4070dULL, 0xbacebfc685fc3ULL, 0x3b84177434800ULL, 0x3e7234f5137b7ULL, 0x0d56eb30b6946ULL }} },
+  { {{ 0x38599d0717940ULL, 0x7c9d2b8aaaac1ULL, 0xce70d271c2141ULL, 0xe675b612136e5ULL, 0x0a1d0fcf2ec9dULL }}, {{ 0x12d39c197a629ULL, 0xa54070f3d5192ULL, 0x09667f2641462ULL, 0xa3cab2e907373ULL, 0x0edd77f50bcb5ULL }} },
+  { {{ 0xa37331cb36980ULL, 0xdee8245c06c7cULL, 0xf84dbe9a790baULL, 0x8ccc5780c0735ULL, 0x0e22fbe15c0afULL }}, {{ 0xd06d77d31da06ULL, 0x154964799be43ULL, 0xf53a1a7a38289ULL, 0xd60c88b430a69ULL, 0x00a855babad5cULL }} },
+  { {{ 0x9452246cfa9b3ULL, 0x394704eaa7400ULL, 0x1155f5f69635eULL, 0xe8e20ee13473cULL, 0x0311091dd9860ULL }}, {{ 0x0f0b1286d8374ULL, 0xa64feee685bd8ULL, 0x8c06830871ec5ULL, 0xf04fffd1f0478ULL, 0x066db656f87d1ULL }} },
+  { {{ 0x7d4232ec2dbdfULL, 0xb45a934078186ULL, 0x3e6ac24883928ULL, 0xbe89b31c0442dULL, 0x034c1fd04d301ULL }}, {{ 0x21857ba73abeeULL, 0xeeb487443dc53ULL, 0x0174136d57f1cULL, 0x1b5954bd46f73ULL, 0x009414685e97bULL }} },
+  { {{ 0xa5e6b049b8d63ULL, 0xabbcd08affcc2ULL, 0x57eb42a8d13f3ULL, 0x701c1c14de5b5ULL, 0x0f219ea5d6b54ULL }}, {{ 0x2962a400766d1ULL, 0x3c07b27fb8d8cULL, 0xcccf6b1f4b08dULL, 0x40b0f73af4544ULL, 0x04cb95957e83dULL }} },
+  { {{ 0x6912469a0b448ULL, 0x90bca62708723ULL, 0xf45de26543a54ULL, 0xfbaab1f683db8ULL, 0x0d7b8740f74a8ULL }}, {{ 0xe0315eaa4593bULL, 0x5ed3c049b3411ULL, 0xad4717eff15dbULL, 0xc92ee1010f337ULL, 0x0fa77968128d9ULL }} },
+  { {{ 0x4d3091aa824bfULL, 0x32abdd94289feULL, 0x3a3335ead5bcdULL, 0x6f0ef86f7c98dULL, 0x032d31c222f8fULL }}, {{ 0xd14b8462e1661ULL, 0x9e6f26e961118ULL, 0x5b9e1da2e6dacULL, 0x56e39ccd3d791ULL, 0x05f3032f58921ULL }} },
+  { {{ 0xf86cbc18347b5ULL, 0x7cd59592c4340ULL, 0xd9831ea8793d7ULL, 0xb32671045a155ULL, 0x07461f371914aULL }}, {{ 0x847b3cc092ff6ULL, 0xf50c986ea6b39ULL, 0xaa442542eee1fULL, 0xbec0cbdddcae0ULL, 0x08ec0ba238b96ULL }} },
+  { {{ 0x698bad7b2b2d6ULL, 0x2c3e67453d287ULL, 0xa38206a6d716bULL, 0x860074356a25aULL, 0x0ee079adb1df1ULL }}, {{ 0xac479ec1c8c1eULL, 0x9af04c4e25ebaULL, 0xcc5f9f6a44698ULL, 0xbe5c4c5f37e0eULL, 0x08dc2412aafe3ULL }} },
+  { {{ 0xd8616ba9da6b5ULL, 0x31874c9dc72bfULL, 0xee620f7e65de3ULL, 0x83f0467b18302ULL, 0x016ec93e447ecULL }}, {{ 0x6778e25b0674dULL, 0x6a50e49713962ULL, 0xa5804a39d5818ULL, 0xfb40d0e8c2a7cULL, 0x05e4631150e62ULL }} },
+  { {{ 0x96065d537bd99ULL, 0x97f98b6aa485bULL, 0xfa70b6bd88558ULL, 0xf6f038978290aULL, 0x0eaa5f980c245ULL }}, {{ 0x041024edc07dcULL, 0x9d7e6ea67fb18ULL, 0xc994624d78486ULL, 0x2e0819a528391ULL, 0x0f65f5d3e292cULL }} },
+  { {{ 0xc4b6b35a49f51ULL, 0x877151342ea96ULL, 0xa02439958ae04ULL, 0xc132692ee1910ULL, 0x0078c9407544aULL }}, {{ 0x675f194a3ddb4ULL, 0x583c064d2462bULL, 0x39a5e68fa1fbdULL, 0x9b85d54047955ULL, 0x0f3e0319169ebULL }} },
+  { {{ 0x578d9702857a5ULL, 0xae7a6fc688726ULL, 0x31aea0001cdc8ULL, 0xa77016dcd8384ULL, 0x0494f4be219a1ULL }}, {{ 0x4b031880d562cULL, 0x30d767ed6e55fULL, 0xe36ba2af925ceULL, 0xa5f339ba7f075ULL, 0x042242a969283ULL }} },
+  { {{ 0xc1e665c1fe9b5ULL, 0xea58faa70ebf4ULL, 0x44ea549d28211ULL, 0xd86c6bc7f2f51ULL, 0x0a598a8030da6ULL }}, {{ 0x26dbd2d864e6bULL, 0xb65b35f86a100ULL, 0x0737aec23fc63ULL, 0x2c307e4b4a714ULL, 0x0204b5d6f8482ULL }} },
+  { {{ 0xadc3e58595997ULL, 0x0f12570a184dbULL, 0xdbeafec208f02ULL, 0x2b5d09192f5f2ULL, 0x0c41916365abbULL }}, {{ 0x6e96b58fa9913ULL, 0x450f34bfc0ed1ULL, 0x8984989d5caf9ULL, 0x7efa49d245b32ULL, 0x004f14351d008ULL }} },
+  { {{ 0x73a5514742881ULL, 0xd2e0a36acfe4cULL, 0xa03bc5b92a2e0ULL, 0xfa475a724604dULL, 0x0841d6063a586ULL }}, {{ 0x36de01a8d6154ULL, 0xd6744c169ce7aULL, 0x7543698e62562ULL, 0x59e81904f9a1cULL, 0x0073867f59c06ULL }} },
+};
+
+static const secp256k1_affine SECP256K1_G_ODD_LAM[1 << (SECP256K1_WNAF_G - 2)] = {
+  { {{ 0xba04400b88fcbULL, 0x067f15e98da7bULL, 0x6902325872844ULL, 0x1887ab0102b69ULL, 0x0bcace2e99da0ULL }}, {{ 0x7d08ffb10d4b8ULL, 0x48a68554199c4ULL, 0xe1108a8fd17b4ULL, 0xc4655da4fbfc0ULL, 0x0483ada7726a3ULL }} },
+  { {{ 0x0728c77206b2fULL, 0x22c6dc8e1cf7fULL, 0xa28fa2f8af1e0ULL, 0x9b4b8dcd8dcf2ULL, 0x0df6edf03731fULL }}, {{ 0x9fd7584b8e672ULL, 0x9934c2231b6cbULL, 0xa37f3566500a9ULL, 0xe8140fe337e62ULL, 0x0388f7b0f632dULL }} },
+  { {{ 0xc694695a83668ULL, 0x3ee0d097cc138ULL, 0xcb94671a04569ULL, 0x49dff79f54fbcULL, 0x0337b52e3acdaULL }}, {{ 0x87d3aa6ac62d6ULL, 0x1bab0d6840dcaULL, 0x6c9c426f78827ULL, 0xe3d6d4dba9ddaULL, 0x0d8ac222636e5ULL }} },
+  { {{ 0x4686e4e53bc94ULL, 0xe20faf7aaa3bcULL, 0x095c06e0d3b20ULL, 0x0b77a4fec4d1cULL, 0x013f26e754beaULL }}, {{ 0x82628087264daULL, 0xb813fde7b5a50ULL, 0x61a54dba813d0ULL, 0x5960a3178d6d8ULL, 0x06aebca40ba25ULL }} },
+  { {{ 0xd912e65953a52ULL, 0xf5ef6d44e120cULL, 0xc58ab20b565cdULL, 0xe8197b6558afeULL, 0x087b404037e44ULL }}, {{ 0xc262ac64f9c37ULL, 0xa4375f8e0f05cULL, 0x63b61e9add888ULL, 0xd9fd643809717ULL, 0x0cc338921b0a7ULL }} },
+  { {{ 0xf4334bb209ce7ULL, 0xb70b5ff620c5fULL, 0xebf1a2679859bULL, 0xac1d8d897c41bULL, 0x051f4d3d1171dULL }}, {{ 0xd74c9c953c61bULL, 0xe2dff9d6a8301ULL, 0x7b7b365372db1ULL, 0x5e190243dd56dULL, 0x0d984a032eb6bULL }} },
+  { {{ 0xaee6a475fb678ULL, 0xd74a3d056260aULL, 0x8fc783b32907eULL, 0x90a207046c457ULL, 0x0f14d58374bb8ULL }}, {{ 0x5cb52db03ed81ULL, 0xda521fa91f29bULL, 0x5cdaf473a1a06ULL, 0x0a89758212eb6ULL, 0x00ab0902e8d88ULL }} },
+  { {{ 0x0a40c71b1b3b4ULL, 0xc9c1c0a6393acULL, 0x12b694805cc3bULL, 0x454a0e1b48255ULL, 0x0805f1105f5f9ULL }}, {{ 0x4dc9ff6a26b58ULL, 0x2bd896d3a5c50ULL, 0x8cc6defea40afULL, 0x72a683842ec22ULL, 0x0581e2872a86cULL }} },
+  { {{ 0x0b26af6433cc9ULL, 0x47a6754102c64ULL, 0x89868675cd585ULL, 0x10e2dd08754ccULL, 0x0c2e95843a1f1ULL }}, {{ 0x199f69e56eb77ULL, 0xa04a95c0f6cfbULL, 0x2a93daeced1f4ULL, 0x5168e997b0eadULL, 0x04211ab069463ULL }} },
+  { {{ 0xeb9142ed76769ULL, 0x25d78eeb1c5d2ULL, 0xfc45cc557bafbULL, 0xb0f63272082dbULL, 0x054f51a8f5a6bULL }}, {{ 0x0c854e5c09b7aULL, 0x0c50269763b57ULL, 0xa1c86131a01f6ULL, 0x5d93b343083b5ULL, 0x085e89bc03794ULL }} },
+  { {{ 0xeaab069cbbc35ULL, 0x84809f29692fdULL, 0xa204325592bc8ULL, 0x452ea63d667a0ULL, 0x0680eb70f9b7eULL }}, {{ 0xd3d8bcf81998cULL, 0x2e71b1039c67bULL, 0xdda3e1f4a1b3bULL, 0xf534d59c18259ULL, 0x0321eb4075348ULL }} },
+  { {{ 0x04dce788930fcULL, 0x0f34a09b26b67ULL, 0xaed4da447c536ULL, 0xbc6ecfe162a03ULL, 0x0bae0440b1659ULL }}, {{ 0xba76b532b7d67ULL, 0xecfc882648423ULL, 0xbd5dd80181d70ULL, 0xd865b64569335ULL, 0x002de1068295dULL }} },
+  { {{ 0x58e87ef3195beULL, 0xf68400aa858d7ULL, 0x01d395fe15b71ULL, 0xc8311f7497e03ULL, 0x0f7554ece5468ULL }}, {{ 0xa32ce97cb3402ULL, 0x2a887912ffe54ULL, 0xea2b1ff3fc0deULL, 0xaade5d1aa71bdULL, 0x073016f7bf234ULL }} },
+  { {{ 0xa2dfef61b7229ULL, 0xc61318a794837ULL, 0xac76911546322ULL, 0xbe981d6d435f1ULL, 0x08ca980cfe497ULL }}, {{ 0x0e52290be1c55ULL, 0x30f3afa726ab4ULL, 0xef8d7003f83c2ULL, 0x98e8d4a1aca87ULL, 0x0a69dce4a7d6cULL }} },
+  { {{ 0x56571d53ba020ULL, 0x25119bd70cc5cULL, 0x658f9eb1b9c05ULL, 0x1775188c807e0ULL, 0x0e48590b373b3ULL }}, {{ 0x9063f0e0e6482ULL, 0x861edf61c5a03ULL, 0x982fdac0e106eULL, 0x6cdc76c45926cULL, 0x02119a460ce32ULL }} },
+  { {{ 0x022a6afac1b9bULL, 0x015945eb468f8ULL, 0x3b19a3a20ba50ULL, 0x27c2e84d27518ULL, 0x0e6034c74dae5ULL }}, {{ 0xe6348100d8a82ULL, 0x48d0423b6efd5ULL, 0x16a24ad8b33baULL, 0x4a708b3f5126fULL, 0x0e022cf42c2bdULL }} },
+  { {{ 0x7db1dae44e551ULL, 0x28e0674325445ULL, 0x08c8fa11fa0e6ULL, 0xb599731752724ULL, 0x0d3ea40607daaULL }}, {{ 0xe9d63d01b2396ULL, 0x009e498ae7adeULL, 0x4557433a2cf15ULL, 0x6f5d27561506eULL, 0x0b9c398f18680ULL }} },
+  { {{ 0x88b9a7429b03fULL, 0x2f5494174bb58ULL, 0x34e9878a473aaULL, 0x79e96851dcdf2ULL, 0x07ff6966b4f8fULL }}, {{ 0x1e1e9056b8c49ULL, 0xe84fb14db43b0ULL, 0xc96fe23c26bfaULL, 0xd20681a78d93eULL, 0x002972d2de4f8ULL }} },
+  { {{ 0x70ef4045cfcb3ULL, 0x36018d2aadeb0ULL, 0x4e4ec59d1acc0ULL, 0x54af554ce32c9ULL, 0x0ab880849ed4cULL }}, {{ 0x5642483b25eafULL, 0x2967ab472235fULL, 0x0eed0db01aa13ULL, 0xb01098088a195ULL, 0x080fc06bd8cc5ULL }} },
+  { {{ 0xeadd83e1f51a1ULL, 0xac94af5f75ef4ULL, 0x9fccfdf3aa695ULL, 0x6dbdfaa581fbaULL, 0x0148d9eee8fa9ULL }}, {{ 0x01f56430bd57aULL, 0x4cbe7024eb1aaULL, 0xfe72f70a65eedULL, 0xc30f26e66bad7ULL, 0x01c38303f1cc5ULL }} },
+  { {{ 0x6211e6a19f543ULL, 0xf83c35304c30eULL, 0xdba68bac7b2deULL, 0x91936bc8823efULL, 0x0c5011eacb876ULL }}, {{ 0x499ec224dc7f7ULL, 0xa10c70ce2b02dULL, 0x9269046bdc59eULL, 0x726909559e0d7ULL, 0x00d0e3fa9eca8ULL }} },
+  { {{ 0xb6fa33b5e25e7ULL, 0xf8ec823ea960bULL, 0xa9bd8523fa22dULL, 0x169b89eb86d54ULL, 0x0e9c9d489f658ULL }}, {{ 0x465b521409933ULL, 0x405c520dbc063ULL, 0x1fd656ebc4345ULL, 0xe5f99966f2188ULL, 0x0eecf41253136ULL }} },
+  { {{ 0xa66db4351973dULL, 0x4eeeb1662d06bULL, 0xf6c352eb9af41ULL, 0x0aa74abe8c119ULL, 0x05e51873a71ebULL }}, {{ 0x3052a12949c9aULL, 0xafbb5b6764b65ULL, 0x12fd62a54c3f3ULL, 0xed428b3081b05ULL, 0x0758f3f41afd6ULL }} },
+  { {{ 0xe312130323cacULL, 0xcd10a2ed1d575ULL, 0xdce1c4fe26f62ULL, 0x1c440cf2d3ea4ULL, 0x0a0a5df60c8a8ULL }}, {{ 0xeb3c7671c60d6ULL, 0x30d97077cbbe8ULL, 0xba1b37896c953ULL, 0xb6400a08266e9ULL, 0x0958ef42a7886ULL }} },
+  { {{ 0x4c1e66d0865eeULL, 0xe918ec3d0da9bULL, 0x1c0ba81d68631ULL, 0xeff58cce3ff1aULL, 0x088bf82907965ULL }}, {{ 0x17dba703a3c37ULL, 0xeb0598e4fd1a1ULL, 0xc2531df9eb5fbULL, 0x8dad4da1f32deULL, 0x0e0dedc9b3b2fULL }} },
+  { {{ 0xeb2c6a6151ccdULL, 0xc8f4120947db2ULL, 0x61c8f852ee49dULL, 0xf50ea273c5094ULL, 0x0d3d898009f38ULL }}, {{ 0x377b01af7307eULL, 0x7c970a1de31cbULL, 0xd8622d7c622e2ULL, 0x6c3543114306dULL, 0x05ed430d78c29ULL }} },
+  { {{ 0x4228dbb643650ULL, 0x708c9cdda6f8eULL, 0x186e54de618bdULL, 0xad4ae68c6222cULL, 0x0aaaa6ea8422eULL }}, {{ 0x79962c4e31df6ULL, 0xc26e5cce26d65ULL, 0xf4e33d92a6c53ULL, 0x3f7e13d206fcdULL, 0x0cedabd9b8220ULL }} },
+  { {{ 0x882a114a4f300ULL, 0x5495505fa9d41ULL, 0x329e931b7f55bULL, 0x7cf2783f1d5beULL, 0x09bdf1191c50bULL }}, {{ 0xf908318a04476ULL, 0xb7962232a5c32ULL, 0x5e460575f4fa9ULL, 0xf5f2a41b643faULL, 0x0cb474660ef35ULL }} },
+  { {{ 0xd22060cb65103ULL, 0x924d3f70f90abULL, 0xb922921e3d8d7ULL, 0xff6077df55e43ULL, 0x06c89c3391cfcULL }}, {{ 0xbe9475a7e4b40ULL, 0x74ab5f0ef44b0ULL, 0xddbb45d5ac6beULL, 0x5bd6a693b03fcULL, 0x04119b88753c1ULL }} },
+  { {{ 0x5a11ed0e6c1cfULL, 0xab67d378fa7b5ULL, 0x5cf654ac139c7ULL, 0xec3a361baf7aaULL, 0x0fb81bec00632ULL }}, {{ 0x76f302c5b9c61ULL, 0x61d57048bad9eULL, 0xf78e6d74ecfc0ULL, 0x9d613d1d5e590ULL, 0x0091b64960948ULL }} },
+  { {{ 0x69207101c2518ULL, 0x78fd8b3e680d7ULL, 0x347db19f6cdffULL, 0xc9f56228149adULL, 0x0be02db9626ddULL }}, {{ 0xd98093c536683ULL, 0xd0197a695d0c5ULL, 0x4ea49a023ee33ULL, 0xa30fb3cd0ed30ULL, 0x00673fb86e5bdULL }} },
+  { {{ 0xb586f6baeef76ULL, 0xa9a550463ec17ULL, 0x889d21daf721aULL, 0xc565175635870ULL, 0x087bd9a8f1c28ULL }}, {{ 0x02af4920e37f5ULL, 0x3993e90c41670ULL, 0x79a3cb6a5a228ULL, 0xe76f40c0aa583ULL, 0x059c9e0bba394ULL }} },
+  { {{ 0x8031158d30e3fULL, 0xdbb9624747a72ULL, 0x02f9697faa0ddULL, 0xf39e82602c3c0ULL, 0x02b6a73604e57ULL }}, {{ 0x797f86e80888bULL, 0x90895138b4a4aULL, 0x04180ab21fb80ULL, 0xf77e2e17446e2ULL, 0x03b952d32c67cULL }} },
+  { {{ 0x932131c6074dbULL, 0x7d64893824591ULL, 0xc7931327c2897ULL, 0x6658eadce5ac6ULL, 0x0689ff442f858ULL }}, {{ 0x8c45cf2ba2417ULL, 0x2720ef9da217bULL, 0xdc39d4ab15722ULL, 0x6ccd5f862b785ULL, 0x055eb2dafd84dULL }} },
+  { {{ 0x63c7c5add7b20ULL, 0xde36a3c416d5eULL, 0x92900c389d9b6ULL, 0xc76579fbe4c38ULL, 0x03c431ae2642bULL }}, {{ 0x706ab7399a868ULL, 0xc0d17a2905cdcULL, 0x0c89ad0c13c66ULL, 0x130661e8cec03ULL, 0x0efae9c8dbc14ULL }} },
+  { {{ 0x858419bfe323bULL, 0xad8ccd0198dfbULL, 0x6c20244cce185ULL, 0x8798f9aefb912ULL, 0x030571001b9f7ULL }}, {{ 0x03afd41943e7aULL, 0x94db2a23146d0ULL, 0x79af25d5b29c0ULL, 0x0621988d00bcfULL, 0x0e38da76dcd44ULL }} },
+  { {{ 0x92a72e701991aULL, 0x008ba9ced586eULL, 0x83e8dcb9ad442ULL, 0xf2b85edab57a1ULL, 0x000d263ad8326ULL }}, {{ 0xfeded498fd9c6ULL, 0xa667a15581bc2ULL, 0x35cfb40c8cd5aULL, 0x2b749a93b0e6fULL, 0x0f98a3fd831ebULL }} },
+  { {{ 0x58f4db2e63cf9ULL, 0xdf6ac298beeb2ULL, 0xf2903f841290bULL, 0x3fdd70dc5ba76ULL, 0x03cff41ca67deULL }}, {{ 0x24f97cbac5996ULL, 0x65fa06cedd2c9ULL, 0x0da38b897584aULL, 0xe5e38dcc88798ULL, 0x0744b1152eacbULL }} },
+  { {{ 0x07a876c079ef2ULL, 0x8558a6076b4bfULL, 0x64efd81b65cb8ULL, 0xbf521fb0e230eULL, 0x004c5c14383b1ULL }}, {{ 0xe216c4a307f6eULL, 0x9a7919798cd85ULL, 0x48309a042ce73ULL, 0xbc300f4ea6ce6ULL, 0x0c534ad44175fULL }} },
+  { {{ 0x8212e095052c4ULL, 0x3030db955f799ULL, 0x0063187b1e99cULL, 0x67063070fdba9ULL, 0x086c9895737bbULL }}, {{ 0x8419bdaf5733dULL, 0x1a6a75c257077ULL, 0x8341f326949e2ULL, 0x4de663bf4bc80ULL, 0x0e13817b44ee1ULL }} },
+  { {{ 0x4e0c12be7dba3ULL, 0xaa1cc01df6d7cULL, 0x60af4672990a5ULL, 0xec564dac8fdcbULL, 0x08f4c4a008e5cULL }}, {{ 0x48b57841163a2ULL, 0x350b6cbcc537aULL, 0x020b8fa8d1e4eULL, 0x9d82224b967c3ULL, 0x030e93e864e66ULL }} },
+  { {{ 0x863add20c3970ULL, 0x98202526a155bULL, 0x8bbd810ce7f2dULL, 0x770845332a036ULL, 0x09cd292290e9eULL }}, {{ 0xa2cae5347d57eULL, 0xefbd2ef1d2cbbULL, 0x4b1bc25df9154ULL, 0xe597d5d28a322ULL, 0x0e491a42537f6ULL }} },
+  { {{ 0x23033100b5d72ULL, 0xf2b751f987bacULL, 0x641d0c1a1bc0cULL, 0x3db6c611b701bULL, 0x08e5ccf4e7ea4ULL }}, {{ 0xfa5b29db83437ULL, 0x051f04ac5760aULL, 0x3ef6f6b12507aULL, 0xb4760d5c1fc13ULL, 0x0100b610ec4ffULL }} },
+  { {{ 0xaca6c5498d815ULL, 0x86698c6afb9f0ULL, 0x79a40ac5a885cULL, 0x902113a5f96faULL, 0x08036894bb4d6ULL }}, {{ 0xd15a0de293311ULL, 0x7c15c2378b7e7ULL, 0xe8127fc6039e7ULL, 0x05448e1652c48ULL, 0x0ef0afbb20562ULL }} },
+  { {{ 0x5cec8b7b44e89ULL, 0x465db7e19fb6dULL, 0x14be9330e6158ULL, 0x7052ba0ae6b38ULL, 0x0b524f8a331b0ULL }}, {{ 0x34db04eede0a4ULL, 0x6290358630afbULL, 0xf9508ae3c2ad4ULL, 0x278d89c5e9be8ULL, 0x08b378a22d827ULL }} },
+  { {{ 0xd7429559f7bb4ULL, 0x0de44cc5a2689ULL, 0x5bc3c2aa1179aULL, 0x6ae0d1ced61c1ULL, 0x0cf0455009381ULL }}, {{ 0x6e2a404078575ULL, 0xf5282be4c8cc0ULL, 0xcd9d4ca896878ULL, 0x903e0914448c6ULL, 0x068651cf9b6daULL }} },
+  { {{ 0xc50187ca9bce6ULL, 0xe34f51067f05aULL, 0x5025697f4a4f9ULL, 0x597337b2e3dc3ULL, 0x00ccbd8ba298aULL }}, {{ 0x673bc1dc5ea1dULL, 0xe0201e4578c54ULL, 0xdb9fcce3e1ef8ULL, 0xdf7d485a4d8b8ULL, 0x0f5435a2bd2baULL }} },
+  { {{ 0xf9d7fe11a2857ULL, 0x44376babae2eeULL, 0xeefa7d9f1a047ULL, 0xa37ab696c0e3fULL, 0x065384c59e84eULL }}, {{ 0x7bbe9efe4070dULL, 0xbacebfc685fc3ULL, 0x3b84177434800ULL, 0x3e7234f5137b7ULL, 0x0d56eb30b6946ULL }} },
+  { {{ 0xb79217de9a019ULL, 0x6a3a6ea12594bULL, 0x8635b1e19c4a9ULL, 0x86c577cbb3bafULL, 0x0d3231073a5a8ULL }}, {{ 0x12d39c197a629ULL, 0xa54070f3d5192ULL, 0x09667f2641462ULL, 0xa3cab2e907373ULL, 0x0edd77f50bcb5ULL }} },
+  { {{ 0xd90c700b8dbb6ULL, 0x57129d49dce3eULL, 0xa6e8944ae79aeULL, 0x0a095605537fbULL, 0x055987956c102ULL }}, {{ 0xd06d77d31da06ULL, 0x154964799be43ULL, 0xf53a1a7a38289ULL, 0xd60c88b430a69ULL, 0x00a855babad5cULL }} },
+  { {{ 0xa639e978d98beULL, 0xaa9853e177f2cULL, 0x8d8d905457399ULL, 0xbbe63633e5b45ULL, 0x092889fa7f164ULL }}, {{ 0x0f0b1286d8374ULL, 0xa64feee685bd8ULL, 0x8c06830871ec5ULL, 0xf04fffd1f0478ULL, 0x066db656f87d1ULL }} },
+  { {{ 0xf7627f6b22bb8ULL, 0x8a273d519c44fULL, 0x5d1a0fbbace2aULL, 0xaea2fcc6b989fULL, 0x0723284d28f50ULL }}, {{ 0x21857ba73abeeULL, 0xeeb487443dc53ULL, 0x0174136d57f1cULL, 0x1b5954bd46f73ULL, 0x009414685e97bULL }} },
+  { {{ 0x5505bf4f97b56ULL, 0xe1abb760f2679ULL, 0xbb17512fadf69ULL, 0x7d21df057d63dULL, 0x0330d232fa1cfULL }}, {{ 0x2962a400766d1ULL, 0x3c07b27fb8d8cULL, 0xcccf6b1f4b08dULL, 0x40b0f73af4544ULL, 0x04cb95957e83dULL }} },
+  { {{ 0x696886d76dfbfULL, 0x5bb7caf16a57fULL, 0x7abb401cb6533ULL, 0xd15499cb563ceULL, 0x090a8b67ed2e6ULL }}, {{ 0xe0315eaa4593bULL, 0x5ed3c049b3411ULL, 0xad4717eff15dbULL, 0xc92ee1010f337ULL, 0x0fa77968128d9ULL }} },
+  { {{ 0xd88ce2c84596bULL, 0x6c2905d4ba890ULL, 0x3f5d433147937ULL, 0x01d9b16751385ULL, 0x08f264368f043ULL }}, {{ 0xd14b8462e1661ULL, 0x9e6f26e961118ULL, 0x5b9e1da2e6dacULL, 0x56e39ccd3d791ULL, 0x05f3032f58921ULL }} },
+  { {{ 0x88e9bac307f42ULL, 0x114ab0be7f9abULL, 0x6fed7941e0554ULL, 0x0d6cf9d9bf047ULL, 0x0309d09650771ULL }}, {{ 0x847b3cc092ff6ULL, 0xf50c986ea6b39ULL, 0xaa442542eee1fULL, 0xbec0cbdddcae0ULL, 0x08ec0ba238b96ULL }} },
+  { {{ 0xf70f8de1e873bULL, 0xf13a2f60ef291ULL, 0x67a81d579e054ULL, 0xe044d81c5d769ULL, 0x08292903799c9ULL }}, {{ 0xac479ec1c8c1eULL, 0x9af04c4e25ebaULL, 0xcc5f9f6a44698ULL, 0xbe5c4c5f37e0eULL, 0x08dc2412aafe3ULL }} },
+  { {{ 0x72271f3f309bbULL, 0xc4d333fcf6d63ULL, 0xf7838e50c9196ULL, 0xabdef0c2ef7a6ULL, 0x0aad8f0b2bd30ULL }}, {{ 0x6778e25b0674dULL, 0x6a50e49713962ULL, 0xa5804a39d5818ULL, 0xfb40d0e8c2a7cULL, 0x05e4631150e62ULL }} },
+  { {{ 0x60b22526c24deULL, 0x39f4acbb5058aULL, 0x22d9d3284bddbULL, 0x83dda4d062226ULL, 0x028eabe22cee1ULL }}, {{ 0x041024edc07dcULL, 0x9d7e6ea67fb18ULL, 0xc994624d78486ULL, 0x2e0819a528391ULL, 0x0f65f5d3e292cULL }} },
+  { {{ 0x7d474aceb43f3ULL, 0xb086ccfd73b5fULL, 0xf7788907f7f90ULL, 0x8ecd533a9dd7eULL, 0x0aecdefd0c335ULL }}, {{ 0x675f194a3ddb4ULL, 0x583c064d2462bULL, 0x39a5e68fa1fbdULL, 0x9b85d54047955ULL, 0x0f3e0319169ebULL }} },
+  { {{ 0xb25a8fe399d2dULL, 0xeb42c7f9f11feULL, 0xf3c2d67bfca43ULL, 0x2c02caeeac7afULL, 0x04db9267bb76cULL }}, {{ 0x4b031880d562cULL, 0x30d767ed6e55fULL, 0xe36ba2af925ceULL, 0xa5f339ba7f075ULL, 0x042242a969283ULL }} },
+  { {{ 0xe0d8332fae1efULL, 0xd4c77e1b62631ULL, 0xa8d1e86df5daeULL, 0x60aad12ca4fd8ULL, 0x04a23f26eb70fULL }}, {{ 0x26dbd2d864e6bULL, 0xb65b35f86a100ULL, 0x0737aec23fc63ULL, 0x2c307e4b4a714ULL, 0x0204b5d6f8482ULL }} },
+  { {{ 0xadd0fb9a43852ULL, 0xa3ccf762f15a8ULL, 0xed899bd82f1e9ULL, 0xb88cfd6d55fbbULL, 0x0e378ca57b07eULL }}, {{ 0x6e96b58fa9913ULL, 0x450f34bfc0ed1ULL, 0x8984989d5caf9ULL, 0x7efa49d245b32ULL, 0x004f14351d008ULL }} },
+  { {{ 0x55f70b1038e42ULL, 0xea00b6172be6bULL, 0x27043dd6645a5ULL, 0xff97eeabb561aULL, 0x0cf1f4919c237ULL }}, {{ 0x36de01a8d6154ULL, 0xd6744c169ce7aULL, 0x7543698e62562ULL, 0x59e81904f9a1cULL, 0x0073867f59c06ULL }} },
+};
+
+#endif
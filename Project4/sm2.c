@@ -0,0 +1,645 @@
+// sm2.c
+#include <stdlib.h>
+#include <string.h>
+#include <x86intrin.h>
+#include "sm3.h"
+#include "sm2.h"
+
+typedef unsigned __int128 u128;
+
+/* ---------------- Montgomery 运算（R = 2^256） ----------------
+   p、n 都是满 256 位的素数（2p > 2^256），加法和 CIOS 乘法都要保留第 5 个进位字 */
+
+typedef struct {
+    uint64_t m[4];
+    uint64_t m0inv;     // -m^{-1} mod 2^64
+    uint64_t rr[4];     // R^2 mod m
+    uint64_t one[4];    // R mod m
+} mont_ctx;
+
+static const mont_ctx SM2_P = {
+    { 0x722edb8b08f1dfc3ULL, 0x457283915c45517dULL, 0xe8b92435bf6ff7deULL, 0x8542d69e4c044f18ULL },
+    0xa2a0380c50f77715ULL,
+    { 0x3d579c46f6de18f2ULL, 0xeb372da83fc9c636ULL, 0xee4d87da90d8c66cULL, 0x0ae55229283cd96aULL },
+    { 0x8dd12474f70e203dULL, 0xba8d7c6ea3baae82ULL, 0x1746dbca40900821ULL, 0x7abd2961b3fbb0e7ULL }
+};
+
+static const mont_ctx SM2_N = {
+    { 0x5ae74ee7c32e79b7ULL, 0x297720630485628dULL, 0xe8b92435bf6ff7ddULL, 0x8542d69e4c044f18ULL },
+    0x0de3063e62f54bf9ULL,
+    { 0xce212b941127d053ULL, 0xd545f52a3adc0b84ULL, 0xbcc00bdbe3d0dcc3ULL, 0x623cd33af648f57fULL },
+    { 0xa518b1183cd18649ULL, 0xd688df9cfb7a9d72ULL, 0x1746dbca40900822ULL, 0x7abd2961b3fbb0e7ULL }
+};
+
+/* 曲线系数 a、b 的 Montgomery 形式 */
+static const sm2_fe SM2_A_MONT = {{ 0x5641407ed7235e97ULL, 0x5b81faf79bbe1a8bULL, 0x4266528f10ced262ULL, 0x836b7fdcb299cbafULL }};
+static const sm2_fe SM2_B_MONT = {{ 0xf2ae6f20fdcb5d92ULL, 0xe05676885776554fULL, 0xc38ae3e6774c8c7bULL, 0x6f39572c790d3a1eULL }};
+
+const sm2_affine SM2_G = {
+    {{ 0x00d82731f368870cULL, 0x9d12c0a0a0105395ULL, 0x98681543b6f56b25ULL, 0x4ec8e57d36e75430ULL }},
+    {{ 0x7cc6691743006adaULL, 0xc6f62c40da122cdeULL, 0xfa7e55ca0749bd88ULL, 0x5ff1658dad3ab75cULL }}
+};
+
+/* 标准字节形式的 a, b, Gx, Gy（用于 Z_A） */
+static const uint8_t SM2_ABG_BYTES[128] = {
+    0x78,0x79,0x68,0xB4,0xFA,0x32,0xC3,0xFD,0x24,0x17,0x84,0x2E,0x73,0xBB,0xFE,0xFF,
+    0x2F,0x3C,0x84,0x8B,0x68,0x31,0xD7,0xE0,0xEC,0x65,0x22,0x8B,0x39,0x37,0xE4,0x98,
+    0x63,0xE4,0xC6,0xD3,0xB2,0x3B,0x0C,0x84,0x9C,0xF8,0x42,0x41,0x48,0x4B,0xFE,0x48,
+    0xF6,0x1D,0x59,0xA5,0xB1,0x6B,0xA0,0x6E,0x6E,0x12,0xD1,0xDA,0x27,0xC5,0x24,0x9A,
+    0x42,0x1D,0xEB,0xD6,0x1B,0x62,0xEA,0xB6,0x74,0x64,0x34,0xEB,0xC3,0xCC,0x31,0x5E,
+    0x32,0x22,0x0B,0x3B,0xAD,0xD5,0x0B,0xDC,0x4C,0x4E,0x6C,0x14,0x7F,0xED,0xD4,0x3D,
+    0x06,0x80,0x51,0x2B,0xCB,0xB4,0x2C,0x07,0xD4,0x73,0x49,0xD2,0x15,0x3B,0x70,0xC4,
+    0xE5,0xD7,0xFD,0xFC,0xBF,0xA3,0x6E,0xA1,0xA8,0x58,0x41,0xB9,0xE4,0x6E,0x09,0xA2
+};
+
+#define MONT_INLINE static inline __attribute__((always_inline))
+
+MONT_INLINE void mont_mul(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const mont_ctx *c){
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5;
+#pragma GCC unroll 4
+    for(int i=0;i<4;i++){
+        u128 x;
+        uint64_t bi = b[i], m;
+        x = (u128)a[0]*bi + t0;             t0 = (uint64_t)x;
+        x = (u128)a[1]*bi + t1 + (x >> 64); t1 = (uint64_t)x;
+        x = (u128)a[2]*bi + t2 + (x >> 64); t2 = (uint64_t)x;
+        x = (u128)a[3]*bi + t3 + (x >> 64); t3 = (uint64_t)x;
+        x = (u128)t4 + (x >> 64);           t4 = (uint64_t)x; t5 = (uint64_t)(x >> 64);
+
+        m = t0 * c->m0inv;
+        x = (u128)m*c->m[0] + t0;
+        x = (u128)m*c->m[1] + t1 + (x >> 64); t0 = (uint64_t)x;
+        x = (u128)m*c->m[2] + t2 + (x >> 64); t1 = (uint64_t)x;
+        x = (u128)m*c->m[3] + t3 + (x >> 64); t2 = (uint64_t)x;
+        x = (u128)t4 + (x >> 64);             t3 = (uint64_t)x;
+        t4 = t5 + (uint64_t)(x >> 64);
+    }
+    // t < 2m，按需减一次 m（常量时间选择）
+    uint64_t s0, s1, s2, s3;
+    unsigned char bw = 0;
+    bw = _subborrow_u64(bw, t0, c->m[0], (unsigned long long*)&s0);
+    bw = _subborrow_u64(bw, t1, c->m[1], (unsigned long long*)&s1);
+    bw = _subborrow_u64(bw, t2, c->m[2], (unsigned long long*)&s2);
+    bw = _subborrow_u64(bw, t3, c->m[3], (unsigned long long*)&s3);
+    uint64_t keep = -(uint64_t)(bw & (t4 == 0));   // 全 1: 保留 t
+    r[0] = (t0 & keep) | (s0 & ~keep);
+    r[1] = (t1 & keep) | (s1 & ~keep);
+    r[2] = (t2 & keep) | (s2 & ~keep);
+    r[3] = (t3 & keep) | (s3 & ~keep);
+}
+
+MONT_INLINE void mont_add(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const mont_ctx *c){
+    unsigned long long s[4], d[4];
+    unsigned char cy = 0, bw = 0;
+    cy = _addcarry_u64(cy, a[0], b[0], &s[0]);
+    cy = _addcarry_u64(cy, a[1], b[1], &s[1]);
+    cy = _addcarry_u64(cy, a[2], b[2], &s[2]);
+    cy = _addcarry_u64(cy, a[3], b[3], &s[3]);
+    bw = _subborrow_u64(bw, s[0], c->m[0], &d[0]);
+    bw = _subborrow_u64(bw, s[1], c->m[1], &d[1]);
+    bw = _subborrow_u64(bw, s[2], c->m[2], &d[2]);
+    bw = _subborrow_u64(bw, s[3], c->m[3], &d[3]);
+    uint64_t keep = -(uint64_t)(bw & (cy ^ 1));
+    for(int j=0;j<4;j++) r[j] = (s[j] & keep) | (d[j] & ~keep);
+}
+
+MONT_INLINE void mont_sub(uint64_t r[4], const uint64_t a[4], const uint64_t b[4], const mont_ctx *c){
+    unsigned long long d[4], o[4];
+    unsigned char bw = 0, cy = 0;
+    bw = _subborrow_u64(bw, a[0], b[0], &d[0]);
+    bw = _subborrow_u64(bw, a[1], b[1], &d[1]);
+    bw = _subborrow_u64(bw, a[2], b[2], &d[2]);
+    bw = _subborrow_u64(bw, a[3], b[3], &d[3]);
+    uint64_t mask = -(uint64_t)bw;
+    cy = _addcarry_u64(cy, d[0], c->m[0] & mask, &o[0]);
+    cy = _addcarry_u64(cy, d[1], c->m[1] & mask, &o[1]);
+    cy = _addcarry_u64(cy, d[2], c->m[2] & mask, &o[2]);
+    cy = _addcarry_u64(cy, d[3], c->m[3] & mask, &o[3]);
+    r[0] = o[0]; r[1] = o[1]; r[2] = o[2]; r[3] = o[3];
+}
+
+/* r = a^e，指数公开，4 位固定窗口 */
+static void mont_pow(uint64_t r[4], const uint64_t a[4], const uint64_t e[4], const mont_ctx *c){
+    uint64_t acc[4], pw[16][4];
+    memcpy(pw[0], c->one, sizeof(pw[0]));
+    memcpy(pw[1], a, sizeof(pw[1]));
+    for(int i=2;i<16;i++) mont_mul(pw[i], pw[i-1], a, c);
+    memcpy(acc, pw[e[3] >> 60], sizeof(acc));
+    for(int i=62;i>=0;i--){
+        for(int j=0;j<4;j++) mont_mul(acc, acc, acc, c);
+        unsigned w = (unsigned)(e[i/16] >> ((i%16)*4)) & 0xF;
+        if(w) mont_mul(acc, acc, pw[w], c);
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+/* r = a^(m-2)：Fermat 求逆 */
+static void mont_inv(uint64_t r[4], const uint64_t a[4], const mont_ctx *c){
+    uint64_t e[4];
+    memcpy(e, c->m, sizeof(e));
+    e[0] -= 2;                      // m 为奇素数，低位不会借位
+    mont_pow(r, a, e, c);
+}
+
+MONT_INLINE void mont_to(uint64_t r[4], const uint64_t a[4], const mont_ctx *c){ mont_mul(r, a, c->rr, c); }
+MONT_INLINE void mont_from(uint64_t r[4], const uint64_t a[4], const mont_ctx *c){
+    static const uint64_t one[4] = {1,0,0,0};
+    mont_mul(r, a, one, c);
+}
+
+/* a < m ? */
+static inline int lt_mod(const uint64_t a[4], const mont_ctx *c){
+    uint64_t bw = 0;
+    for(int j=0;j<4;j++){
+        u128 x = (u128)a[j] - c->m[j] - bw;
+        bw = (uint64_t)(x >> 64) & 1;
+    }
+    return (int)bw;
+}
+
+/* ---------------- 域/标量接口 ---------------- */
+
+void sm2_fp_mul(sm2_fe *r, const sm2_fe *a, const sm2_fe *b){ mont_mul(r->v, a->v, b->v, &SM2_P); }
+void sm2_fp_sqr(sm2_fe *r, const sm2_fe *a){ mont_mul(r->v, a->v, a->v, &SM2_P); }
+void sm2_fp_add(sm2_fe *r, const sm2_fe *a, const sm2_fe *b){ mont_add(r->v, a->v, b->v, &SM2_P); }
+void sm2_fp_sub(sm2_fe *r, const sm2_fe *a, const sm2_fe *b){ mont_sub(r->v, a->v, b->v, &SM2_P); }
+void sm2_fp_inv(sm2_fe *r, const sm2_fe *a){ mont_inv(r->v, a->v, &SM2_P); }
+
+/* p ≡ 3 (mod 4)：sqrt(a) = a^((p+1)/4)，再平方核对 */
+int sm2_fp_sqrt(sm2_fe *r, const sm2_fe *a){
+    uint64_t e[4];
+    sm2_fe t, c;
+    e[0] = SM2_P.m[0] + 1;          // p 的最低字不会进位
+    e[1] = SM2_P.m[1]; e[2] = SM2_P.m[2]; e[3] = SM2_P.m[3];
+    for(int j=0;j<4;j++) e[j] = (e[j] >> 2) | (j < 3 ? e[j+1] << 62 : 0);
+    mont_pow(t.v, a->v, e, &SM2_P);
+    sm2_fp_sqr(&c, &t);
+    if(!sm2_fe_equal(&c, a)) return -1;
+    *r = t;
+    return 0;
+}
+
+/* Montgomery 联合求逆：一次求逆 + 3(n-1) 次乘法。输入不能为 0；out 可以与 in 相同 */
+void sm2_fp_batch_inv(sm2_fe *out, const sm2_fe *in, size_t n, sm2_fe *scratch){
+    if(n == 0) return;
+    scratch[0] = in[0];
+    for(size_t i=1;i<n;i++) sm2_fp_mul(&scratch[i], &scratch[i-1], &in[i]);
+    sm2_fe inv, t;
+    sm2_fp_inv(&inv, &scratch[n-1]);
+    for(size_t i=n-1;i>0;i--){
+        sm2_fp_mul(&t, &inv, &scratch[i-1]);    // 1/in[i]
+        sm2_fp_mul(&inv, &inv, &in[i]);         // 1/(in[0]..in[i-1])
+        out[i] = t;
+    }
+    out[0] = inv;
+}
+void sm2_fp_to_mont(sm2_fe *r, const sm2_fe *a){ mont_to(r->v, a->v, &SM2_P); }
+void sm2_fp_from_mont(sm2_fe *r, const sm2_fe *a){ mont_from(r->v, a->v, &SM2_P); }
+
+void sm2_fn_mul(sm2_fe *r, const sm2_fe *a, const sm2_fe *b){ mont_mul(r->v, a->v, b->v, &SM2_N); }
+void sm2_fn_add(sm2_fe *r, const sm2_fe *a, const sm2_fe *b){ mont_add(r->v, a->v, b->v, &SM2_N); }
+void sm2_fn_sub(sm2_fe *r, const sm2_fe *a, const sm2_fe *b){ mont_sub(r->v, a->v, b->v, &SM2_N); }
+void sm2_fn_inv(sm2_fe *r, const sm2_fe *a){ mont_inv(r->v, a->v, &SM2_N); }
+void sm2_fn_to_mont(sm2_fe *r, const sm2_fe *a){ mont_to(r->v, a->v, &SM2_N); }
+void sm2_fn_from_mont(sm2_fe *r, const sm2_fe *a){ mont_from(r->v, a->v, &SM2_N); }
+
+void sm2_fn_reduce(sm2_fe *r, const sm2_fe *a){
+    // 2n > 2^256，最多减一次
+    uint64_t d[4], bw = 0;
+    for(int j=0;j<4;j++){
+        u128 x = (u128)a->v[j] - SM2_N.m[j] - bw;
+        d[j] = (uint64_t)x; bw = (uint64_t)(x >> 64) & 1;
+    }
+    uint64_t keep = -bw;
+    for(int j=0;j<4;j++) r->v[j] = (a->v[j] & keep) | (d[j] & ~keep);
+}
+
+void sm2_fe_from_bytes(sm2_fe *r, const uint8_t in[32]){
+    for(int j=0;j<4;j++){
+        uint64_t w = 0;
+        for(int i=0;i<8;i++) w = (w << 8) | in[(3-j)*8 + i];
+        r->v[j] = w;
+    }
+}
+
+void sm2_fe_to_bytes(uint8_t out[32], const sm2_fe *a){
+    for(int j=0;j<4;j++)
+        for(int i=0;i<8;i++) out[(3-j)*8 + i] = (uint8_t)(a->v[j] >> (56 - 8*i));
+}
+
+int sm2_fe_is_zero(const sm2_fe *a){
+    return (a->v[0] | a->v[1] | a->v[2] | a->v[3]) == 0;
+}
+
+int sm2_fe_equal(const sm2_fe *a, const sm2_fe *b){
+    return ((a->v[0]^b->v[0]) | (a->v[1]^b->v[1]) | (a->v[2]^b->v[2]) | (a->v[3]^b->v[3])) == 0;
+}
+
+/* ---------------- 点运算（Jacobian） ---------------- */
+
+void sm2_point_from_affine(sm2_point *r, const sm2_affine *a){
+    r->X = a->x; r->Y = a->y;
+    memcpy(r->Z.v, SM2_P.one, sizeof(r->Z.v));
+}
+
+int sm2_point_to_affine(sm2_affine *r, const sm2_point *p){
+    if(sm2_fe_is_zero(&p->Z)) return -1;
+    sm2_fe zi, zi2, zi3;
+    sm2_fp_inv(&zi, &p->Z);
+    sm2_fp_sqr(&zi2, &zi);
+    sm2_fp_mul(&zi3, &zi2, &zi);
+    sm2_fp_mul(&r->x, &p->X, &zi2);
+    sm2_fp_mul(&r->y, &p->Y, &zi3);
+    return 0;
+}
+
+/* 批量转仿射：所有 Z 共用一次求逆。含无穷远点时对应输出置 0 并返回 -1 */
+int sm2_point_batch_to_affine(sm2_affine *out, const sm2_point *in, size_t n){
+    sm2_fe *z = malloc(2 * n * sizeof(sm2_fe));
+    if(!z) return -1;
+    int inf = 0;
+    for(size_t i=0;i<n;i++){
+        if(sm2_fe_is_zero(&in[i].Z)){ memcpy(z[i].v, SM2_P.one, sizeof(z[i].v)); inf = 1; }
+        else z[i] = in[i].Z;
+    }
+    sm2_fp_batch_inv(z, z, n, z + n);
+    for(size_t i=0;i<n;i++){
+        if(sm2_fe_is_zero(&in[i].Z)){ memset(&out[i], 0, sizeof(out[i])); continue; }
+        sm2_fe zi2, zi3;
+        sm2_fp_sqr(&zi2, &z[i]);
+        sm2_fp_mul(&zi3, &zi2, &z[i]);
+        sm2_fp_mul(&out[i].x, &in[i].X, &zi2);
+        sm2_fp_mul(&out[i].y, &in[i].Y, &zi3);
+    }
+    free(z);
+    return inf ? -1 : 0;
+}
+
+/* dbl-2007-bl（a 为一般值）；Z=0 时结果仍为 Z=0 */
+void sm2_point_double(sm2_point *r, const sm2_point *p){
+    sm2_fe XX, YY, YYYY, ZZ, S, M, T, t0, t1;
+    sm2_fp_sqr(&XX, &p->X);
+    sm2_fp_sqr(&YY, &p->Y);
+    sm2_fp_sqr(&YYYY, &YY);
+    sm2_fp_sqr(&ZZ, &p->Z);
+    sm2_fp_add(&t0, &p->X, &YY);
+    sm2_fp_sqr(&t0, &t0);
+    sm2_fp_sub(&t0, &t0, &XX);
+    sm2_fp_sub(&t0, &t0, &YYYY);
+    sm2_fp_add(&S, &t0, &t0);                 // S = 2((X+YY)^2-XX-YYYY)
+    sm2_fp_sqr(&t0, &ZZ);
+    sm2_fp_mul(&t0, &t0, &SM2_A_MONT);
+    sm2_fp_add(&M, &XX, &XX);
+    sm2_fp_add(&M, &M, &XX);
+    sm2_fp_add(&M, &M, &t0);                  // M = 3XX + a·ZZ^2
+    sm2_fp_sqr(&T, &M);
+    sm2_fp_sub(&T, &T, &S);
+    sm2_fp_sub(&T, &T, &S);                   // T = M^2 - 2S
+    sm2_fp_add(&t1, &p->Y, &p->Z);
+    sm2_fp_sqr(&t1, &t1);
+    sm2_fp_sub(&t1, &t1, &YY);
+    sm2_fp_sub(&r->Z, &t1, &ZZ);              // Z3 = (Y+Z)^2 - YY - ZZ
+    sm2_fp_sub(&t0, &S, &T);
+    sm2_fp_mul(&t0, &M, &t0);
+    sm2_fp_add(&YYYY, &YYYY, &YYYY);
+    sm2_fp_add(&YYYY, &YYYY, &YYYY);
+    sm2_fp_add(&YYYY, &YYYY, &YYYY);
+    sm2_fp_sub(&r->Y, &t0, &YYYY);            // Y3 = M(S-T) - 8YYYY
+    r->X = T;
+}
+
+/* add-2007-bl；处理无穷远点与 P == ±Q */
+void sm2_point_add(sm2_point *r, const sm2_point *p, const sm2_point *q){
+    if(sm2_fe_is_zero(&p->Z)){ *r = *q; return; }
+    if(sm2_fe_is_zero(&q->Z)){ *r = *p; return; }
+    sm2_fe Z1Z1, Z2Z2, U1, U2, S1, S2, H, I, J, R, V, t0;
+    sm2_fp_sqr(&Z1Z1, &p->Z);
+    sm2_fp_sqr(&Z2Z2, &q->Z);
+    sm2_fp_mul(&U1, &p->X, &Z2Z2);
+    sm2_fp_mul(&U2, &q->X, &Z1Z1);
+    sm2_fp_mul(&S1, &p->Y, &q->Z);
+    sm2_fp_mul(&S1, &S1, &Z2Z2);
+    sm2_fp_mul(&S2, &q->Y, &p->Z);
+    sm2_fp_mul(&S2, &S2, &Z1Z1);
+    sm2_fp_sub(&H, &U2, &U1);
+    sm2_fp_sub(&R, &S2, &S1);
+    if(sm2_fe_is_zero(&H)){
+        if(sm2_fe_is_zero(&R)){ sm2_point_double(r, p); return; }
+        memset(r, 0, sizeof(*r));
+        return;
+    }
+    sm2_fp_add(&I, &H, &H);
+    sm2_fp_sqr(&I, &I);
+    sm2_fp_mul(&J, &H, &I);
+    sm2_fp_add(&R, &R, &R);
+    sm2_fp_mul(&V, &U1, &I);
+    sm2_fp_add(&t0, &p->Z, &q->Z);
+    sm2_fp_sqr(&t0, &t0);
+    sm2_fp_sub(&t0, &t0, &Z1Z1);
+    sm2_fp_sub(&t0, &t0, &Z2Z2);
+    sm2_fp_mul(&r->Z, &t0, &H);
+    sm2_fp_sqr(&t0, &R);
+    sm2_fp_sub(&t0, &t0, &J);
+    sm2_fp_sub(&t0, &t0, &V);
+    sm2_fp_sub(&t0, &t0, &V);                 // X3 = r^2 - J - 2V
+    sm2_fp_sub(&V, &V, &t0);
+    sm2_fp_mul(&V, &R, &V);
+    sm2_fp_mul(&S1, &S1, &J);
+    sm2_fp_add(&S1, &S1, &S1);
+    sm2_fp_sub(&r->Y, &V, &S1);               // Y3 = r(V-X3) - 2·S1·J
+    r->X = t0;
+}
+
+/* madd-2007-bl：q 为仿射点 */
+void sm2_point_add_affine(sm2_point *r, const sm2_point *p, const sm2_affine *q){
+    if(sm2_fe_is_zero(&p->Z)){ sm2_point_from_affine(r, q); return; }
+    sm2_fe Z1Z1, U2, S2, H, HH, I, J, R, V, t0;
+    sm2_fp_sqr(&Z1Z1, &p->Z);
+    sm2_fp_mul(&U2, &q->x, &Z1Z1);
+    sm2_fp_mul(&S2, &q->y, &p->Z);
+    sm2_fp_mul(&S2, &S2, &Z1Z1);
+    sm2_fp_sub(&H, &U2, &p->X);
+    sm2_fp_sub(&R, &S2, &p->Y);
+    if(sm2_fe_is_zero(&H)){
+        if(sm2_fe_is_zero(&R)){ sm2_point_double(r, p); return; }
+        memset(r, 0, sizeof(*r));
+        return;
+    }
+    sm2_fp_sqr(&HH, &H);
+    sm2_fp_add(&I, &HH, &HH);
+    sm2_fp_add(&I, &I, &I);
+    sm2_fp_mul(&J, &H, &I);
+    sm2_fp_add(&R, &R, &R);
+    sm2_fp_mul(&V, &p->X, &I);
+    sm2_fp_add(&t0, &p->Z, &H);
+    sm2_fp_sqr(&t0, &t0);
+    sm2_fp_sub(&t0, &t0, &Z1Z1);
+    sm2_fp_sub(&r->Z, &t0, &HH);              // Z3 = (Z1+H)^2 - Z1Z1 - HH
+    sm2_fe Y1J;
+    sm2_fp_mul(&Y1J, &p->Y, &J);
+    sm2_fp_sqr(&t0, &R);
+    sm2_fp_sub(&t0, &t0, &J);
+    sm2_fp_sub(&t0, &t0, &V);
+    sm2_fp_sub(&t0, &t0, &V);
+    sm2_fp_sub(&V, &V, &t0);
+    sm2_fp_mul(&V, &R, &V);
+    sm2_fp_add(&Y1J, &Y1J, &Y1J);
+    sm2_fp_sub(&r->Y, &V, &Y1J);
+    r->X = t0;
+}
+
+int sm2_affine_on_curve(const sm2_affine *a){
+    sm2_fe y2, rhs, t;
+    sm2_fp_sqr(&y2, &a->y);
+    sm2_fp_sqr(&t, &a->x);
+    sm2_fp_add(&t, &t, &SM2_A_MONT);
+    sm2_fp_mul(&rhs, &t, &a->x);
+    sm2_fp_add(&rhs, &rhs, &SM2_B_MONT);     // x^3 + ax + b
+    return sm2_fe_equal(&y2, &rhs);
+}
+
+int sm2_affine_from_bytes(sm2_affine *r, const uint8_t in[64]){
+    sm2_fe x, y;
+    sm2_fe_from_bytes(&x, in);
+    sm2_fe_from_bytes(&y, in + 32);
+    if(!lt_mod(x.v, &SM2_P) || !lt_mod(y.v, &SM2_P)) return -1;
+    sm2_fp_to_mont(&r->x, &x);
+    sm2_fp_to_mont(&r->y, &y);
+    return sm2_affine_on_curve(r) ? 0 : -1;
+}
+
+int sm2_affine_from_x(sm2_affine *r, const sm2_fe *x, int y_odd){
+    sm2_fe xm, rhs, t, zero = {{ 0 }};
+    if(!lt_mod(x->v, &SM2_P)) return -1;
+    sm2_fp_to_mont(&xm, x);
+    sm2_fp_sqr(&t, &xm);
+    sm2_fp_add(&t, &t, &SM2_A_MONT);
+    sm2_fp_mul(&rhs, &t, &xm);
+    sm2_fp_add(&rhs, &rhs, &SM2_B_MONT);
+    if(sm2_fp_sqrt(&r->y, &rhs) != 0) return -1;
+    sm2_fp_from_mont(&t, &r->y);
+    if((int)(t.v[0] & 1) != (y_odd & 1)) sm2_fp_sub(&r->y, &zero, &r->y);
+    r->x = xm;
+    return 0;
+}
+
+void sm2_affine_to_bytes(uint8_t out[64], const sm2_affine *a){
+    sm2_fe t;
+    sm2_fp_from_mont(&t, &a->x);
+    sm2_fe_to_bytes(out, &t);
+    sm2_fp_from_mont(&t, &a->y);
+    sm2_fe_to_bytes(out + 32, &t);
+}
+
+/* ---------------- HMAC-SM3 与确定性 k ---------------- */
+
+typedef struct { sm3_ctx in, out; } hmac_sm3_ctx;
+
+static void hmac_sm3_init(hmac_sm3_ctx *h, const uint8_t key[32]){
+    uint8_t ipad[64], opad[64];
+    for(int i=0;i<64;i++){
+        uint8_t k = i < 32 ? key[i] : 0;
+        ipad[i] = k ^ 0x36; opad[i] = k ^ 0x5c;
+    }
+    sm3_init(&h->in);  sm3_update(&h->in, ipad, 64);
+    sm3_init(&h->out); sm3_update(&h->out, opad, 64);
+}
+
+static void hmac_sm3_final(hmac_sm3_ctx *h, uint8_t out[32]){
+    uint8_t inner[32];
+    sm3_final(&h->in, inner);
+    sm3_update(&h->out, inner, 32);
+    sm3_final(&h->out, out);
+}
+
+/* 与 sm2_basic.rfc6979_k() 相同的 HMAC-DRBG；K、V 由调用方保存以便重试 */
+static void rfc6979_init(uint8_t K[32], uint8_t V[32], const uint8_t bx[32], const uint8_t h1[32]){
+    hmac_sm3_ctx h;
+    memset(V, 0x01, 32);
+    memset(K, 0x00, 32);
+    for(uint8_t sep = 0; sep < 2; sep++){
+        hmac_sm3_init(&h, K);
+        sm3_update(&h.in, V, 32);
+        sm3_update(&h.in, &sep, 1);
+        sm3_update(&h.in, bx, 32);
+        sm3_update(&h.in, h1, 32);
+        hmac_sm3_final(&h, K);
+        hmac_sm3_init(&h, K); sm3_update(&h.in, V, 32); hmac_sm3_final(&h, V);
+    }
+}
+
+static void rfc6979_next(uint8_t K[32], uint8_t V[32], uint8_t T[32]){
+    hmac_sm3_ctx h;
+    hmac_sm3_init(&h, K); sm3_update(&h.in, V, 32); hmac_sm3_final(&h, V);
+    memcpy(T, V, 32);
+}
+
+static void rfc6979_retry(uint8_t K[32], uint8_t V[32]){
+    hmac_sm3_ctx h;
+    uint8_t zero = 0;
+    hmac_sm3_init(&h, K); sm3_update(&h.in, V, 32); sm3_update(&h.in, &zero, 1); hmac_sm3_final(&h, K);
+    hmac_sm3_init(&h, K); sm3_update(&h.in, V, 32); hmac_sm3_final(&h, V);
+}
+
+/* ---------------- 签名 / 验签 ---------------- */
+
+int sm2_keygen(const uint8_t d[32], uint8_t pub[64]){
+    sm2_fe k, nm2 = {{ SM2_N.m[0] - 1, SM2_N.m[1], SM2_N.m[2], SM2_N.m[3] }};
+    sm2_fe_from_bytes(&k, d);
+    // 1 <= d <= n-2，保证 1+d 可逆
+    if(sm2_fe_is_zero(&k) || !lt_mod(k.v, &SM2_N) || sm2_fe_equal(&k, &nm2)) return -1;
+    sm2_point P;
+    sm2_affine A;
+    sm2_point_mul_g(&P, &k);
+    sm2_point_to_affine(&A, &P);
+    sm2_affine_to_bytes(pub, &A);
+    return 0;
+}
+
+void sm2_compute_za(const uint8_t *id, size_t idlen, const uint8_t pub[64], uint8_t za[32]){
+    uint8_t entl[2] = { (uint8_t)((idlen*8) >> 8), (uint8_t)(idlen*8) };
+    sm3_ctx c;
+    sm3_init(&c);
+    sm3_update(&c, entl, 2);
+    sm3_update(&c, id, idlen);
+    sm3_update(&c, SM2_ABG_BYTES, sizeof(SM2_ABG_BYTES));
+    sm3_update(&c, pub, 64);
+    sm3_final(&c, za);
+}
+
+void sm2_compute_e(const uint8_t za[32], const uint8_t *msg, size_t len, uint8_t e[32]){
+    sm3_ctx c;
+    sm3_init(&c);
+    sm3_update(&c, za, 32);
+    sm3_update(&c, msg, len);
+    sm3_final(&c, e);
+}
+
+int sm2_sign_digest(const uint8_t d[32], const uint8_t e[32], uint8_t sig[64]){
+    return sm2_sign_digest_recid(d, e, sig, NULL);
+}
+
+int sm2_sign_digest_recid(const uint8_t d[32], const uint8_t e[32], uint8_t sig[64], int *recid){
+    sm2_fe dk, en, nm2 = {{ SM2_N.m[0] - 1, SM2_N.m[1], SM2_N.m[2], SM2_N.m[3] }};
+    sm2_fe_from_bytes(&dk, d);
+    if(sm2_fe_is_zero(&dk) || !lt_mod(dk.v, &SM2_N) || sm2_fe_equal(&dk, &nm2)) return -1;
+    sm2_fe_from_bytes(&en, e);
+    sm2_fn_reduce(&en, &en);
+
+    // (1+d)^{-1}
+    sm2_fe dm, one_m, inv1d;
+    sm2_fn_to_mont(&dm, &dk);
+    memcpy(one_m.v, SM2_N.one, sizeof(one_m.v));
+    sm2_fn_add(&inv1d, &one_m, &dm);
+    sm2_fn_inv(&inv1d, &inv1d);
+
+    uint8_t K[32], V[32], T[32];
+    rfc6979_init(K, V, d, e);
+    for(;;){
+        sm2_fe k, x1, r, s, km, rm, t;
+        rfc6979_next(K, V, T);
+        sm2_fe_from_bytes(&k, T);
+        sm2_fn_reduce(&k, &k);                  // k = T mod n
+        if(sm2_fe_is_zero(&k)){ rfc6979_retry(K, V); continue; }
+
+        sm2_point P;
+        sm2_affine A;
+        sm2_point_mul_g(&P, &k);
+        sm2_point_to_affine(&A, &P);
+        sm2_fp_from_mont(&x1, &A.x);
+        int over = !lt_mod(x1.v, &SM2_N);
+        sm2_fn_reduce(&x1, &x1);
+        sm2_fn_add(&r, &en, &x1);               // 普通形式下的模加同样成立
+        sm2_fn_add(&t, &r, &k);
+        if(sm2_fe_is_zero(&r) || sm2_fe_is_zero(&t)){ rfc6979_retry(K, V); continue; }
+
+        // s = (1+d)^{-1}·(k - r·d)
+        sm2_fn_to_mont(&km, &k);
+        sm2_fn_to_mont(&rm, &r);
+        sm2_fn_mul(&t, &rm, &dm);
+        sm2_fn_sub(&t, &km, &t);
+        sm2_fn_mul(&s, &inv1d, &t);
+        sm2_fn_from_mont(&s, &s);
+        if(sm2_fe_is_zero(&s)){ rfc6979_retry(K, V); continue; }
+
+        sm2_fe_to_bytes(sig, &r);
+        sm2_fe_to_bytes(sig + 32, &s);
+        if(recid){
+            sm2_fe y1;
+            sm2_fp_from_mont(&y1, &A.y);
+            *recid = (int)(y1.v[0] & 1) | over << 1;
+        }
+        return 0;
+    }
+}
+
+int sm2_sign(const uint8_t d[32], const uint8_t pub[64], const uint8_t *id, size_t idlen,
+             const uint8_t *msg, size_t len, uint8_t sig[64]){
+    uint8_t za[32], e[32];
+    sm2_compute_za(id, idlen, pub, za);
+    sm2_compute_e(za, msg, len, e);
+    return sm2_sign_digest(d, e, sig);
+}
+
+int sm2_verify_setup(const uint8_t pub[64], const uint8_t e[32], const uint8_t sig[64],
+                     sm2_affine *P, sm2_fe *s, sm2_fe *t, sm2_fe *x1){
+    sm2_fe r, en;
+    sm2_fe_from_bytes(&r, sig);
+    sm2_fe_from_bytes(s, sig + 32);
+    if(sm2_fe_is_zero(&r) || !lt_mod(r.v, &SM2_N)) return -1;
+    if(sm2_fe_is_zero(s) || !lt_mod(s->v, &SM2_N)) return -1;
+    if(sm2_affine_from_bytes(P, pub) != 0) return -1;
+    sm2_fn_add(t, &r, s);
+    if(sm2_fe_is_zero(t)) return -1;
+    sm2_fe_from_bytes(&en, e);
+    sm2_fn_reduce(&en, &en);
+    sm2_fn_sub(x1, &r, &en);                    // x1 mod n
+    return 0;
+}
+
+/* 不求逆，直接检查 X == x1·Z^2，其中 x1 ∈ {r-e, r-e+n} */
+int sm2_verify_check_x(const sm2_point *Q, const sm2_fe *x1){
+    sm2_fe zz, c, cm;
+    if(sm2_fe_is_zero(&Q->Z)) return 0;
+    sm2_fp_sqr(&zz, &Q->Z);
+    for(int pass=0;pass<2;pass++){
+        if(pass){
+            // x1 + n 仅当其仍 < p
+            unsigned char cy = 0;
+            for(int j=0;j<4;j++) cy = _addcarry_u64(cy, x1->v[j], SM2_N.m[j], (unsigned long long*)&c.v[j]);
+            if(cy || !lt_mod(c.v, &SM2_P)) break;
+        }else c = *x1;
+        sm2_fp_to_mont(&cm, &c);
+        sm2_fp_mul(&cm, &cm, &zz);
+        if(sm2_fe_equal(&cm, &Q->X)) return 1;
+    }
+    return 0;
+}
+
+int sm2_verify_recover_r(sm2_affine *R, const sm2_fe *x1, int recid){
+    sm2_fe x = *x1;
+    if(recid < 0 || recid > 3) return -1;
+    if(recid & 2){
+        unsigned char cy = 0;
+        for(int j=0;j<4;j++) cy = _addcarry_u64(cy, x.v[j], SM2_N.m[j], (unsigned long long*)&x.v[j]);
+        if(cy) return -1;
+    }
+    return sm2_affine_from_x(R, &x, recid & 1);
+}
+
+int sm2_verify_digest(const uint8_t pub[64], const uint8_t e[32], const uint8_t sig[64]){
+    sm2_fe s, t, x1;
+    sm2_affine P;
+    sm2_point Q;
+    if(sm2_verify_setup(pub, e, sig, &P, &s, &t, &x1) != 0) return 0;
+    sm2_point_mul2_vartime(&Q, &s, &t, &P);     // (x1, y1) = s·G + t·P
+    return sm2_verify_check_x(&Q, &x1);
+}
+
+int sm2_verify(const uint8_t pub[64], const uint8_t *id, size_t idlen,
+               const uint8_t *msg, size_t len, const uint8_t sig[64]){
+    uint8_t za[32], e[32];
+    sm2_compute_za(id, idlen, pub, za);
+    sm2_compute_e(za, msg, len, e);
+    return sm2_verify_digest(pub, e, sig);
+}
@@ -0,0 +1,127 @@
+// sm2.h
+#ifndef SM2_H
+#define SM2_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  SM2 签名/验签（原生实现），曲线参数与 Project5/sm2_basic.py 完全相同：
+    p = 8542D69E 4C044F18 E8B92435 BF6FF7DE 45728391 5C45517D 722EDB8B 08F1DFC3
+    n = 8542D69E 4C044F18 E8B92435 BF6FF7DD 29772063 0485628D 5AE74EE7 C32E79B7
+  字节接口一律大端：私钥 d 32 字节，公钥 x||y 64 字节，签名 r||s 64 字节。
+  确定性签名的 k 与 Python 版 rfc6979_k()（HMAC-SM3）逐字节一致。
+*/
+
+/* ---------------- 字节接口 ---------------- */
+
+/* d ∈ [1, n-2]，输出 P = dG。成功返回 0 */
+int  sm2_keygen(const uint8_t d[32], uint8_t pub[64]);
+
+/* Z_A = SM3(ENTL || ID || a || b || Gx || Gy || Px || Py)，ID 不超过 8191 字节 */
+void sm2_compute_za(const uint8_t *id, size_t idlen, const uint8_t pub[64], uint8_t za[32]);
+/* e = SM3(Z_A || M) */
+void sm2_compute_e(const uint8_t za[32], const uint8_t *msg, size_t len, uint8_t e[32]);
+
+/* 确定性签名。成功返回 0 */
+int  sm2_sign(const uint8_t d[32], const uint8_t pub[64], const uint8_t *id, size_t idlen,
+              const uint8_t *msg, size_t len, uint8_t sig[64]);
+int  sm2_sign_digest(const uint8_t d[32], const uint8_t e[32], uint8_t sig[64]);
+/* 同上，另输出 recid = (y1 & 1) | (x1 >= n) << 1，其中 (x1, y1) = kG；供批量验签恢复 R */
+int  sm2_sign_digest_recid(const uint8_t d[32], const uint8_t e[32], uint8_t sig[64], int *recid);
+
+/* 验签：通过返回 1，否则 0 */
+int  sm2_verify(const uint8_t pub[64], const uint8_t *id, size_t idlen,
+                const uint8_t *msg, size_t len, const uint8_t sig[64]);
+int  sm2_verify_digest(const uint8_t pub[64], const uint8_t e[32], const uint8_t sig[64]);
+
+/* ---------------- 批量验签（sm2_batch.c） ----------------
+   带 recid 的条目先按随机线性组合合并成一次多标量乘法检查：
+     Σ z_i·(s_i·G + t_i·P_i − R_i) == O，z_i 为 128 位随机数
+   合并检查失败时二分定位，规模足够小后逐条验证；不带 recid（填 -1）的条目直接逐条验证，
+   逐条路径里每个公钥的奇数倍点表用联合求逆一次性转成仿射坐标。
+   结果与逐条调用 sm2_verify_digest 完全一致。 */
+typedef struct {
+    const uint8_t *pub;     // 64 字节 x||y
+    const uint8_t *e;       // 32 字节摘要 SM3(Z_A || M)
+    const uint8_t *sig;     // 64 字节 r||s
+    int recid;              // sm2_sign_digest_recid 的输出；未知填 -1
+} sm2_batch_item;
+
+/* ok[i] = 1/0，返回通过的条数；nthreads <= 1 时在调用线程内完成，否则用共享线程池 tp_default()
+   的前 nthreads 个 worker（不超过池大小） */
+size_t sm2_verify_batch(const sm2_batch_item *items, size_t n, uint8_t *ok, int nthreads);
+
+/* ---------------- 底层运算（供标量乘、批量验签等模块使用） ----------------
+   sm2_fe 是 4×64 位小端 limb。sm2_fp_* 在 Montgomery 域 (mod p) 上运算，
+   sm2_fn_* 在 Montgomery 域 (mod n) 上运算；标量乘使用的标量是普通整数形式。 */
+
+typedef struct { uint64_t v[4]; } sm2_fe;
+typedef struct { sm2_fe X, Y, Z; } sm2_point;   // Jacobian, Z=0 表示无穷远点
+typedef struct { sm2_fe x, y; } sm2_affine;     // 仿射坐标 (Montgomery 形式)
+
+extern const sm2_affine SM2_G;
+
+void sm2_fp_mul(sm2_fe *r, const sm2_fe *a, const sm2_fe *b);
+void sm2_fp_sqr(sm2_fe *r, const sm2_fe *a);
+void sm2_fp_add(sm2_fe *r, const sm2_fe *a, const sm2_fe *b);
+void sm2_fp_sub(sm2_fe *r, const sm2_fe *a, const sm2_fe *b);
+void sm2_fp_inv(sm2_fe *r, const sm2_fe *a);
+/* 平方根（p ≡ 3 mod 4），a 不是二次剩余时返回 -1 */
+int  sm2_fp_sqrt(sm2_fe *r, const sm2_fe *a);
+/* Montgomery 联合求逆：out[i] = 1/in[i]，in 不能含 0，scratch 至少 n 个元素；out 可与 in 相同 */
+void sm2_fp_batch_inv(sm2_fe *out, const sm2_fe *in, size_t n, sm2_fe *scratch);
+void sm2_fp_to_mont(sm2_fe *r, const sm2_fe *a);
+void sm2_fp_from_mont(sm2_fe *r, const sm2_fe *a);
+
+void sm2_fn_mul(sm2_fe *r, const sm2_fe *a, const sm2_fe *b);
+void sm2_fn_add(sm2_fe *r, const sm2_fe *a, const sm2_fe *b);
+void sm2_fn_sub(sm2_fe *r, const sm2_fe *a, const sm2_fe *b);
+void sm2_fn_inv(sm2_fe *r, const sm2_fe *a);
+void sm2_fn_to_mont(sm2_fe *r, const sm2_fe *a);
+void sm2_fn_from_mont(sm2_fe *r, const sm2_fe *a);
+/* 把任意 256 位整数约化到 [0, n) */
+void sm2_fn_reduce(sm2_fe *r, const sm2_fe *a);
+
+void sm2_fe_from_bytes(sm2_fe *r, const uint8_t in[32]);
+void sm2_fe_to_bytes(uint8_t out[32], const sm2_fe *a);
+int  sm2_fe_is_zero(const sm2_fe *a);
+int  sm2_fe_equal(const sm2_fe *a, const sm2_fe *b);
+
+void sm2_point_from_affine(sm2_point *r, const sm2_affine *a);
+int  sm2_point_to_affine(sm2_affine *r, const sm2_point *p);  // 无穷远点返回 -1
+/* n 个点共用一次求逆转成仿射坐标；含无穷远点时对应输出置 0 并返回 -1 */
+int  sm2_point_batch_to_affine(sm2_affine *out, const sm2_point *in, size_t n);
+void sm2_point_double(sm2_point *r, const sm2_point *p);
+void sm2_point_add(sm2_point *r, const sm2_point *p, const sm2_point *q);
+void sm2_point_add_affine(sm2_point *r, const sm2_point *p, const sm2_affine *q);
+int  sm2_affine_on_curve(const sm2_affine *a);
+
+/* 标量乘（sm2_mul.c），标量均为普通整数形式且 < n */
+/* R = k·G，固定基 comb 预计算表，常量时间 */
+void sm2_point_mul_g(sm2_point *r, const sm2_fe *k);
+/* R = k·P，常量时间窗口法，用于私钥/秘密标量 */
+void sm2_point_mul(sm2_point *r, const sm2_fe *k, const sm2_affine *p);
+/* R = s·G + t·P，wNAF + Straus 交错，非常量时间，只能用于公开数据 */
+void sm2_point_mul2_vartime(sm2_point *r, const sm2_fe *s, const sm2_fe *t, const sm2_affine *p);
+/* 同上，P 的奇数倍点表 P, 3P, ..., 15P 已由调用方给出（仿射坐标） */
+#define SM2_WNAF_P_TABLE 8
+void sm2_point_odd_multiples(sm2_point tab[SM2_WNAF_P_TABLE], const sm2_affine *p);
+void sm2_point_mul2_vartime_tab(sm2_point *r, const sm2_fe *s, const sm2_fe *t,
+                                const sm2_affine tab[SM2_WNAF_P_TABLE]);
+
+/* 公钥字节 <-> 仿射点；坐标越界或不在曲线上返回 -1 */
+int  sm2_affine_from_bytes(sm2_affine *r, const uint8_t in[64]);
+/* 由普通形式的 x 与 y 的奇偶位解压点；x >= p 或无对应 y 返回 -1 */
+int  sm2_affine_from_x(sm2_affine *r, const sm2_fe *x, int y_odd);
+
+/* 验签拆成两步，供批量验签复用：
+   sm2_verify_setup 检查 r、s 与公钥，算出 t = r+s 与 x1 = (r-e) mod n，失败返回 -1；
+   sm2_verify_check_x 检查 Jacobian 点 Q 的 x 坐标模 n 是否等于 x1 */
+int  sm2_verify_setup(const uint8_t pub[64], const uint8_t e[32], const uint8_t sig[64],
+                      sm2_affine *P, sm2_fe *s, sm2_fe *t, sm2_fe *x1);
+int  sm2_verify_check_x(const sm2_point *Q, const sm2_fe *x1);
+/* 由 x1 与 recid 恢复 R = (x1 或 x1+n, y1)，失败返回 -1 */
+int  sm2_verify_recover_r(sm2_affine *R, const sm2_fe *x1, int recid);
+void sm2_affine_to_bytes(uint8_t out[64], const sm2_affine *a);
+
+#endif
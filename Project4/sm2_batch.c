@@ -0,0 +1,261 @@
+// sm2_batch.c
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <sys/random.h>
+#include "sm3.h"
+#include "sm2.h"
+#include "thread_pool.h"
+
+/*
+  批量验签：
+    1. 逐条检查 r、s、公钥，带 recid 的条目由 x1 与 y 奇偶位解压出 R = (x1, y1)；
+    2. 每 BATCH_CHUNK 条做一次合并检查
+         (Σ z_i·s_i)·G + Σ (z_i·t_i)·P_i + Σ z_i·(−R_i) == O
+       z_i 为 128 位随机数，多标量乘法用 Pippenger 桶方法；
+    3. 合并组的大小按结果自适应：通过则翻倍（上限 BATCH_CHUNK）；失败则缩到 1/4 后
+       从同一位置重试，相当于四分定位；最小组（BATCH_MIN_COMBINED）仍失败就逐条验证，
+       并且之后的若干条直接逐条验证再重新试探，连续失败时退避长度翻倍
+       （BATCH_BACKOFF 到 BATCH_BACKOFF_MAX）。坏签名很密时总开销只比逐条验签略多；
+    4. 逐条验证每 SINGLE_BLOCK 条一组，P 的奇数倍点表共用一次求逆转成仿射坐标。
+  多线程时由共享线程池（thread_pool.c）按块分发并窃取，自适应状态与工作缓冲按 worker 各一份，
+  缓冲由 worker 自己分配，落在它所在的 NUMA 节点上。
+  合并检查通过即说明每条都满足 s_i·G + t_i·P_i = R_i，而 R_i 的 x 坐标正是 r_i − e_i，因此结果与逐条验签一致。
+*/
+
+#define BATCH_CHUNK        1024
+#define BATCH_MIN_COMBINED 64
+#define BATCH_BACKOFF      256
+#define BATCH_BACKOFF_MAX  16384
+#define SINGLE_BLOCK       64
+
+typedef struct {
+    sm2_affine P, R;
+    sm2_fe s, t, x1;
+    int state;              // -1 格式错误，0 需逐条验证，1 可参与合并检查
+} prep_t;
+
+typedef struct {
+    const sm2_batch_item *items;
+    uint8_t *ok;
+    size_t base;            // 当前块首条的全局下标，prep/idx 都是块内下标
+    int use_combined;       // 取不到随机数时全部逐条验证
+    uint8_t seed[32];
+    uint32_t id;
+    uint64_t ctr;
+    size_t passed;
+    size_t group;           // 当前合并组大小
+    size_t backoff;         // 还要直接逐条验证的条数
+    size_t backoff_len;     // 下次退避的长度
+    prep_t *pr;             // 工作缓冲，该 worker 第一次领到块时分配
+    size_t *comb, *single;
+    int nomem;
+} worker_t;
+
+/* ---------------- 随机系数 z_i ---------------- */
+
+/* z = SM3(seed || worker id || ctr) 的前 16 字节 */
+static void next_z(worker_t *w, sm2_fe *z){
+    uint8_t buf[44], h[32];
+    memcpy(buf, w->seed, 32);
+    memcpy(buf + 32, &w->id, 4);
+    memcpy(buf + 36, &w->ctr, 8);
+    w->ctr++;
+    sm3_hash(buf, sizeof(buf), h);
+    memcpy(&z->v[0], h, 8);
+    memcpy(&z->v[1], h + 8, 8);
+    z->v[2] = z->v[3] = 0;
+    if((z->v[0] | z->v[1]) == 0) z->v[0] = 1;
+}
+
+/* ---------------- Pippenger 多标量乘法（非常量时间） ---------------- */
+
+static inline unsigned scalar_bits(const sm2_fe *k, int pos, int c){
+    int j = pos >> 6, o = pos & 63;
+    uint64_t v = k->v[j] >> o;
+    if(o + c > 64 && j < 3) v |= k->v[j+1] << (64 - o);
+    return (unsigned)(v & ((1u << c) - 1));
+}
+
+static int msm_window(size_t n){
+    int c = 0;
+    while(((size_t)1 << (c + 1)) <= n) c++;     // floor(log2 n)
+    c -= 3;
+    return c < 2 ? 2 : c > 12 ? 12 : c;
+}
+
+/* r = Σ sc[i]·pts[i]，标量为普通形式 */
+static int msm(sm2_point *r, const sm2_affine *pts, const sm2_fe *sc, size_t n){
+    int c = msm_window(n), nb = (1 << c) - 1;
+    sm2_point *bk = malloc((size_t)nb * sizeof(sm2_point));
+    if(!bk) return -1;
+    sm2_point acc, run, sum;
+    memset(&acc, 0, sizeof(acc));
+    for(int w=(256 + c - 1)/c - 1; w>=0; w--){
+        if(!sm2_fe_is_zero(&acc.Z)) for(int j=0;j<c;j++) sm2_point_double(&acc, &acc);
+        memset(bk, 0, (size_t)nb * sizeof(sm2_point));
+        int bits = 256 - w*c < c ? 256 - w*c : c;
+        for(size_t i=0;i<n;i++){
+            unsigned d = scalar_bits(&sc[i], w*c, bits);
+            if(d) sm2_point_add_affine(&bk[d-1], &bk[d-1], &pts[i]);
+        }
+        // Σ d·B_d = 从高到低累加的前缀和之和
+        memset(&run, 0, sizeof(run));
+        memset(&sum, 0, sizeof(sum));
+        for(int d=nb-1; d>=0; d--){
+            sm2_point_add(&run, &run, &bk[d]);
+            sm2_point_add(&sum, &sum, &run);
+        }
+        sm2_point_add(&acc, &acc, &sum);
+    }
+    free(bk);
+    *r = acc;
+    return 0;
+}
+
+/* ---------------- 合并检查与逐条验证 ---------------- */
+
+static int combined_check(worker_t *w, const prep_t *pr, const size_t *idx, size_t m){
+    size_t n = 2*m + 1;
+    sm2_affine *pts = malloc(n * sizeof(sm2_affine));
+    sm2_fe *sc = malloc(n * sizeof(sm2_fe));
+    if(!pts || !sc){ free(pts); free(sc); return 0; }
+    sm2_fe a0 = {{ 0 }}, zero = {{ 0 }}, z, zm, t;
+    for(size_t j=0;j<m;j++){
+        const prep_t *p = &pr[idx[j]];
+        next_z(w, &z);
+        sm2_fn_to_mont(&zm, &z);
+        sm2_fn_mul(&t, &zm, &p->s);             // 一侧为 Montgomery 形式，乘积回到普通形式
+        sm2_fn_add(&a0, &a0, &t);
+        sm2_fn_mul(&sc[1 + j], &zm, &p->t);
+        pts[1 + j] = p->P;
+        sc[1 + m + j] = z;
+        pts[1 + m + j].x = p->R.x;
+        sm2_fp_sub(&pts[1 + m + j].y, &zero, &p->R.y);
+    }
+    pts[0] = SM2_G;
+    sc[0] = a0;
+    sm2_point r;
+    int ok = msm(&r, pts, sc, n) == 0 && sm2_fe_is_zero(&r.Z);
+    free(pts);
+    free(sc);
+    return ok;
+}
+
+static void verify_single(worker_t *w, const prep_t *pr, const size_t *idx, size_t m){
+    sm2_point jt[SINGLE_BLOCK * SM2_WNAF_P_TABLE], Q;
+    sm2_affine at[SINGLE_BLOCK * SM2_WNAF_P_TABLE];
+    for(size_t b=0;b<m;b+=SINGLE_BLOCK){
+        size_t cnt = m - b < SINGLE_BLOCK ? m - b : SINGLE_BLOCK;
+        for(size_t j=0;j<cnt;j++) sm2_point_odd_multiples(&jt[j * SM2_WNAF_P_TABLE], &pr[idx[b + j]].P);
+        sm2_point_batch_to_affine(at, jt, cnt * SM2_WNAF_P_TABLE);
+        for(size_t j=0;j<cnt;j++){
+            const prep_t *p = &pr[idx[b + j]];
+            sm2_point_mul2_vartime_tab(&Q, &p->s, &p->t, &at[j * SM2_WNAF_P_TABLE]);
+            int v = sm2_verify_check_x(&Q, &p->x1);
+            w->ok[w->base + idx[b + j]] = (uint8_t)v;
+            w->passed += (size_t)v;
+        }
+    }
+}
+
+/* ---------------- 预处理 ---------------- */
+
+static void prepare(const sm2_batch_item *it, prep_t *p, int use_combined){
+    if(sm2_verify_setup(it->pub, it->e, it->sig, &p->P, &p->s, &p->t, &p->x1) != 0){ p->state = -1; return; }
+    p->state = 0;
+    if(!use_combined || it->recid < 0 || it->recid > 3) return;
+    if(sm2_verify_recover_r(&p->R, &p->x1, it->recid) == 0) p->state = 1;
+}
+
+/* 处理 [lo, hi)，不超过 BATCH_CHUNK 条 */
+static void verify_range(void *arg, size_t lo, size_t hi, int worker){
+    worker_t *w = &((worker_t*)arg)[worker];
+    if(!w->pr && !w->nomem){
+        w->pr = malloc(BATCH_CHUNK * sizeof(prep_t));
+        w->comb = malloc(BATCH_CHUNK * sizeof(size_t));
+        w->single = malloc(BATCH_CHUNK * sizeof(size_t));
+        if(!w->pr || !w->comb || !w->single){
+            free(w->pr); free(w->comb); free(w->single);
+            w->pr = NULL; w->comb = w->single = NULL;
+            w->nomem = 1;
+        }
+    }
+    if(w->nomem){
+        // 内存不足时退回逐条验签
+        for(size_t i=lo;i<hi;i++){
+            const sm2_batch_item *it = &w->items[i];
+            w->ok[i] = (uint8_t)sm2_verify_digest(it->pub, it->e, it->sig);
+            w->passed += w->ok[i];
+        }
+        return;
+    }
+    prep_t *pr = w->pr;
+    size_t *comb = w->comb, *single = w->single;
+    size_t base = lo, cnt = hi - lo, nc = 0, ns = 0;
+    w->base = base;
+    for(size_t i=0;i<cnt;i++){
+        prepare(&w->items[base + i], &pr[i], w->use_combined);
+        if(pr[i].state < 0) w->ok[base + i] = 0;
+        else if(pr[i].state == 0) single[ns++] = i;
+        else comb[nc++] = i;
+    }
+    for(size_t g=0; g<nc; ){
+        size_t len = nc - g < w->group ? nc - g : w->group;
+        if(w->backoff || len < BATCH_MIN_COMBINED){
+            if(w->backoff){
+                len = nc - g < w->backoff ? nc - g : w->backoff;
+                w->backoff -= len;
+            }
+            verify_single(w, pr, comb + g, len);
+        }else if(combined_check(w, pr, comb + g, len)){
+            for(size_t j=0;j<len;j++) w->ok[base + comb[g + j]] = 1;
+            w->passed += len;
+            if(w->group < BATCH_CHUNK) w->group *= 2;
+            w->backoff_len = BATCH_BACKOFF;
+        }else if(w->group > BATCH_MIN_COMBINED){
+            // 缩小组后从同一位置重试
+            w->group = w->group / 4 < BATCH_MIN_COMBINED ? BATCH_MIN_COMBINED : w->group / 4;
+            continue;
+        }else{
+            verify_single(w, pr, comb + g, len);
+            w->backoff = w->backoff_len;
+            if(w->backoff_len < BATCH_BACKOFF_MAX) w->backoff_len *= 2;
+        }
+        g += len;
+    }
+    verify_single(w, pr, single, ns);
+}
+
+size_t sm2_verify_batch(const sm2_batch_item *items, size_t n, uint8_t *ok, int nthreads){
+    if(n == 0) return 0;
+    if(nthreads < 1) nthreads = 1;
+    if((size_t)nthreads > n) nthreads = (int)n;
+
+    uint8_t seed[32];
+    int use_combined = getrandom(seed, sizeof(seed), 0) == (ssize_t)sizeof(seed);
+
+    worker_t *ws = calloc((size_t)nthreads, sizeof(worker_t));
+    if(!ws){ memset(ok, 0, n); return 0; }
+    for(int i=0;i<nthreads;i++){
+        ws[i].items = items;
+        ws[i].ok = ok;
+        ws[i].use_combined = use_combined;
+        memcpy(ws[i].seed, seed, 32);
+        ws[i].id = (uint32_t)i;
+        ws[i].group = BATCH_CHUNK;
+        ws[i].backoff_len = BATCH_BACKOFF;
+    }
+    // 条数不多时块也相应变小，让每个线程都分到活
+    size_t grain = (n + (size_t)nthreads - 1) / (size_t)nthreads;
+    if(grain > BATCH_CHUNK) grain = BATCH_CHUNK;
+    tp_parallel_for(nthreads > 1 ? tp_default() : NULL, nthreads, n, grain, verify_range, ws);
+    size_t passed = 0;
+    for(int i=0;i<nthreads;i++){
+        passed += ws[i].passed;
+        free(ws[i].pr); free(ws[i].comb); free(ws[i].single);
+    }
+    memset(seed, 0, sizeof(seed));
+    free(ws);
+    return passed;
+}
@@ -0,0 +1,117 @@
+// sm2_demo.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "sm2.h"
+
+/*
+  用法:
+    ./sm2_demo                      已知答案测试 + 性能测试
+    ./sm2_demo kat <d_hex> <id> <msg>
+        输出 "pub_hex sig_hex verify"，供 Project5/sm2_crosscheck.py 与 Python 版逐项比对
+*/
+
+/* 由 Project5/sm2_basic.py 生成：d 固定，ID="User"，M="hello sm2"，deterministic=True */
+static const char *KAT_D   = "3945208f7b2144b13f36e38ac6d39f95889393692860b51a42fb81ef4df7c5b8";
+static const char *KAT_PUB = "6cf10afb6dcefd3076c36e786cb12bd3e458a3e7c7072266a1f4d0a3662c8db7"
+                             "28deb4279d23be02d35f578449f664398f16cdf9e6c6f881111c951a19a47343";
+static const char *KAT_SIG = "364ea3fab94c9f3aed4b8fbd49fd72e2d17d127c0c81eb46b37b86c87eca6d7e"
+                             "2536eb99ac3289b9e0e596697501639877d64557771f2f2e57861bfb544d4b58";
+
+static void print_hex(const uint8_t *p, size_t n){
+    for(size_t i=0;i<n;i++) printf("%02x", p[i]);
+}
+
+static int parse_hex(const char *s, uint8_t *out, size_t n){
+    if(strlen(s) != 2*n) return -1;
+    for(size_t i=0;i<n;i++){
+        unsigned v;
+        if(sscanf(s + 2*i, "%2x", &v) != 1) return -1;
+        out[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int run_kat(const char *dhex, const char *id, const char *msg){
+    uint8_t d[32], pub[64], sig[64];
+    if(parse_hex(dhex, d, 32) != 0 || sm2_keygen(d, pub) != 0){ fprintf(stderr, "bad d\n"); return 1; }
+    if(sm2_sign(d, pub, (const uint8_t*)id, strlen(id), (const uint8_t*)msg, strlen(msg), sig) != 0) return 1;
+    int ok = sm2_verify(pub, (const uint8_t*)id, strlen(id), (const uint8_t*)msg, strlen(msg), sig);
+    print_hex(pub, 64); printf(" "); print_hex(sig, 64); printf(" %d\n", ok);
+    return 0;
+}
+
+int main(int argc, char **argv){
+    if(argc == 5 && strcmp(argv[1], "kat") == 0) return run_kat(argv[2], argv[3], argv[4]);
+
+    const uint8_t id[] = "User", msg[] = "hello sm2";
+    uint8_t d[32], pub[64], sig[64], want_pub[64], want_sig[64];
+    parse_hex(KAT_D, d, 32);
+    parse_hex(KAT_PUB, want_pub, 64);
+    parse_hex(KAT_SIG, want_sig, 64);
+
+    sm2_keygen(d, pub);
+    sm2_sign(d, pub, id, 4, msg, 9, sig);
+    printf("pub: "); print_hex(pub, 64); printf("\n");
+    printf("sig: "); print_hex(sig, 64); printf("\n");
+    printf("pub matches sm2_basic.py: %s\n", memcmp(pub, want_pub, 64) == 0 ? "OK" : "FAIL");
+    printf("sig matches sm2_basic.py: %s\n", memcmp(sig, want_sig, 64) == 0 ? "OK" : "FAIL");
+    printf("verify: %s\n", sm2_verify(pub, id, 4, msg, 9, sig) ? "OK" : "FAIL");
+    sig[63] ^= 1;
+    printf("verify (tampered s): %s\n", sm2_verify(pub, id, 4, msg, 9, sig) ? "ACCEPTED (FAIL)" : "rejected (OK)");
+    sig[63] ^= 1;
+
+    // 三种标量乘互相核对：comb k·G、常量时间 k·G、Straus s·G + t·P
+    int agree = 1;
+    sm2_fe k = {{ 0x0123456789abcdefULL, 0xfedcba9876543210ULL, 0x0f1e2d3c4b5a6978ULL, 0x1234 }}, one = {{ 1 }}, zero = {{ 0 }};
+    for(int i=0;i<64;i++){
+        sm2_point A, B, C;
+        sm2_affine a, b, c;
+        k.v[0] += (uint64_t)i * 0x9e3779b97f4a7c15ULL;    // 奇偶交替
+        k.v[3] = (k.v[3] * 6364136223846793005ULL + i) >> 2;
+        sm2_point_mul_g(&A, &k);
+        sm2_point_mul(&B, &k, &SM2_G);
+        sm2_point_mul2_vartime(&C, i & 1 ? &k : &zero, i & 1 ? &zero : &one, &SM2_G);
+        sm2_point_to_affine(&a, &A);
+        sm2_point_to_affine(&b, &B);
+        if(!sm2_fe_equal(&a.x, &b.x) || !sm2_fe_equal(&a.y, &b.y)) agree = 0;
+        if(i & 1){
+            sm2_point_to_affine(&c, &C);
+            if(!sm2_fe_equal(&a.x, &c.x) || !sm2_fe_equal(&a.y, &c.y)) agree = 0;
+        }
+    }
+    printf("scalar mul (comb / ladder / straus) agree: %s\n", agree ? "OK" : "FAIL");
+
+    // 性能：对同一消息摘要反复签名/验签
+    uint8_t za[32], e[32];
+    sm2_compute_za(id, 4, pub, za);
+    sm2_compute_e(za, msg, 9, e);
+    const int N = 2000;
+    double t0 = now_sec();
+    for(int i=0;i<N;i++){ e[0] = (uint8_t)i; sm2_sign_digest(d, e, sig); }
+    double t1 = now_sec();
+    int ok = 0;
+    for(int i=0;i<N;i++) ok += sm2_verify_digest(pub, e, sig);
+    double t2 = now_sec();
+    printf("sign:   %.1f us/op (%.0f ops/s)\n", (t1 - t0) / N * 1e6, N / (t1 - t0));
+    printf("verify: %.1f us/op (%.0f ops/s), ok=%d/%d\n", (t2 - t1) / N * 1e6, N / (t2 - t1), ok, N);
+
+    sm2_point R;
+    double t3 = now_sec();
+    for(int i=0;i<N;i++){ k.v[0] += i; sm2_point_mul_g(&R, &k); }
+    double t4 = now_sec();
+    for(int i=0;i<N;i++){ k.v[0] += i; sm2_point_mul(&R, &k, &SM2_G); }
+    double t5 = now_sec();
+    printf("k*G comb:     %.1f us/op\n", (t4 - t3) / N * 1e6);
+    printf("k*P constant: %.1f us/op\n", (t5 - t4) / N * 1e6);
+    return 0;
+}
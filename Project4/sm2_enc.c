@@ -0,0 +1,187 @@
+// sm2_enc.c
+#define _GNU_SOURCE
+#include <string.h>
+#include <sys/random.h>
+#include "sm3.h"
+#include "sm2.h"
+#include "sm2_enc.h"
+
+/*
+  SM2 加密/解密的流式实现。update 把输入按 SM2_KDF_CHUNK 分段：
+  加密时先把明文段喂给 C3 再异或（允许 in == out），解密时先异或再把得到的明文段喂给 C3。
+  密钥流用完才补，补多少由本次剩余长度决定（向上取到 32 字节，最多 SM2_KDF_CHUNK），
+  短消息不会白算整块。
+*/
+
+/* k ∈ [1, n-1]：约化后不变且非零 */
+static int load_scalar(sm2_fe *k, const uint8_t in[32]){
+    sm2_fe r;
+    sm2_fe_from_bytes(k, in);
+    sm2_fn_reduce(&r, k);
+    return (sm2_fe_is_zero(k) || !sm2_fe_equal(&r, k)) ? -1 : 0;
+}
+
+static void ctx_setup(sm2_enc_ctx *c, const uint8_t x2y2[64]){
+    sm3_init(&c->kdf);
+    sm3_update(&c->kdf, x2y2, 64);
+    sm3_init(&c->c3);
+    sm3_update(&c->c3, x2y2, 32);
+    memcpy(c->y2, x2y2 + 32, 32);
+    c->ct = 1;
+    c->ks_pos = c->ks_len = 0;
+    c->total = 0;
+    c->nonzero = 0;
+    c->failed = 0;
+}
+
+/* 计入 len 字节；累计超过 klen 上限时置位 failed，之后不再产生密钥流 */
+static int account(sm2_enc_ctx *c, size_t len){
+    if(c->failed || len > SM2_ENC_MAX_BYTES - c->total){
+        c->failed = 1;
+        return -1;
+    }
+    c->total += len;
+    return 0;
+}
+
+/* 生成 ceil(want/32) 个 KDF 分组（不超过 SM2_KDF_CHUNK 字节），每组从保存的状态复制出来只压缩一次 */
+static void refill(sm2_enc_ctx *c, size_t want){
+    size_t blocks = (want + 31) / 32;
+    if(blocks > SM2_KDF_CHUNK / 32) blocks = SM2_KDF_CHUNK / 32;
+    for(size_t i=0;i<blocks;i++){
+        sm3_ctx t = c->kdf;
+        uint8_t ct[4] = { (uint8_t)(c->ct >> 24), (uint8_t)(c->ct >> 16), (uint8_t)(c->ct >> 8), (uint8_t)c->ct };
+        sm3_update(&t, ct, 4);
+        sm3_final(&t, c->ks + 32*i);
+        c->ct++;
+    }
+    c->ks_pos = 0;
+    c->ks_len = blocks * 32;
+}
+
+/* out = in ⊕ 密钥流，len 不超过 SM2_KDF_CHUNK */
+static void xor_stream(sm2_enc_ctx *c, const uint8_t *in, uint8_t *out, size_t len){
+    while(len){
+        if(c->ks_pos == c->ks_len) refill(c, len);
+        size_t n = c->ks_len - c->ks_pos < len ? c->ks_len - c->ks_pos : len;
+        const uint8_t *ks = c->ks + c->ks_pos;
+        uint8_t nz = 0;
+        for(size_t i=0;i<n;i++){ nz |= ks[i]; out[i] = in[i] ^ ks[i]; }
+        c->nonzero |= nz;
+        c->ks_pos += n;
+        in += n; out += n; len -= n;
+    }
+}
+
+static int mul_to_bytes(uint8_t out[64], const sm2_point *P){
+    sm2_affine A;
+    if(sm2_point_to_affine(&A, P) != 0) return -1;
+    sm2_affine_to_bytes(out, &A);
+    return 0;
+}
+
+int sm2_encrypt_init_k(sm2_enc_ctx *c, const uint8_t pub[64], const uint8_t k[32], uint8_t c1[SM2_ENC_C1_BYTES]){
+    sm2_fe kk;
+    sm2_affine PB;
+    sm2_point P;
+    uint8_t x2y2[64];
+    if(load_scalar(&kk, k) != 0 || sm2_affine_from_bytes(&PB, pub) != 0) return -1;
+    sm2_point_mul_g(&P, &kk);
+    c1[0] = 0x04;
+    if(mul_to_bytes(c1 + 1, &P) != 0) return -1;
+    sm2_point_mul(&P, &kk, &PB);                // 余因子为 1，P_B 合法即 k·P_B 非无穷远点
+    if(mul_to_bytes(x2y2, &P) != 0) return -1;
+    ctx_setup(c, x2y2);
+    memset(x2y2, 0, sizeof(x2y2));
+    memset(&kk, 0, sizeof(kk));
+    return 0;
+}
+
+int sm2_encrypt_init(sm2_enc_ctx *c, const uint8_t pub[64], uint8_t c1[SM2_ENC_C1_BYTES]){
+    uint8_t k[32];
+    sm2_fe t;
+    do{
+        if(getrandom(k, sizeof(k), 0) != (ssize_t)sizeof(k)) return -1;
+    }while(load_scalar(&t, k) != 0);            // 拒绝采样，k 在 [1, n-1] 上均匀
+    int rc = sm2_encrypt_init_k(c, pub, k, c1);
+    memset(k, 0, sizeof(k));
+    return rc;
+}
+
+int sm2_encrypt_update(sm2_enc_ctx *c, const uint8_t *in, uint8_t *out, size_t len){
+    if(account(c, len) != 0) return -1;
+    while(len){
+        size_t n = len < SM2_KDF_CHUNK ? len : SM2_KDF_CHUNK;
+        sm3_update(&c->c3, in, n);
+        xor_stream(c, in, out, n);
+        in += n; out += n; len -= n;
+    }
+    return 0;
+}
+
+int sm2_encrypt_final(sm2_enc_ctx *c, uint8_t c3[SM2_ENC_C3_BYTES]){
+    sm3_update(&c->c3, c->y2, 32);
+    sm3_final(&c->c3, c3);
+    int rc = (c->failed || (c->total && !c->nonzero)) ? -1 : 0;
+    memset(c, 0, sizeof(*c));
+    return rc;
+}
+
+int sm2_decrypt_init(sm2_enc_ctx *c, const uint8_t d[32], const uint8_t c1[SM2_ENC_C1_BYTES]){
+    sm2_fe dk;
+    sm2_affine C1;
+    sm2_point P;
+    uint8_t x2y2[64];
+    if(c1[0] != 0x04 || sm2_affine_from_bytes(&C1, c1 + 1) != 0) return -1;
+    if(load_scalar(&dk, d) != 0) return -1;
+    sm2_point_mul(&P, &dk, &C1);
+    int rc = mul_to_bytes(x2y2, &P);
+    if(rc == 0) ctx_setup(c, x2y2);
+    memset(x2y2, 0, sizeof(x2y2));
+    memset(&dk, 0, sizeof(dk));
+    return rc;
+}
+
+int sm2_decrypt_update(sm2_enc_ctx *c, const uint8_t *in, uint8_t *out, size_t len){
+    if(account(c, len) != 0) return -1;
+    while(len){
+        size_t n = len < SM2_KDF_CHUNK ? len : SM2_KDF_CHUNK;
+        xor_stream(c, in, out, n);
+        sm3_update(&c->c3, out, n);
+        in += n; out += n; len -= n;
+    }
+    return 0;
+}
+
+int sm2_decrypt_final(sm2_enc_ctx *c, const uint8_t c3[SM2_ENC_C3_BYTES]){
+    uint8_t u[32], diff = 0;
+    sm3_update(&c->c3, c->y2, 32);
+    sm3_final(&c->c3, u);
+    for(int i=0;i<32;i++) diff |= u[i] ^ c3[i];
+    if(c->failed || (c->total && !c->nonzero)) diff = 1;
+    memset(c, 0, sizeof(*c));
+    return diff ? -1 : 0;
+}
+
+int sm2_encrypt(const uint8_t pub[64], const uint8_t *msg, size_t len, uint8_t *out){
+    sm2_enc_ctx c;
+    if(len > SM2_ENC_MAX_BYTES) return -1;
+    for(;;){
+        if(sm2_encrypt_init(&c, pub, out) != 0) return -1;
+        sm2_encrypt_update(&c, msg, out + SM2_ENC_OVERHEAD, len);
+        if(sm2_encrypt_final(&c, out + SM2_ENC_C1_BYTES) == 0) return 0;
+    }
+}
+
+int sm2_decrypt(const uint8_t d[32], const uint8_t *in, size_t inlen, uint8_t *out){
+    sm2_enc_ctx c;
+    if(inlen < SM2_ENC_OVERHEAD || inlen - SM2_ENC_OVERHEAD > SM2_ENC_MAX_BYTES || sm2_decrypt_init(&c, d, in) != 0)
+        return -1;
+    size_t len = inlen - SM2_ENC_OVERHEAD;
+    sm2_decrypt_update(&c, in + SM2_ENC_OVERHEAD, out, len);
+    if(sm2_decrypt_final(&c, in + SM2_ENC_C1_BYTES) != 0){
+        memset(out, 0, len);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+// sm2_enc.h
+#ifndef SM2_ENC_H
+#define SM2_ENC_H
+#include <stdint.h>
+#include <stddef.h>
+#include "sm3.h"
+
+/*
+  SM2 公钥加密（GB/T 32918.4-2016），曲线与 sm2.h 相同，密文按 C1 || C3 || C2 排列：
+    C1 = 04 || x1 || y1，(x1, y1) = k·G                      65 字节
+    C3 = SM3(x2 || M || y2)，(x2, y2) = k·P_B                32 字节
+    C2 = M ⊕ KDF(x2 || y2, klen)，KDF 第 i 块为 SM3(x2 || y2 || ct_i)，ct 从 1 开始的 32 位大端计数
+  流式接口：密钥流按需成块生成（每次最多 SM2_KDF_CHUNK 字节），C3 随明文分段喂给 sm3_update，
+  上下文大小固定，与明文长度无关。x2 || y2 正好 64 字节，KDF 的 SM3 状态吸收它之后保存下来，
+  之后每个密钥流分组只需一次压缩。
+
+  流式解密在 final 之前就已输出明文；C3 校验失败时调用方必须丢弃已输出的内容。
+
+  KDF 计数器为 32 位，klen 不超过 (2^32 - 1)·32 字节（GM/T 0003 的上限，约 128 GiB）。
+  超出时 update 不输出并返回 -1，此后 update/final 一律返回 -1，计数器不会回绕复用密钥流。
+*/
+
+#define SM2_ENC_C1_BYTES 65
+#define SM2_ENC_C3_BYTES 32
+#define SM2_ENC_OVERHEAD (SM2_ENC_C1_BYTES + SM2_ENC_C3_BYTES)
+#define SM2_KDF_CHUNK    4096                   // 一次最多生成的密钥流字节数（SM3 输出的整数倍）
+#define SM2_ENC_MAX_BYTES (0xffffffffull * 32)   // 单条消息的明文上限
+
+typedef struct {
+    sm3_ctx  kdf;                               // 已吸收 x2 || y2 的 SM3 状态
+    sm3_ctx  c3;                                // SM3(x2 || M || y2) 的运行状态
+    uint8_t  y2[32];
+    uint32_t ct;                                // 下一个 KDF 计数值
+    uint8_t  ks[SM2_KDF_CHUNK];
+    size_t   ks_pos, ks_len;                    // ks 中已用掉 / 已生成的字节数
+    uint64_t total;                             // 已处理的明文字节数
+    uint8_t  nonzero;                           // 已用密钥流的按位或，全零时 final 报错
+    uint8_t  failed;                            // 超过 SM2_ENC_MAX_BYTES 后置位
+} sm2_enc_ctx;
+
+/* 加密：随机 k 取自 getrandom，输出 C1。成功返回 0 */
+int  sm2_encrypt_init(sm2_enc_ctx *c, const uint8_t pub[64], uint8_t c1[SM2_ENC_C1_BYTES]);
+/* 同上，k 由调用方给出（仅用于标准测试向量），k ∈ [1, n-1] */
+int  sm2_encrypt_init_k(sm2_enc_ctx *c, const uint8_t pub[64], const uint8_t k[32], uint8_t c1[SM2_ENC_C1_BYTES]);
+/* 明文 in 加密到 out（C2 的下一段），in 与 out 可以相同。累计长度超过 SM2_ENC_MAX_BYTES 返回 -1 */
+int  sm2_encrypt_update(sm2_enc_ctx *c, const uint8_t *in, uint8_t *out, size_t len);
+/* 输出 C3；密钥流全为 0（klen > 0 时概率 2^-8klen）返回 -1，此时应换 k 重新加密；长度超限也返回 -1 */
+int  sm2_encrypt_final(sm2_enc_ctx *c, uint8_t c3[SM2_ENC_C3_BYTES]);
+
+/* 解密：检查 C1 在曲线上，(x2, y2) = d·C1（常量时间）。成功返回 0 */
+int  sm2_decrypt_init(sm2_enc_ctx *c, const uint8_t d[32], const uint8_t c1[SM2_ENC_C1_BYTES]);
+int  sm2_decrypt_update(sm2_enc_ctx *c, const uint8_t *in, uint8_t *out, size_t len);
+/* C3 一致且长度未超限返回 0，否则 -1 */
+int  sm2_decrypt_final(sm2_enc_ctx *c, const uint8_t c3[SM2_ENC_C3_BYTES]);
+
+/* 一次性接口：out 长度为 len + SM2_ENC_OVERHEAD，成功返回 0 */
+int  sm2_encrypt(const uint8_t pub[64], const uint8_t *msg, size_t len, uint8_t *out);
+/* in 为 C1 || C3 || C2，明文写到 out（inlen - SM2_ENC_OVERHEAD 字节），成功返回 0 */
+int  sm2_decrypt(const uint8_t d[32], const uint8_t *in, size_t inlen, uint8_t *out);
+
+#endif
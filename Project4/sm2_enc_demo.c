@@ -0,0 +1,258 @@
+// sm2_enc_demo.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "sm2.h"
+#include "sm2_enc.h"
+
+/*
+  用法:
+    ./sm2_enc_demo                               标准测试向量 + 往返/篡改测试 + 性能测试
+    ./sm2_enc_demo kat <d_hex> <k_hex> <msg_hex>
+        用给定 k 加密，输出 "pub_hex ct_hex dec_ok"，供 Project5/sm2_enc_crosscheck.py 比对
+    ./sm2_enc_demo dec <d_hex> <ct_hex>          一次性解密，输出明文 hex；C3 不符输出 "-"
+    ./sm2_enc_demo encfile <pub_hex> <in> <out>  流式加密文件（先占位 C3，写完 C2 再回填）
+    ./sm2_enc_demo decfile <d_hex> <in> <out>    流式解密文件，C3 不符时删除输出并返回 1
+  文件模式结束时打印峰值 RSS，内存占用与文件大小无关。
+*/
+
+/* GB/T 32918.4-2016 附录 A.2 的数据换到 sm2.h 所用的示例曲线上，由 Project5/sm2_basic.py 复现 */
+static const char *KAT_D   = "1649ab77a00637bd5e2efe283fbf353534aa7f7cb89463f208ddbc2920bb0da0";
+static const char *KAT_K   = "4c62eefd6ecfc2b95b92fd6c3d9575148afa17425546d49018e5388d49dd7b4f";
+static const char *KAT_MSG = "encryption standard";
+static const char *KAT_CT  = "04245c26fb68b1ddddb12c4b6bf9f2b6d5fe60a383b0d18d1c4144abf17f6252e7"
+                             "76cb9264c2a7e88e52b19903fdc47378f605e36811f5c07423a24b84400f01b8"
+                             "9c3d7360c30156fab7c80a0276712da9d8094a634b766d3a285e07480653426d"
+                             "650053a89b41c418b0c3aad00d886c00286467";
+
+#define FILE_BUF (1u << 20)
+
+static void print_hex(const uint8_t *p, size_t n){
+    for(size_t i=0;i<n;i++) printf("%02x", p[i]);
+}
+
+static int parse_hex(const char *s, uint8_t *out, size_t n){
+    if(strlen(s) != 2*n) return -1;
+    for(size_t i=0;i<n;i++){
+        unsigned v;
+        if(sscanf(s + 2*i, "%2x", &v) != 1) return -1;
+        out[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long peak_rss_kb(void){
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+static int run_kat(const char *dhex, const char *khex, const char *mhex){
+    uint8_t d[32], k[32], pub[64];
+    size_t len = strlen(mhex) / 2;
+    uint8_t *msg = malloc(len + 1), *ct = malloc(len + SM2_ENC_OVERHEAD), *pt = malloc(len + 1);
+    int rc = 1;
+    sm2_enc_ctx c;
+    if(!msg || !ct || !pt) goto out;
+    if(parse_hex(dhex, d, 32) != 0 || parse_hex(khex, k, 32) != 0 || parse_hex(mhex, msg, len) != 0 ||
+       sm2_keygen(d, pub) != 0){ fprintf(stderr, "bad input\n"); goto out; }
+    if(sm2_encrypt_init_k(&c, pub, k, ct) != 0){ fprintf(stderr, "bad k\n"); goto out; }
+    sm2_encrypt_update(&c, msg, ct + SM2_ENC_OVERHEAD, len);
+    int zero_ks = sm2_encrypt_final(&c, ct + SM2_ENC_C1_BYTES) != 0;
+    int ok = !zero_ks && sm2_decrypt(d, ct, len + SM2_ENC_OVERHEAD, pt) == 0 && memcmp(pt, msg, len) == 0;
+    print_hex(pub, 64); printf(" "); print_hex(ct, len + SM2_ENC_OVERHEAD); printf(" %d\n", ok);
+    rc = 0;
+out:
+    free(msg); free(ct); free(pt);
+    return rc;
+}
+
+static int run_dec(const char *dhex, const char *chex){
+    uint8_t d[32];
+    size_t len = strlen(chex) / 2;
+    uint8_t *ct = malloc(len + 1), *pt = malloc(len + 1);
+    int rc = 1;
+    if(!ct || !pt || parse_hex(dhex, d, 32) != 0 || parse_hex(chex, ct, len) != 0){ fprintf(stderr, "bad input\n"); goto out; }
+    if(sm2_decrypt(d, ct, len, pt) == 0){ print_hex(pt, len - SM2_ENC_OVERHEAD); printf("\n"); }
+    else printf("-\n");
+    rc = 0;
+out:
+    free(ct); free(pt);
+    return rc;
+}
+
+static int run_encfile(const char *pubhex, const char *in, const char *out){
+    uint8_t pub[64], hdr[SM2_ENC_OVERHEAD] = {0};
+    if(parse_hex(pubhex, pub, 64) != 0){ fprintf(stderr, "bad pub\n"); return 1; }
+    FILE *fi = fopen(in, "rb"), *fo = fopen(out, "wb");
+    uint8_t *buf = malloc(FILE_BUF);
+    int rc = 1;
+    if(!fi || !fo || !buf){ perror("open"); goto out; }
+    for(;;){
+        sm2_enc_ctx c;
+        double t0 = now_sec();
+        uint64_t total = 0;
+        if(sm2_encrypt_init(&c, pub, hdr) != 0){ fprintf(stderr, "bad pub\n"); goto out; }
+        rewind(fi); rewind(fo);
+        if(fwrite(hdr, 1, sizeof(hdr), fo) != sizeof(hdr)) goto out;   // C3 先占位
+        size_t n;
+        while((n = fread(buf, 1, FILE_BUF, fi)) > 0){
+            if(sm2_encrypt_update(&c, buf, buf, n) != 0){ fprintf(stderr, "input too large\n"); goto out; }
+            if(fwrite(buf, 1, n, fo) != n) goto out;
+            total += n;
+        }
+        if(ferror(fi)) goto out;
+        if(sm2_encrypt_final(&c, hdr + SM2_ENC_C1_BYTES) != 0) continue;   // 密钥流全零，换 k 重来
+        if(fseek(fo, SM2_ENC_C1_BYTES, SEEK_SET) != 0 || fwrite(hdr + SM2_ENC_C1_BYTES, 1, SM2_ENC_C3_BYTES, fo) != SM2_ENC_C3_BYTES) goto out;
+        double dt = now_sec() - t0;
+        fprintf(stderr, "encrypted %llu bytes in %.3f s (%.1f MB/s), peak RSS %ld KB\n",
+                (unsigned long long)total, dt, total / dt / 1e6, peak_rss_kb());
+        rc = 0;
+        break;
+    }
+out:
+    free(buf);
+    if(fi) fclose(fi);
+    if(fo && fclose(fo) != 0) rc = 1;
+    if(rc != 0 && fo) unlink(out);
+    return rc;
+}
+
+static int run_decfile(const char *dhex, const char *in, const char *out){
+    uint8_t d[32], hdr[SM2_ENC_OVERHEAD];
+    if(parse_hex(dhex, d, 32) != 0){ fprintf(stderr, "bad d\n"); return 1; }
+    FILE *fi = fopen(in, "rb"), *fo = fopen(out, "wb");
+    uint8_t *buf = malloc(FILE_BUF);
+    int rc = 1;
+    sm2_enc_ctx c;
+    double t0 = now_sec();
+    uint64_t total = 0;
+    if(!fi || !fo || !buf){ perror("open"); goto out; }
+    if(fread(hdr, 1, sizeof(hdr), fi) != sizeof(hdr) || sm2_decrypt_init(&c, d, hdr) != 0){
+        fprintf(stderr, "bad ciphertext header\n"); goto out;
+    }
+    size_t n;
+    while((n = fread(buf, 1, FILE_BUF, fi)) > 0){
+        if(sm2_decrypt_update(&c, buf, buf, n) != 0){ fprintf(stderr, "ciphertext too large\n"); goto out; }
+        if(fwrite(buf, 1, n, fo) != n) goto out;
+        total += n;
+    }
+    if(ferror(fi)) goto out;
+    if(sm2_decrypt_final(&c, hdr + SM2_ENC_C1_BYTES) != 0){ fprintf(stderr, "C3 mismatch, output removed\n"); goto out; }
+    double dt = now_sec() - t0;
+    fprintf(stderr, "decrypted %llu bytes in %.3f s (%.1f MB/s), peak RSS %ld KB\n",
+            (unsigned long long)total, dt, total / dt / 1e6, peak_rss_kb());
+    rc = 0;
+out:
+    free(buf);
+    if(fi) fclose(fi);
+    if(fo && fclose(fo) != 0) rc = 1;
+    if(rc != 0 && fo) unlink(out);     // 已写出的明文未经认证，失败时不留下
+    return rc;
+}
+
+int main(int argc, char **argv){
+    if(argc == 5 && strcmp(argv[1], "kat") == 0) return run_kat(argv[2], argv[3], argv[4]);
+    if(argc == 4 && strcmp(argv[1], "dec") == 0) return run_dec(argv[2], argv[3]);
+    if(argc == 5 && strcmp(argv[1], "encfile") == 0) return run_encfile(argv[2], argv[3], argv[4]);
+    if(argc == 5 && strcmp(argv[1], "decfile") == 0) return run_decfile(argv[2], argv[3], argv[4]);
+
+    uint8_t d[32], k[32], pub[64], want[SM2_ENC_OVERHEAD + 19], ct[SM2_ENC_OVERHEAD + 19], pt[19];
+    sm2_enc_ctx c;
+    parse_hex(KAT_D, d, 32);
+    parse_hex(KAT_K, k, 32);
+    parse_hex(KAT_CT, want, sizeof(want));
+    sm2_keygen(d, pub);
+    sm2_encrypt_init_k(&c, pub, k, ct);
+    sm2_encrypt_update(&c, (const uint8_t*)KAT_MSG, ct + SM2_ENC_OVERHEAD, 19);
+    sm2_encrypt_final(&c, ct + SM2_ENC_C1_BYTES);
+    printf("ct: "); print_hex(ct, sizeof(ct)); printf("\n");
+    printf("ct matches GB/T 32918.4 example: %s\n", memcmp(ct, want, sizeof(ct)) == 0 ? "OK" : "FAIL");
+    int ok = sm2_decrypt(d, ct, sizeof(ct), pt) == 0 && memcmp(pt, KAT_MSG, 19) == 0;
+    printf("decrypt: %s\n", ok ? "OK" : "FAIL");
+
+    // KAT 的 k 派生出的密钥流首字节恰好为 0（C2[0] = 'e' ⊕ 0x65），1 字节消息必须被判为全零密钥流
+    sm2_encrypt_init_k(&c, pub, k, ct);
+    sm2_encrypt_update(&c, (const uint8_t*)"x", ct + SM2_ENC_OVERHEAD, 1);
+    printf("all-zero keystream (1-byte msg): %s\n", sm2_encrypt_final(&c, ct + SM2_ENC_C1_BYTES) != 0 ? "rejected (OK)" : "ACCEPTED (FAIL)");
+    k[31] ^= 1;
+
+    // 往返：各种长度（跨 32 字节分组、跨 SM2_KDF_CHUNK），流式分段与一次性结果一致
+    static const size_t lens[] = { 0, 1, 31, 32, 33, 4095, 4096, 4097, 3*4096 + 7, 100000 };
+    int rt_ok = 1, tamper_ok = 1;
+    for(size_t t=0;t<sizeof(lens)/sizeof(lens[0]);t++){
+        size_t len = lens[t];
+        uint8_t *m = malloc(len + 1), *e1 = malloc(len + SM2_ENC_OVERHEAD), *e2 = malloc(len + SM2_ENC_OVERHEAD), *p = malloc(len + 1);
+        for(size_t i=0;i<len;i++) m[i] = (uint8_t)(i * 131 + t);
+        sm2_encrypt_init_k(&c, pub, k, e1);
+        sm2_encrypt_update(&c, m, e1 + SM2_ENC_OVERHEAD, len);
+        sm2_encrypt_final(&c, e1 + SM2_ENC_C1_BYTES);
+        sm2_encrypt_init_k(&c, pub, k, e2);
+        for(size_t off=0, step=1; off<len; off+=step, step=step*3+1){   // 1, 4, 13, ... 字节一段
+            size_t n = len - off < step ? len - off : step;
+            sm2_encrypt_update(&c, m + off, e2 + SM2_ENC_OVERHEAD + off, n);
+        }
+        sm2_encrypt_final(&c, e2 + SM2_ENC_C1_BYTES);
+        if(memcmp(e1, e2, len + SM2_ENC_OVERHEAD) != 0)rt_ok = 0;
+        if(sm2_decrypt(d, e1, len + SM2_ENC_OVERHEAD, p) != 0 || memcmp(p, m, len) != 0)rt_ok = 0;
+        if(sm2_encrypt(pub, m, len, e2) != 0 || sm2_decrypt(d, e2, len + SM2_ENC_OVERHEAD, p) != 0 || memcmp(p, m, len) != 0) rt_ok = 0;
+        // 篡改 C2 最后一个字节、C3、C1 都必须被拒绝
+        size_t pos[3] = { len + SM2_ENC_OVERHEAD - 1, SM2_ENC_C1_BYTES + 5, 10 };
+        for(int j=(len ? 0 : 1); j<3; j++){
+            e1[pos[j]] ^= 0x40;
+            if(sm2_decrypt(d, e1, len + SM2_ENC_OVERHEAD, p) == 0) tamper_ok = 0;
+            e1[pos[j]] ^= 0x40;
+        }
+        free(m); free(e1); free(e2); free(p);
+    }
+    printf("round trip (streamed / one-shot, 0..100000 bytes): %s\n", rt_ok ? "OK" : "FAIL");
+    printf("tampered C1 / C2 / C3: %s\n", tamper_ok ? "rejected (OK)" : "ACCEPTED (FAIL)");
+
+    // klen 上限：把已处理长度拨到上限前 40 字节，最后 32 字节的分组用计数器 2^32-1，再多 1 字节就必须拒绝而不是回绕
+    int lim_ok = 1;
+    uint8_t tail[64] = {0};
+    sm2_encrypt_init_k(&c, pub, k, ct);
+    c.total = SM2_ENC_MAX_BYTES - 40;
+    c.ct = 0xfffffffeu;
+    c.ks_pos = c.ks_len = 0;
+    if(sm2_encrypt_update(&c, tail, tail, 40) != 0 || c.ct != 0) lim_ok = 0;
+    if(sm2_encrypt_update(&c, tail, tail + 40, 1) != -1 || sm2_encrypt_update(&c, tail, tail, 0) != -1) lim_ok = 0;
+    if(sm2_encrypt_final(&c, ct + SM2_ENC_C1_BYTES) != -1) lim_ok = 0;
+    if(tail[40] != 0) lim_ok = 0;
+    printf("klen limit ((2^32-1)*32 bytes): %s\n", lim_ok ? "enforced (OK)" : "FAIL");
+
+    // 性能：固定开销（两次标量乘）与长消息吞吐
+    const int N = 500;
+    double t0 = now_sec();
+    for(int i=0;i<N;i++){ sm2_encrypt_init(&c, pub, ct); sm2_encrypt_final(&c, ct + SM2_ENC_C1_BYTES); }
+    double t1 = now_sec();
+    uint8_t c1[SM2_ENC_C1_BYTES];
+    memcpy(c1, ct, sizeof(c1));
+    for(int i=0;i<N;i++){ sm2_decrypt_init(&c, d, c1); sm2_decrypt_final(&c, ct + SM2_ENC_C1_BYTES); }
+    double t2 = now_sec();
+    printf("encrypt setup: %.1f us/op\n", (t1 - t0) / N * 1e6);
+    printf("decrypt setup: %.1f us/op\n", (t2 - t1) / N * 1e6);
+
+    size_t big = 64u << 20;
+    uint8_t *buf = malloc(FILE_BUF);
+    memset(buf, 0x5a, FILE_BUF);
+    sm2_encrypt_init(&c, pub, ct);
+    double t3 = now_sec();
+    for(size_t off=0; off<big; off+=FILE_BUF) sm2_encrypt_update(&c, buf, buf, FILE_BUF);
+    double t4 = now_sec();
+    sm2_encrypt_final(&c, ct + SM2_ENC_C1_BYTES);
+    printf("stream encrypt: %.1f MB/s (%zu MB, context %zu bytes)\n", big / (t4 - t3) / 1e6, big >> 20, sizeof(sm2_enc_ctx));
+    free(buf);
+    return 0;
+}
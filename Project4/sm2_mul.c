@@ -0,0 +1,210 @@
+// sm2_mul.c
+#include <string.h>
+#include "sm2.h"
+#include "sm2_tables.h"
+
+/*
+  标量乘：
+    sm2_point_mul_g        k·G，固定基 comb（6 齿、间隔 43、两块各 22 列），查表全表扫描，常量时间
+    sm2_point_mul          k·P，正则奇数重编码 + 4 位有符号窗口，查表全表扫描，常量时间
+    sm2_point_mul2_vartime s·G + t·P，wNAF(G 窗口 8 / P 窗口 5) + Straus 交错，仅用于公开数据（验签）
+  预计算表由 gen_sm2_tables.py 生成（sm2_tables.h）。
+*/
+
+#define WNAF_P 5                        // 表大小 SM2_WNAF_P_TABLE = 2^(WNAF_P-2)
+
+static const sm2_fe FE_ZERO = {{ 0, 0, 0, 0 }};
+
+/* 全 1 当且仅当 a == b */
+static inline uint64_t ct_eq_mask(uint64_t a, uint64_t b){
+    uint64_t x = a ^ b;
+    return ((x | (0 - x)) >> 63) - 1;
+}
+
+static inline void ct_select_fe(sm2_fe *r, const sm2_fe *a, uint64_t mask){
+    for(int j=0;j<4;j++) r->v[j] = (a->v[j] & mask) | (r->v[j] & ~mask);
+}
+
+static inline unsigned scalar_bit(const sm2_fe *k, int pos){
+    return pos < 256 ? (unsigned)(k->v[pos >> 6] >> (pos & 63)) & 1 : 0;
+}
+
+/* r = tab[idx]，逐项读取整张表 */
+static void ct_lookup_affine(sm2_affine *r, const sm2_affine *tab, int n, unsigned idx){
+    uint64_t o[8] = {0};
+    for(int i=0;i<n;i++){
+        uint64_t m = ct_eq_mask((uint64_t)i, idx);
+        const uint64_t *t = (const uint64_t*)&tab[i];
+        for(int j=0;j<8;j++) o[j] |= t[j] & m;
+    }
+    memcpy(r, o, sizeof(o));
+}
+
+static void ct_lookup_point(sm2_point *r, const sm2_point *tab, int n, unsigned idx){
+    uint64_t o[12] = {0};
+    for(int i=0;i<n;i++){
+        uint64_t m = ct_eq_mask((uint64_t)i, idx);
+        const uint64_t *t = (const uint64_t*)&tab[i];
+        for(int j=0;j<12;j++) o[j] |= t[j] & m;
+    }
+    memcpy(r, o, sizeof(o));
+}
+
+/* ---------------- k·G：固定基 comb ----------------
+   第 b 块第 col 列的齿位为 k 的第 i·43 + b·22 + col 位 (i = 0..5)。
+   表项都带偏移点 O_b（下标 0 也不是无穷远点），循环中没有零位分支；
+   偏移总和在最后由 SM2_COMB_CORR 抵消。 */
+void sm2_point_mul_g(sm2_point *r, const sm2_fe *k){
+    sm2_point acc;
+    sm2_affine t;
+    for(int col = SM2_COMB_BLOCKLEN - 1; col >= 0; col--){
+        if(col != SM2_COMB_BLOCKLEN - 1) sm2_point_double(&acc, &acc);
+        for(int b=0;b<SM2_COMB_BLOCKS;b++){
+            int off = b*SM2_COMB_BLOCKLEN + col;
+            unsigned idx = 0;
+            if(off < SM2_COMB_SPACING)          // 最后一块多出的一列，只加偏移点
+                for(int i=0;i<SM2_COMB_TEETH;i++) idx |= scalar_bit(k, i*SM2_COMB_SPACING + off) << i;
+            ct_lookup_affine(&t, SM2_COMB[b], 1 << SM2_COMB_TEETH, idx);
+            if(col == SM2_COMB_BLOCKLEN - 1 && b == 0) sm2_point_from_affine(&acc, &t);
+            else sm2_point_add_affine(&acc, &acc, &t);
+        }
+    }
+    sm2_point_add_affine(r, &acc, &SM2_COMB_CORR);
+}
+
+/* ---------------- k·P：常量时间变基点 ----------------
+   k 为偶数时改算 (n-k)·P 再取负，保证 k 为奇数；再重编码为 65 个奇数位
+   d_i ∈ {±1, ±3, ..., ±15}，k = Σ d_i·16^i，每个窗口都做一次加法。 */
+static void recode_regular(int8_t d[65], const sm2_fe *k){
+    uint64_t w[5] = { k->v[0], k->v[1], k->v[2], k->v[3], 0 };
+    for(int i=0;i<64;i++){
+        int64_t v = (int64_t)(w[0] & 31) - 16;
+        d[i] = (int8_t)v;
+        // w = (w - v) >> 4，-v 符号扩展到高位
+        uint64_t add = (uint64_t)(-v), hi = (uint64_t)(-(int64_t)(v > 0));
+        unsigned char cy = 0;
+        cy = __builtin_add_overflow(w[0], add, &w[0]);
+        for(int j=1;j<5;j++){
+            uint64_t s = w[j] + hi;
+            unsigned char c1 = s < hi;
+            w[j] = s + cy;
+            cy = c1 | (w[j] < s);
+        }
+        for(int j=0;j<4;j++) w[j] = (w[j] >> 4) | (w[j+1] << 60);
+        w[4] >>= 4;
+    }
+    d[64] = (int8_t)w[0];
+}
+
+void sm2_point_mul(sm2_point *r, const sm2_fe *k, const sm2_affine *p){
+    sm2_fe kk, kn;
+    sm2_fn_sub(&kn, &FE_ZERO, k);                // n - k（普通形式下同样成立）
+    uint64_t even = (k->v[0] & 1) - 1;
+    kk = *k;
+    ct_select_fe(&kk, &kn, even);
+
+    int8_t d[65];
+    recode_regular(d, &kk);
+
+    sm2_point tab[SM2_WNAF_P_TABLE], acc, t;
+    sm2_point_odd_multiples(tab, p);
+
+    ct_lookup_point(&acc, tab, 8, (unsigned)(d[64] >> 1));
+    for(int i=63;i>=0;i--){
+        for(int j=0;j<4;j++) sm2_point_double(&acc, &acc);
+        int v = d[i];
+        uint64_t neg = -(uint64_t)(v < 0);
+        unsigned a = (unsigned)((v ^ (int)neg) - (int)neg);
+        ct_lookup_point(&t, tab, 8, a >> 1);
+        sm2_fe ny;
+        sm2_fp_sub(&ny, &FE_ZERO, &t.Y);
+        ct_select_fe(&t.Y, &ny, neg);
+        sm2_point_add(&acc, &acc, &t);
+    }
+    sm2_fe ny;
+    sm2_fp_sub(&ny, &FE_ZERO, &acc.Y);
+    ct_select_fe(&acc.Y, &ny, even);
+    // k = 0 时结果为无穷远点
+    uint64_t zero = ct_eq_mask(k->v[0] | k->v[1] | k->v[2] | k->v[3], 0);
+    ct_select_fe(&acc.Z, &FE_ZERO, zero);
+    *r = acc;
+}
+
+/* ---------------- s·G + t·P：wNAF + Straus（非常量时间） ---------------- */
+
+/* 宽度 w 的 NAF，返回位数（最多 257） */
+static int wnaf(int8_t out[257], const sm2_fe *k, int w){
+    uint64_t x[5] = { k->v[0], k->v[1], k->v[2], k->v[3], 0 };
+    int len = 0;
+    memset(out, 0, 257);
+    while(x[0] | x[1] | x[2] | x[3] | x[4]){
+        if(x[0] & 1){
+            int v = (int)(x[0] & ((1u << w) - 1));
+            if(v >= 1 << (w - 1)) v -= 1 << w;
+            out[len] = (int8_t)v;
+            if(v > 0){
+                uint64_t b = (uint64_t)v;
+                for(int j=0;j<5 && b;j++){ uint64_t o = x[j]; x[j] -= b; b = o < b; }
+            }else{
+                uint64_t c = (uint64_t)(-v);
+                for(int j=0;j<5 && c;j++){ x[j] += c; c = x[j] < c; }
+            }
+        }
+        for(int j=0;j<4;j++) x[j] = (x[j] >> 1) | (x[j+1] << 63);
+        x[4] >>= 1;
+        len++;
+    }
+    return len;
+}
+
+void sm2_point_odd_multiples(sm2_point tab[SM2_WNAF_P_TABLE], const sm2_affine *p){
+    sm2_point p2;
+    sm2_point_from_affine(&tab[0], p);
+    sm2_point_double(&p2, &tab[0]);
+    for(int i=1;i<SM2_WNAF_P_TABLE;i++) sm2_point_add(&tab[i], &tab[i-1], &p2);
+}
+
+/* P 的表二选一：jtab（Jacobian，一般加法）或 atab（仿射，混合加法） */
+static void straus(sm2_point *r, const sm2_fe *s, const sm2_fe *t,
+                   const sm2_point *jtab, const sm2_affine *atab){
+    int8_t ns[257], nt[257];
+    int ls = wnaf(ns, s, SM2_WNAF_G), lt = wnaf(nt, t, WNAF_P);
+    sm2_point acc;
+    memset(&acc, 0, sizeof(acc));
+    int started = 0;
+    for(int i=(ls > lt ? ls : lt) - 1; i>=0; i--){
+        if(started) sm2_point_double(&acc, &acc);
+        if(ns[i]){
+            int v = ns[i];
+            sm2_affine a = SM2_G_ODD[(v > 0 ? v : -v) >> 1];
+            if(v < 0) sm2_fp_sub(&a.y, &FE_ZERO, &a.y);
+            sm2_point_add_affine(&acc, &acc, &a);
+            started = 1;
+        }
+        if(nt[i]){
+            int v = nt[i];
+            if(atab){
+                sm2_affine a = atab[(v > 0 ? v : -v) >> 1];
+                if(v < 0) sm2_fp_sub(&a.y, &FE_ZERO, &a.y);
+                sm2_point_add_affine(&acc, &acc, &a);
+            }else{
+                sm2_point q = jtab[(v > 0 ? v : -v) >> 1];
+                if(v < 0) sm2_fp_sub(&q.Y, &FE_ZERO, &q.Y);
+                sm2_point_add(&acc, &acc, &q);
+            }
+            started = 1;
+        }
+    }
+    *r = acc;
+}
+
+void sm2_point_mul2_vartime(sm2_point *r, const sm2_fe *s, const sm2_fe *t, const sm2_affine *p){
+    sm2_point tab[SM2_WNAF_P_TABLE];
+    sm2_point_odd_multiples(tab, p);
+    straus(r, s, t, tab, NULL);
+}
+
+void sm2_point_mul2_vartime_tab(sm2_point *r, const sm2_fe *s, const sm2_fe *t,
+                                const sm2_affine tab[SM2_WNAF_P_TABLE]){
+    straus(r, s, t, NULL, tab);
+}
@@ -0,0 +1,292 @@
+// sm2_pool.c
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/random.h>
+#include <unistd.h>
+#include "sm2_pool.h"
+
+/*
+  队列是有界 MPMC 环形队列（Vyukov）：每个槽位带一个序号 seq，
+    生产者在 seq == pos 时用 CAS 占住 enq 位置，写入后发布 seq = pos + 1；
+    消费者在 seq == pos + 1 时用 CAS 占住 deq 位置，读出并擦除后发布 seq = pos + cap。
+  在线路径只有两次原子操作，没有锁。
+  补充线程每批 REFILL_BATCH 个：随机 k 逐个算 k·G（comb），整批共用一次求逆得到 x1；
+  队列降到 3/4 以下时由消费者通过信号量唤醒它，补满后继续睡眠。
+*/
+
+#define REFILL_BATCH 64
+
+typedef struct {
+    _Alignas(64) _Atomic size_t seq;
+    sm2_fe km;              // k，Montgomery 形式
+    sm2_fe x1;              // (k·G).x mod n，普通形式
+} slot_t;
+
+struct sm2_pool {
+    slot_t *slots;
+    size_t cap, mask;
+    size_t map_len;         // slots 映射的字节数（整页）
+    int locked;
+    _Alignas(64) _Atomic size_t enq;
+    _Alignas(64) _Atomic size_t deq;
+    _Alignas(64) _Atomic uint64_t hits;
+    _Atomic uint64_t misses;
+    _Atomic uint64_t produced;
+    _Atomic uint64_t wakeups;
+    atomic_int wake_pending;
+    atomic_int stop;
+    sem_t wake;
+    pthread_t th;
+    int threaded;
+};
+
+static void wipe(void *p, size_t n){
+    explicit_bzero(p, n);
+}
+
+static size_t level_of(const sm2_pool *p){
+    size_t e = atomic_load_explicit(&p->enq, memory_order_relaxed);
+    size_t d = atomic_load_explicit(&p->deq, memory_order_relaxed);
+    return e - d <= p->cap ? e - d : 0;         // 两次读取之间可能有出队，差值会短暂“为负”
+}
+
+static int push(sm2_pool *p, const sm2_fe *km, const sm2_fe *x1){
+    size_t pos = atomic_load_explicit(&p->enq, memory_order_relaxed);
+    for(;;){
+        slot_t *s = &p->slots[pos & p->mask];
+        size_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&p->enq, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                s->km = *km;
+                s->x1 = *x1;
+                atomic_store_explicit(&s->seq, pos + 1, memory_order_release);
+                return 0;
+            }
+        }else if(diff < 0) return -1;           // 满
+        else pos = atomic_load_explicit(&p->enq, memory_order_relaxed);
+    }
+}
+
+static int pop(sm2_pool *p, sm2_fe *km, sm2_fe *x1){
+    size_t pos = atomic_load_explicit(&p->deq, memory_order_relaxed);
+    for(;;){
+        slot_t *s = &p->slots[pos & p->mask];
+        size_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&p->deq, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                *km = s->km;
+                *x1 = s->x1;
+                wipe(&s->km, sizeof(s->km));
+                wipe(&s->x1, sizeof(s->x1));
+                atomic_store_explicit(&s->seq, pos + p->cap, memory_order_release);
+                return 0;
+            }
+        }else if(diff < 0) return -1;           // 空
+        else pos = atomic_load_explicit(&p->deq, memory_order_relaxed);
+    }
+}
+
+/* 随机 k ∈ [1, n-1]（拒绝采样） */
+static int random_scalar(sm2_fe *k){
+    uint8_t b[32];
+    sm2_fe r;
+    do{
+        if(getrandom(b, sizeof(b), 0) != (ssize_t)sizeof(b)) return -1;
+        sm2_fe_from_bytes(k, b);
+        sm2_fn_reduce(&r, k);
+    }while(sm2_fe_is_zero(k) || !sm2_fe_equal(&r, k));
+    wipe(b, sizeof(b));
+    return 0;
+}
+
+/* X/Z² 的 x 坐标转为 mod n 的普通整数 */
+static void x_mod_n(sm2_fe *x1, const sm2_fe *X, const sm2_fe *zi){
+    sm2_fe zi2;
+    sm2_fp_sqr(&zi2, zi);
+    sm2_fp_mul(x1, X, &zi2);
+    sm2_fp_from_mont(x1, x1);
+    sm2_fn_reduce(x1, x1);
+}
+
+/* 生成至多 max 个 (k, x1) 放入队列，返回放入的数量 */
+static size_t produce(sm2_pool *p, size_t max){
+    sm2_fe k[REFILL_BATCH], z[REFILL_BATCH], scratch[REFILL_BATCH];
+    sm2_point P[REFILL_BATCH];
+    size_t done = 0;
+    while(done < max){
+        size_t room = p->cap - level_of(p);
+        size_t m = max - done;
+        if(m > room) m = room;
+        if(m > REFILL_BATCH) m = REFILL_BATCH;
+        if(m == 0) break;
+        size_t got = 0;
+        for(; got<m; got++){
+            if(random_scalar(&k[got]) != 0) break;
+            sm2_point_mul_g(&P[got], &k[got]);  // k ∈ [1, n-1]，Z 不为 0
+            z[got] = P[got].Z;
+        }
+        sm2_fp_batch_inv(z, z, got, scratch);
+        size_t pushed = 0;
+        for(size_t i=0;i<got;i++){
+            sm2_fe x1, km;
+            x_mod_n(&x1, &P[i].X, &z[i]);
+            sm2_fn_to_mont(&km, &k[i]);
+            if(push(p, &km, &x1) != 0){ wipe(&km, sizeof(km)); break; }
+            pushed++;
+        }
+        wipe(k, sizeof(k));
+        wipe(P, sizeof(P));
+        wipe(z, sizeof(z));
+        wipe(scratch, sizeof(scratch));
+        atomic_fetch_add_explicit(&p->produced, pushed, memory_order_relaxed);
+        done += pushed;
+        if(pushed < m) break;                   // getrandom 失败或队列已满
+    }
+    return done;
+}
+
+static void *refill_main(void *arg){
+    sm2_pool *p = (sm2_pool*)arg;
+    while(!atomic_load(&p->stop)){
+        atomic_store(&p->wake_pending, 0);
+        produce(p, p->cap);
+        while(sem_wait(&p->wake) != 0) ;        // EINTR 重试
+        atomic_fetch_add_explicit(&p->wakeups, 1, memory_order_relaxed);
+    }
+    return NULL;
+}
+
+sm2_pool *sm2_pool_create(size_t capacity, int background){
+    if(capacity == 0) return NULL;
+    size_t cap = 1;
+    while(cap < capacity) cap <<= 1;
+    sm2_pool *p = aligned_alloc(64, sizeof(*p));
+    if(!p) return NULL;
+    memset(p, 0, sizeof(*p));
+    // 槽位数组单独 mmap：页对齐、按整页计长，madvise/mlock 覆盖的正好是这段映射
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    p->map_len = (cap * sizeof(slot_t) + page - 1) & ~(page - 1);
+    p->slots = mmap(NULL, p->map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(p->slots == MAP_FAILED){ free(p); return NULL; }
+    // 不进 core dump 是硬性要求，标记失败就不创建
+    if(madvise(p->slots, p->map_len, MADV_DONTDUMP) != 0 || sem_init(&p->wake, 0, 0) != 0){
+        munmap(p->slots, p->map_len);
+        free(p);
+        return NULL;
+    }
+    p->cap = cap;
+    p->mask = cap - 1;
+    p->locked = mlock(p->slots, p->map_len) == 0;              // 失败不影响使用，只是可能被换出
+    for(size_t i=0;i<cap;i++) atomic_init(&p->slots[i].seq, i);
+    atomic_init(&p->enq, 0);
+    atomic_init(&p->deq, 0);
+    if(background){
+        p->threaded = pthread_create(&p->th, NULL, refill_main, p) == 0;
+        if(p->threaded){
+            struct sched_param sp = { .sched_priority = 0 };
+            pthread_setschedparam(p->th, SCHED_IDLE, &sp);
+        }
+    }
+    return p;
+}
+
+void sm2_pool_destroy(sm2_pool *p){
+    if(!p) return;
+    if(p->threaded){
+        atomic_store(&p->stop, 1);
+        sem_post(&p->wake);
+        pthread_join(p->th, NULL);
+    }
+    sem_destroy(&p->wake);
+    wipe(p->slots, p->map_len);
+    if(p->locked) munlock(p->slots, p->map_len);
+    munmap(p->slots, p->map_len);
+    free(p);
+}
+
+size_t sm2_pool_fill(sm2_pool *p, size_t max){
+    return produce(p, max);
+}
+
+int sm2_pool_key_init(sm2_pool_key *key, const uint8_t d[32]){
+    sm2_fe dk, r, one = {{ 1 }}, t;
+    sm2_fe_from_bytes(&dk, d);
+    sm2_fn_reduce(&r, &dk);
+    if(sm2_fe_is_zero(&dk) || !sm2_fe_equal(&r, &dk)) return -1;
+    sm2_fn_to_mont(&key->dm, &dk);
+    sm2_fn_to_mont(&one, &one);
+    sm2_fn_add(&t, &one, &key->dm);
+    wipe(&dk, sizeof(dk));
+    if(sm2_fe_is_zero(&t)){ wipe(key, sizeof(*key)); return -1; }     // d = n-1
+    sm2_fn_inv(&key->inv1d, &t);
+    return 0;
+}
+
+void sm2_pool_key_wipe(sm2_pool_key *key){
+    wipe(key, sizeof(*key));
+}
+
+/* 队列为空时现算一对 */
+static int fresh_pair(sm2_fe *km, sm2_fe *x1){
+    sm2_fe k;
+    sm2_point P;
+    if(random_scalar(&k) != 0) return -1;
+    sm2_point_mul_g(&P, &k);
+    sm2_fp_inv(&P.Z, &P.Z);
+    x_mod_n(x1, &P.X, &P.Z);
+    sm2_fn_to_mont(km, &k);
+    wipe(&k, sizeof(k));
+    wipe(&P, sizeof(P));
+    return 0;
+}
+
+int sm2_pool_sign_digest(sm2_pool *p, const sm2_pool_key *key, const uint8_t e[32], uint8_t sig[64]){
+    sm2_fe en, km, x1, r, rm, t, s;
+    sm2_fe_from_bytes(&en, e);
+    sm2_fn_reduce(&en, &en);
+    for(;;){
+        if(pop(p, &km, &x1) == 0){
+            atomic_fetch_add_explicit(&p->hits, 1, memory_order_relaxed);
+            if(level_of(p) <= p->cap - p->cap / 4 && p->threaded &&
+               !atomic_exchange_explicit(&p->wake_pending, 1, memory_order_relaxed))
+                sem_post(&p->wake);
+        }else{
+            atomic_fetch_add_explicit(&p->misses, 1, memory_order_relaxed);
+            if(fresh_pair(&km, &x1) != 0) return -1;
+        }
+        // r = e + x1；r = 0 或 r + k = n 时换一个 k
+        sm2_fn_add(&r, &en, &x1);
+        sm2_fn_to_mont(&rm, &r);
+        sm2_fn_add(&t, &rm, &km);
+        if(sm2_fe_is_zero(&r) || sm2_fe_is_zero(&t)) continue;
+
+        // s = (1+d)^{-1}·(k - r·d)
+        sm2_fn_mul(&t, &rm, &key->dm);
+        sm2_fn_sub(&t, &km, &t);
+        sm2_fn_mul(&s, &key->inv1d, &t);
+        sm2_fn_from_mont(&s, &s);
+        wipe(&km, sizeof(km));
+        wipe(&t, sizeof(t));
+        if(sm2_fe_is_zero(&s)) continue;
+        sm2_fe_to_bytes(sig, &r);
+        sm2_fe_to_bytes(sig + 32, &s);
+        return 0;
+    }
+}
+
+void sm2_pool_get_stats(const sm2_pool *p, sm2_pool_stats *st){
+    st->hits = atomic_load_explicit(&p->hits, memory_order_relaxed);
+    st->misses = atomic_load_explicit(&p->misses, memory_order_relaxed);
+    st->produced = atomic_load_explicit(&p->produced, memory_order_relaxed);
+    st->wakeups = atomic_load_explicit(&p->wakeups, memory_order_relaxed);
+    st->level = level_of(p);
+    st->capacity = p->cap;
+}
@@ -0,0 +1,51 @@
+// sm2_pool.h
+#ifndef SM2_POOL_H
+#define SM2_POOL_H
+#include <stdint.h>
+#include <stddef.h>
+#include "sm2.h"
+
+/*
+  离线/在线 SM2 签名：签名的主要开销是 k·G，而 (k, x1) 与私钥、消息都无关，可以提前算好。
+    离线：后台线程用随机 k 计算 x1 = (k·G).x mod n，放进无锁的定长环形队列；
+    在线：取出一对 (k, x1)，r = e + x1，s = (1+d)^{-1}·(k − r·d)，只剩 4 次模 n 乘法。
+  只适用于允许随机 nonce 的密钥；确定性签名（sm2_sign_digest，k 由 d 和 e 决定）无法预计算。
+  队列为空时直接现算一次（计为 miss），签名结果同样有效。
+
+  内存有上界：容量在创建时固定，槽位数组单独 mmap，标记 MADV_DONTDUMP（失败时创建失败）并尽量 mlock。取出的槽位和销毁时的整个数组都会擦除。
+  后台线程以 SCHED_IDLE 运行，只在 CPU 空闲时补充，不与在线请求抢时间片。
+*/
+
+typedef struct sm2_pool sm2_pool;
+
+/* 在线签名用的私钥：d 与 (1+d)^{-1}，均为 Montgomery 形式 (mod n) */
+typedef struct {
+    sm2_fe dm, inv1d;
+} sm2_pool_key;
+
+typedef struct {
+    uint64_t hits;          // 从队列取到预计算结果的签名次数
+    uint64_t misses;        // 队列为空、现算 k·G 的签名次数
+    uint64_t produced;      // 后台线程与 sm2_pool_fill 放入队列的总数
+    uint64_t wakeups;       // 后台线程被唤醒的次数
+    size_t   level;         // 当前队列中的数量（近似值）
+    size_t   capacity;
+} sm2_pool_stats;
+
+/* capacity 向上取整到 2 的幂。background 非 0 时启动后台补充线程，否则只能用 sm2_pool_fill 补充 */
+sm2_pool *sm2_pool_create(size_t capacity, int background);
+/* 停止后台线程，擦除并释放全部槽位 */
+void sm2_pool_destroy(sm2_pool *p);
+/* 在调用线程中补充至多 max 个，返回实际放入的数量 */
+size_t sm2_pool_fill(sm2_pool *p, size_t max);
+
+/* d ∈ [1, n-2]，成功返回 0 */
+int  sm2_pool_key_init(sm2_pool_key *key, const uint8_t d[32]);
+void sm2_pool_key_wipe(sm2_pool_key *key);
+
+/* 对摘要 e = SM3(Z_A || M) 签名，sig = r || s；可被多个线程同时调用。成功返回 0 */
+int  sm2_pool_sign_digest(sm2_pool *p, const sm2_pool_key *key, const uint8_t e[32], uint8_t sig[64]);
+
+void sm2_pool_get_stats(const sm2_pool *p, sm2_pool_stats *st);
+
+#endif
@@ -0,0 +1,158 @@
+// sm2_pool_demo.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "sm2.h"
+#include "sm2_pool.h"
+
+/*
+  用法:
+    ./sm2_pool_demo                             正确性 + 命中统计 + 延迟分布（p50/p99/p99.9）
+    ./sm2_pool_demo sign <d_hex> <id> <msg> <count>
+        输出公钥和 count 个签名（一半来自队列、一半现算），供 Project5/sm2_pool_crosscheck.py 验证
+*/
+
+static const char *DEMO_D = "3945208f7b2144b13f36e38ac6d39f95889393692860b51a42fb81ef4df7c5b8";
+
+static void print_hex(const uint8_t *p, size_t n){
+    for(size_t i=0;i<n;i++) printf("%02x", p[i]);
+}
+
+static int parse_hex(const char *s, uint8_t *out, size_t n){
+    if(strlen(s) != 2*n) return -1;
+    for(size_t i=0;i<n;i++){
+        unsigned v;
+        if(sscanf(s + 2*i, "%2x", &v) != 1) return -1;
+        out[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int cmp_double(const void *a, const void *b){
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void report(const char *name, double *lat, int n, const sm2_pool *p){
+    qsort(lat, (size_t)n, sizeof(double), cmp_double);
+    printf("%-26s p50 %6.1f  p99 %6.1f  p99.9 %6.1f  max %7.1f us", name,
+           lat[n / 2] * 1e6, lat[n * 99 / 100] * 1e6, lat[n * 999 / 1000] * 1e6, lat[n - 1] * 1e6);
+    if(p){
+        sm2_pool_stats st;
+        sm2_pool_get_stats(p, &st);
+        printf("  (hit %llu / miss %llu)", (unsigned long long)st.hits, (unsigned long long)st.misses);
+    }
+    printf("\n");
+}
+
+static int run_sign(const char *dhex, const char *id, const char *msg, int count){
+    uint8_t d[32], pub[64], za[32], e[32], sig[64];
+    sm2_pool_key key;
+    if(count <= 0 || parse_hex(dhex, d, 32) != 0 || sm2_keygen(d, pub) != 0 || sm2_pool_key_init(&key, d) != 0){
+        fprintf(stderr, "bad input\n"); return 1;
+    }
+    sm2_pool *p = sm2_pool_create((size_t)count, 0);
+    if(!p) return 1;
+    sm2_pool_fill(p, (size_t)count / 2);
+    sm2_compute_za((const uint8_t*)id, strlen(id), pub, za);
+    sm2_compute_e(za, (const uint8_t*)msg, strlen(msg), e);
+    print_hex(pub, 64); printf("\n");
+    for(int i=0;i<count;i++){
+        if(sm2_pool_sign_digest(p, &key, e, sig) != 0) return 1;
+        print_hex(sig, 64); printf(" %d\n", sm2_verify_digest(pub, e, sig));
+    }
+    sm2_pool_key_wipe(&key);
+    sm2_pool_destroy(p);
+    return 0;
+}
+
+int main(int argc, char **argv){
+    if(argc == 6 && strcmp(argv[1], "sign") == 0) return run_sign(argv[2], argv[3], argv[4], atoi(argv[5]));
+
+    uint8_t d[32], pub[64], e[32], sig[64];
+    sm2_pool_key key;
+    parse_hex(DEMO_D, d, 32);
+    sm2_keygen(d, pub);
+    sm2_pool_key_init(&key, d);
+
+    // 正确性：不开后台线程，先放 256 个，签 1000 次，前 256 次命中、其余现算
+    sm2_pool *p = sm2_pool_create(256, 0);
+    size_t filled = sm2_pool_fill(p, 1000);
+    int ok = 0;
+    for(int i=0;i<1000;i++){
+        for(int j=0;j<32;j++) e[j] = (uint8_t)(i * 7 + j);
+        sm2_pool_sign_digest(p, &key, e, sig);
+        ok += sm2_verify_digest(pub, e, sig);
+    }
+    sm2_pool_stats st;
+    sm2_pool_get_stats(p, &st);
+    printf("filled %zu (capacity %zu), signatures verified %d/1000, hit %llu / miss %llu: %s\n",
+           filled, st.capacity, ok, (unsigned long long)st.hits, (unsigned long long)st.misses,
+           ok == 1000 && filled == 256 && st.hits == 256 && st.misses == 744 ? "OK" : "FAIL");
+    sm2_pool_destroy(p);
+    uint8_t bad[32];
+    memset(bad, 0, 32);
+    printf("key d = 0 rejected: %s\n", sm2_pool_key_init(&(sm2_pool_key){0}, bad) != 0 ? "OK" : "FAIL");
+
+    // 延迟：请求之间留 200us 空闲（后台线程趁空闲补充），与确定性签名对比
+    const int N = 10000;
+    double *lat = malloc(N * sizeof(double));
+    struct timespec gap = { 0, 200000 };
+    for(int i=0;i<N;i++){
+        e[0] = (uint8_t)i; e[1] = (uint8_t)(i >> 8);
+        double t0 = now_sec();
+        sm2_sign_digest(d, e, sig);
+        lat[i] = now_sec() - t0;
+        nanosleep(&gap, NULL);
+    }
+    report("deterministic (RFC 6979)", lat, N, NULL);
+
+    p = sm2_pool_create(1024, 1);
+    struct timespec warm = { 0, 200000000 };
+    nanosleep(&warm, NULL);                     // 等后台线程填满
+    for(int i=0;i<N;i++){
+        e[0] = (uint8_t)i; e[1] = (uint8_t)(i >> 8);
+        double t0 = now_sec();
+        sm2_pool_sign_digest(p, &key, e, sig);
+        lat[i] = now_sec() - t0;
+        nanosleep(&gap, NULL);
+    }
+    report("pool, 200us gaps", lat, N, p);
+    sm2_pool_destroy(p);
+
+    // 突发：没有空闲，队列耗尽后退化为现算
+    p = sm2_pool_create(1024, 1);
+    nanosleep(&warm, NULL);
+    for(int i=0;i<N;i++){
+        e[0] = (uint8_t)i; e[1] = (uint8_t)(i >> 8);
+        double t0 = now_sec();
+        sm2_pool_sign_digest(p, &key, e, sig);
+        lat[i] = now_sec() - t0;
+    }
+    report("pool, back-to-back burst", lat, N, p);
+    sm2_pool_get_stats(p, &st);
+    printf("refill: produced %llu, wakeups %llu, level %zu/%zu\n",
+           (unsigned long long)st.produced, (unsigned long long)st.wakeups, st.level, st.capacity);
+    sm2_pool_destroy(p);
+
+    // 离线阶段的单价
+    p = sm2_pool_create(4096, 0);
+    double t0 = now_sec();
+    size_t made = sm2_pool_fill(p, 4096);
+    double t1 = now_sec();
+    printf("offline (k, x1): %.1f us/pair\n", (t1 - t0) / made * 1e6);
+    sm2_pool_destroy(p);
+
+    sm2_pool_key_wipe(&key);
+    free(lat);
+    return 0;
+}
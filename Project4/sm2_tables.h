@@ -0,0 +1,216 @@
+// sm2_tables.h -- generated by gen_sm2_tables.py, do not edit
+#ifndef SM2_TABLES_H
+#define SM2_TABLES_H
+#include "sm2.h"
+
+#define SM2_COMB_TEETH    6
+#define SM2_COMB_SPACING  43
+#define SM2_COMB_BLOCKS   2
+#define SM2_COMB_BLOCKLEN 22
+#define SM2_WNAF_G        8
+
+static const sm2_affine SM2_COMB[SM2_COMB_BLOCKS][1 << SM2_COMB_TEETH] = {
+  {
+    { {{ 0x8e7045453f82677aULL, 0x3ab594ebdf64454eULL, 0x31ce10a745b7d22bULL, 0x2ef0eb9f8c16a022ULL }}, {{ 0x7f8507a41e95a4c1ULL, 0x12afc78e36cf9c59ULL, 0x4538b8c4d0bd964aULL, 0x4d47989c4ab5e304ULL }} },
+    { {{ 0xd4b8b68a0a057c80ULL, 0x180db57f828f82a4ULL, 0x65ae0bbef9594b60ULL, 0x3a0a5e11306ac098ULL }}, {{ 0x00f73ee3106e9753ULL, 0x1da52653abf21f7dULL, 0x42db67d92e1a7b53ULL, 0x494fde3aee574769ULL }} },
+    { {{ 0x959e2f38ab4b1aabULL, 0x58d91f4ec1991b54ULL, 0x23353c4d974e7114ULL, 0x3c7b906633735b96ULL }}, {{ 0x6f6b8f7f558c9e3eULL, 0x92002853898bccc5ULL, 0xf2be59f5b3c98d28ULL, 0x756b8f14117d91a8ULL }} },
+    { {{ 0xba2c8d82671bf4eeULL, 0x45b17b4d230defa3ULL, 0x67936a27e0e83374ULL, 0x1ea1ed60a14777c7ULL }}, {{ 0xb69a912495cc4aa7ULL, 0x0b0a292dc6f03dcaULL, 0xc755de1a96c25c6cULL, 0x7065c1178a4b7ff8ULL }} },
+    { {{ 0x1bb5f2a628beac3cULL, 0xb2faf3bc59097c8bULL, 0xa6f52403ed660cf0ULL, 0x209bc819cd7032eaULL }}, {{ 0x52b00a195a958693ULL, 0x81e215e9be308fabULL, 0xc16fc8df6ece85c1ULL, 0x0923a3bd74e4de89ULL }} },
+    { {{ 0xd25fe19474e87156ULL, 0xb99e2ef6fa376b91ULL, 0x9d04ea607996570fULL, 0x20f0c138024e5da0ULL }}, {{ 0x856f8ed89206ab33ULL, 0x15be9fcf8ce32743ULL, 0xec4ad3b5c61a33f0ULL, 0x68da1460f2d17b81ULL }} },
+    { {{ 0x7e7ed0d5ce91b22cULL, 0x8dc526d9134b1ec7ULL, 0x65f8d4a5877c3debULL, 0x787b5629905dd4e2ULL }}, {{ 0xf3b3ed1ddc15efc3ULL, 0x02131a216a2986a3ULL, 0x6c97db166747102dULL, 0x803368a1602fb06bULL }} },
+    { {{ 0xf3d48a098ec0a4ddULL, 0x519252dd6c4a94eaULL, 0x2e13e6847006eaa0ULL, 0x630a2cbfaa71ce67ULL }}, {{ 0x3fd98418246477b1ULL, 0x9d10b88c23313770ULL, 0xff6c97e5e7818930ULL, 0x315acd32f90dd9d8ULL }} },
+    { {{ 0x0ab162f203d952f6ULL, 0x2ef510a78ca1d023ULL, 0xd7c69db20664d6caULL, 0x0ebdd862e3524efeULL }}, {{ 0xd197ab0ff439d753ULL, 0xbf50b247413acec3ULL, 0x827210a84a04d475ULL, 0x3dc89452b0a86dbeULL }} },
+    { {{ 0x82f8a3df4d29c449ULL, 0xa8e67ef4b1ff3e3dULL, 0x2d1404065c28a9b7ULL, 0x44496d7c282fd538ULL }}, {{ 0x7aa56a469d221271ULL, 0xbd98d6b7305bb8ccULL, 0xc77bf8c5e8ff8a7dULL, 0x00790b588a03296fULL }} },
+    { {{ 0xe49f398f3ca4d445ULL, 0xb4cd5a4eeb004e1fULL, 0x0fa6e27afd7882caULL, 0x49f7fad254bbb0abULL }}, {{ 0x3d3b7af71608ac90ULL, 0x700d1b5993352940ULL, 0xd34312c02323c62dULL, 0x78f65cba1f85ac94ULL }} },
+    { {{ 0x1d9edd081fd54868ULL, 0x20613727a99ed9f7ULL, 0xea2d5e01b9f9f780ULL, 0x4e73a10145c9febeULL }}, {{ 0x2b0bf81690b82153ULL, 0x53002706be35a516ULL, 0x98e2232af05f8d66ULL, 0x53773ddcdd99f427ULL }} },
+    { {{ 0xc653672dc806c225ULL, 0x63ad0318611cfb72ULL, 0xd603d8f381242578ULL, 0x1ebaadc07786cf4fULL }}, {{ 0x5a325fd0b460c523ULL, 0xb887b937ebb7abbbULL, 0xc8848fe00810cf72ULL, 0x567eade1a3f9d3e5ULL }} },
+    { {{ 0x91e0d08ae4ca2ed9ULL, 0xd2e00b2c94dc9628ULL, 0x1185c3de99982f8cULL, 0x347a938b3269fa4bULL }}, {{ 0xcf9cab47842f9a44ULL, 0xf824ad7defd2858cULL, 0x32561ae7739a2c77ULL, 0x3553e97f10ed60e1ULL }} },
+    { {{ 0x9fefa40d5a4df9c2ULL, 0x71633c37728878feULL, 0x6c53a6fdd7deed33ULL, 0x1fd8c2cd74c60498ULL }}, {{ 0x42af2c40f54a0b38ULL, 0x92169d129cda14d7ULL, 0xb445be1d3357a573ULL, 0x84749ed927ed3e34ULL }} },
+    { {{ 0xb18feb338a0cb46dULL, 0x2eaa6649217677c7ULL, 0xb643009802053897ULL, 0x3e3194cf465af5d4ULL }}, {{ 0x7770dd4270acd3bcULL, 0x8cc30bdab16f24efULL, 0x17051f5eb36d46d9ULL, 0x448b6ccb47749dc9ULL }} },
+    { {{ 0x0170c85f6b8ba141ULL, 0x426960af1a723d72ULL, 0x56db887722d4cc9cULL, 0x3d2fa63a277fada3ULL }}, {{ 0x784334ecacdb97b6ULL, 0x89932e72220db8f4ULL, 0xaec09eb6fbe17e39ULL, 0x05aaa4be3af091a7ULL }} },
+    { {{ 0xc9c24f8584e3b196ULL, 0xffb0c0b7a90f4b5aULL, 0x98a4d80f91055230ULL, 0x5ff3e63bf28f29e6ULL }}, {{ 0xf0ae1a5c3304c2d0ULL, 0xf0b0ffec28787588ULL, 0x14bc97d72df8937fULL, 0x4eea161356f94ca2ULL }} },
+    { {{ 0xc6222265b4c21cf5ULL, 0x4c66c4578c1dbda8ULL, 0x4d145b94dbd633b9ULL, 0x03dd8965bf9e8182ULL }}, {{ 0xbcbe7292798ba6c0ULL, 0xce354992ef8d797cULL, 0x29df5a73e82e0bf4ULL, 0x1403ad24f8c1e7d2ULL }} },
+    { {{ 0xa96ed8599cc8dbd1ULL, 0x5469bc585452de4aULL, 0xac0659512739ab7cULL, 0x4a5749f7f4368469ULL }}, {{ 0x0e7b3c725a61ff32ULL, 0xd54c9cb357f18bb7ULL, 0xa01b3bc9319e5550ULL, 0x0dbbcbf7ab7364b2ULL }} },
+    { {{ 0xecae3288747e0f52ULL, 0x1272254e643c77aeULL, 0xe4e8d70f7251c50eULL, 0x5bb84afe3e4d1900ULL }}, {{ 0x3c4a27334f3c176cULL, 0x43f256bb5ba3602bULL, 0x44bc2ab7d2e67e45ULL, 0x106fa4b1c49a87f5ULL }} },
+    { {{ 0xdfd302318a01c174ULL, 0xed14b08096ece2f1ULL, 0x7dfddf7355f56162ULL, 0x718e8a562bd86447ULL }}, {{ 0xe0b5dad048cd4b2cULL, 0x0ac623dd7a702db5ULL, 0x5607eb2d6717074cULL, 0x453fd8f09ac8ae8fULL }} },
+    { {{ 0x2a8a5e84d2f76e52ULL, 0xb32eadb73c9f8f62ULL, 0x67189e23014c479fULL, 0x50be58837229ad2fULL }}, {{ 0x396adc9681b8fde1ULL, 0xe8a3541cb86649caULL, 0x0b605b324096221cULL, 0x5fec9a317d10120dULL }} },
+    { {{ 0x7dcde21b88720d3dULL, 0xb4dfb04c3f929d3eULL, 0x8780f8abdda71fbbULL, 0x2f64dacbd8f4e9a8ULL }}, {{ 0x2f78a92ee4d63173ULL, 0x4ac538c62044bc65ULL, 0xcb27aac7f51fc2dcULL, 0x18c61b3408f30912ULL }} },
+    { {{ 0x527d65416bdd3e57ULL, 0xa13336a62db36b67ULL, 0xd8f1bc47f2b9ea0eULL, 0x7594b8f47698ea78ULL }}, {{ 0x8d370f001135c837ULL, 0x9f5828c3511bdb86ULL, 0x3a7a172c81be9568ULL, 0x7f886615383bcedcULL }} },
+    { {{ 0xf92944f29040494bULL, 0xc702f7318aa05050ULL, 0xb1573b6dd1d3af5cULL, 0x7ae2b47582c59f25ULL }}, {{ 0x4eb3c0e00bde4dfeULL, 0x622b916899819f59ULL, 0x70dbf3fed360c849ULL, 0x6b3e9aa0e1cdb795ULL }} },
+    { {{ 0xf5ae85cdc46e4e8fULL, 0xb4f4672c23cdbcffULL, 0x3b2ea8a3d9b56ec9ULL, 0x6ba7acdfb7a0ff8cULL }}, {{ 0xaae2cb89f878a245ULL, 0x0751719d688286b0ULL, 0xa67607fff80a693eULL, 0x4c82cda1d62ca15aULL }} },
+    { {{ 0x8fada9a37dada009ULL, 0xb66e22daed69e264ULL, 0x8dd4a597949406a3ULL, 0x491fcf22199926e4ULL }}, {{ 0x7349a51c49326f07ULL, 0x23c05ed78f16dc08ULL, 0x382ba7b045d975f7ULL, 0x2ff3f5ee9b330493ULL }} },
+    { {{ 0xcea99b1a090aee5aULL, 0x49e003198f4bc211ULL, 0x29ae463e5fb407c0ULL, 0x069cab7abbb6f9f4ULL }}, {{ 0x525bdb69891b8781ULL, 0xcebabf5b83183f7bULL, 0xfdecb9cc3ddfd9b3ULL, 0x1ca082d6c58876a3ULL }} },
+    { {{ 0x5bf0c7fd030ebd59ULL, 0xf0abaf41b73aa23bULL, 0xd1376c0d2bd64863ULL, 0x27d170ecf7e6847cULL }}, {{ 0x02947322baf39ab8ULL, 0x2d92c9b7bbacf548ULL, 0x12d7efac01f51e6eULL, 0x47b0ca6803de73faULL }} },
+    { {{ 0x6f5de8b1a499d834ULL, 0x79d7e5c3cf290c57ULL, 0x45de34088ea6e09aULL, 0x5f9d59821ccf8bb9ULL }}, {{ 0x7d2df852aab36ef1ULL, 0x4b41ca8d360a77b5ULL, 0x3397a6edd23a7735ULL, 0x7bbf1fe1ffb52681ULL }} },
+    { {{ 0x94b4e35061e6b1fbULL, 0x1bf3b0b4adb31484ULL, 0x756048a10c219407ULL, 0x7c2a48d1fe2f2073ULL }}, {{ 0x64c5f8952e0582ecULL, 0x0c9d8744caae2513ULL, 0x5b72ca80141528c9ULL, 0x3b34ff460534c0f5ULL }} },
+    { {{ 0xdda7e40632fa318eULL, 0x596421b3b5f79a0bULL, 0xe2d4b492eba6b2e8ULL, 0x4f810e937f9f3426ULL }}, {{ 0xc3b71a24a6045f99ULL, 0x1a4f075d36ad9fe1ULL, 0x0d94816aadb3f63dULL, 0x2d6098c5d7af160eULL }} },
+    { {{ 0xf3f78b1a60058b2dULL, 0xe46edb12fb47e566ULL, 0x56f64ffac00160d5ULL, 0x5b402944cf24c953ULL }}, {{ 0xa3da437f07a10604ULL, 0x6a321fdd4ac94898ULL, 0xfc2c808cee431a94ULL, 0x7a2999af10c9cad7ULL }} },
+    { {{ 0x602d026e7708cd42ULL, 0x4c87671aa4f2a32eULL, 0x66d499aba45a2935ULL, 0x0cf43eb1c8bfe893ULL }}, {{ 0xd5dd5d4ace9639d9ULL, 0xb3aa019a0fe36ff8ULL, 0xfefabe831cda81d7ULL, 0x6b66556b80eb60bfULL }} },
+    { {{ 0xbf3ae11f7f702d97ULL, 0x351e6108778fcdfeULL, 0x100288d81e2b398bULL, 0x651570dea5277e2cULL }}, {{ 0x13e96dacf49a0dfaULL, 0xe3dc1526589e6a7fULL, 0xb89699f3cba8d263ULL, 0x3ab2d6b2104acf69ULL }} },
+    { {{ 0xcff676a69ae7158dULL, 0xb5bda6dc3097b111ULL, 0xd9e94e9dcbc5c9d7ULL, 0x7ef597c4e7e92048ULL }}, {{ 0xe3717984b63dd4e8ULL, 0xfa37e16981d81e3aULL, 0x700bd92515540898ULL, 0x851d913fcf6a26e6ULL }} },
+    { {{ 0x3c04822282c5d436ULL, 0x26a03d0579d6a3b4ULL, 0x3cc3c46947771d89ULL, 0x68e700d8edc4aa5dULL }}, {{ 0xfe3ce5c052398e56ULL, 0xb64f1a568a32390fULL, 0x19d2df8f46bb1a03ULL, 0x505fa3d6e7101d6fULL }} },
+    { {{ 0xdac20037b2de4678ULL, 0x9851e133f5d09fddULL, 0x2f3e229c5d3015cdULL, 0x3855388110800f4cULL }}, {{ 0x69fccbc07d63fbe5ULL, 0xa5a108b3887259e2ULL, 0x9dfec1f9da9bdbd7ULL, 0x2b6e15a1f65298a2ULL }} },
+    { {{ 0xcfcdb9f86f38f38cULL, 0xf492deb60e1c86d9ULL, 0x054b7b0027613c34ULL, 0x2c0bff4394b1aa7dULL }}, {{ 0x06c6487c8edecd40ULL, 0x6b2da89464c68857ULL, 0x1e72c1963964543cULL, 0x283a64569762f1d7ULL }} },
+    { {{ 0xb3eb054eff5da3edULL, 0xe9aaadea4b8cfa51ULL, 0x4c2757db9e77234fULL, 0x4d418736a6152845ULL }}, {{ 0x3d9e6a175d2ea2a3ULL, 0x6bb4e0d9ec999e82ULL, 0xbd7285d1cbf4e6f8ULL, 0x3282929c1b78ecdeULL }} },
+    { {{ 0xcdd0d81a8023df27ULL, 0x14d6bf5a2e3236a2ULL, 0xcf87af74e33f14b6ULL, 0x50d39cb8464be2a3ULL }}, {{ 0xf812a824012aece6ULL, 0x881603625f1de7fdULL, 0xbb4c599efad780dbULL, 0x7c2671c2aa894d0dULL }} },
+    { {{ 0xc4abd16bbed8c898ULL, 0x42a1fa7b5bdf99e9ULL, 0xfa0aacc377998f22ULL, 0x46bafe7296ab9ad9ULL }}, {{ 0xa0b50fb7acf99963ULL, 0x8dc261c799df9898ULL, 0x94aa5740a40027fcULL, 0x68defabc930ad747ULL }} },
+    { {{ 0x10cd69e8aa9d4621ULL, 0x49b4deea55fb1e46ULL, 0x7318674ac5bfffa2ULL, 0x57e59626070c3456ULL }}, {{ 0x008dd90538f41d7dULL, 0x3fc9e02e98f7cbd5ULL, 0x1e955a90740c1a3dULL, 0x4862946e0e50ae71ULL }} },
+    { {{ 0xc5dfa320eb8ca14dULL, 0x8a59786a7517efceULL, 0x4eb58e13e22284d1ULL, 0x6815b07b1ff9abf4ULL }}, {{ 0x0fe2b56f00cd9c46ULL, 0xa9e1455a6e2bb78aULL, 0x9aad41e1bb48d2c5ULL, 0x682d5606dc9c7c14ULL }} },
+    { {{ 0xcfe97ed3dcefa0a1ULL, 0x035a799786cdb6afULL, 0xbe74d25aa3dc58c9ULL, 0x5e2bee46ce307961ULL }}, {{ 0x2eeffc0f8f0cb3b8ULL, 0x2d75f88b3d661d24ULL, 0x00778757f0ab234dULL, 0x0c24efefda55309cULL }} },
+    { {{ 0x95cca37c6fe966a2ULL, 0x024f2b60d2f60fe1ULL, 0xcd5f55c68d7145e6ULL, 0x516e2b96927188a3ULL }}, {{ 0x7b7b2a3a841f84ebULL, 0x2a0ed64be37fbf7fULL, 0x39a31d29af1ff855ULL, 0x7eb8503f2703057cULL }} },
+    { {{ 0x63bf96070930047dULL, 0x1ab7708803974926ULL, 0x869c75ef387b0aaaULL, 0x3cc1341dd25b5ad0ULL }}, {{ 0x5dd6887dc80cbc56ULL, 0x3b93a34ad9517994ULL, 0x33803941a95f5ae2ULL, 0x072554c6b4c20fcaULL }} },
+    { {{ 0x9cdad544aa806503ULL, 0x1c8078d8e397cf2bULL, 0x68c97cdea9f7fb97ULL, 0x4f31a6a7afff03c0ULL }}, {{ 0xaa6edf38d203378bULL, 0x0789052a0f829557ULL, 0xfc616fd1113944f5ULL, 0x567097a382c2787bULL }} },
+    { {{ 0x205344c8a0c908bcULL, 0xb1d9ee54b14baebeULL, 0x88cedee73ae6e96fULL, 0x7897d3f56b8d33cfULL }}, {{ 0xee1e939b8591df08ULL, 0x06529f05efa95493ULL, 0x82a9a924223758a0ULL, 0x3754dcacfd2b51a7ULL }} },
+    { {{ 0x81a8b210a98429bdULL, 0x6c6e902fa44f8bd5ULL, 0x8b2c0c4afd353603ULL, 0x5cd652059f28a3cfULL }}, {{ 0x9daeeb9b6a417fceULL, 0x85ac76d2632c2a80ULL, 0xfef40a6e3dd7c8a5ULL, 0x841194f0bea82be3ULL }} },
+    { {{ 0xd74f32dbb12a1f60ULL, 0xb31773d5d15c418cULL, 0x3865ac90d4e733c6ULL, 0x2aa13ed7e81ecadfULL }}, {{ 0x08f46a58b72b4876ULL, 0x3fd5dad585ac1a18ULL, 0x7318f10a7a911cc9ULL, 0x8339f23a40d9d236ULL }} },
+    { {{ 0x2678faee4da56c93ULL, 0xc0194555d27d0a2dULL, 0x76bc106e63c64a55ULL, 0x5c111c3b0275dab6ULL }}, {{ 0x523d43487eeebe55ULL, 0x15e9b6e138b6f2dfULL, 0x20846274f3889804ULL, 0x61652a7f609b5a50ULL }} },
+    { {{ 0x3b74a88d9248ab30ULL, 0xbcfaa966898ed917ULL, 0x64aeb9742cc5c9beULL, 0x09e31e4146229696ULL }}, {{ 0x26f8e84bf552157dULL, 0x5460e4696611b7baULL, 0x9ce5537edc70edb6ULL, 0x157230281f4c10faULL }} },
+    { {{ 0x1811ea1825fc4c89ULL, 0x68604e912cacfb62ULL, 0xaca48e78c21abbd0ULL, 0x73c1eeec3bb6105bULL }}, {{ 0xc390e80bcf2342deULL, 0x13c3628a5df3bdecULL, 0x9c41cb5d1e7b0288ULL, 0x40bc364e934a3779ULL }} },
+    { {{ 0xbb36beb63d39648aULL, 0xa42c7237ff44e9d9ULL, 0x88d9b5e52b4dbf76ULL, 0x05b2c77a4d0f3c8eULL }}, {{ 0x00ab02302802685bULL, 0x3c32c64de5ab4086ULL, 0xa473a8806ed1a5f0ULL, 0x3d840e3cec172000ULL }} },
+    { {{ 0x4fb09bd4262b7787ULL, 0x180b9474c0082412ULL, 0xf01612c00479c9fcULL, 0x7ecd48648d379d72ULL }}, {{ 0xfe3034eb3d92af2eULL, 0x3f1c5ece063ea4aeULL, 0x512fb08da8835a57ULL, 0x6d5575f5418de4aaULL }} },
+    { {{ 0x71e4b68e417668d7ULL, 0xfdbc28495204aea1ULL, 0x2136414e4df12934ULL, 0x1c52d910bec1fac8ULL }}, {{ 0xd8cbb82401baff68ULL, 0x79fb2c067963dd66ULL, 0x696a74aa95a75276ULL, 0x0e005fad801dbedfULL }} },
+    { {{ 0x190e2e173e070e96ULL, 0x54443f35166f84b0ULL, 0x183f67bcf20bc33bULL, 0x7405c4bba58600a7ULL }}, {{ 0xc9bd701b5aa22829ULL, 0x84bb672029dccb4aULL, 0x112d3a74c35eac98ULL, 0x12f0a5bfa79894fbULL }} },
+    { {{ 0x833926413c44db13ULL, 0xd36c37e3ca0d0615ULL, 0xc5fe1c1940b00fe0ULL, 0x774be2b79098ce86ULL }}, {{ 0x790288798e43e286ULL, 0x814b0eccf076e800ULL, 0x6f8639d05e7c1217ULL, 0x033977f78e0d44a3ULL }} },
+    { {{ 0x6b064312bbd6d917ULL, 0xbc8fb55a7d5652bfULL, 0xfbf5c179c50c6c43ULL, 0x2b8b5b9d14329d1dULL }}, {{ 0x6ce43c16d4ddb05fULL, 0x5e9a5084ea529bbfULL, 0xd94f9a38f7a46dbdULL, 0x65a275b9dc179a34ULL }} },
+    { {{ 0x111e9c524cfee18eULL, 0xef2d303712aa89f8ULL, 0x9ce5f613b981e703ULL, 0x4fa74796bfbe38eaULL }}, {{ 0x4963fb350b2206dfULL, 0x6895a8d8d382767cULL, 0xe214b7c002dd7affULL, 0x77a80a70614d7e38ULL }} },
+    { {{ 0x4f1763e903fdddb4ULL, 0xc098e582dc361d33ULL, 0xed79b80a1fe4b063ULL, 0x76b19e2b4690c330ULL }}, {{ 0x51902b25156be942ULL, 0x47fb319d19d1371eULL, 0x82f43ad7cf126bc6ULL, 0x5f91d1fb2f13e92fULL }} },
+    { {{ 0x863dd8e3bc0ca174ULL, 0xf441f2134a02004fULL, 0x01cab840a9247e75ULL, 0x824c391ec43f997bULL }}, {{ 0x7b5489cfafd05094ULL, 0x49c9245f5dabef3aULL, 0x6e1866d6ddcb91aeULL, 0x702d9642a5c9ed3dULL }} },
+  },
+  {
+    { {{ 0x79cc1bb382e38433ULL, 0xba75a41745ba1a7bULL, 0x18787237f38e8297ULL, 0x3c6d69cb73475742ULL }}, {{ 0x2aab9bb9ae2e34b6ULL, 0x277cea43a3e1eb0bULL, 0x1bf907697e87ec68ULL, 0x66f3f136839c69e9ULL }} },
+    { {{ 0x82f4ac1283a65ed8ULL, 0x4a8e817458f1be02ULL, 0x87866a8aaaa2da83ULL, 0x6bfd8efebbb283fdULL }}, {{ 0xd9833fab8e43b356ULL, 0x94d280216c3388b6ULL, 0xfdec96b851cbf98fULL, 0x06846143c41fc4dcULL }} },
+    { {{ 0x669afe52bc55d208ULL, 0x661842d3479ab90cULL, 0x33594ac431aa99ebULL, 0x1627fc320d6c3041ULL }}, {{ 0x9e3b0de2c0aa06dfULL, 0x042d596182c65f5cULL, 0x88caf94d17349972ULL, 0x0c563429927a48ebULL }} },
+    { {{ 0x5d8143eb60931f23ULL, 0xb3ad433e5e60c20fULL, 0x99af1029d5f09923ULL, 0x68f66f1508cb25e7ULL }}, {{ 0x2414c8cd894ba95dULL, 0xc66c06cf1fa6f7a5ULL, 0x78bcd8cb8ed8af4aULL, 0x58a61e4d7a33b930ULL }} },
+    { {{ 0x584e322caf5bd766ULL, 0x27021bb0a639e5faULL, 0xbb8c128e8a45d90fULL, 0x66668f0a073ab16cULL }}, {{ 0xbdce7314c72b0d49ULL, 0x0f674de7050928dbULL, 0xf264439b770f45caULL, 0x66fa8a07b43a829dULL }} },
+    { {{ 0x6360bc4ba8a5a15aULL, 0x909cddb5ca4c6674ULL, 0x2a61aa25624fa84bULL, 0x370f4cc83cf7e5bcULL }}, {{ 0x7d6ece2686a64fb1ULL, 0x6e37bbf569e4cc49ULL, 0xb41cea3abd193588ULL, 0x14e89d2d1a78c2d7ULL }} },
+    { {{ 0xa5a492e34cdaebfcULL, 0x936b545fa379e0e8ULL, 0xdc84024676eeaa36ULL, 0x368fa8512fb6b4f8ULL }}, {{ 0x0ed8b1bfd66bb728ULL, 0x5ca4fdf4cd7d8cd0ULL, 0x56b90b2367a561b3ULL, 0x1f08fdc6cffecc46ULL }} },
+    { {{ 0xf2105d046427065fULL, 0x32d00c0b17c39733ULL, 0x3bce2e90b186b597ULL, 0x5fffefb7ff483a5aULL }}, {{ 0x7a683bea785fb831ULL, 0x54eba3756caca3f2ULL, 0x2bf9f8b194e490d6ULL, 0x41bb02a4c032adf5ULL }} },
+    { {{ 0x9eb0f4a0a5b7f7a8ULL, 0x57b28169fe7c83a9ULL, 0xcf51b5eeac926e81ULL, 0x395ae8d970d53641ULL }}, {{ 0xbde16dd31aa6c988ULL, 0xab145e282636894aULL, 0x30442026a9973580ULL, 0x7a9cfff24f2bb725ULL }} },
+    { {{ 0x21943ba2bce71810ULL, 0x1e3bb9ec50c930c5ULL, 0x56fc2bf15dc15925ULL, 0x0df543ab968eb9ecULL }}, {{ 0x9d0a419213e702f5ULL, 0xa3b365f3df40a44eULL, 0xb782683344e2e344ULL, 0x0f0fe78d584de4f0ULL }} },
+    { {{ 0x0043c0d3c285c7caULL, 0xae14999d3a25ea4fULL, 0xc2c2085d6e2d86f5ULL, 0x4bc873fdc5424879ULL }}, {{ 0xebed8b677fed4a11ULL, 0x725dbc22853f76ddULL, 0x387fc1ae88ada74fULL, 0x1c9aa058b1512946ULL }} },
+    { {{ 0xb3a13e39a6045aafULL, 0xa3e2e5d638b3ff91ULL, 0xc1c57a35ccfe6fa7ULL, 0x3ac8d8b1b8b17765ULL }}, {{ 0x967618f8490fa182ULL, 0xe11d85dc7a423200ULL, 0xc72ac0d4da692bdbULL, 0x72fa7140bb6d78ccULL }} },
+    { {{ 0xa89b15a02fb2b77aULL, 0x847e300875e10f98ULL, 0x65ade9dabac4d614ULL, 0x3a3f46ba84d1c1aeULL }}, {{ 0x260e7aebc35c5c49ULL, 0x63fd7b39f278b385ULL, 0x3b219fb95ec8e689ULL, 0x3adf5eead45c8de3ULL }} },
+    { {{ 0x94b76f236e9b612eULL, 0xd88a2877883a713cULL, 0x76bbafd7ca419b54ULL, 0x51b9a419dbadbd80ULL }}, {{ 0x5d5a883f32def061ULL, 0xf4231f21d7b815dbULL, 0xf281b0ecc0bd1388ULL, 0x2d39c426a655494dULL }} },
+    { {{ 0xa0e7fb828bc2ce6eULL, 0xc9279f37cd2afec8ULL, 0xe4945ea88c9e21ecULL, 0x5a0979180ff381d1ULL }}, {{ 0x3c2aa57bca2734a4ULL, 0x7a4a0503ced0a7b7ULL, 0xd3a1aafb0da07235ULL, 0x35eb6c60c11fa79bULL }} },
+    { {{ 0xd3f0af1afe143b03ULL, 0x77f2cd8c33079006ULL, 0xc50b979cb1c49661ULL, 0x18f826fb6202221eULL }}, {{ 0x2db3edd01f77a9fcULL, 0xcc2409e642f39b12ULL, 0x5079cde98bfe4380ULL, 0x7bca0b830906e88cULL }} },
+    { {{ 0x75f8f2910bc33ff8ULL, 0x815ae9cb0c7a1589ULL, 0x25a414c325053837ULL, 0x3faf5f97d827a771ULL }}, {{ 0x22b86ad33a51fd9fULL, 0xdadd843be5d0daddULL, 0x8293f389ba5f4061ULL, 0x028dbacec814142aULL }} },
+    { {{ 0xd1fd485dde14b1cdULL, 0xc2b0407f6bebaf82ULL, 0xbc5af30d21473db4ULL, 0x7f2f1473cd0e2104ULL }}, {{ 0x6290fd89c80149b4ULL, 0x902b241a71c1a5f5ULL, 0x5c02f1e63ab7ffbeULL, 0x5d0fa8848ff1fa7dULL }} },
+    { {{ 0x24d94efb83167c63ULL, 0xc474a70a5f2547f4ULL, 0xc0e2d690bb73dd0eULL, 0x4f8d116edee1f654ULL }}, {{ 0xa8786f23ba521edfULL, 0xd9a86be2ecb89cfeULL, 0xbaa0a31da7315ac9ULL, 0x4df3c2d7f95c0bddULL }} },
+    { {{ 0x09869598ce6442acULL, 0x8abe419d0cccab8eULL, 0x9ce56f3b52fab3d1ULL, 0x38927ae3f2ba0abdULL }}, {{ 0x78fad2ce6ba680e0ULL, 0xb75728e0fd4864b6ULL, 0xe5d6984f007c02e8ULL, 0x67dba3143f1dddf5ULL }} },
+    { {{ 0xc8cafb2fc6d0fd9fULL, 0x85ec1ae9f17d0ba8ULL, 0x7886aa9ee6e06eeeULL, 0x6b3404ac891edcf3ULL }}, {{ 0xbee50b98c60a7876ULL, 0xd21725ad93912129ULL, 0x613f3dc38cd9d4c2ULL, 0x62e10938c4105538ULL }} },
+    { {{ 0x7219fde7d683403eULL, 0x8ce9c8943386772bULL, 0x072768666286b069ULL, 0x78f20bbe5b036d1eULL }}, {{ 0x6d9345add128dc07ULL, 0x13bb9c2ee39b5cb8ULL, 0xce7de2f5db101681ULL, 0x66679ad3a7de382cULL }} },
+    { {{ 0x61dacc973cb19415ULL, 0x1fd3087f43106c23ULL, 0xb2af5d0b38d40b89ULL, 0x0de64d5fa5a68745ULL }}, {{ 0x16a288634e808154ULL, 0x8914050d4b0c3f32ULL, 0xf7b183f97cbbe980ULL, 0x38875af97d7fab8fULL }} },
+    { {{ 0xa6169f4220542859ULL, 0xf1dddce61bd6ea08ULL, 0x01aceec6438b5f1aULL, 0x8202974b1e904ca8ULL }}, {{ 0x213162f08763f7a5ULL, 0x7def15beab1e8ad1ULL, 0x049c3d8a78affa45ULL, 0x62b249e4ea9accecULL }} },
+    { {{ 0xa463234353f01a86ULL, 0xcafe7049921af539ULL, 0x99d1e9a5153c1545ULL, 0x3e755749989ea2f3ULL }}, {{ 0xbecbff54c400424fULL, 0xac8b9fba55424602ULL, 0xb20701083bada737ULL, 0x2764c6663fe03039ULL }} },
+    { {{ 0x4fda809eed9c8fb2ULL, 0x5de89c505254b0acULL, 0x86221ad8412019f7ULL, 0x6a41623f36afe27dULL }}, {{ 0xa3dd893657a7f69fULL, 0xea401b2308881a3bULL, 0xba7b69eacf27af7bULL, 0x5bf19c9b120c8c48ULL }} },
+    { {{ 0x913269ff69558cb3ULL, 0xc04aa16f76a259aaULL, 0x3f1010da68fdfc1cULL, 0x753ac669b8b1dbe5ULL }}, {{ 0x41fa3772aa2ff471ULL, 0x3aaf8cf5c442af0dULL, 0xde67cf39aa0c9c6fULL, 0x4a715a89cc4b8400ULL }} },
+    { {{ 0x4372b49b049f9635ULL, 0x421ba5e5d35e98acULL, 0x647d06f41f917643ULL, 0x6277226d74524a97ULL }}, {{ 0xfe7138508ec4a418ULL, 0x0c5fbe1942dbf8eeULL, 0xc3a4994bf023c4ecULL, 0x562745e371e42237ULL }} },
+    { {{ 0xe187ebbc2d0ce21eULL, 0x1e8519d72dd1a585ULL, 0x379da3600dde2138ULL, 0x1cee90af7208b137ULL }}, {{ 0xd2a7a85f40270b0aULL, 0xd33edb3fe837cc80ULL, 0xe2c6a60815dfbfafULL, 0x662aa504255d4c36ULL }} },
+    { {{ 0xe39cba7f9567a10dULL, 0xa8c419b80486fcfbULL, 0xf8050c8b903f38f6ULL, 0x2269313978d02197ULL }}, {{ 0x83fea86206992665ULL, 0x0fd39593d88a1ed7ULL, 0x8d06cd73aee7c4b6ULL, 0x49cfcf7825cc2b43ULL }} },
+    { {{ 0x15452180377eed6fULL, 0xb99caf635f9ab8d9ULL, 0x131521b51b51ae94ULL, 0x69ae3086e062db3fULL }}, {{ 0x2ed82e16504db3deULL, 0x57985484f62cf291ULL, 0xd0d8badd2f6e0de5ULL, 0x59d55fb4e1164f5eULL }} },
+    { {{ 0x56f162c16458a9b4ULL, 0xeef1a2417ca7bfccULL, 0x5fc9bf211d389bcfULL, 0x3d3f218175382891ULL }}, {{ 0x2239175fcd9d5a37ULL, 0xd716e227a35dac2fULL, 0x214ea630b6673ed4ULL, 0x4fbdfa40bd9ffa85ULL }} },
+    { {{ 0x8a4c9b4faf2f6b31ULL, 0x2f357ff059be27d8ULL, 0xaf40fa4457eb90b9ULL, 0x26ad279f54af11adULL }}, {{ 0x02203e70ad66d063ULL, 0xf197f847f552b6f8ULL, 0x5224c5aa8d3eaf8aULL, 0x7029626deea4c5c7ULL }} },
+    { {{ 0x0721d90a6aff3f00ULL, 0x62416deb0e6051b1ULL, 0xc34bea1b0ff7562aULL, 0x807f7f12c86ec6a6ULL }}, {{ 0x2c6925fab2474db5ULL, 0x3100502a377da5a9ULL, 0x8489b8827189bef4ULL, 0x07d49cfbe2bf7793ULL }} },
+    { {{ 0xaa5aabbe923e7f07ULL, 0xde235c5d56121bc2ULL, 0x22197a3e543d3305ULL, 0x19b16eaa9ab412e8ULL }}, {{ 0x8fc00b13024334b7ULL, 0xcb45f8657cd5dc1cULL, 0x0420180e2227b378ULL, 0x08a9c17f245b1acfULL }} },
+    { {{ 0xb748c77fcb8fa598ULL, 0x20a7cb498e647e76ULL, 0xb81575b50f7d5f88ULL, 0x2147fede386d9aecULL }}, {{ 0x9a361eb26226ebd9ULL, 0x5fc63f4f97b49fdaULL, 0xb70c781a3f378120ULL, 0x11c14c5b79e69f14ULL }} },
+    { {{ 0x0cb5b90f7f3d264aULL, 0x41a2591b90acd135ULL, 0x7771b9b92f7379a4ULL, 0x7ada18f82980c37fULL }}, {{ 0xfa940e273abba58cULL, 0xa6b758aa18d0cbd1ULL, 0x194c0bc0f9a97598ULL, 0x6252c371527e3494ULL }} },
+    { {{ 0xef32dac7772180a4ULL, 0x8c653162fc752240ULL, 0x5bfd5aa8acd8bca9ULL, 0x4f03060ad1ed1bd3ULL }}, {{ 0x78453b9e4a0b9907ULL, 0x1c50222642312f40ULL, 0xdbdb01dc29471106ULL, 0x58a537e7bcc42b37ULL }} },
+    { {{ 0x690910f4edda45e3ULL, 0x921ec30244c53f05ULL, 0xd928b9e612acf15aULL, 0x606f5042bab5bd90ULL }}, {{ 0xd0f857bbf1d34aa4ULL, 0x12735adb0052becbULL, 0xe6db5ee7bfa2f7acULL, 0x0a170fdad015b3ceULL }} },
+    { {{ 0xe723c34ba5f15ec9ULL, 0x64a4644c5894435eULL, 0xde637ba1714249c3ULL, 0x7179f102e4910197ULL }}, {{ 0x1fd324c2eb4444fdULL, 0xb605d5a34597e5d2ULL, 0x93ba450a699bc282ULL, 0x094b42c159effd33ULL }} },
+    { {{ 0x2850001257961298ULL, 0xdeb7dbf0a961dc24ULL, 0x931ef629fc1ae504ULL, 0x48fc5fb862fa6e02ULL }}, {{ 0x72af6c8df6ee3bd9ULL, 0xbb044f230bb85299ULL, 0xe1398932d03da2c5ULL, 0x167e3cc01a11c04cULL }} },
+    { {{ 0x8214b8bc77b25407ULL, 0x507a159fc262fc64ULL, 0xe8cc2cdc070054b5ULL, 0x58468d6ec58842b7ULL }}, {{ 0xe8d3cc77087d7396ULL, 0xd7db79868f3906f6ULL, 0x86bb0e02ab0492c3ULL, 0x2bfaecc220f68da0ULL }} },
+    { {{ 0x16797dfa29eaf6aeULL, 0x88012e4e0f849a9eULL, 0x5cc9c6ac7da9ebbcULL, 0x3da9c4dce98611faULL }}, {{ 0xe66052adeaa2107aULL, 0xb38ec94f20c0f27fULL, 0xef0680509c596fd0ULL, 0x523327d9cab9ed62ULL }} },
+    { {{ 0x975bb2bcd8f14806ULL, 0x89cf84e5dcd89eb4ULL, 0x45b50de595848286ULL, 0x79fbb98a85eef574ULL }}, {{ 0x4cc52e1ea3bcd0d7ULL, 0xb9b66aa6627a901cULL, 0x84f5732c76ba08a6ULL, 0x44dbfa208da22d7fULL }} },
+    { {{ 0x55c54028a8a5730bULL, 0xd2c1531fe23334a5ULL, 0x40ccf5924f6b5380ULL, 0x5f034ba6bbbb2b12ULL }}, {{ 0xf13be3d6630a14f5ULL, 0x98b917cf99fcbed9ULL, 0x89fb710841d5d749ULL, 0x60925e917690f39bULL }} },
+    { {{ 0x1524d1696cffe3bdULL, 0x7933fae625900d92ULL, 0x98720087a150b832ULL, 0x46023f66aa7f2034ULL }}, {{ 0x5a794b0346249618ULL, 0xd672a997369ef87eULL, 0xbc4e598065a9080eULL, 0x117a688f6385f37cULL }} },
+    { {{ 0x8e561dc7eeececd4ULL, 0xa55bc494923bb2d4ULL, 0xfe94bb98ceb8576dULL, 0x713a259a35560a6eULL }}, {{ 0x3ccfa29644a46286ULL, 0xa62de70bd9c1c52aULL, 0xf4bedb412ad0992bULL, 0x56658982886ad6b2ULL }} },
+    { {{ 0xae39d29fd7072714ULL, 0x9db15bd00945fdacULL, 0x1996015ef8662051ULL, 0x6c60bfa44320e5feULL }}, {{ 0x6e169c97e2f92945ULL, 0x0a232a7ba0674096ULL, 0x7e28550e82c9e204ULL, 0x5853dd8a49585140ULL }} },
+    { {{ 0xcc2def20efcab533ULL, 0xb2e8ee919be80b46ULL, 0xfab2c292f1bd04b1ULL, 0x45438da75ffdd20bULL }}, {{ 0x2cfd63cbef69859cULL, 0x33213db57f418bcfULL, 0x6a3e1b6d9a9cc36bULL, 0x3019cfb753b16f78ULL }} },
+    { {{ 0xd723e9313daad8ecULL, 0x7b051657f5470fdbULL, 0xe566a46c6eb47217ULL, 0x7ad6b06e1465bef8ULL }}, {{ 0xc754d45c64299b51ULL, 0x5c1a7eded4277dd0ULL, 0x9446dc9d9fad774fULL, 0x4b69cfa9d9631de1ULL }} },
+    { {{ 0x3527308c3c28304bULL, 0x77fdf32a6e5d38c2ULL, 0x870694c1b2df03c0ULL, 0x185675e676ff8248ULL }}, {{ 0x1d2c734eb9914e8fULL, 0xa72e7de544624ca8ULL, 0x9ac9cda5857252d0ULL, 0x04df5cd2c16c9f0dULL }} },
+    { {{ 0x5b351dba88d3795aULL, 0xb7eb932c02370a97ULL, 0xb1b2f2456e16dea2ULL, 0x6dc968945808c5feULL }}, {{ 0xad5b9761dc6e3540ULL, 0x084190c8fa24dcccULL, 0xb1fa3f4dad0b6dcfULL, 0x04d6d4e02fb36fcaULL }} },
+    { {{ 0x8021306f6f245ebeULL, 0x8f5b46003162716dULL, 0xde7fe5490837a7aaULL, 0x3e8411914b2cf8a6ULL }}, {{ 0x743b181d94638f57ULL, 0x79a98b08473c8b57ULL, 0xa0a50daed74d942dULL, 0x0e1abacafb6ff9caULL }} },
+    { {{ 0x84619d62ae522c8cULL, 0x11be278e252bbd0aULL, 0xa95cb38519bc2ac2ULL, 0x05f351d6b8e3de1eULL }}, {{ 0xce5d41cb0dccffb0ULL, 0xa6518e17c98cf24aULL, 0x1034100675f7a2feULL, 0x19527dabac095320ULL }} },
+    { {{ 0x67505b919ac1afebULL, 0x5288c26bbe64593eULL, 0x6d5688df4b9f8d2bULL, 0x18438433e5806bf9ULL }}, {{ 0xc0a8080bdb464888ULL, 0xe5e8df54301768afULL, 0xff6cc9f7ee6197b6ULL, 0x08194c3797813ea7ULL }} },
+    { {{ 0x65babf03f49637f9ULL, 0xd0f324c4aca07015ULL, 0x39c747d7fc9adafdULL, 0x47e44ee3db415c78ULL }}, {{ 0x509b4c8d1c5e7161ULL, 0x451a6aef078e05ccULL, 0xf3a16bd742cf07f6ULL, 0x5f686f5a72dab6a1ULL }} },
+    { {{ 0x368ac0baba3c719eULL, 0x65dc639e500a492dULL, 0x8e4a937cd3a027c3ULL, 0x03129546d5b3b82bULL }}, {{ 0x0ae16434da62f40dULL, 0x4f02c17cf3c35bb3ULL, 0xd2012ce93f602d40ULL, 0x70562a983bfef7a3ULL }} },
+    { {{ 0x135f12721ec14f20ULL, 0x97319d27d4ea265cULL, 0x1575e39315ac7cc6ULL, 0x5ff5b4e772b5045aULL }}, {{ 0x6c53c479af2cc4a6ULL, 0x91900bcdc8e5a1adULL, 0x14d347ddddf72be8ULL, 0x4b5f1c90ac379b4cULL }} },
+    { {{ 0x4aa0b9c8a11b0ec5ULL, 0xd1efbf7b4fa001ecULL, 0xc54dad1c472ef2e3ULL, 0x47266f0d40c10af9ULL }}, {{ 0x7a229c5333657789ULL, 0x5a0666e511632169ULL, 0x9841f06bc287859cULL, 0x529b8b77f9fd4a54ULL }} },
+    { {{ 0x99cf242b6da0c29dULL, 0x56144ed93acdd9faULL, 0x28d82d4dd86e299eULL, 0x669a8ea6db856f95ULL }}, {{ 0x37642245733250f5ULL, 0xc75517b2a1e2d8f2ULL, 0x930ba17705706ae4ULL, 0x000f3245e1216b27ULL }} },
+    { {{ 0xe2e698e66393bee7ULL, 0x8c45370d4ab537c1ULL, 0xbdf96a8e05120b47ULL, 0x684035fa5fc9285eULL }}, {{ 0xd193bbd50c5593c2ULL, 0xefb7a32d5baa3d5cULL, 0xbe7f1a1091b921b3ULL, 0x354e1dbda6055dbdULL }} },
+    { {{ 0xba992fc38b3a5031ULL, 0xe86bd0fa9ab71ea1ULL, 0x535c1e638dc1cad7ULL, 0x70a009b3db943da6ULL }}, {{ 0xd6602b7d6aec77d4ULL, 0x2768341a2b3fe32bULL, 0x31b869d6da54c0cfULL, 0x6fa5fa3805bf4051ULL }} },
+    { {{ 0xc45d9a206abda24bULL, 0xb5e39d8a8bd688c3ULL, 0x58b006a08d0f459fULL, 0x4bcf4c887c18e404ULL }}, {{ 0x6f86a5c0fca485d7ULL, 0x42b021ee5362a94fULL, 0x99b1bcd5f3841fdeULL, 0x5edb1218dd21cb0fULL }} },
+    { {{ 0xb4eadd33d995e32bULL, 0x6ad6ca17a6733fdaULL, 0x0ce4acd00f8b2de9ULL, 0x499ff1ce94941f1cULL }}, {{ 0xc8401752a309a2d8ULL, 0x8c7bddd73bcea239ULL, 0x29d62796bfda7f75ULL, 0x069bb4595899a774ULL }} },
+  },
+};
+
+static const sm2_affine SM2_COMB_CORR = { {{ 0xc15abde354b9ef77ULL, 0xe7c1f484b4685016ULL, 0x9b6a4cb96657ead4ULL, 0x49842af492d26ba4ULL }}, {{ 0x20103e8e66353141ULL, 0x3ae84153fae67666ULL, 0xdf9f78187c3476c6ULL, 0x2597524ebe58585cULL }} };
+
+static const sm2_affine SM2_G_ODD[1 << (SM2_WNAF_G - 2)] = {
+  { {{ 0x00d82731f368870cULL, 0x9d12c0a0a0105395ULL, 0x98681543b6f56b25ULL, 0x4ec8e57d36e75430ULL }}, {{ 0x7cc6691743006adaULL, 0xc6f62c40da122cdeULL, 0xfa7e55ca0749bd88ULL, 0x5ff1658dad3ab75cULL }} },
+  { {{ 0x7a6edaafa364ec6bULL, 0x9af82006e1471b03ULL, 0x438d47445ed6a7d6ULL, 0x2c423183f0a714aaULL }}, {{ 0x57c4b0d02b5a11dcULL, 0x5e980d6fbc03f9b5ULL, 0x37d6e45c4000b7a6ULL, 0x37770191381b969cULL }} },
+  { {{ 0xa97e78e2a9a87903ULL, 0x77230b5ed9769103ULL, 0x039a95676b43f982ULL, 0x1e2d5345a428cf7eULL }}, {{ 0xbebbaf59fe50459bULL, 0x6ed4c0327b05d55eULL, 0xa1f7c1d50e3be628ULL, 0x13350ca2ace4ab5eULL }} },
+  { {{ 0x28a3adb8dab7e77eULL, 0x948a7b8a58f8f4e3ULL, 0x711789f2b8d2df43ULL, 0x2e209ae4e2f68ce0ULL }}, {{ 0x0f477ccffbc639faULL, 0x19c7c184510962c4ULL, 0xd05cc93a4a4291f8ULL, 0x656ef9dd36d022e0ULL }} },
+  { {{ 0x2862a4e689ccb7b7ULL, 0xd415a752f522fd89ULL, 0x7a36b7641930e415ULL, 0x0ade8e4cf1bdda3eULL }}, {{ 0xf55c8452fac0583aULL, 0x561d9f9d82dd5006ULL, 0x644e82aba9856024ULL, 0x6d8f919826d71737ULL }} },
+  { {{ 0xbd6f1b0d2ff3756fULL, 0x8755e019f05e555dULL, 0x8cb03031c9d1f1f5ULL, 0x489ee09d30685e9dULL }}, {{ 0xba054a97379611e4ULL, 0x1f70945fc83d687cULL, 0x9448742d3ab6323dULL, 0x2a193abb16cb7719ULL }} },
+  { {{ 0xde03fbf404723dc1ULL, 0x00651f23a023ab72ULL, 0xf227a6c148803929ULL, 0x7520ed673a1a2608ULL }}, {{ 0xf5a2010c6e05c133ULL, 0xd053339cf1b22168ULL, 0xfabff086669f1fbbULL, 0x221cb9b3d7b4c923ULL }} },
+  { {{ 0xacb41ccdfe118dafULL, 0x92be3a3e5fd84ec2ULL, 0xc8bd8ccd29eff650ULL, 0x457f11c231f6bd26ULL }}, {{ 0xf829540c20f41993ULL, 0x52c3b0d99b46ce24ULL, 0x88af76b38a23605bULL, 0x0c444df10d0dd3f7ULL }} },
+  { {{ 0x9f96cb23d68f4c99ULL, 0x613d8f04a95ba2a1ULL, 0xe54fa001958473e9ULL, 0x28c601b56468c4c4ULL }}, {{ 0x2f06b5a3fafa69f0ULL, 0x607c5feba85182cfULL, 0x25118dbba4f422ddULL, 0x46677ac98609fae4ULL }} },
+  { {{ 0x39795e323df10fe5ULL, 0x606743900848b223ULL, 0xa10764cb76eaf026ULL, 0x6ea7eaf773bc9c8fULL }}, {{ 0xb9dd57326002ee80ULL, 0xe64dc92e00277b94ULL, 0xa7b28115ebb9bf8cULL, 0x7222ab22a6ca0b5eULL }} },
+  { {{ 0x47d6f49273cbca18ULL, 0xe9931e15ba91797eULL, 0x561c09341a78f8a7ULL, 0x6c0bce9c309bc6eeULL }}, {{ 0xd951914da791cdd9ULL, 0x052d1a6c14340aa6ULL, 0x0dc0dba553d5b475ULL, 0x361b3ef9526a632bULL }} },
+  { {{ 0xb61d8259634d3816ULL, 0x98d765420971640aULL, 0x53834cae36babf58ULL, 0x30b7720aaa80154eULL }}, {{ 0x03bacc620beb7cf6ULL, 0xae99bda436e4930fULL, 0x91213a3cdea9016fULL, 0x5680bca09b7e365aULL }} },
+  { {{ 0xc1caa163f4501868ULL, 0xf91fff51b8f8b686ULL, 0x04321efe1615d891ULL, 0x1ff8ed08915c0784ULL }}, {{ 0x7e11ad471a9c0607ULL, 0xaef59ebe662d2153ULL, 0x4561d57b45f6e434ULL, 0x6830c2755c0d55eeULL }} },
+  { {{ 0xc04c9b296636c883ULL, 0x2365a113511db13aULL, 0xc84c514d9419f2c6ULL, 0x1cc604ebd84c5e19ULL }}, {{ 0xea05d22f0da9153bULL, 0xfe498cc65388d78dULL, 0xfefdca22cbdb9966ULL, 0x582229529b7b48e3ULL }} },
+  { {{ 0xcfbef2a97f1e0e07ULL, 0xd9818ce311ae00c8ULL, 0x08ab081c830da218ULL, 0x72a8c4612efc3915ULL }}, {{ 0xacdc82365600fdd4ULL, 0x9b6d838468dbef5fULL, 0x01e128648a0ff06eULL, 0x715ba0a435c211b1ULL }} },
+  { {{ 0x5298e90644fbdfceULL, 0xb7688b8f8863b55aULL, 0xcfbe41b0b5ada347ULL, 0x3953c88ce766b2acULL }}, {{ 0x37053edf1089e8faULL, 0xdfdc118f3db06a5dULL, 0x1c21ad34e01709bfULL, 0x674c6af437c5daf1ULL }} },
+  { {{ 0xc69ce8f869b4918aULL, 0x976cad8e6e528496ULL, 0x25f24ba8783f425aULL, 0x771e94901231a4bbULL }}, {{ 0x7badef5edc79c0c7ULL, 0xec4a86b847531546ULL, 0xd42a71de1792e4afULL, 0x7a3657b3d06ba404ULL }} },
+  { {{ 0x3dcfad835e30b0f8ULL, 0x6070079a3da140dbULL, 0x43df5984e3dfec44ULL, 0x4b97cdf11fa5ad22ULL }}, {{ 0x93c28e02f5752847ULL, 0xfe8e50b8f1b85c82ULL, 0xb1ec22dbc4407ddaULL, 0x31d3e3ddb3d00d29ULL }} },
+  { {{ 0xd5c5a53d9c130f9cULL, 0x502bfa05c878e7f0ULL, 0x32cd19feb221ed8bULL, 0x0704f2d5347c6d3fULL }}, {{ 0x7c4edf3138a8ccd8ULL, 0x0b61e8ca5f8e3783ULL, 0x946bcc42e643bf1eULL, 0x339032008e56a091ULL }} },
+  { {{ 0x5ca69a3cb7c3dbf9ULL, 0x4c94914fa4e0143bULL, 0xe22de09ee93c5195ULL, 0x6094461ffa0be0b3ULL }}, {{ 0x654648f4b7879354ULL, 0x4937565803037df9ULL, 0x11f43242ba968d4bULL, 0x4d8032578a60ddf4ULL }} },
+  { {{ 0x1a4ab938d3ca6d53ULL, 0x75dd39a39b67b702ULL, 0x00c5729c8f21290aULL, 0x308d6e9e601781faULL }}, {{ 0x51590b0164af080bULL, 0x38db17c330922e35ULL, 0x079722658ac74d76ULL, 0x7b66c0c732b96394ULL }} },
+  { {{ 0xec71885d9b726fb4ULL, 0x162cddccd453f55cULL, 0xdfe00b75a293667eULL, 0x7719eb8c0fceffd1ULL }}, {{ 0x50221f0e4a6f851cULL, 0x2b8333f47184b7c4ULL, 0x54ba5e8164bf7923ULL, 0x345626c7e5017088ULL }} },
+  { {{ 0x165d299b5ad91e2aULL, 0x163974f2acc2940aULL, 0xdb1ef1adaec3cce6ULL, 0x676745044f33a02fULL }}, {{ 0x7fd0a617bdf5fcf2ULL, 0x582997a7209fd8ceULL, 0xe48a34580d7ceb0aULL, 0x6c27afd196c76182ULL }} },
+  { {{ 0x35103b4a7897e31bULL, 0x8c24f5b04e9de85cULL, 0x901af6239148a2c0ULL, 0x5aa328b127113a57ULL }}, {{ 0x33dd6ae05f9ff849ULL, 0x9f21b7198c2ed250ULL, 0x7ab420d00400b1faULL, 0x0ba3d185ae9108ddULL }} },
+  { {{ 0xffd9dd24940078abULL, 0x499f9babf0f75e35ULL, 0x82eb3a0f0af10e51ULL, 0x272c1bb5b47d821cULL }}, {{ 0x97e37795ae81cbb5ULL, 0x01fb6dfc914dd856ULL, 0x41e0e5e10f960178ULL, 0x623dcaf657c84b7bULL }} },
+  { {{ 0x00362348d3f174a4ULL, 0x35f58c066f22f8d4ULL, 0xcbabe952bcd278f5ULL, 0x321972970c4b452fULL }}, {{ 0x5e52811853676659ULL, 0x1e7f9aab394e1b8cULL, 0x141851befd77d9a6ULL, 0x4085dac490dbdae7ULL }} },
+  { {{ 0x27ed2d64ec656a26ULL, 0xc6f47b8f25d62f0cULL, 0xb6d1ff9bb3bc70f8ULL, 0x3d2f8efcc6cec7d0ULL }}, {{ 0xfa47c1da6aa9dedcULL, 0xd9994586dc62e7b2ULL, 0x3210ec538ffddf32ULL, 0x615a240821f4ae60ULL }} },
+  { {{ 0xd4e1babd82d54894ULL, 0xe7ace388cc94e0c2ULL, 0x995d44cf702faad5ULL, 0x40f1f96dfc8b55f7ULL }}, {{ 0x959e2291d8e0fc49ULL, 0x0d0bbe9f55b8187dULL, 0xb78c13aab3ac35f4ULL, 0x5dfa1c42f91d6fffULL }} },
+  { {{ 0x39dcf1b853401e88ULL, 0xa8ec59db654be946ULL, 0xee4b700f42d861b7ULL, 0x1cb304a07ec1ce65ULL }}, {{ 0x302fef7f3199aaceULL, 0x6b7f58093df22305ULL, 0xa72be9e757274d0dULL, 0x280ed71a073afd97ULL }} },
+  { {{ 0xf3bd1f1e0635a512ULL, 0x18f9d24464889ef9ULL, 0xfbc70d9825fdaa79ULL, 0x416205ef9ca994bcULL }}, {{ 0x9cac6d228d5b536dULL, 0x75e9ee9760fc82c5ULL, 0x19688492a088b3d9ULL, 0x39018bf82e73cf92ULL }} },
+  { {{ 0x8c7f843105f1aa51ULL, 0xcee4878a9aaf05c5ULL, 0x2ed782c548fd6133ULL, 0x66c170e81e150992ULL }}, {{ 0x5fb2df8b6005cd16ULL, 0xcc91c3bcf1796741ULL, 0x6910ae4475dbf3d6ULL, 0x41a698bf45e3ad94ULL }} },
+  { {{ 0x4cdc6f2da99a19feULL, 0x0e18e637a0baf706ULL, 0x3107d3dbc9a6fb67ULL, 0x324fadd8f20c1446ULL }}, {{ 0xb15112f4b4201bd6ULL, 0x91a80b119e0031b4ULL, 0x369f5dc566da07e0ULL, 0x1706732742634206ULL }} },
+  { {{ 0x95e2dffeb7e94677ULL, 0x85e23f8cee53c798ULL, 0x8ddc0745ea639de6ULL, 0x368fe9c3f42bea66ULL }}, {{ 0x853d8e5845c61687ULL, 0x15370f42ed70fa4bULL, 0xad8c925fc7c908ffULL, 0x2f70409fb94b592aULL }} },
+  { {{ 0x03d522c45202b217ULL, 0x1b411a3488e0caf5ULL, 0x6042a7b045bb63cdULL, 0x2d0241d226f8a317ULL }}, {{ 0xcc56c03d115f7f07ULL, 0xa77da122f5c0053dULL, 0xcfa97791a243f2aaULL, 0x174548a88554ff33ULL }} },
+  { {{ 0x6c126b22a6663fd4ULL, 0xa843cbf1e2582173ULL, 0xcf0ea3664ec4050bULL, 0x2f1504b716cb1a20ULL }}, {{ 0xc5df3d0198b5cf22ULL, 0xb89773e0f84a2432ULL, 0x0120828b113c1677ULL, 0x15fd1efde45f532cULL }} },
+  { {{ 0xc2ece5ebfa34aaa9ULL, 0x8294ef770e8ae006ULL, 0x4da7fd1576e2237fULL, 0x252d394c0f935f7cULL }}, {{ 0x9093bfb351e633d7ULL, 0x81cc31c860c2c2b0ULL, 0x1130c064ce63d134ULL, 0x7752fa7be73ab82eULL }} },
+  { {{ 0xef9f5f3713205001ULL, 0x00479640d4a2a969ULL, 0x6b85ce15983bde1fULL, 0x740db8891c12a793ULL }}, {{ 0x566d71808afd4ed6ULL, 0x5db83db42c8932c3ULL, 0x38aa5a4a4870d4f7ULL, 0x2c7cecb074314749ULL }} },
+  { {{ 0x1153cf193ebd82aaULL, 0x160435af4e085a04ULL, 0x0dc8cda9c79f3481ULL, 0x7a618f8dfc279e42ULL }}, {{ 0x031cbd322f6b7130ULL, 0xe0a76662e5f1ce9dULL, 0x3ec4fd1891c77d7bULL, 0x6e47f3ec4357ec55ULL }} },
+  { {{ 0x8dd2c29421adc990ULL, 0x2a9e3cb143f42c3cULL, 0x98cb23e30bdf5b5cULL, 0x2bd6d1657b677aa6ULL }}, {{ 0xbaa7a4f90ad594feULL, 0x7e38ab00dff78f77ULL, 0xf872c956d4740177ULL, 0x1977ca205238b365ULL }} },
+  { {{ 0x5899917b10d791c1ULL, 0x7af9a2ef6544fedfULL, 0x7b4f6d8764b93048ULL, 0x106b7460f32acb1fULL }}, {{ 0x8e61f80025c738b8ULL, 0xad5428b6b65bf40cULL, 0xc5cac5baaba34ee1ULL, 0x62e342372ede1619ULL }} },
+  { {{ 0x26d70e42d54b8ffeULL, 0x9131873db98c92fbULL, 0xbff7261a647640caULL, 0x71cbbf014f29f0aeULL }}, {{ 0x5bd9e51f64441194ULL, 0xd19a0ea1c7486e35ULL, 0xd226fd26bc0645deULL, 0x316c5f8a74450fdcULL }} },
+  { {{ 0x83b794d3e7240af4ULL, 0xe8398356af92eed7ULL, 0xe68fdef041ec9685ULL, 0x64529190230b2373ULL }}, {{ 0xafd7f08e018405c8ULL, 0xf673f4f8d13e8e52ULL, 0xf6c03b63d24572cdULL, 0x767d9b036ed7124eULL }} },
+  { {{ 0x10bce57671783a0bULL, 0x7a45a11d9dceda7bULL, 0x7ba8cbc580b57080ULL, 0x593bc48eeecb9f26ULL }}, {{ 0x6f0d90806de303ccULL, 0xe3d0508e14871309ULL, 0xd53c03923dda5c12ULL, 0x07d4c91a53b045b0ULL }} },
+  { {{ 0xa52014fc064b583aULL, 0x4150eb69f33a3d6eULL, 0x9b02125d7b869823ULL, 0x3854b07a496231b9ULL }}, {{ 0xac146c2a4ceba177ULL, 0x81c194008bea7f91ULL, 0xf9c4c4604982dc32ULL, 0x2a24f9a577a0c617ULL }} },
+  { {{ 0x69baadbc50a2fb70ULL, 0x2682ffcfd6f2f82cULL, 0x0196835c65f17ddeULL, 0x8309b5565660a62eULL }}, {{ 0x7dab9c52bc15a9efULL, 0xfbe900c95c2460d2ULL, 0x92e6cfd468951c15ULL, 0x5a0f9d4691dbd6c9ULL }} },
+  { {{ 0x9580a7879f98c37bULL, 0x92fed416f298d69fULL, 0x60149e4df15bf9bcULL, 0x18c9235d65f60896ULL }}, {{ 0x9dfa740c8ae7c36fULL, 0x797c60fe6a3195c0ULL, 0x42757ee68562c565ULL, 0x2770afc2cedb5615ULL }} },
+  { {{ 0xe9aa8434e7c20e27ULL, 0xf0196e4bd53726afULL, 0xb1fd03c077a17768ULL, 0x2b15ec3f489683f4ULL }}, {{ 0xfc4d72b675b0ecc0ULL, 0xff40e3b9b3e4554cULL, 0x78912cefb6ee7eb0ULL, 0x03701cc0d8cbfcb6ULL }} },
+  { {{ 0x9ec054811894c026ULL, 0x3f1178ac0f3b2855ULL, 0x349bac9f5bf30a1cULL, 0x5d3b701db8c70a08ULL }}, {{ 0x7be44d1fde405146ULL, 0xa9a6aeeec0c6b3afULL, 0xecefef742d3dc6d8ULL, 0x697cdc9253215af2ULL }} },
+  { {{ 0x0bf53b6d0a9b8b5bULL, 0x735d455928d77df8ULL, 0x0b8585eb07796d3dULL, 0x06036d5d95345e80ULL }}, {{ 0x1f5086cc4315fb0aULL, 0xbc48dd27941b85b8ULL, 0xe6cc2904eea6a0dfULL, 0x4256390339c969e4ULL }} },
+  { {{ 0xd28116ee233741b1ULL, 0xa2db3b4916e48359ULL, 0x9b534bbe4cb71df1ULL, 0x1f1fd5056b484377ULL }}, {{ 0xd2c563e5bd959ab5ULL, 0x1b424d38438694d8ULL, 0xbd1f6222bacd7644ULL, 0x46a1068ed77fcc34ULL }} },
+  { {{ 0x85dbe690852504f7ULL, 0x5ef6ef3d03f155c7ULL, 0x54d71e215120fb08ULL, 0x6be9d84025321fbaULL }}, {{ 0x63dde74e25074a75ULL, 0x1e50c3c51e4bddbbULL, 0x3ad7ceb9e9140f9aULL, 0x482dfa95cc93c760ULL }} },
+  { {{ 0xd638c30ec178ab7dULL, 0xfca2dffed799062aULL, 0xcc6a1d2531028520ULL, 0x6a69c293941c71e7ULL }}, {{ 0x10d956e23a9e20eaULL, 0x9f462b7d1149a225ULL, 0x07786ebf7a22199dULL, 0x545c9bf08a97dec5ULL }} },
+  { {{ 0xa740e4c0691f0289ULL, 0xfeec7500218f2859ULL, 0x0da4692f71556ce9ULL, 0x250908e6fb2024aeULL }}, {{ 0x9a02206655dfd9aaULL, 0x45fdd129022473d5ULL, 0xcf0316725112793fULL, 0x02acc434961ce0b0ULL }} },
+  { {{ 0x8bdaf1a351b6e973ULL, 0x1a5bb83f197c9d36ULL, 0x69cac642aa195808ULL, 0x6d87c54faf21e629ULL }}, {{ 0x3c58d8e919f8897fULL, 0x29c936f29fa4ec9aULL, 0xee536b65e189fc8cULL, 0x3bb8250a2ac8ba4cULL }} },
+  { {{ 0x16ccb7a0fd1ffe97ULL, 0xe56a571eee46f3bcULL, 0x8aeb7816964a86ebULL, 0x273bd654381d3d4fULL }}, {{ 0xea76ee617692ddccULL, 0xaa3f5359274c95d5ULL, 0x5218301c9c9dd5c9ULL, 0x4595345b0c4f2682ULL }} },
+  { {{ 0x13b9f7a65a10912bULL, 0xfec8f777d9d500f6ULL, 0xc3bc1fa6b96a6675ULL, 0x144c99536d157507ULL }}, {{ 0x8d2fc159624c12b7ULL, 0xf47d965d53df72e7ULL, 0x1650ae1ec813b1dcULL, 0x3f1e810c0ba209c2ULL }} },
+  { {{ 0x7f8faed39ad62c47ULL, 0xbeddbf896b189a62ULL, 0x04a0f24b57ac8c88ULL, 0x8103b286c3fa7556ULL }}, {{ 0x5629c59124a3a89cULL, 0xc9ff2771f602c203ULL, 0xd882aa11578d1b70ULL, 0x541672f404db39d8ULL }} },
+  { {{ 0x39d9a0b93b6d2de0ULL, 0x90d7c7a1314c2543ULL, 0x0005cbff0235d4f3ULL, 0x449ccf7ea6e79929ULL }}, {{ 0x2c84e5a4fec46e85ULL, 0xce5cc39c95080ecfULL, 0xf6cf077591ac71feULL, 0x290415c48f4d7700ULL }} },
+  { {{ 0x625be4e03ebe3678ULL, 0xd15c78a60254fc11ULL, 0xe67f6475993424d8ULL, 0x6888b9cee608a15dULL }}, {{ 0x6e8f6c907e116832ULL, 0x21e409dc8384eb3bULL, 0xca447cbf180b23f8ULL, 0x0503b418a91876deULL }} },
+  { {{ 0x5e2c9868ac200f3eULL, 0x916ba4f39f936215ULL, 0x9cb324bb929173a1ULL, 0x2377106008ccf206ULL }}, {{ 0x396365756623e9ddULL, 0x1df501dd27c6ce17ULL, 0x1dd1ebdceae02b7aULL, 0x68af584233c6708fULL }} },
+  { {{ 0x2679f9a6012b56a5ULL, 0xe2fdb54a744a2a11ULL, 0xe6c8ada9588f8259ULL, 0x675350513f6e7c69ULL }}, {{ 0x34b95153398d7d45ULL, 0x37471c7f867b3e02ULL, 0xfed2ee28fdb2345cULL, 0x6917a523676b192eULL }} },
+  { {{ 0x5b55fb0572746a84ULL, 0xa0c7f1a97a44b9ecULL, 0x0900b1ea14860ce0ULL, 0x36c2e874c91b765bULL }}, {{ 0x9f9a002b7fa433b8ULL, 0xc6c54c56c50d9f81ULL, 0xbc210d2b62f8ac9aULL, 0x2f36545f9361d8edULL }} },
+  { {{ 0x3fd3853f11580a37ULL, 0x94e3886e631eaea4ULL, 0xaaeaef7037ee7d48ULL, 0x7d6b24a5bfaba092ULL }}, {{ 0x517c90450f483ad3ULL, 0x54f477a30ec19d30ULL, 0xa1676fe30ae63fe5ULL, 0x076e6a27205dfd9cULL }} },
+  { {{ 0x8b6548c5ca9bd484ULL, 0xc6ab6c8fb8dc873cULL, 0x247daed6b8379784ULL, 0x0638997d8dc40eeaULL }}, {{ 0xcb75525f83bd02d1ULL, 0xb2351c988cb9f238ULL, 0x2ca2724b983ca7f0ULL, 0x1df0ba4a13bb8e8bULL }} },
+};
+
+#endif
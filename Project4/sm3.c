@@ -1,6 +1,7 @@
 // sm3.c
 #include "sm3.h"
 #include <string.h>
+#include <sys/uio.h>
 
 #define ROTL32(x,n) ((uint32_t)(((x) << (n)) | ((x) >> (32 - (n)))))
 #define P0(x) ((x) ^ ROTL32((x), 9) ^ ROTL32((x),17))
@@ -83,6 +84,10 @@ void sm3_update(sm3_ctx *ctx, const void *data, size_t len){
     if(len){ memcpy(ctx->buffer, p, len); ctx->buffer_len=len; }
 }
 
+void sm3_update_iov(sm3_ctx *ctx, const struct iovec *iov, int iovcnt){
+    for(int i=0;i<iovcnt;i++) sm3_update(ctx, iov[i].iov_base, iov[i].iov_len);
+}
+
 void sm3_final(sm3_ctx *ctx, uint8_t out[32]){
     uint8_t pad[64]={0x80}; // 1 后跟 0
     size_t nzero = (ctx->buffer_len<=55)? (55-ctx->buffer_len) : (119-ctx->buffer_len);
@@ -105,3 +110,7 @@ void sm3_final(sm3_ctx *ctx, uint8_t out[32]){
 void sm3_hash(const void *data, size_t len, uint8_t out[32]){
     sm3_ctx c; sm3_init(&c); sm3_update(&c,data,len); sm3_final(&c,out);
 }
+
+void sm3_hash_iov(const struct iovec *iov, int iovcnt, uint8_t out[32]){
+    sm3_ctx c; sm3_init(&c); sm3_update_iov(&c,iov,iovcnt); sm3_final(&c,out);
+}
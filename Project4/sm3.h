@@ -4,6 +4,12 @@
 #include <stdint.h>
 #include <stddef.h>
 
+struct iovec;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef struct {
     uint32_t state[8];
     uint64_t bitlen;     // 已处理的比特数
@@ -14,8 +20,15 @@ typedef struct {
 void sm3_init(sm3_ctx *ctx);
 void sm3_update(sm3_ctx *ctx, const void *data, size_t len);
 void sm3_final(sm3_ctx *ctx, uint8_t out[32]);
+// 按 iovec 片段依次吸收数据，跨片段的不满 64 字节部分由 ctx->buffer 衔接，不需要先拼成连续缓冲
+void sm3_update_iov(sm3_ctx *ctx, const struct iovec *iov, int iovcnt);
 
 
 void sm3_hash(const void *data, size_t len, uint8_t out[32]);
+void sm3_hash_iov(const struct iovec *iov, int iovcnt, uint8_t out[32]);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif
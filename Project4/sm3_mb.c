@@ -0,0 +1,154 @@
+// sm3_mb.c
+#include <string.h>
+#include "sm3.h"
+#include "sm3_mb.h"
+
+/*
+  每个通道的状态按“字 × 通道”存放：st[w][lane]，压缩时整行载入一个 __m256i。
+  消息字 W[0..15] 先逐通道按大端读进 w[i][lane]，之后的扩展与 64 轮迭代全部在向量里做。
+  空闲通道喂一个全零分组，结果丢弃；换入新消息时把该通道的状态列重置为 IV。
+*/
+
+#ifdef __AVX2__
+#include <immintrin.h>
+
+static const uint32_t IV[8] = {
+    0x7380166F,0x4914B2B9,0x172442D7,0xDA8A0600,
+    0xA96F30BC,0x163138AA,0xE38DEE4D,0xB0FB0E4E
+};
+
+// Tj <<< (j mod 32)
+static const uint32_t TJ[64] = {
+    0x79cc4519, 0xf3988a32, 0xe7311465, 0xce6228cb, 0x9cc45197, 0x3988a32f, 0x7311465e, 0xe6228cbc,
+    0xcc451979, 0x988a32f3, 0x311465e7, 0x6228cbce, 0xc451979c, 0x88a32f39, 0x11465e73, 0x228cbce6,
+    0x9d8a7a87, 0x3b14f50f, 0x7629ea1e, 0xec53d43c, 0xd8a7a879, 0xb14f50f3, 0x629ea1e7, 0xc53d43ce,
+    0x8a7a879d, 0x14f50f3b, 0x29ea1e76, 0x53d43cec, 0xa7a879d8, 0x4f50f3b1, 0x9ea1e762, 0x3d43cec5,
+    0x7a879d8a, 0xf50f3b14, 0xea1e7629, 0xd43cec53, 0xa879d8a7, 0x50f3b14f, 0xa1e7629e, 0x43cec53d,
+    0x879d8a7a, 0x0f3b14f5, 0x1e7629ea, 0x3cec53d4, 0x79d8a7a8, 0xf3b14f50, 0xe7629ea1, 0xcec53d43,
+    0x9d8a7a87, 0x3b14f50f, 0x7629ea1e, 0xec53d43c, 0xd8a7a879, 0xb14f50f3, 0x629ea1e7, 0xc53d43ce,
+    0x8a7a879d, 0x14f50f3b, 0x29ea1e76, 0x53d43cec, 0xa7a879d8, 0x4f50f3b1, 0x9ea1e762, 0x3d43cec5
+};
+
+static inline __m256i rol(__m256i x, int n) {
+    return _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - n));
+}
+#define P0V(x) _mm256_xor_si256(_mm256_xor_si256((x), rol((x), 9)), rol((x), 17))
+#define P1V(x) _mm256_xor_si256(_mm256_xor_si256((x), rol((x), 15)), rol((x), 23))
+
+static inline uint32_t load_be32(const uint8_t *p){
+    return ((uint32_t)p[0]<<24)|((uint32_t)p[1]<<16)|((uint32_t)p[2]<<8)|(uint32_t)p[3];
+}
+
+static void compress_x8(uint32_t st[8][8], const uint8_t *const blk[8]){
+    _Alignas(32) uint32_t w16[16][8];
+    __m256i W[68];
+    for(int i=0;i<16;i++)
+        for(int l=0;l<8;l++) w16[i][l] = load_be32(blk[l] + 4*i);
+    for(int i=0;i<16;i++) W[i] = _mm256_load_si256((const __m256i*)w16[i]);
+    for(int j=16;j<68;j++){
+        __m256i x = _mm256_xor_si256(_mm256_xor_si256(W[j-16], W[j-9]), rol(W[j-3], 15));
+        W[j] = _mm256_xor_si256(_mm256_xor_si256(P1V(x), rol(W[j-13], 7)), W[j-6]);
+    }
+
+    __m256i A=_mm256_load_si256((const __m256i*)st[0]), B=_mm256_load_si256((const __m256i*)st[1]);
+    __m256i C=_mm256_load_si256((const __m256i*)st[2]), D=_mm256_load_si256((const __m256i*)st[3]);
+    __m256i E=_mm256_load_si256((const __m256i*)st[4]), F=_mm256_load_si256((const __m256i*)st[5]);
+    __m256i G=_mm256_load_si256((const __m256i*)st[6]), H=_mm256_load_si256((const __m256i*)st[7]);
+    const __m256i A0=A, B0=B, C0=C, D0=D, E0=E, F0=F, G0=G, H0=H;
+    for(int j=0;j<64;j++){
+        __m256i a12 = rol(A, 12);
+        __m256i SS1 = rol(_mm256_add_epi32(_mm256_add_epi32(a12, E), _mm256_set1_epi32((int)TJ[j])), 7);
+        __m256i SS2 = _mm256_xor_si256(SS1, a12);
+        __m256i ff, gg;
+        if(j<16){
+            ff = _mm256_xor_si256(_mm256_xor_si256(A, B), C);
+            gg = _mm256_xor_si256(_mm256_xor_si256(E, F), G);
+        }else{
+            ff = _mm256_or_si256(_mm256_and_si256(A, B), _mm256_and_si256(C, _mm256_or_si256(A, B)));
+            gg = _mm256_or_si256(_mm256_and_si256(E, F), _mm256_andnot_si256(E, G));
+        }
+        __m256i TT1 = _mm256_add_epi32(_mm256_add_epi32(ff, D), _mm256_add_epi32(SS2, _mm256_xor_si256(W[j], W[j+4])));
+        __m256i TT2 = _mm256_add_epi32(_mm256_add_epi32(gg, H), _mm256_add_epi32(SS1, W[j]));
+        D = C; C = rol(B, 9); B = A; A = TT1;
+        H = G; G = rol(F, 19); F = E; E = P0V(TT2);
+    }
+    _mm256_store_si256((__m256i*)st[0], _mm256_xor_si256(A, A0));
+    _mm256_store_si256((__m256i*)st[1], _mm256_xor_si256(B, B0));
+    _mm256_store_si256((__m256i*)st[2], _mm256_xor_si256(C, C0));
+    _mm256_store_si256((__m256i*)st[3], _mm256_xor_si256(D, D0));
+    _mm256_store_si256((__m256i*)st[4], _mm256_xor_si256(E, E0));
+    _mm256_store_si256((__m256i*)st[5], _mm256_xor_si256(F, F0));
+    _mm256_store_si256((__m256i*)st[6], _mm256_xor_si256(G, G0));
+    _mm256_store_si256((__m256i*)st[7], _mm256_xor_si256(H, H0));
+}
+
+typedef struct {
+    const uint8_t *p;       // 下一个整分组
+    size_t full;            // 剩余整分组数
+    int tail_n, tail_pos;   // 尾部分组数（1 或 2）与下一个尾部分组
+    size_t job;
+    int active;
+    uint8_t tail[128];      // 不满 64 字节的余数 + 填充 + 长度
+} lane_t;
+
+static void lane_load(lane_t *ln, uint32_t st[8][8], int l, const uint8_t *msg, size_t len, size_t job){
+    size_t r = len % 64;
+    uint64_t bits = (uint64_t)len * 8;
+    ln->p = msg;
+    ln->full = len / 64;
+    ln->tail_n = r <= 55 ? 1 : 2;
+    ln->tail_pos = 0;
+    ln->job = job;
+    ln->active = 1;
+    memset(ln->tail, 0, sizeof(ln->tail));
+    if(r) memcpy(ln->tail, msg + len - r, r);
+    ln->tail[r] = 0x80;
+    uint8_t *end = ln->tail + 64 * ln->tail_n;
+    for(int i=0;i<8;i++) end[-1-i] = (uint8_t)(bits >> (8*i));
+    for(int w=0;w<8;w++) st[w][l] = IV[w];
+}
+#endif
+
+size_t sm3_mb_hash(const uint8_t *const *msg, const size_t *len, size_t n, uint8_t (*out)[32]){
+#ifdef __AVX2__
+    if(n >= SM3_MB_MIN){
+        static const uint8_t zero_block[64];
+        _Alignas(32) uint32_t st[8][8] = {{0}};
+        lane_t ln[8];
+        size_t next = 0, steps = 0;
+        int active = 0;
+        for(int l=0;l<8;l++){
+            ln[l].active = 0;
+            if(next < n){ lane_load(&ln[l], st, l, msg[next], len[next], next); next++; active++; }
+        }
+        while(active){
+            const uint8_t *blk[8];
+            for(int l=0;l<8;l++){
+                if(!ln[l].active)      blk[l] = zero_block;
+                else if(ln[l].full)    blk[l] = ln[l].p;
+                else                   blk[l] = ln[l].tail + 64 * ln[l].tail_pos;
+            }
+            compress_x8(st, blk);
+            steps++;
+            for(int l=0;l<8;l++){
+                lane_t *q = &ln[l];
+                if(!q->active) continue;
+                if(q->full){ q->full--; q->p += 64; continue; }
+                if(++q->tail_pos < q->tail_n) continue;
+                for(int w=0;w<8;w++){
+                    uint32_t v = st[w][l];
+                    out[q->job][4*w]   = (uint8_t)(v >> 24);
+                    out[q->job][4*w+1] = (uint8_t)(v >> 16);
+                    out[q->job][4*w+2] = (uint8_t)(v >> 8);
+                    out[q->job][4*w+3] = (uint8_t)v;
+                }
+                q->active = 0; active--;
+                if(next < n){ lane_load(q, st, l, msg[next], len[next], next); next++; active++; }
+            }
+        }
+        return steps;
+    }
+#endif
+    for(size_t i=0;i<n;i++) sm3_hash(msg[i], len[i], out[i]);
+    return 0;
+}
@@ -0,0 +1,30 @@
+// sm3_mb.h
+#ifndef SM3_MB_H
+#define SM3_MB_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  多缓冲 SM3：一次对 n 条互不相关的消息求摘要。
+  AVX2 下 8 条消息各占一个 32 位通道，8 个分组一起压缩；某个通道的消息做完后立刻换入下一条消息，
+  长短不一的消息也能让 8 个通道尽量保持满载。最后一两个分组（含填充）在通道自己的缓冲里拼好，
+  其余分组直接从消息里读，不拷贝。
+  编译：gcc -O2 -mavx2；没有 AVX2，或 n 小于 SM3_MB_MIN 时逐条调用 sm3_hash。
+*/
+
+#define SM3_MB_LANES 8
+#define SM3_MB_MIN   2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// out[i] = SM3(msg[i], len[i])。返回 8 通道压缩的次数（逐条计算时为 0），
+// 与各消息分组总数之比就是通道利用率
+size_t sm3_mb_hash(const uint8_t *const *msg, const size_t *len, size_t n, uint8_t (*out)[32]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
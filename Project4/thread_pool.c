@@ -0,0 +1,371 @@
+// thread_pool.c
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "thread_pool.h"
+
+/*
+  每个 worker 的剩余区间以单元号打包在一个 64 位原子量里（高 32 位 lo，低 32 位 hi）：
+  所有者 CAS 取走 lo，窃取者 CAS 把 hi 改成中点、把后一半存进自己（此时为空）的槽位。
+  双方都只用一次 CAS，不需要锁；单元数超过 2^32 时放大 grain。
+  任务的发布与完成用一把互斥锁加两个条件变量，每次调用只有一次唤醒和一次汇合，
+  适合单元耗时在微秒以上的批量运算。
+*/
+
+#define MAX_CPUS 4096
+
+typedef struct {
+    _Atomic uint64_t range;
+    char pad[64 - sizeof(uint64_t)];
+} slot_t;
+
+struct tp_pool {
+    int n, nnodes;
+    int *cpu, *node;                // 每个 worker 绑定的 CPU 与所在节点；0 号只在 run_job 期间绑定
+    int *cpu_node;                  // CPU -> 节点，绑不上 0 号时按它当前所在的 CPU 修正 node[0]
+    int *victims;                   // n*(n-1)：每个 worker 的窃取顺序，同节点在前
+    pthread_t *th;
+    slot_t *slot;
+
+    pthread_mutex_t run_lock;       // 串行化外部调用
+    pthread_mutex_t mu;
+    pthread_cond_t start, done;
+    uint64_t gen;
+    int stop, pending;
+
+    // 当前任务，在 mu 下发布
+    tp_range_fn fn;
+    void *arg;
+    size_t items, grain;
+    int width, steal;
+};
+
+typedef struct {
+    tp_pool *p;
+    int id;
+} worker_arg_t;
+
+static __thread tp_pool *tls_pool;  // 当前线程是 tls_pool 的 worker
+
+static inline uint64_t pack(uint32_t lo, uint32_t hi){ return (uint64_t)lo << 32 | hi; }
+
+/* ---------------- 拓扑 ---------------- */
+
+/* 解析 "0-3,8-11" 形式的 CPU 列表 */
+static void parse_cpulist(const char *s, int nd, int *cpu_node){
+    while(*s){
+        char *e;
+        long a = strtol(s, &e, 10), b = a;
+        if(e == s) break;
+        if(*e == '-') b = strtol(e + 1, &e, 10);
+        for(long c=a;c<=b;c++) if(c >= 0 && c < MAX_CPUS) cpu_node[c] = nd;
+        s = *e == ',' ? e + 1 : e;
+        if(*s == '\n') break;
+    }
+}
+
+/* 返回节点数；cpu_node[c] 为 CPU c 所在节点（读不到拓扑时全为 0） */
+static int read_topology(int *cpu_node){
+    memset(cpu_node, 0, MAX_CPUS * sizeof(int));
+    DIR *d = opendir("/sys/devices/system/node");
+    if(!d) return 1;
+    int maxnd = 0;
+    struct dirent *e;
+    while((e = readdir(d))){
+        int nd;
+        char path[300], buf[4096];
+        if(sscanf(e->d_name, "node%d", &nd) != 1 || nd < 0) continue;
+        snprintf(path, sizeof(path), "/sys/devices/system/node/%s/cpulist", e->d_name);
+        FILE *f = fopen(path, "r");
+        if(!f) continue;
+        if(fgets(buf, sizeof(buf), f)) parse_cpulist(buf, nd, cpu_node);
+        fclose(f);
+        if(nd > maxnd) maxnd = nd;
+    }
+    closedir(d);
+    return maxnd + 1;
+}
+
+/* ---------------- 执行 ---------------- */
+
+static void run_unit(const tp_pool *p, uint32_t u, int id){
+    size_t lo = (size_t)u * p->grain;
+    size_t hi = p->items - lo < p->grain ? p->items : lo + p->grain;
+    p->fn(p->arg, lo, hi, id);
+}
+
+static void run_worker(tp_pool *p, int id){
+    for(;;){
+        uint64_t v = atomic_load(&p->slot[id].range);
+        while((uint32_t)(v >> 32) < (uint32_t)v){
+            uint32_t lo = (uint32_t)(v >> 32);
+            if(atomic_compare_exchange_weak(&p->slot[id].range, &v, pack(lo + 1, (uint32_t)v))){
+                run_unit(p, lo, id);
+                v = atomic_load(&p->slot[id].range);
+            }
+        }
+        if(!p->steal) return;
+        int got = 0;
+        for(int k=0;k<p->n-1 && !got;k++){
+            int vic = p->victims[id * (p->n - 1) + k];
+            if(vic >= p->width) continue;
+            v = atomic_load(&p->slot[vic].range);
+            for(;;){
+                uint32_t lo = (uint32_t)(v >> 32), hi = (uint32_t)v;
+                if(lo >= hi) break;
+                uint32_t mid = hi - (hi - lo + 1) / 2;
+                if(atomic_compare_exchange_weak(&p->slot[vic].range, &v, pack(lo, mid))){
+                    atomic_store(&p->slot[id].range, pack(mid, hi));
+                    got = 1;
+                    break;
+                }
+            }
+        }
+        if(!got) return;            // 正被别人取走但还没存进槽位的区间由取走的人自己做完
+    }
+}
+
+static void *worker_main(void *arg){
+    worker_arg_t *wa = arg;
+    tp_pool *p = wa->p;
+    int id = wa->id;
+    free(wa);
+    tls_pool = p;
+    uint64_t seen = 0;
+    for(;;){
+        pthread_mutex_lock(&p->mu);
+        while(p->gen == seen && !p->stop) pthread_cond_wait(&p->start, &p->mu);
+        if(p->stop){ pthread_mutex_unlock(&p->mu); break; }
+        seen = p->gen;
+        int part = id < p->width;
+        pthread_mutex_unlock(&p->mu);
+        if(!part) continue;
+        run_worker(p, id);
+        pthread_mutex_lock(&p->mu);
+        if(--p->pending == 0) pthread_cond_signal(&p->done);
+        pthread_mutex_unlock(&p->mu);
+    }
+    return NULL;
+}
+
+static void run_inline(size_t n, size_t grain, tp_range_fn fn, void *arg){
+    for(size_t lo=0; lo<n; lo+=grain) fn(arg, lo, n - lo < grain ? n : lo + grain, 0);
+}
+
+/* 窃取顺序：同节点的 worker 在前，各组内从 id+1 开始循环 */
+static void build_victims_of(tp_pool *p, int i){
+    int n = p->n, m = 0;
+    int *vl = p->victims + (size_t)i * (size_t)(n - 1);
+    for(int pass=0;pass<2;pass++)
+        for(int k=1;k<n;k++){
+            int j = (i + k) % n;
+            if((p->node[j] == p->node[i]) == (pass == 0)) vl[m++] = j;
+        }
+}
+
+/* 多节点时把调用线程（0 号 worker）绑到 cpu[0]，它的静态份额、tp_alloc 首次写入和窃取顺序都按这个节点算；
+   绑不上（调用线程的 cpuset 不含 cpu[0]）就按它此刻所在的 CPU 修正 node[0] 和它的窃取顺序。
+   返回 1 表示改过亲和性，结束后用 saved 恢复 */
+static int pin_caller(tp_pool *p, cpu_set_t *saved){
+    if(p->nnodes <= 1) return 0;
+    pthread_t self = pthread_self();
+    if(pthread_getaffinity_np(self, sizeof(*saved), saved) == 0){
+        cpu_set_t one;
+        CPU_ZERO(&one);
+        CPU_SET(p->cpu[0], &one);
+        if(pthread_setaffinity_np(self, sizeof(one), &one) == 0){
+            if(p->node[0] != p->cpu_node[p->cpu[0]]){
+                p->node[0] = p->cpu_node[p->cpu[0]];
+                build_victims_of(p, 0);
+            }
+            return 1;
+        }
+    }
+    int c = sched_getcpu();
+    int nd = c >= 0 && c < MAX_CPUS ? p->cpu_node[c] : p->node[0];
+    if(nd != p->node[0]){
+        p->node[0] = nd;
+        build_victims_of(p, 0);
+    }
+    return 0;
+}
+
+static void run_job(tp_pool *p, int width, size_t n, size_t grain, tp_range_fn fn, void *arg, int steal){
+    if(n == 0) return;
+    if(grain == 0) grain = 1;
+    if(width <= 0 || (p && width > p->n)) width = p ? p->n : 1;
+    if(!p || width == 1 || tls_pool == p || n <= grain){ run_inline(n, grain, fn, arg); return; }
+    if((n - 1) / grain >= UINT32_MAX) grain = (n - 1) / (UINT32_MAX - 1) + 1;
+    uint32_t units = (uint32_t)((n - 1) / grain + 1);
+    if((uint32_t)width > units) width = (int)units;
+
+    pthread_mutex_lock(&p->run_lock);
+    for(int i=0;i<p->n;i++){
+        uint32_t lo = i < width ? (uint32_t)((uint64_t)units * (uint64_t)i / (uint64_t)width) : 0;
+        uint32_t hi = i < width ? (uint32_t)((uint64_t)units * (uint64_t)(i + 1) / (uint64_t)width) : 0;
+        atomic_store(&p->slot[i].range, pack(lo, hi));
+    }
+    pthread_mutex_lock(&p->mu);
+    p->fn = fn; p->arg = arg; p->items = n; p->grain = grain;
+    p->width = width; p->steal = steal;
+    p->pending = width - 1;
+    p->gen++;
+    pthread_cond_broadcast(&p->start);
+    pthread_mutex_unlock(&p->mu);
+
+    cpu_set_t aff;
+    int pinned = pin_caller(p, &aff);
+    tp_pool *saved = tls_pool;          // 可能是别的池的 worker
+    tls_pool = p;
+    run_worker(p, 0);
+    tls_pool = saved;
+    if(pinned) pthread_setaffinity_np(pthread_self(), sizeof(aff), &aff);
+
+    pthread_mutex_lock(&p->mu);
+    while(p->pending) pthread_cond_wait(&p->done, &p->mu);
+    pthread_mutex_unlock(&p->mu);
+    pthread_mutex_unlock(&p->run_lock);
+}
+
+void tp_parallel_for(tp_pool *p, int width, size_t n, size_t grain, tp_range_fn fn, void *arg){
+    run_job(p, width, n, grain, fn, arg, 1);
+}
+
+/* ---------------- 创建与销毁 ---------------- */
+
+tp_pool *tp_create(int nthreads){
+    cpu_set_t set;
+    int *cpu_node = malloc(MAX_CPUS * sizeof(int)), *order = malloc(MAX_CPUS * sizeof(int));
+    if(!cpu_node || !order){ free(cpu_node); free(order); return NULL; }
+    int nnodes = read_topology(cpu_node), ncpu = 0;
+    if(sched_getaffinity(0, sizeof(set), &set) != 0){ CPU_ZERO(&set); CPU_SET(0, &set); }
+    // 可用 CPU 按节点排序
+    for(int nd=0;nd<nnodes;nd++)
+        for(int c=0;c<CPU_SETSIZE && c<MAX_CPUS;c++)
+            if(CPU_ISSET(c, &set) && cpu_node[c] == nd) order[ncpu++] = c;
+    if(ncpu == 0) order[ncpu++] = 0;
+    if(nthreads <= 0) nthreads = ncpu;
+    if(nthreads > TP_MAX_WORKERS) nthreads = TP_MAX_WORKERS;
+
+    tp_pool *p = calloc(1, sizeof(*p));
+    if(!p){ free(cpu_node); free(order); return NULL; }
+    p->cpu_node = cpu_node;
+    p->n = nthreads;
+    p->nnodes = nnodes;
+    p->cpu = malloc((size_t)nthreads * sizeof(int));
+    p->node = malloc((size_t)nthreads * sizeof(int));
+    p->victims = malloc((size_t)nthreads * (size_t)(nthreads > 1 ? nthreads - 1 : 1) * sizeof(int));
+    p->th = calloc((size_t)nthreads, sizeof(pthread_t));
+    p->slot = aligned_alloc(64, (size_t)nthreads * sizeof(slot_t));
+    if(!p->cpu || !p->node || !p->victims || !p->th || !p->slot){
+        free(p->cpu); free(p->node); free(p->victims); free(p->th); free(p->slot); free(p);
+        free(cpu_node); free(order);
+        return NULL;
+    }
+    for(int i=0;i<nthreads;i++){
+        int c = order[i % ncpu];
+        p->cpu[i] = c;
+        p->node[i] = cpu_node[c];
+        atomic_init(&p->slot[i].range, 0);
+    }
+    free(order);
+
+    pthread_mutex_init(&p->run_lock, NULL);
+    pthread_mutex_init(&p->mu, NULL);
+    pthread_cond_init(&p->start, NULL);
+    pthread_cond_init(&p->done, NULL);
+    for(int i=1;i<nthreads;i++){
+        worker_arg_t *wa = malloc(sizeof(*wa));
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        if(wa){
+            cpu_set_t one;
+            CPU_ZERO(&one);
+            CPU_SET(p->cpu[i], &one);
+            pthread_attr_setaffinity_np(&attr, sizeof(one), &one);
+            wa->p = p;
+            wa->id = i;
+        }
+        int rc = wa ? pthread_create(&p->th[i], &attr, worker_main, wa) : -1;
+        pthread_attr_destroy(&attr);
+        if(rc != 0){
+            // 线程不够时缩小池，已建的线程照常使用
+            free(wa);
+            p->n = i;
+            break;
+        }
+    }
+    for(int i=0;i<p->n;i++) build_victims_of(p, i);
+    return p;
+}
+
+void tp_destroy(tp_pool *p){
+    if(!p) return;
+    pthread_mutex_lock(&p->mu);
+    p->stop = 1;
+    pthread_cond_broadcast(&p->start);
+    pthread_mutex_unlock(&p->mu);
+    for(int i=1;i<p->n;i++) pthread_join(p->th[i], NULL);
+    pthread_mutex_destroy(&p->run_lock);
+    pthread_mutex_destroy(&p->mu);
+    pthread_cond_destroy(&p->start);
+    pthread_cond_destroy(&p->done);
+    free(p->cpu); free(p->node); free(p->cpu_node); free(p->victims); free(p->th); free(p->slot);
+    free(p);
+}
+
+static pthread_once_t default_once = PTHREAD_ONCE_INIT;
+static tp_pool *default_pool;
+
+static void default_init(void){
+    const char *s = getenv("TP_THREADS");
+    default_pool = tp_create(s ? atoi(s) : 0);
+}
+
+tp_pool *tp_default(void){
+    pthread_once(&default_once, default_init);
+    return default_pool;
+}
+
+int tp_size(const tp_pool *p){ return p ? p->n : 1; }
+int tp_nodes(const tp_pool *p){ return p ? p->nnodes : 1; }
+int tp_worker_node(const tp_pool *p, int worker){
+    return p && worker >= 0 && worker < p->n ? p->node[worker] : 0;
+}
+
+/* ---------------- NUMA 本地缓冲 ---------------- */
+
+typedef struct {
+    uint8_t *base;
+    size_t size, page;
+} touch_t;
+
+static void touch_pages(void *arg, size_t lo, size_t hi, int worker){
+    (void)worker;
+    touch_t *t = arg;
+    for(size_t i=lo;i<hi;i++){
+        size_t off = i * t->page;
+        if(off < t->size) t->base[off] = 0;
+    }
+}
+
+void *tp_alloc(tp_pool *p, int width, size_t size){
+    if(size == 0) size = 1;
+    void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(ptr == MAP_FAILED) return NULL;
+    touch_t t = { ptr, size, (size_t)sysconf(_SC_PAGESIZE) };
+    // 不窃取：必须严格按静态划分写入，否则先醒的 worker 会替别人把页分到自己节点上
+    if(p && width != 1) run_job(p, width, (size - 1) / t.page + 1, 1, touch_pages, &t, 0);
+    return ptr;
+}
+
+void tp_free(void *ptr, size_t size){
+    if(ptr) munmap(ptr, size == 0 ? 1 : size);
+}
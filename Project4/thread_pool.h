@@ -0,0 +1,57 @@
+// thread_pool.h
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+  批量密码运算共用的工作窃取线程池（NUMA 感知）：
+    - 拓扑取自 /sys/devices/system/node/nodeN/cpulist，可用 CPU 按节点排序后依次分给各 worker，
+      1..n-1 号 worker 是池里的线程并绑到对应 CPU；0 号 worker 是调用 tp_parallel_for 的线程本身，
+      多节点时在这次调用（以及 tp_alloc 的首次写入）期间绑到第一个 CPU，返回前恢复原来的亲和性；
+    - [0, n) 按 grain 切成单元，先静态均分给前 width 个 worker，各自从前往后取；
+      自己的做完后去偷别人剩余区间的后一半，先偷同节点的，再跨节点；
+    - 大块输入输出缓冲用 tp_alloc 分配：按同样的静态划分由各 worker 首次写入，页就落在它所在的节点上，
+      之后没有窃取发生时每个 worker 只访问本节点内存；
+    - worker 私有的工作缓冲（预处理表、临时点表等）由 worker 在 fn 里自己分配，首次写入同样在本节点。
+  fn 在 worker 线程内再次调用 tp_parallel_for（同一个池）时直接在当前线程串行执行；
+  不同线程同时调用同一个池时依次执行。
+*/
+
+#define TP_MAX_WORKERS 256
+
+typedef struct tp_pool tp_pool;
+
+/* 处理 [lo, hi)，hi - lo 不超过 grain；worker 为 0..width-1，可用来索引每个 worker 的私有状态 */
+typedef void (*tp_range_fn)(void *arg, size_t lo, size_t hi, int worker);
+
+/* nthreads <= 0 时取可用 CPU 数；失败返回 NULL */
+tp_pool *tp_create(int nthreads);
+void tp_destroy(tp_pool *p);
+
+/* 进程共享的池，首次调用时创建，大小取环境变量 TP_THREADS，未设置时为可用 CPU 数；创建失败返回 NULL */
+tp_pool *tp_default(void);
+
+int tp_size(const tp_pool *p);
+int tp_nodes(const tp_pool *p);
+int tp_worker_node(const tp_pool *p, int worker);
+
+/* 用前 width 个 worker 处理 [0, n)；width <= 0 时用全部，超过池大小时截到池大小。
+   p 为 NULL 或 width == 1 时在调用线程内按 grain 分段执行，worker 恒为 0 */
+void tp_parallel_for(tp_pool *p, int width, size_t n, size_t grain, tp_range_fn fn, void *arg);
+
+/* 匿名映射 size 字节，按 width 个 worker 的静态划分并行首次写入（内容为 0）；p 为 NULL 或 width <= 1 时不预先写入。
+   与之后 tp_parallel_for(p, width, ...) 按比例处理同一缓冲时，各 worker 访问的正是自己写入的那一段。
+   失败返回 NULL；用 tp_free 释放 */
+void *tp_alloc(tp_pool *p, int width, size_t size);
+void tp_free(void *ptr, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
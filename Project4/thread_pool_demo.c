@@ -0,0 +1,202 @@
+// thread_pool_demo.c
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "sm3.h"
+#include "merkle.h"
+#include "thread_pool.h"
+
+/*
+  用法:
+    ./thread_pool_demo [线程数]
+      1. 拓扑与绑核；每个下标恰好被处理一次（不同 width / grain、嵌套调用）；tp_alloc 的内容
+      2. 负载不均（前 1/8 的单元耗时是其余的 16 倍）时静态均分与工作窃取的对比；
+         另用睡眠代替计算的单元对比一次，单核机器上也能看出窃取的效果
+      3. merkle_build_par 与 merkle_build 的根一致性与耗时
+*/
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ---------------- 1. 覆盖性 ---------------- */
+
+typedef struct {
+    tp_pool *p;
+    unsigned char *hits;
+    size_t grain;
+    int bad, width;
+} cover_t;
+
+static void mark(void *arg, size_t lo, size_t hi, int worker){
+    cover_t *c = arg;
+    if(hi - lo > c->grain || worker < 0 || worker >= (c->width > 0 ? c->width : tp_size(c->p))) c->bad = 1;
+    for(size_t i=lo;i<hi;i++) __atomic_add_fetch(&c->hits[i], 1, __ATOMIC_RELAXED);
+}
+
+static void nested(void *arg, size_t lo, size_t hi, int worker){
+    (void)worker;
+    cover_t *outer = arg;
+    // 同一个池的嵌套调用在当前线程内串行执行
+    cover_t in = { outer->p, outer->hits, 7, 0, 0 };
+    tp_parallel_for(outer->p, 0, hi - lo, 7, mark, &in);
+    if(in.bad) outer->bad = 1;
+}
+
+/* ---------------- 2. 负载不均 ---------------- */
+
+typedef struct {
+    size_t n;
+    uint64_t acc[TP_MAX_WORKERS];
+} work_t;
+
+static void burn(void *arg, size_t lo, size_t hi, int worker){
+    work_t *w = arg;
+    uint8_t buf[64], h[32];
+    for(size_t i=lo;i<hi;i++){
+        memset(buf, 0, sizeof(buf));
+        int rounds = i < w->n / 8 ? 64 : 4;
+        memcpy(buf, &i, sizeof(i));
+        for(int r=0;r<rounds;r++){ sm3_hash(buf, sizeof(buf), h); memcpy(buf + 8, h, 32); }
+        w->acc[worker] += h[0];
+    }
+}
+
+/* 单元以睡眠代替计算：核数不够时也能看出调度是否把慢单元分散开 */
+static void nap(void *arg, size_t lo, size_t hi, int worker){
+    (void)worker;
+    const size_t *n = arg;
+    for(size_t i=lo;i<hi;i++){
+        struct timespec ts = { 0, i < *n / 8 ? 2000000 : 100000 };
+        nanosleep(&ts, NULL);
+    }
+}
+
+/* 每个线程分到一整段（grain = n / width），相当于原来各模块里的静态切分 */
+static double run_burn(tp_pool *p, int width, size_t n, size_t grain, uint64_t *sum){
+    work_t w;
+    memset(&w, 0, sizeof(w));
+    w.n = n;
+    double t0 = now_sec();
+    tp_parallel_for(p, width, n, grain, burn, &w);
+    double t = now_sec() - t0;
+    *sum = 0;
+    for(int i=0;i<TP_MAX_WORKERS;i++) *sum += w.acc[i];
+    return t;
+}
+
+int main(int argc, char **argv){
+    int nthr = argc > 1 ? atoi(argv[1]) : 4;
+    int bad = 0;
+    tp_pool *p = tp_create(nthr);
+    if(!p){ fprintf(stderr, "tp_create failed\n"); return 1; }
+    nthr = tp_size(p);
+    printf("pool: %d workers, %d NUMA node(s); worker->node:", nthr, tp_nodes(p));
+    for(int i=0;i<nthr;i++) printf(" %d", tp_worker_node(p, i));
+    printf("\n");
+
+    /* 1. 每个下标恰好一次 */
+    static const size_t ns[] = { 0, 1, 5, 1000, 123457 };
+    static const size_t grains[] = { 1, 3, 64, 100000 };
+    int cover_bad = 0;
+    for(size_t a=0;a<sizeof(ns)/sizeof(ns[0]);a++)
+        for(size_t b=0;b<sizeof(grains)/sizeof(grains[0]);b++)
+            for(int width=0; width<=nthr; width++){
+                size_t n = ns[a];
+                cover_t c = { p, calloc(n + 1, 1), grains[b], 0, width };
+                tp_parallel_for(p, width, n, grains[b], mark, &c);
+                for(size_t i=0;i<n;i++) if(c.hits[i] != 1) c.bad = 1;
+                if(c.bad) cover_bad++;
+                free(c.hits);
+            }
+    {
+        size_t n = 50000;
+        cover_t c = { p, calloc(n, 1), 500, 0, 0 };
+        tp_parallel_for(p, 0, n, 500, nested, &c);
+        // 每个外层单元都在 hits[0..500) 上各加 1，总数应为 n
+        size_t total = 0;
+        for(size_t i=0;i<n;i++) total += c.hits[i];
+        if(c.bad || total != n) cover_bad++;
+        free(c.hits);
+    }
+    printf("each index processed exactly once (widths 0..%d, nested calls): %s\n", nthr, cover_bad ? "FAIL" : "OK");
+    bad += cover_bad;
+
+    size_t asz = (size_t)3 << 20;
+    uint8_t *buf = tp_alloc(p, 0, asz);
+    int zero = buf != NULL;
+    for(size_t i=0; zero && i<asz; i+=4096) if(buf[i]) zero = 0;
+    tp_free(buf, asz);
+    printf("tp_alloc %zu MiB first-touched by %d workers: %s\n", asz >> 20, nthr, zero ? "OK" : "FAIL");
+    if(!zero) bad++;
+
+    /* 2. 负载不均 */
+    const size_t N = 1 << 15;
+    uint64_t s0, s1, s2;
+    double t1 = run_burn(NULL, 1, N, 64, &s0);
+    double ts = run_burn(p, nthr, N, (N + (size_t)nthr - 1) / (size_t)nthr, &s1);
+    double tw = run_burn(p, nthr, N, 64, &s2);
+    printf("\nskewed workload, %zu units (first 1/8 cost 16x):\n", N);
+    printf("  1 thread              : %.3f s\n", t1);
+    printf("  %2d threads, static    : %.3f s (%.2fx)\n", nthr, ts, t1 / ts);
+    printf("  %2d threads, stealing  : %.3f s (%.2fx)%s\n", nthr, tw, t1 / tw, s0 == s1 && s1 == s2 ? "" : "  MISMATCH");
+    if(s0 != s1 || s1 != s2) bad++;
+    const size_t M = 512;
+    double n0 = now_sec();
+    tp_parallel_for(p, nthr, M, (M + (size_t)nthr - 1) / (size_t)nthr, nap, (void*)&M);
+    double n1 = now_sec();
+    tp_parallel_for(p, nthr, M, 1, nap, (void*)&M);
+    double n2 = now_sec();
+    printf("sleeping units, %zu units (first 1/8 sleep 2 ms, others 0.1 ms):\n", M);
+    printf("  %2d threads, static    : %.3f s\n", nthr, n1 - n0);
+    printf("  %2d threads, stealing  : %.3f s\n", nthr, n2 - n1);
+
+    /* 3. Merkle */
+    const size_t L = 1 << 18;
+    uint8_t **leaf = malloc(L * sizeof(*leaf));
+    size_t *len = malloc(L * sizeof(*len));
+    for(size_t i=0;i<L;i++){
+        char tmp[64];
+        len[i] = (size_t)snprintf(tmp, sizeof(tmp), "leaf-%08zu", i);
+        leaf[i] = malloc(len[i]);
+        memcpy(leaf[i], tmp, len[i]);
+    }
+    size_t nl1, nl2, na, nb;
+    uint8_t r1[HASHLEN], r2[HASHLEN];
+    double m0 = now_sec();
+    level_t *lv1 = merkle_build(leaf, len, L, &nl1);
+    double m1 = now_sec();
+    level_t *lv2 = merkle_build_par(leaf, len, L, &nl2, p, 0);
+    double m2 = now_sec();
+    merkle_root(lv1, nl1, r1);
+    merkle_root(lv2, nl2, r2);
+    int same = nl1 == nl2 && memcmp(r1, r2, HASHLEN) == 0;
+    for(size_t i=0; same && i<nl1; i++)
+        same = lv1[i].nodes == lv2[i].nodes && memcmp(lv1[i].data, lv2[i].data, lv1[i].nodes * HASHLEN) == 0;
+    // 奇数叶子与很小的树
+    for(size_t n=1; same && n<40; n++){
+        level_t *a = merkle_build(leaf, len, n, &na), *b = merkle_build_par(leaf, len, n, &nb, p, 0);
+        merkle_root(a, na, r1);
+        merkle_root(b, nb, r2);
+        same = na == nb && memcmp(r1, r2, HASHLEN) == 0;
+        merkle_free(a, na);
+        merkle_free(b, nb);
+    }
+    printf("\nMerkle tree, %zu leaves:\n", L);
+    printf("  merkle_build          : %.3f s\n", m1 - m0);
+    printf("  merkle_build_par (%2d) : %.3f s (%.2fx)\n", nthr, m2 - m1, (m1 - m0) / (m2 - m1));
+    printf("  all levels identical  : %s\n", same ? "OK" : "FAIL");
+    if(!same) bad++;
+    merkle_free(lv1, nl1);
+    merkle_free(lv2, nl2);
+    for(size_t i=0;i<L;i++) free(leaf[i]);
+    free(leaf); free(len);
+
+    tp_destroy(p);
+    return bad ? 1 : 0;
+}
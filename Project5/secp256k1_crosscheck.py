@@ -0,0 +1,94 @@
+# secp256k1_crosscheck.py
+# Cross-check the native secp256k1 engine (Project4/secp256k1*.c) against sign.py.
+#   - public key, WIF and address (compressed and uncompressed) of random private keys
+#   - native signatures: byte-exact against an RFC 6979 (HMAC-SHA256) + low-S signer built on
+#     sign.py's curve arithmetic, DER encoding against signature_to_der, and sign.ecdsa_verify
+#   - sign.ecdsa_sign signatures (random k) are accepted by the native verifier, tampered ones rejected
+#   - secp256k1_address_batch (multi-threaded, with invalid keys mixed in) against public_key_to_address
+# Usage:
+#   gcc -O2 -pthread -o ../Project4/secp256k1_demo ../Project4/secp256k1_demo.c ../Project4/secp256k1.c \
+#       ../Project4/secp256k1_mul.c ../Project4/secp256k1_addr.c ../Project4/sha256.c ../Project4/ripemd160.c \
+#       ../Project4/thread_pool.c
+#   python3 secp256k1_crosscheck.py [../Project4/secp256k1_demo] [rounds]
+
+import hashlib, hmac, random, string, subprocess, sys
+from sign import (ECPoint, Gx, Gy, N, modinv, sha256, private_key_to_public_key, private_key_to_wif,
+                  public_key_to_address, ecdsa_sign, ecdsa_verify, signature_to_der)
+
+def rand_text(lo, hi):
+    return "".join(random.choice(string.ascii_letters + string.digits + " ") for _ in range(random.randint(lo, hi)))
+
+def rfc6979_k(d, z):
+    mac = lambda k, v: hmac.new(k, v, hashlib.sha256).digest()
+    x, h1 = d.to_bytes(32, "big"), (z % N).to_bytes(32, "big")
+    K, V = b"\x00" * 32, b"\x01" * 32
+    K = mac(K, V + b"\x00" + x + h1); V = mac(K, V)
+    K = mac(K, V + b"\x01" + x + h1); V = mac(K, V)
+    while True:
+        V = mac(K, V)
+        k = int.from_bytes(V, "big")
+        if 1 <= k < N:
+            return k
+        K = mac(K, V + b"\x00"); V = mac(K, V)
+
+def sign_deterministic(d, msg):
+    z = int.from_bytes(sha256(msg), "big")
+    k = rfc6979_k(d, z)
+    r = (k * ECPoint(Gx, Gy)).x % N
+    s = modinv(k, N) * (z + r * d) % N
+    return r, min(s, N - s)
+
+def check_kat(exe, d, msg):
+    P = private_key_to_public_key(d)
+    pr, ps = ecdsa_sign(d, msg)
+    out = subprocess.run([exe, "kat", "%064x" % d, msg, "%064x" % pr, "%064x" % (ps ^ 1)],
+                         capture_output=True, text=True, check=True).stdout.split()
+    out2 = subprocess.run([exe, "kat", "%064x" % d, msg, "%064x" % pr, "%064x" % ps],
+                          capture_output=True, text=True, check=True).stdout.split()
+    pub_hex, wif, addr_c, addr_u, sig_hex, der_hex, ok, tampered_ok = out
+    r, s = sign_deterministic(d, msg)
+    checks = [
+        pub_hex == "%064x%064x" % (P.x, P.y),
+        wif == private_key_to_wif(d),
+        addr_c == public_key_to_address(P, compressed=True),
+        addr_u == public_key_to_address(P, compressed=False),
+        sig_hex == "%064x%064x" % (r, s),
+        der_hex == signature_to_der(r, s).hex(),
+        ok == "1" and ecdsa_verify(P, msg, (r, s)),
+        tampered_ok == "0" and out2[7] == "1",
+    ]
+    return all(checks)
+
+def check_batch(exe, count, compressed):
+    keys = [random.randrange(1, N) for _ in range(count)]
+    keys[count // 3] = 0            # invalid keys -> empty address
+    keys[count // 2] = N
+    keys[-1] = N - 1
+    inp = "".join("%064x\n" % k for k in keys)
+    out = subprocess.run([exe, "addr", str(int(compressed)), "3"], input=inp,
+                         capture_output=True, text=True, check=True).stdout.split("\n")
+    bad = 0
+    for k, line in zip(keys, out):
+        want = public_key_to_address(private_key_to_public_key(k), compressed) if 1 <= k < N else "-"
+        if line != want:
+            bad += 1
+            print("BATCH MISMATCH k=%064x got=%r want=%r" % (k, line, want))
+    return bad
+
+def main():
+    exe = sys.argv[1] if len(sys.argv) > 1 else "../Project4/secp256k1_demo"
+    rounds = int(sys.argv[2]) if len(sys.argv) > 2 else 50
+    bad = 0
+    for i in range(rounds):
+        d = random.choice([random.randrange(1, N), random.randrange(1, 2**64), N - random.randrange(1, 2**64)])
+        msg = rand_text(0, 200)
+        if not check_kat(exe, d, msg):
+            bad += 1
+            print("MISMATCH d=%064x msg=%r" % (d, msg))
+    print("%d/%d vectors match sign.py" % (rounds - bad, rounds))
+    batch_bad = check_batch(exe, 4 * rounds, True) + check_batch(exe, 4 * rounds, False)
+    print("address batch: %d/%d match sign.py" % (8 * rounds - batch_bad, 8 * rounds))
+    return 1 if bad or batch_bad else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,36 @@
+# sm2_crosscheck.py
+# Cross-check the native SM2 engine (Project4/sm2.c) against sm2_basic.py.
+# Usage:
+#   gcc -O2 -o ../Project4/sm2_demo ../Project4/sm2_demo.c ../Project4/sm2.c ../Project4/sm2_mul.c ../Project4/sm3.c
+#   python3 sm2_crosscheck.py [../Project4/sm2_demo] [rounds]
+
+import random, string, subprocess, sys
+from sm2_basic import keygen, sm2_sign, sm2_verify, n
+
+def rand_text(lo, hi):
+    return "".join(random.choice(string.ascii_letters + string.digits) for _ in range(random.randint(lo, hi)))
+
+def main():
+    exe = sys.argv[1] if len(sys.argv) > 1 else "../Project4/sm2_demo"
+    rounds = int(sys.argv[2]) if len(sys.argv) > 2 else 50
+    bad = 0
+    for i in range(rounds):
+        d = random.randrange(1, n - 1)
+        ID = rand_text(1, 16)
+        M = rand_text(0, 200)
+        out = subprocess.run([exe, "kat", "%064x" % d, ID, M], capture_output=True, text=True, check=True).stdout.split()
+        pub_hex, sig_hex, ok = out
+        _, P = keygen(d)
+        r, s = sm2_sign(d, ID.encode(), M.encode(), P, deterministic=True)
+        want_pub = "%064x%064x" % P
+        want_sig = "%064x%064x" % (r, s)
+        native_sig = (int(sig_hex[:64], 16), int(sig_hex[64:], 16))
+        if pub_hex != want_pub or sig_hex != want_sig or ok != "1" \
+                or not sm2_verify(P, ID.encode(), M.encode(), native_sig):
+            bad += 1
+            print("MISMATCH d=%064x ID=%r M=%r" % (d, ID, M))
+    print("%d/%d vectors match sm2_basic.py" % (rounds - bad, rounds))
+    return 1 if bad else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
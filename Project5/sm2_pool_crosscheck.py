@@ -0,0 +1,40 @@
+# sm2_pool_crosscheck.py
+# Cross-check the offline/online SM2 signer (Project4/sm2_pool.c) against sm2_basic.py.
+# Every signature (half from the precomputed pool, half computed on a miss) must pass
+# sm2_basic.sm2_verify, and no two signatures of the same message may share r
+# (a repeated nonce would leak the private key).
+# Usage:
+#   gcc -O2 -pthread -o ../Project4/sm2_pool_demo ../Project4/sm2_pool_demo.c ../Project4/sm2_pool.c \
+#       ../Project4/sm2.c ../Project4/sm2_mul.c ../Project4/sm3.c
+#   python3 sm2_pool_crosscheck.py [../Project4/sm2_pool_demo] [rounds]
+
+import random, string, subprocess, sys
+from sm2_basic import keygen, sm2_verify, n
+
+def rand_text(lo, hi):
+    return "".join(random.choice(string.ascii_letters + string.digits) for _ in range(random.randint(lo, hi)))
+
+def main():
+    exe = sys.argv[1] if len(sys.argv) > 1 else "../Project4/sm2_pool_demo"
+    rounds = int(sys.argv[2]) if len(sys.argv) > 2 else 20
+    per_key = 16
+    bad = 0
+    for i in range(rounds):
+        d, P = keygen(random.randrange(1, n - 1))
+        ID, M = rand_text(1, 16), rand_text(0, 200)
+        lines = subprocess.run([exe, "sign", "%064x" % d, ID, M, str(per_key)],
+                               capture_output=True, text=True, check=True).stdout.split("\n")
+        pub_ok = lines[0] == "%064x%064x" % P
+        sigs = [l.split() for l in lines[1:1 + per_key]]
+        rs = [(int(h[:64], 16), int(h[64:], 16)) for h, _ in sigs]
+        checks = [pub_ok, len(set(r for r, _ in rs)) == per_key,
+                  all(v == "1" for _, v in sigs),
+                  all(sm2_verify(P, ID.encode(), M.encode(), sig) for sig in rs)]
+        if not all(checks):
+            bad += 1
+            print("MISMATCH d=%064x ID=%r M=%r checks=%s" % (d, ID, M, checks))
+    print("%d/%d keys: all pool signatures verify with sm2_basic.py" % (rounds - bad, rounds))
+    return 1 if bad else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,592 @@
+// p256.c
+#include <stdlib.h>
+#include <string.h>
+#include <sys/random.h>
+#include <x86intrin.h>
+#include "sha256.h"
+#include "p256.h"
+
+typedef unsigned __int128 u128;
+
+/* ---------------- Montgomery 运算（R = 2^256） ----------------
+   与 Project4/sm2.c 相同的 CIOS 写法：p 满 256 位，保留第 5 个进位字 */
+
+static const uint64_t P256_P[4]   = { 0xffffffffffffffffULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL };
+static const uint64_t P256_N[4]   = { 0xf3b9cac2fc632551ULL, 0xbce6faada7179e84ULL, 0xffffffffffffffffULL, 0xffffffff00000000ULL };
+static const uint64_t P256_M0INV  = 1;                                  // -p^{-1} mod 2^64
+static const uint64_t P256_RR[4]  = { 0x0000000000000003ULL, 0xfffffffbffffffffULL, 0xfffffffffffffffeULL, 0x00000004fffffffdULL };
+static const uint64_t P256_RRR[4] = { 0xfffffffd0000000aULL, 0xffffffedfffffff7ULL, 0x00000005fffffffcULL, 0x0000001800000001ULL };
+static const uint64_t P256_ONE[4] = { 0x0000000000000001ULL, 0xffffffff00000000ULL, 0xffffffffffffffffULL, 0x00000000fffffffeULL };
+static const uint64_t P256_PM2[4] = { 0xfffffffffffffffdULL, 0x00000000ffffffffULL, 0x0000000000000000ULL, 0xffffffff00000001ULL };
+static const uint64_t P256_SQRT_E[4] = { 0x0000000000000000ULL, 0x0000000040000000ULL, 0x4000000000000000ULL, 0x3fffffffc0000000ULL }; // (p+1)/4
+
+/* 曲线与 SSWU 常量（Montgomery 形式）：A = -3，Z = -10 */
+static const p256_fe FE_A    = {{ 0xfffffffffffffffcULL, 0x00000003ffffffffULL, 0x0000000000000000ULL, 0xfffffffc00000004ULL }};
+static const p256_fe FE_B    = {{ 0xd89cdf6229c4bddfULL, 0xacf005cd78843090ULL, 0xe5a220abf7212ed6ULL, 0xdc30061d04874834ULL }};
+static const p256_fe FE_Z    = {{ 0xfffffffffffffff5ULL, 0x0000000affffffffULL, 0x0000000000000000ULL, 0xfffffff50000000bULL }};
+static const p256_fe FE_MBA  = {{ 0x9d899fcb6341949fULL, 0x8efaac9a7d816585ULL, 0xa1e0b58ea7b5ba47ULL, 0xf410020901826d67ULL }}; // -B/A
+static const p256_fe FE_BZA  = {{ 0x5c8dc32df0535ba9ULL, 0xc17f77a98c8cf08dULL, 0x7696788e43f892a0ULL, 0x9868003399c03e24ULL }}; // B/(Z·A)
+static const p256_fe FE_ZC   = {{ 0xac1bc6ae09b02418ULL, 0x4d7f939d6995e599ULL, 0xe53a2a63cd6740afULL, 0x5ccdc7ad456681d9ULL }}; // Z·sqrt(-Z)
+static const p256_fe FE_ZERO = {{ 0, 0, 0, 0 }};
+
+typedef struct { p256_fe X, Y, Z; } p256_point;  // Jacobian, Z=0 表示无穷远点
+
+#define FE_INLINE static inline __attribute__((always_inline))
+
+FE_INLINE void fe_mul(p256_fe *r, const p256_fe *A, const p256_fe *B){
+    const uint64_t *a = A->v, *b = B->v;
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5;
+#pragma GCC unroll 4
+    for(int i=0;i<4;i++){
+        u128 x;
+        uint64_t bi = b[i], m;
+        x = (u128)a[0]*bi + t0;             t0 = (uint64_t)x;
+        x = (u128)a[1]*bi + t1 + (x >> 64); t1 = (uint64_t)x;
+        x = (u128)a[2]*bi + t2 + (x >> 64); t2 = (uint64_t)x;
+        x = (u128)a[3]*bi + t3 + (x >> 64); t3 = (uint64_t)x;
+        x = (u128)t4 + (x >> 64);           t4 = (uint64_t)x; t5 = (uint64_t)(x >> 64);
+
+        m = t0 * P256_M0INV;
+        x = (u128)m*P256_P[0] + t0;
+        x = (u128)m*P256_P[1] + t1 + (x >> 64); t0 = (uint64_t)x;
+        x = (u128)m*P256_P[2] + t2 + (x >> 64); t1 = (uint64_t)x;
+        x = (u128)m*P256_P[3] + t3 + (x >> 64); t2 = (uint64_t)x;
+        x = (u128)t4 + (x >> 64);               t3 = (uint64_t)x;
+        t4 = t5 + (uint64_t)(x >> 64);
+    }
+    // t < 2p，按需减一次 p（常量时间选择）
+    unsigned long long s0, s1, s2, s3;
+    unsigned char bw = 0;
+    bw = _subborrow_u64(bw, t0, P256_P[0], &s0);
+    bw = _subborrow_u64(bw, t1, P256_P[1], &s1);
+    bw = _subborrow_u64(bw, t2, P256_P[2], &s2);
+    bw = _subborrow_u64(bw, t3, P256_P[3], &s3);
+    uint64_t keep = -(uint64_t)(bw & (t4 == 0));   // 全 1: 保留 t
+    r->v[0] = (t0 & keep) | (s0 & ~keep);
+    r->v[1] = (t1 & keep) | (s1 & ~keep);
+    r->v[2] = (t2 & keep) | (s2 & ~keep);
+    r->v[3] = (t3 & keep) | (s3 & ~keep);
+}
+
+FE_INLINE void fe_sqr(p256_fe *r, const p256_fe *a){ fe_mul(r, a, a); }
+
+FE_INLINE void fe_add(p256_fe *r, const p256_fe *a, const p256_fe *b){
+    unsigned long long s[4], d[4];
+    unsigned char cy = 0, bw = 0;
+    cy = _addcarry_u64(cy, a->v[0], b->v[0], &s[0]);
+    cy = _addcarry_u64(cy, a->v[1], b->v[1], &s[1]);
+    cy = _addcarry_u64(cy, a->v[2], b->v[2], &s[2]);
+    cy = _addcarry_u64(cy, a->v[3], b->v[3], &s[3]);
+    bw = _subborrow_u64(bw, s[0], P256_P[0], &d[0]);
+    bw = _subborrow_u64(bw, s[1], P256_P[1], &d[1]);
+    bw = _subborrow_u64(bw, s[2], P256_P[2], &d[2]);
+    bw = _subborrow_u64(bw, s[3], P256_P[3], &d[3]);
+    uint64_t keep = -(uint64_t)(bw & (cy ^ 1));
+    for(int j=0;j<4;j++) r->v[j] = (s[j] & keep) | (d[j] & ~keep);
+}
+
+FE_INLINE void fe_sub(p256_fe *r, const p256_fe *a, const p256_fe *b){
+    unsigned long long d[4], o[4];
+    unsigned char bw = 0, cy = 0;
+    bw = _subborrow_u64(bw, a->v[0], b->v[0], &d[0]);
+    bw = _subborrow_u64(bw, a->v[1], b->v[1], &d[1]);
+    bw = _subborrow_u64(bw, a->v[2], b->v[2], &d[2]);
+    bw = _subborrow_u64(bw, a->v[3], b->v[3], &d[3]);
+    uint64_t mask = -(uint64_t)bw;
+    cy = _addcarry_u64(cy, d[0], P256_P[0] & mask, &o[0]);
+    cy = _addcarry_u64(cy, d[1], P256_P[1] & mask, &o[1]);
+    cy = _addcarry_u64(cy, d[2], P256_P[2] & mask, &o[2]);
+    cy = _addcarry_u64(cy, d[3], P256_P[3] & mask, &o[3]);
+    for(int j=0;j<4;j++) r->v[j] = o[j];
+}
+
+/* r = a^e，指数公开，4 位固定窗口 */
+static void fe_pow(p256_fe *r, const p256_fe *a, const uint64_t e[4]){
+    p256_fe acc, pw[16];
+    memcpy(pw[0].v, P256_ONE, sizeof(pw[0].v));
+    pw[1] = *a;
+    for(int i=2;i<16;i++) fe_mul(&pw[i], &pw[i-1], a);
+    acc = pw[e[3] >> 60];
+    for(int i=62;i>=0;i--){
+        for(int j=0;j<4;j++) fe_sqr(&acc, &acc);
+        unsigned w = (unsigned)(e[i/16] >> ((i%16)*4)) & 0xF;
+        if(w) fe_mul(&acc, &acc, &pw[w]);
+    }
+    *r = acc;
+}
+
+static void fe_inv(p256_fe *r, const p256_fe *a){ fe_pow(r, a, P256_PM2); }
+
+/* Montgomery 联合求逆：out[i] = 1/in[i]，in 不能含 0；out 可与 in 相同 */
+static void fe_batch_inv(p256_fe *out, const p256_fe *in, size_t n, p256_fe *scratch){
+    if(!n) return;
+    scratch[0] = in[0];
+    for(size_t i=1;i<n;i++) fe_mul(&scratch[i], &scratch[i-1], &in[i]);
+    p256_fe inv, t;
+    fe_inv(&inv, &scratch[n-1]);
+    for(size_t i=n-1;i>0;i--){
+        fe_mul(&t, &inv, &scratch[i-1]);
+        fe_mul(&inv, &inv, &in[i]);
+        out[i] = t;
+    }
+    out[0] = inv;
+}
+
+FE_INLINE void fe_to_mont(p256_fe *r, const p256_fe *a){
+    p256_fe rr;
+    memcpy(rr.v, P256_RR, sizeof(rr.v));
+    fe_mul(r, a, &rr);
+}
+
+FE_INLINE void fe_from_mont(p256_fe *r, const p256_fe *a){
+    p256_fe one = {{ 1, 0, 0, 0 }};
+    fe_mul(r, a, &one);
+}
+
+static inline int fe_is_zero(const p256_fe *a){
+    return (a->v[0] | a->v[1] | a->v[2] | a->v[3]) == 0;
+}
+
+static inline int fe_equal(const p256_fe *a, const p256_fe *b){
+    return ((a->v[0] ^ b->v[0]) | (a->v[1] ^ b->v[1]) | (a->v[2] ^ b->v[2]) | (a->v[3] ^ b->v[3])) == 0;
+}
+
+/* 全 1 当且仅当 a == b */
+static inline uint64_t ct_eq_mask(uint64_t a, uint64_t b){
+    uint64_t x = a ^ b;
+    return ((x | (0 - x)) >> 63) - 1;
+}
+
+static inline void ct_select_fe(p256_fe *r, const p256_fe *a, uint64_t mask){
+    for(int j=0;j<4;j++) r->v[j] = (a->v[j] & mask) | (r->v[j] & ~mask);
+}
+
+/* a < m（大端比较，公开数据） */
+static int lt_256(const uint64_t a[4], const uint64_t m[4]){
+    for(int i=3;i>=0;i--){
+        if(a[i] < m[i]) return 1;
+        if(a[i] > m[i]) return 0;
+    }
+    return 0;
+}
+
+static void fe_from_bytes(p256_fe *r, const uint8_t in[32]){
+    for(int i=0;i<4;i++){
+        uint64_t w = 0;
+        for(int j=0;j<8;j++) w = (w << 8) | in[(3-i)*8 + j];
+        r->v[i] = w;
+    }
+}
+
+static void fe_to_bytes(uint8_t out[32], const p256_fe *a){
+    for(int i=0;i<4;i++)
+        for(int j=0;j<8;j++) out[(3-i)*8 + j] = (uint8_t)(a->v[i] >> (56 - 8*j));
+}
+
+/* ---------------- 标量 ---------------- */
+
+int p256_scalar_from_bytes(p256_fe *k, const uint8_t in[32]){
+    fe_from_bytes(k, in);
+    return (fe_is_zero(k) || !lt_256(k->v, P256_N)) ? -1 : 0;
+}
+
+void p256_scalar_to_bytes(uint8_t out[32], const p256_fe *k){ fe_to_bytes(out, k); }
+
+int p256_scalar_random(p256_fe *k){
+    uint8_t buf[32];
+    for(int tries=0; tries<64; tries++){
+        if(getrandom(buf, sizeof(buf), 0) != (ssize_t)sizeof(buf)) return -1;
+        if(p256_scalar_from_bytes(k, buf) == 0){
+            memset(buf, 0, sizeof(buf));
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/* ---------------- 点运算（Jacobian，a = -3） ---------------- */
+
+static void point_from_affine(p256_point *r, const p256_affine *a){
+    r->X = a->x; r->Y = a->y;
+    memcpy(r->Z.v, P256_ONE, sizeof(r->Z.v));
+}
+
+/* dbl-2001-b；Z=0 时结果仍为 Z=0 */
+static void point_double(p256_point *r, const p256_point *p){
+    p256_fe delta, gamma, beta, alpha, t0, t1;
+    fe_sqr(&delta, &p->Z);
+    fe_sqr(&gamma, &p->Y);
+    fe_mul(&beta, &p->X, &gamma);
+    fe_sub(&t0, &p->X, &delta);
+    fe_add(&t1, &p->X, &delta);
+    fe_mul(&alpha, &t0, &t1);
+    fe_add(&t0, &alpha, &alpha);
+    fe_add(&alpha, &alpha, &t0);              // alpha = 3(X-delta)(X+delta)
+    fe_add(&t0, &p->Y, &p->Z);
+    fe_sqr(&t0, &t0);
+    fe_sub(&t0, &t0, &gamma);
+    fe_sub(&r->Z, &t0, &delta);               // Z3 = (Y+Z)^2 - gamma - delta
+    fe_add(&beta, &beta, &beta);
+    fe_add(&beta, &beta, &beta);              // 4beta
+    fe_sqr(&t0, &alpha);
+    fe_sub(&t0, &t0, &beta);
+    fe_sub(&t0, &t0, &beta);                  // X3 = alpha^2 - 8beta
+    fe_sub(&beta, &beta, &t0);
+    fe_mul(&beta, &alpha, &beta);
+    fe_sqr(&gamma, &gamma);
+    fe_add(&gamma, &gamma, &gamma);
+    fe_add(&gamma, &gamma, &gamma);
+    fe_add(&gamma, &gamma, &gamma);
+    fe_sub(&r->Y, &beta, &gamma);             // Y3 = alpha(4beta - X3) - 8gamma^2
+    r->X = t0;
+}
+
+/* add-2007-bl；处理无穷远点与 P == ±Q */
+static void point_add(p256_point *r, const p256_point *p, const p256_point *q){
+    if(fe_is_zero(&p->Z)){ *r = *q; return; }
+    if(fe_is_zero(&q->Z)){ *r = *p; return; }
+    p256_fe Z1Z1, Z2Z2, U1, U2, S1, S2, H, I, J, R, V, t0;
+    fe_sqr(&Z1Z1, &p->Z);
+    fe_sqr(&Z2Z2, &q->Z);
+    fe_mul(&U1, &p->X, &Z2Z2);
+    fe_mul(&U2, &q->X, &Z1Z1);
+    fe_mul(&S1, &p->Y, &q->Z);
+    fe_mul(&S1, &S1, &Z2Z2);
+    fe_mul(&S2, &q->Y, &p->Z);
+    fe_mul(&S2, &S2, &Z1Z1);
+    fe_sub(&H, &U2, &U1);
+    fe_sub(&R, &S2, &S1);
+    if(fe_is_zero(&H)){
+        if(fe_is_zero(&R)){ point_double(r, p); return; }
+        memset(r, 0, sizeof(*r));
+        return;
+    }
+    fe_add(&I, &H, &H);
+    fe_sqr(&I, &I);
+    fe_mul(&J, &H, &I);
+    fe_add(&R, &R, &R);
+    fe_mul(&V, &U1, &I);
+    fe_add(&t0, &p->Z, &q->Z);
+    fe_sqr(&t0, &t0);
+    fe_sub(&t0, &t0, &Z1Z1);
+    fe_sub(&t0, &t0, &Z2Z2);
+    fe_mul(&r->Z, &t0, &H);
+    fe_sqr(&t0, &R);
+    fe_sub(&t0, &t0, &J);
+    fe_sub(&t0, &t0, &V);
+    fe_sub(&t0, &t0, &V);                     // X3 = r^2 - J - 2V
+    fe_sub(&V, &V, &t0);
+    fe_mul(&V, &R, &V);
+    fe_mul(&S1, &S1, &J);
+    fe_add(&S1, &S1, &S1);
+    fe_sub(&r->Y, &V, &S1);                   // Y3 = r(V-X3) - 2·S1·J
+    r->X = t0;
+}
+
+/* madd-2007-bl：q 为仿射点 */
+static void point_add_affine(p256_point *r, const p256_point *p, const p256_affine *q){
+    if(fe_is_zero(&p->Z)){ point_from_affine(r, q); return; }
+    p256_fe Z1Z1, U2, S2, H, HH, I, J, R, V, t0, Y1J;
+    fe_sqr(&Z1Z1, &p->Z);
+    fe_mul(&U2, &q->x, &Z1Z1);
+    fe_mul(&S2, &q->y, &p->Z);
+    fe_mul(&S2, &S2, &Z1Z1);
+    fe_sub(&H, &U2, &p->X);
+    fe_sub(&R, &S2, &p->Y);
+    if(fe_is_zero(&H)){
+        if(fe_is_zero(&R)){ point_double(r, p); return; }
+        memset(r, 0, sizeof(*r));
+        return;
+    }
+    fe_sqr(&HH, &H);
+    fe_add(&I, &HH, &HH);
+    fe_add(&I, &I, &I);
+    fe_mul(&J, &H, &I);
+    fe_add(&R, &R, &R);
+    fe_mul(&V, &p->X, &I);
+    fe_add(&t0, &p->Z, &H);
+    fe_sqr(&t0, &t0);
+    fe_sub(&t0, &t0, &Z1Z1);
+    fe_sub(&r->Z, &t0, &HH);                  // Z3 = (Z1+H)^2 - Z1Z1 - HH
+    fe_mul(&Y1J, &p->Y, &J);
+    fe_sqr(&t0, &R);
+    fe_sub(&t0, &t0, &J);
+    fe_sub(&t0, &t0, &V);
+    fe_sub(&t0, &t0, &V);
+    fe_sub(&V, &V, &t0);
+    fe_mul(&V, &R, &V);
+    fe_add(&Y1J, &Y1J, &Y1J);
+    fe_sub(&r->Y, &V, &Y1J);
+    r->X = t0;
+}
+
+/* 批量转仿射：所有 Z 共用一次求逆；无穷远点输出全 0。scratch 至少 2n 个元素 */
+static void point_batch_to_affine(p256_affine *out, const p256_point *in, size_t n, p256_fe *scratch){
+    p256_fe *z = scratch, *tmp = scratch + n;
+    for(size_t i=0;i<n;i++){
+        if(fe_is_zero(&in[i].Z)) memcpy(z[i].v, P256_ONE, sizeof(z[i].v));
+        else z[i] = in[i].Z;
+    }
+    fe_batch_inv(z, z, n, tmp);
+    for(size_t i=0;i<n;i++){
+        if(fe_is_zero(&in[i].Z)){ memset(&out[i], 0, sizeof(out[i])); continue; }
+        p256_fe zi2, zi3;
+        fe_sqr(&zi2, &z[i]);
+        fe_mul(&zi3, &zi2, &z[i]);
+        fe_mul(&out[i].x, &in[i].X, &zi2);
+        fe_mul(&out[i].y, &in[i].Y, &zi3);
+    }
+}
+
+/* ---------------- hash-to-curve（RFC 9380） ---------------- */
+
+/* expand_message_xmd(msg, DST, 96)：b0 的 64 字节零前缀是固定的一块，压缩后的中间状态由调用方给出 */
+static void expand_xmd_96(uint8_t out[96], const sha256_ctx *zpad, const uint8_t *msg, size_t len,
+                          const uint8_t *dst_prime, size_t dplen){
+    static const uint8_t lib_str[3] = { 0, 96, 0 };     // I2OSP(96, 2) || I2OSP(0, 1)
+    uint8_t b0[32], x[32];
+    sha256_ctx c = *zpad;
+    sha256_update(&c, msg, len);
+    sha256_update(&c, lib_str, 3);
+    sha256_update(&c, dst_prime, dplen);
+    sha256_final(&c, b0);
+    memcpy(x, b0, 32);                                  // b1 = H(b0 || 1 || DST')
+    for(int i=1;i<=3;i++){
+        uint8_t idx = (uint8_t)i;
+        if(i > 1)                                       // b_i = H((b0 ^ b_{i-1}) || i || DST')
+            for(int j=0;j<32;j++) x[j] = b0[j] ^ out[32*(i-2) + j];
+        sha256_init(&c);
+        sha256_update(&c, x, 32);
+        sha256_update(&c, &idx, 1);
+        sha256_update(&c, dst_prime, dplen);
+        sha256_final(&c, out + 32*(i-1));
+    }
+}
+
+/* 48 字节大端整数 mod p（Montgomery 形式）：hi·2^256 + lo */
+static void fe_from_48(p256_fe *r, const uint8_t in[48]){
+    uint8_t hi[32] = {0};
+    p256_fe h, l, rrr, rr;
+    memcpy(hi + 16, in, 16);
+    fe_from_bytes(&h, hi);
+    fe_from_bytes(&l, in + 16);
+    memcpy(rrr.v, P256_RRR, sizeof(rrr.v));
+    memcpy(rr.v, P256_RR, sizeof(rr.v));
+    fe_mul(&h, &h, &rrr);                      // h·2^256·R
+    fe_mul(&l, &l, &rr);                       // l·R（l 可以 >= p，结果仍 < p）
+    fe_add(r, &h, &l);
+}
+
+/* simplified SWU 的后半段（常量时间）：inv = 1/(Z²u⁴ + Zu²)，分母为 0 时 exceptional 为全 1 */
+static void sswu_finish(p256_affine *q, const p256_fe *u, const p256_fe *zu2, const p256_fe *inv, uint64_t exceptional){
+    p256_fe x1, x2, gx1, y1, y2, t, one;
+    memcpy(one.v, P256_ONE, sizeof(one.v));
+    fe_add(&t, &one, inv);
+    fe_mul(&x1, &FE_MBA, &t);                  // x1 = (-B/A)(1 + 1/den)
+    ct_select_fe(&x1, &FE_BZA, exceptional);   // den = 0 时 x1 = B/(Z·A)
+    fe_sqr(&t, &x1);
+    fe_add(&t, &t, &FE_A);
+    fe_mul(&gx1, &t, &x1);
+    fe_add(&gx1, &gx1, &FE_B);                 // g(x1) = x1^3 + A·x1 + B
+    // p ≡ 3 mod 4：gx1 为平方剩余时 y1^2 = gx1，否则 y1^2 = -gx1
+    fe_pow(&y1, &gx1, P256_SQRT_E);
+    fe_sqr(&t, &y1);
+    uint64_t square = -(uint64_t)fe_equal(&t, &gx1);
+    // x2 = Z·u²·x1，g(x2) = Z³u⁶·g(x1)，平方根取 u³·Z·sqrt(-Z)·y1，省去第二次开方
+    fe_mul(&x2, zu2, &x1);
+    fe_sqr(&t, u);
+    fe_mul(&t, &t, u);
+    fe_mul(&y2, &t, &FE_ZC);
+    fe_mul(&y2, &y2, &y1);
+    ct_select_fe(&x2, &x1, square);
+    ct_select_fe(&y2, &y1, square);
+    // sgn0(u) == sgn0(y)
+    p256_fe uc, yc, ny;
+    fe_from_mont(&uc, u);
+    fe_from_mont(&yc, &y2);
+    fe_sub(&ny, &FE_ZERO, &y2);
+    ct_select_fe(&y2, &ny, -((uc.v[0] ^ yc.v[0]) & 1));
+    q->x = x2;
+    q->y = y2;
+}
+
+#define H2C_BLOCK 64        // 每块 2·64 个域元素共用一次求逆
+
+void p256_hash_to_curve_batch(p256_affine *out, const uint8_t *const *msg, const size_t *len, size_t n,
+                              const uint8_t *dst, size_t dstlen){
+    uint8_t dst_prime[256];
+    if(dstlen > 255) dstlen = 255;
+    memcpy(dst_prime, dst, dstlen);
+    dst_prime[dstlen] = (uint8_t)dstlen;
+    static const uint8_t zeros[64] = {0};
+    sha256_ctx zpad;
+    sha256_init(&zpad);
+    sha256_update(&zpad, zeros, 64);
+
+    p256_fe u[2*H2C_BLOCK], zu2[2*H2C_BLOCK], den[2*H2C_BLOCK], scratch[2*H2C_BLOCK];
+    uint64_t exc[2*H2C_BLOCK];
+    p256_point sum[H2C_BLOCK];
+    p256_fe norm[2*H2C_BLOCK];
+    for(size_t base=0; base<n; base+=H2C_BLOCK){
+        size_t m = n - base < H2C_BLOCK ? n - base : H2C_BLOCK;
+        for(size_t i=0;i<m;i++){
+            uint8_t uni[96];
+            expand_xmd_96(uni, &zpad, msg[base+i], len[base+i], dst_prime, dstlen + 1);
+            fe_from_48(&u[2*i], uni);
+            fe_from_48(&u[2*i+1], uni + 48);
+        }
+        for(size_t i=0;i<2*m;i++){
+            p256_fe t;
+            fe_sqr(&t, &u[i]);
+            fe_mul(&zu2[i], &FE_Z, &t);
+            fe_sqr(&t, &zu2[i]);
+            fe_add(&den[i], &t, &zu2[i]);       // Z²u⁴ + Zu²
+            exc[i] = -(uint64_t)fe_is_zero(&den[i]);
+            memcpy(t.v, P256_ONE, sizeof(t.v));
+            ct_select_fe(&den[i], &t, exc[i]);
+        }
+        fe_batch_inv(den, den, 2*m, scratch);
+        for(size_t i=0;i<m;i++){
+            p256_affine q0, q1;
+            sswu_finish(&q0, &u[2*i], &zu2[2*i], &den[2*i], exc[2*i]);
+            sswu_finish(&q1, &u[2*i+1], &zu2[2*i+1], &den[2*i+1], exc[2*i+1]);
+            point_from_affine(&sum[i], &q0);
+            point_add_affine(&sum[i], &sum[i], &q1);
+        }
+        point_batch_to_affine(out + base, sum, m, norm);
+    }
+}
+
+/* ---------------- 固定标量批量点乘 ----------------
+   k 为偶数时改算 (n-k)·P 再取负，保证 k 为奇数；再重编码为 65 个奇数位
+   d_i ∈ {±1, ±3, ..., ±15}，k = Σ d_i·16^i，每个窗口都做一次加法（与 Project4/sm2_mul.c 相同）。
+   所有点共用同一套数字。每块 MUL_BLOCK 个点：奇数倍点表 P, 3P, ..., 15P 先在 Jacobian 下算出，
+   8·MUL_BLOCK 个点一次求逆转成仿射，主循环全部用混合加法；结果再一次求逆转仿射。 */
+
+#define MUL_BLOCK 64
+
+static void recode_regular(int8_t d[65], const p256_fe *k){
+    uint64_t w[5] = { k->v[0], k->v[1], k->v[2], k->v[3], 0 };
+    for(int i=0;i<64;i++){
+        int64_t v = (int64_t)(w[0] & 31) - 16;
+        d[i] = (int8_t)v;
+        // w = (w - v) >> 4，-v 符号扩展到高位
+        uint64_t add = (uint64_t)(-v), hi = (uint64_t)(-(int64_t)(v > 0));
+        unsigned char cy = 0;
+        cy = __builtin_add_overflow(w[0], add, &w[0]);
+        for(int j=1;j<5;j++){
+            uint64_t s = w[j] + hi;
+            unsigned char c1 = s < hi;
+            w[j] = s + cy;
+            cy = c1 | (w[j] < s);
+        }
+        for(int j=0;j<4;j++) w[j] = (w[j] >> 4) | (w[j+1] << 60);
+        w[4] >>= 4;
+    }
+    d[64] = (int8_t)w[0];
+}
+
+/* r = tab[idx]，逐项读取整张表 */
+static void ct_lookup_affine(p256_affine *r, const p256_affine *tab, int n, unsigned idx){
+    uint64_t o[8] = {0};
+    for(int i=0;i<n;i++){
+        uint64_t m = ct_eq_mask((uint64_t)i, idx);
+        const uint64_t *t = (const uint64_t*)&tab[i];
+        for(int j=0;j<8;j++) o[j] |= t[j] & m;
+    }
+    memcpy(r, o, sizeof(o));
+}
+
+void p256_mul_batch(p256_affine *out, const p256_affine *in, size_t n, const p256_fe *k){
+    // kk = k 为奇数时取 k，否则取 n - k
+    p256_fe kk = *k, kn;
+    unsigned char bw = 0;
+    for(int j=0;j<4;j++) bw = _subborrow_u64(bw, P256_N[j], k->v[j], (unsigned long long*)&kn.v[j]);
+    uint64_t even = (k->v[0] & 1) - 1;
+    ct_select_fe(&kk, &kn, even);
+    int8_t d[65];
+    recode_regular(d, &kk);
+
+    p256_point *jac = malloc(sizeof(p256_point) * 8 * MUL_BLOCK);
+    p256_affine *tab = malloc(sizeof(p256_affine) * 8 * MUL_BLOCK);
+    p256_fe *scratch = malloc(sizeof(p256_fe) * 16 * MUL_BLOCK);
+    p256_point acc[MUL_BLOCK];
+    if(!jac || !tab || !scratch){ free(jac); free(tab); free(scratch); memset(out, 0, n * sizeof(*out)); return; }
+
+    for(size_t base=0; base<n; base+=MUL_BLOCK){
+        size_t m = n - base < MUL_BLOCK ? n - base : MUL_BLOCK;
+        for(size_t i=0;i<m;i++){
+            p256_point *t = jac + 8*i, dbl;
+            point_from_affine(&t[0], &in[base+i]);
+            point_double(&dbl, &t[0]);
+            for(int j=1;j<8;j++) point_add(&t[j], &t[j-1], &dbl);
+        }
+        point_batch_to_affine(tab, jac, 8*m, scratch);
+
+        for(size_t i=0;i<m;i++){
+            p256_affine t;
+            ct_lookup_affine(&t, tab + 8*i, 8, (unsigned)(d[64] >> 1));
+            point_from_affine(&acc[i], &t);
+        }
+        for(int w=63; w>=0; w--){
+            int v = d[w];
+            uint64_t neg = -(uint64_t)(v < 0);
+            unsigned a = (unsigned)((v ^ (int)neg) - (int)neg);
+            for(size_t i=0;i<m;i++){
+                for(int j=0;j<4;j++) point_double(&acc[i], &acc[i]);
+                p256_affine t;
+                p256_fe ny;
+                ct_lookup_affine(&t, tab + 8*i, 8, a >> 1);
+                fe_sub(&ny, &FE_ZERO, &t.y);
+                ct_select_fe(&t.y, &ny, neg);
+                point_add_affine(&acc[i], &acc[i], &t);
+            }
+        }
+        for(size_t i=0;i<m;i++){
+            p256_fe ny;
+            fe_sub(&ny, &FE_ZERO, &acc[i].Y);
+            ct_select_fe(&acc[i].Y, &ny, even);
+        }
+        point_batch_to_affine(out + base, acc, m, scratch);
+    }
+    memset(d, 0, sizeof(d));
+    free(jac);
+    free(tab);
+    free(scratch);
+}
+
+/* ---------------- 编码 ---------------- */
+
+void p256_compress(uint8_t out[P256_COMPRESSED], const p256_affine *a){
+    p256_fe x, y;
+    fe_from_mont(&x, &a->x);
+    fe_from_mont(&y, &a->y);
+    out[0] = (uint8_t)(2 | (y.v[0] & 1));
+    fe_to_bytes(out + 1, &x);
+}
+
+int p256_decompress(p256_affine *r, const uint8_t in[P256_COMPRESSED]){
+    p256_fe x, rhs, t;
+    if(in[0] != 2 && in[0] != 3) return -1;
+    fe_from_bytes(&x, in + 1);
+    if(!lt_256(x.v, P256_P)) return -1;
+    fe_to_mont(&r->x, &x);
+    fe_sqr(&t, &r->x);
+    fe_add(&t, &t, &FE_A);
+    fe_mul(&rhs, &t, &r->x);
+    fe_add(&rhs, &rhs, &FE_B);
+    fe_pow(&r->y, &rhs, P256_SQRT_E);
+    fe_sqr(&t, &r->y);
+    if(!fe_equal(&t, &rhs)) return -1;
+    fe_from_mont(&t, &r->y);
+    if((t.v[0] & 1) != (uint64_t)(in[0] & 1)) fe_sub(&r->y, &FE_ZERO, &r->y);
+    return 0;
+}
+
+void p256_affine_to_bytes(uint8_t out[64], const p256_affine *a){
+    p256_fe t;
+    fe_from_mont(&t, &a->x);
+    fe_to_bytes(out, &t);
+    fe_from_mont(&t, &a->y);
+    fe_to_bytes(out + 32, &t);
+}
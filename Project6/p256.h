@@ -0,0 +1,40 @@
+// p256.h
+#ifndef P256_H
+#define P256_H
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  P-256 (secp256r1 / prime256v1) 上 DDH 交集求和需要的运算（原生实现）：
+    - hash-to-curve：RFC 9380 P256_XMD:SHA-256_SSWU_RO_（expand_message_xmd + simplified SWU）
+    - 固定标量的批量点乘 k·P_i：标量只重编码一次；每块点的奇数倍点表与结果各做一次联合求逆转仿射
+    - 33 字节压缩点编码
+  字段元素在 Montgomery 域（R = 2^256）中表示，4×64 位小端 limb；与 p256_ref.py 逐字节对照。
+*/
+
+#define P256_COMPRESSED 33
+#define P256_PISUM_DST  "PISUM-V01-CS01-with-P256_XMD:SHA-256_SSWU_RO_"
+
+typedef struct { uint64_t v[4]; } p256_fe;
+typedef struct { p256_fe x, y; } p256_affine;   // 仿射坐标 (Montgomery 形式)
+
+/* 随机标量 k ∈ [1, n-1]（getrandom），普通整数形式。失败返回 -1 */
+int  p256_scalar_random(p256_fe *k);
+/* 32 字节大端 <-> 标量；from_bytes 在 k = 0 或 k >= n 时返回 -1 */
+int  p256_scalar_from_bytes(p256_fe *k, const uint8_t in[32]);
+void p256_scalar_to_bytes(uint8_t out[32], const p256_fe *k);
+
+/* out[i] = hash_to_curve(msg[i])；dst 不超过 255 字节 */
+void p256_hash_to_curve_batch(p256_affine *out, const uint8_t *const *msg, const size_t *len, size_t n,
+                              const uint8_t *dst, size_t dstlen);
+
+/* out[i] = k·in[i]，k ∈ [1, n-1]；对秘密 k 常量时间（正则奇数重编码 + 全表扫描查表）。out 可与 in 相同 */
+void p256_mul_batch(p256_affine *out, const p256_affine *in, size_t n, const p256_fe *k);
+
+void p256_compress(uint8_t out[P256_COMPRESSED], const p256_affine *a);
+/* 首字节不是 02/03、x >= p 或不在曲线上时返回 -1 */
+int  p256_decompress(p256_affine *r, const uint8_t in[P256_COMPRESSED]);
+/* x||y 各 32 字节大端 */
+void p256_affine_to_bytes(uint8_t out[64], const p256_affine *a);
+
+#endif
@@ -0,0 +1,88 @@
+# p256_ref.py
+# P-256 参考实现（纯 Python，只依赖 hashlib），用于和原生引擎 pisum 对照：
+#   hash_to_curve  RFC 9380 P256_XMD:SHA-256_SSWU_RO_
+#   mul            k·P，结果为 33 字节压缩点
+import hashlib
+
+P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+N = 0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551
+A = P - 3
+B = 0x5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b
+Z = P - 10
+DST = b"PISUM-V01-CS01-with-P256_XMD:SHA-256_SSWU_RO_"   # 与 p256.h 中 P256_PISUM_DST 相同
+
+def expand_message_xmd(msg, dst, n):
+    ell = (n + 31) // 32
+    dst_prime = dst + bytes([len(dst)])
+    b0 = hashlib.sha256(bytes(64) + msg + n.to_bytes(2, 'big') + b"\0" + dst_prime).digest()
+    b = [hashlib.sha256(b0 + b"\1" + dst_prime).digest()]
+    for i in range(2, ell + 1):
+        x = bytes(u ^ v for u, v in zip(b0, b[-1]))
+        b.append(hashlib.sha256(x + bytes([i]) + dst_prime).digest())
+    return b"".join(b)[:n]
+
+def hash_to_field(msg, dst, count=2):
+    u = expand_message_xmd(msg, dst, 48 * count)
+    return [int.from_bytes(u[48*i:48*(i+1)], 'big') % P for i in range(count)]
+
+def is_square(x):
+    return x == 0 or pow(x, (P - 1) // 2, P) == 1
+
+def map_to_curve_sswu(u):
+    tv1 = (Z * Z * pow(u, 4, P) + Z * u * u) % P
+    if tv1 == 0:
+        x1 = B * pow(Z * A, -1, P) % P
+    else:
+        x1 = (-B * pow(A, -1, P)) * (1 + pow(tv1, -1, P)) % P
+    gx1 = (x1 ** 3 + A * x1 + B) % P
+    x2 = Z * u * u * x1 % P
+    gx2 = (x2 ** 3 + A * x2 + B) % P
+    x, gx = (x1, gx1) if is_square(gx1) else (x2, gx2)
+    y = pow(gx, (P + 1) // 4, P)
+    if (u & 1) != (y & 1):
+        y = P - y
+    return x, y
+
+def add(p1, p2):
+    if p1 is None: return p2
+    if p2 is None: return p1
+    (x1, y1), (x2, y2) = p1, p2
+    if x1 == x2:
+        if (y1 + y2) % P == 0: return None
+        l = (3 * x1 * x1 + A) * pow(2 * y1, -1, P) % P
+    else:
+        l = (y2 - y1) * pow(x2 - x1, -1, P) % P
+    x3 = (l * l - x1 - x2) % P
+    return x3, (l * (x1 - x3) - y1) % P
+
+def mul(k, pt):
+    r = None
+    for bit in bin(k)[2:]:
+        r = add(r, r)
+        if bit == '1': r = add(r, pt)
+    return r
+
+def hash_to_curve(msg, dst=DST):
+    u0, u1 = hash_to_field(msg, dst)
+    return add(map_to_curve_sswu(u0), map_to_curve_sswu(u1))
+
+def compress(pt):
+    x, y = pt
+    return bytes([2 | (y & 1)]) + x.to_bytes(32, 'big')
+
+def decompress(b):
+    x = int.from_bytes(b[1:], 'big')
+    y = pow((x ** 3 + A * x + B) % P, (P + 1) // 4, P)
+    if (y & 1) != (b[0] & 1):
+        y = P - y
+    return x, y
+
+if __name__ == '__main__':
+    import sys
+    # python p256_ref.py h2c <msg> [dst]   |   python p256_ref.py mul <k hex> <压缩点 hex>
+    if sys.argv[1] == 'h2c':
+        dst = sys.argv[3].encode() if len(sys.argv) > 3 else DST
+        x, y = hash_to_curve(sys.argv[2].encode(), dst)
+        print("%064x %064x" % (x, y))
+    elif sys.argv[1] == 'mul':
+        print(compress(mul(int(sys.argv[2], 16), decompress(bytes.fromhex(sys.argv[3])))).hex())
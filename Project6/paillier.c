@@ -0,0 +1,360 @@
+// paillier.c
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/random.h>
+#include "paillier.h"
+
+static int random_bytes(uint8_t *buf, size_t len){
+    while(len){
+        ssize_t r = getrandom(buf, len, 0);
+        if(r <= 0) return -1;
+        buf += r; len -= (size_t)r;
+    }
+    return 0;
+}
+
+/* r 均匀取自 Z_m^*（与 m 不互素的概率可忽略，仍然检查） */
+static void random_unit(const mpz_t m, mpz_t r){
+    size_t len = (mpz_sizeinbase(m, 2) + 7) / 8 + 16;  // 多取 128 位，取模后的偏差可忽略
+    uint8_t *buf = malloc(len);
+    mpz_t g;
+    mpz_init(g);
+    do {
+        if(!buf || random_bytes(buf, len) != 0) abort();
+        mpz_import(r, len, 1, 1, 1, 0, buf);
+        mpz_mod(r, r, m);
+        mpz_gcd(g, r, m);
+    } while(mpz_cmp_ui(g, 1) != 0);
+    memset(buf, 0, len);
+    free(buf);
+    mpz_clear(g);
+}
+
+static void random_prime(mpz_t p, unsigned bits){
+    size_t len = (bits + 7) / 8;
+    uint8_t *buf = malloc(len);
+    if(!buf || random_bytes(buf, len) != 0) abort();
+    buf[0] |= 0xC0;                     // 最高两位置 1，保证 p·q 恰好 2·bits 位
+    mpz_import(p, len, 1, 1, 1, 0, buf);
+    mpz_nextprime(p, p);
+    memset(buf, 0, len);
+    free(buf);
+}
+
+static void pk_setup(paillier_pk *pk){
+    mpz_mul(pk->n2, pk->n, pk->n);
+    pk->nbytes = (mpz_sizeinbase(pk->n, 2) + 7) / 8;
+}
+
+/* h = L((n+1)^{p-1} mod p²)^{-1} mod p，L(x) = (x-1)/p */
+static void crt_h(mpz_t h, const mpz_t n, const mpz_t p, const mpz_t p2){
+    mpz_t t;
+    mpz_init(t);
+    mpz_add_ui(t, n, 1);
+    mpz_sub_ui(h, p, 1);
+    mpz_powm(t, t, h, p2);
+    mpz_sub_ui(t, t, 1);
+    mpz_divexact(t, t, p);
+    mpz_invert(h, t, p);
+    mpz_clear(t);
+}
+
+int paillier_keygen(paillier_sk *sk, unsigned bits){
+    if(bits < 512 || bits % 16) return -1;
+    mpz_t p1, q1, g;
+    mpz_inits(p1, q1, g, NULL);
+    mpz_inits(sk->pk.n, sk->pk.n2, sk->p, sk->q, sk->p2, sk->q2, sk->hp, sk->hq, sk->qinv, sk->q2inv, NULL);
+    do {
+        random_prime(sk->p, bits / 2);
+        do random_prime(sk->q, bits / 2); while(mpz_cmp(sk->p, sk->q) == 0);
+        mpz_mul(sk->pk.n, sk->p, sk->q);
+        mpz_sub_ui(p1, sk->p, 1);
+        mpz_sub_ui(q1, sk->q, 1);
+        mpz_mul(g, p1, q1);
+        mpz_gcd(g, g, sk->pk.n);        // gcd(n, φ(n)) = 1
+    } while(mpz_cmp_ui(g, 1) != 0 || mpz_sizeinbase(sk->pk.n, 2) != bits);
+    pk_setup(&sk->pk);
+    mpz_mul(sk->p2, sk->p, sk->p);
+    mpz_mul(sk->q2, sk->q, sk->q);
+    crt_h(sk->hp, sk->pk.n, sk->p, sk->p2);
+    crt_h(sk->hq, sk->pk.n, sk->q, sk->q2);
+    mpz_invert(sk->qinv, sk->q, sk->p);
+    mpz_invert(sk->q2inv, sk->q2, sk->p2);
+    mpz_clears(p1, q1, g, NULL);
+    return 0;
+}
+
+void paillier_sk_clear(paillier_sk *sk){
+    mpz_clears(sk->p, sk->q, sk->p2, sk->q2, sk->hp, sk->hq, sk->qinv, sk->q2inv, NULL);
+    paillier_pk_clear(&sk->pk);
+}
+
+int paillier_pk_import(paillier_pk *pk, const uint8_t *in, size_t len){
+    mpz_inits(pk->n, pk->n2, NULL);
+    mpz_import(pk->n, len, 1, 1, 1, 0, in);
+    if(mpz_sizeinbase(pk->n, 2) < 512 || mpz_even_p(pk->n)){ paillier_pk_clear(pk); return -1; }
+    pk_setup(pk);
+    return 0;
+}
+
+void paillier_pk_export(const paillier_pk *pk, uint8_t *out){
+    size_t cnt;
+    memset(out, 0, pk->nbytes);
+    mpz_export(out + pk->nbytes - (mpz_sizeinbase(pk->n, 2) + 7) / 8, &cnt, 1, 1, 1, 0, pk->n);
+}
+
+void paillier_pk_clear(paillier_pk *pk){
+    mpz_clears(pk->n, pk->n2, NULL);
+}
+
+/*
+  r^n mod p² 只取决于 r mod p，且 (r mod p)^n 与 s^p（s 均匀取自 Z_p^*）同分布：
+  二者都是 Z_{p²}^* 中 p-1 阶子群上的均匀元素。于是两半各做一次 1024 位指数、2048 位模数的幂，
+  再按 CRT 合成；p、q 是私钥，用 powm_sec。
+*/
+void paillier_randomizer(const paillier_pk *pk, const paillier_sk *sk, mpz_t rn){
+    mpz_t r, a;
+    mpz_inits(r, a, NULL);
+    if(sk){
+        random_unit(sk->p, a);
+        mpz_powm_sec(a, a, sk->p, sk->p2);
+        random_unit(sk->q, r);
+        mpz_powm_sec(r, r, sk->q, sk->q2);
+        mpz_sub(a, a, r);               // rn = b + q²·((a - b)·(q²)^{-1} mod p²)
+        mpz_mul(a, a, sk->q2inv);
+        mpz_mod(a, a, sk->p2);
+        mpz_mul(a, a, sk->q2);
+        mpz_add(rn, a, r);
+    } else {
+        random_unit(pk->n, r);
+        mpz_powm(rn, r, pk->n, pk->n2);
+    }
+    mpz_clears(r, a, NULL);
+}
+
+void paillier_encrypt_with(const paillier_pk *pk, mpz_t c, const mpz_t m, const mpz_t rn){
+    mpz_t t;
+    mpz_init(t);
+    mpz_mod(t, m, pk->n);
+    mpz_mul(t, t, pk->n);
+    mpz_add_ui(t, t, 1);                // g^m = (n+1)^m = 1 + m·n mod n²
+    mpz_mul(c, t, rn);
+    mpz_mod(c, c, pk->n2);
+    mpz_clear(t);
+}
+
+void paillier_encrypt(const paillier_pk *pk, mpz_t c, const mpz_t m){
+    mpz_t rn;
+    mpz_init(rn);
+    paillier_randomizer(pk, NULL, rn);
+    paillier_encrypt_with(pk, c, m, rn);
+    mpz_clear(rn);
+}
+
+void paillier_encrypt_u64(const paillier_pk *pk, mpz_t c, uint64_t m){
+    mpz_t t;
+    mpz_init_set_ui(t, m);
+    paillier_encrypt(pk, c, t);
+    mpz_clear(t);
+}
+
+/* m_p = L_p(c^{p-1} mod p²)·h_p mod p */
+static void decrypt_half(mpz_t mp, const mpz_t c, const mpz_t p, const mpz_t p2, const mpz_t h){
+    mpz_t e;
+    mpz_init(e);
+    mpz_sub_ui(e, p, 1);
+    mpz_mod(mp, c, p2);
+    mpz_powm_sec(mp, mp, e, p2);
+    mpz_sub_ui(mp, mp, 1);
+    mpz_divexact(mp, mp, p);
+    mpz_mul(mp, mp, h);
+    mpz_mod(mp, mp, p);
+    mpz_clear(e);
+}
+
+void paillier_decrypt(const paillier_sk *sk, mpz_t m, const mpz_t c){
+    mpz_t mp, mq;
+    mpz_inits(mp, mq, NULL);
+    decrypt_half(mp, c, sk->p, sk->p2, sk->hp);
+    decrypt_half(mq, c, sk->q, sk->q2, sk->hq);
+    mpz_sub(mp, mp, mq);                // m = m_q + q·((m_p - m_q)·q^{-1} mod p)
+    mpz_mul(mp, mp, sk->qinv);
+    mpz_mod(mp, mp, sk->p);
+    mpz_mul(mp, mp, sk->q);
+    mpz_add(m, mq, mp);
+    mpz_clears(mp, mq, NULL);
+}
+
+void paillier_add(const paillier_pk *pk, mpz_t c, const mpz_t a, const mpz_t b){
+    mpz_mul(c, a, b);
+    mpz_mod(c, c, pk->n2);
+}
+
+void paillier_rerandomize(const paillier_pk *pk, mpz_t c){
+    mpz_t rn;
+    mpz_init(rn);
+    paillier_randomizer(pk, NULL, rn);
+    mpz_mul(c, c, rn);
+    mpz_mod(c, c, pk->n2);
+    mpz_clear(rn);
+}
+
+void paillier_ct_export(const paillier_pk *pk, uint8_t *out, const mpz_t c){
+    size_t len = paillier_ct_bytes(pk), cnt, used = (mpz_sizeinbase(c, 2) + 7) / 8;
+    memset(out, 0, len);
+    if(mpz_sgn(c)) mpz_export(out + len - used, &cnt, 1, 1, 1, 0, c);
+}
+
+int paillier_ct_import(const paillier_pk *pk, mpz_t c, const uint8_t *in){
+    mpz_import(c, paillier_ct_bytes(pk), 1, 1, 1, 0, in);
+    return mpz_cmp(c, pk->n2) < 0 ? 0 : -1;
+}
+
+/* ---------------- 槽位打包 ---------------- */
+
+void paillier_pack(mpz_t m, const uint64_t *v, unsigned slots, unsigned slot_bits){
+    mpz_set_ui(m, 0);
+    for(unsigned i=slots; i-- > 0; ){
+        mpz_mul_2exp(m, m, slot_bits);
+        mpz_add_ui(m, m, v[i]);         // unsigned long 为 64 位
+    }
+}
+
+void paillier_unpack(uint64_t *v, const mpz_t m, unsigned slots, unsigned slot_bits){
+    mpz_t t, s;
+    mpz_init_set(t, m);
+    mpz_init(s);
+    for(unsigned i=0;i<slots;i++){
+        mpz_tdiv_r_2exp(s, t, slot_bits);
+        v[i] = mpz_get_ui(s);
+        mpz_tdiv_q_2exp(t, t, slot_bits);
+    }
+    mpz_clears(t, s, NULL);
+}
+
+/* ---------------- 随机化因子池 ---------------- */
+
+struct paillier_pool {
+    const paillier_pk *pk;
+    const paillier_sk *sk;
+    mpz_t *slot;                // slot[0 .. count) 可用
+    size_t cap, count;
+    int stop, nthreads;
+    pthread_mutex_t lock;
+    pthread_cond_t not_full;
+    pthread_t *th;
+};
+
+static void *pool_worker(void *arg){
+    paillier_pool *pool = arg;
+    mpz_t rn;
+    mpz_init(rn);
+    for(;;){
+        pthread_mutex_lock(&pool->lock);
+        while(pool->count == pool->cap && !pool->stop) pthread_cond_wait(&pool->not_full, &pool->lock);
+        int stop = pool->stop;
+        pthread_mutex_unlock(&pool->lock);
+        if(stop) break;
+        paillier_randomizer(pool->pk, pool->sk, rn);
+        pthread_mutex_lock(&pool->lock);
+        if(pool->count < pool->cap) mpz_swap(pool->slot[pool->count++], rn);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    mpz_clear(rn);
+    return NULL;
+}
+
+paillier_pool *paillier_pool_new(const paillier_pk *pk, const paillier_sk *sk, size_t capacity, int nthreads){
+    paillier_pool *pool = calloc(1, sizeof(*pool));
+    if(!pool) return NULL;
+    if(capacity == 0) capacity = 1;
+    if(nthreads < 1) nthreads = 1;
+    pool->pk = pk;
+    pool->sk = sk;
+    pool->cap = capacity;
+    pool->slot = malloc(capacity * sizeof(mpz_t));
+    pool->th = malloc((size_t)nthreads * sizeof(pthread_t));
+    if(!pool->slot || !pool->th){ free(pool->slot); free(pool->th); free(pool); return NULL; }
+    for(size_t i=0;i<capacity;i++) mpz_init2(pool->slot[i], 2 * pk->nbytes * 8);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->not_full, NULL);
+    for(int i=0;i<nthreads;i++)
+        if(pthread_create(&pool->th[pool->nthreads], NULL, pool_worker, pool) == 0) pool->nthreads++;
+    return pool;
+}
+
+int paillier_pool_take(paillier_pool *pool, mpz_t rn){
+    pthread_mutex_lock(&pool->lock);
+    if(pool->count){
+        mpz_swap(rn, pool->slot[--pool->count]);
+        pthread_cond_signal(&pool->not_full);
+        pthread_mutex_unlock(&pool->lock);
+        return 1;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    paillier_randomizer(pool->pk, pool->sk, rn);
+    return 0;
+}
+
+void paillier_pool_free(paillier_pool *pool){
+    if(!pool) return;
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->not_full);
+    pthread_mutex_unlock(&pool->lock);
+    for(int i=0;i<pool->nthreads;i++) pthread_join(pool->th[i], NULL);
+    for(size_t i=0;i<pool->cap;i++) mpz_clear(pool->slot[i]);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->not_full);
+    free(pool->slot);
+    free(pool->th);
+    free(pool);
+}
+
+/* ---------------- 批量加密 ---------------- */
+
+#define ENC_GRAIN 16
+
+typedef struct {
+    const paillier_pk *pk;
+    const paillier_sk *sk;
+    paillier_pool *pool;
+    uint8_t *out;
+    size_t stride, n, next;
+    const uint64_t *v;
+    unsigned slots, slot_bits;
+} enc_job;
+
+static void *enc_worker(void *arg){
+    enc_job *j = arg;
+    mpz_t m, rn, c;
+    mpz_inits(m, rn, c, NULL);
+    for(;;){
+        size_t lo = __atomic_fetch_add(&j->next, ENC_GRAIN, __ATOMIC_RELAXED);
+        if(lo >= j->n) break;
+        size_t hi = lo + ENC_GRAIN < j->n ? lo + ENC_GRAIN : j->n;
+        for(size_t i=lo;i<hi;i++){
+            paillier_pack(m, j->v + i * j->slots, j->slots, j->slot_bits);
+            if(j->pool) paillier_pool_take(j->pool, rn);
+            else paillier_randomizer(j->pk, j->sk, rn);
+            paillier_encrypt_with(j->pk, c, m, rn);
+            paillier_ct_export(j->pk, j->out + i * j->stride, c);
+        }
+    }
+    mpz_clears(m, rn, c, NULL);
+    return NULL;
+}
+
+void paillier_encrypt_batch(const paillier_pk *pk, const paillier_sk *sk, paillier_pool *pool,
+                            uint8_t *out, size_t stride, const uint64_t *v, size_t n,
+                            unsigned slots, unsigned slot_bits, int nthreads){
+    enc_job j = { pk, sk, pool, out, stride, n, 0, v, slots, slot_bits };
+    pthread_t th[256];
+    int started = 0;
+    if(nthreads > 256) nthreads = 256;
+    for(int i=1;i<nthreads && (size_t)i*ENC_GRAIN < n;i++)
+        if(pthread_create(&th[started], NULL, enc_worker, &j) == 0) started++;
+    enc_worker(&j);
+    for(int i=0;i<started;i++) pthread_join(th[i], NULL);
+}
@@ -0,0 +1,836 @@
+// pisum.c
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/random.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "p256.h"
+#include "paillier.h"
+#include "psi_net.h"
+#include "psi_set.h"
+#include "psi_spill.h"
+
+/*
+  DDH 交集求和协议（Figure 2，与 ddh_pisum_demo.py 相同的三轮流程）的原生引擎：
+    Round 1  P1 → P2   {H(v_i)^k1}（打乱）
+    Round 2  P2 → P1   Z = {H(v_i)^k1k2}（打乱），{(H(w_j)^k2, Enc(t_j))}（打乱）
+    Round 3  P1 → P2   Σ_{H(w_j)^k1k2 ∈ Z} Enc(t_j)（重随机化），P2 解密
+  H 为 P-256 上的 RFC 9380 hash-to-curve，点以 33 字节压缩形式传输；
+  集合按帧流式发送，每帧在多个线程上批量计算（同一标量的批量点乘 + 联合求逆）。
+  P2 的每行可带多列值，按槽位打包进同一个 Paillier 明文，一次协议得到各列的交集和；
+  加密用私钥走 CRT，随机化因子 r^n 由后台线程在第一轮期间预先填入池中。
+
+  内存有界（-m）：输入文件逐行读入，先写进随机桶再逐桶洗牌发送（外部洗牌）；P2 的 Z 同样经随机桶打乱；
+  P1 按点的带密钥哈希把 Z 与 (点, 密文) 分到同样的分区落盘，再逐分区建集合、连接（分区哈希连接）。
+  每个桶 / 分区约为预算的一半；集合放得进预算时全部留在内存，与不加 -m 相同。
+
+  用法:
+    ./pisum gen   <n1> <n2> <overlap> <p1_ids.txt> <p2_pairs.txt> [列数=1]
+    ./pisum [-m MB] [-d 临时目录] p2    <监听地址> <p2_pairs.txt> [线程数] [密钥位数=2048] [列数=1]
+    ./pisum [-m MB] [-d 临时目录] p1    <连接地址> <p1_ids.txt> [线程数]
+    ./pisum [-m MB] [-d 临时目录] local <n1> <n2> <overlap> [线程数] [密钥位数=2048] [列数=1]
+                                              两个进程经 socketpair 跑完整协议并与明文对照
+    ./pisum kat h2c <msg> [dst]  |  ./pisum kat mul <k hex> <压缩点 hex>
+  地址为 host:port 或 unix:/path；p1_ids.txt 每行一个标识符，p2_pairs.txt 每行 "标识符,值1[,值2...]"。
+*/
+
+enum { TAG_PK = 1, TAG_R1, TAG_Z, TAG_PAIRS, TAG_SUM, TAG_N1 };
+
+#define FRAME_ITEMS 16384           // 每帧条目数
+#define SMALL_FRAME 4096            // 公钥等小消息的接收上限（公钥最多 32768 位）
+#define GRAIN       256             // 线程每次领取的条目数
+#define POOL_MAX    65536           // r^n 池容量上限（2048 位密钥约 32 MB）
+#define SPILL_MAX   1024            // 每个暂存的桶数上限（每桶一个文件描述符）
+
+static double now_sec(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double peak_rss_mb(void){
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss / 1024.0;
+}
+
+/* 运行参数 */
+typedef struct {
+    int nthreads;
+    uint64_t mem;               // 内存预算（字节），0 表示不限
+    const char *tmpdir;
+} run_cfg;
+
+/* k 个桶的暂存：只有一个桶时留在内存，否则落盘，各桶的写缓冲合计约为预算的 1/16 */
+static int spill_open_parts(psi_spill *s, const run_cfg *cfg, unsigned k){
+    size_t bufsize = cfg->mem / 16 / k;
+    if(bufsize < 4096) bufsize = 4096;
+    if(bufsize > (1u << 20)) bufsize = 1u << 20;
+    if(psi_spill_open(s, k, k > 1 ? cfg->tmpdir : NULL, bufsize) == 0) return 0;
+    fprintf(stderr, "cannot create %u spill files in %s\n", k, cfg->tmpdir);
+    return -1;
+}
+
+/* 按预算选桶数：每桶（读回后的内存占用约 bytes / k）不超过预算的一半 */
+static int spill_open(psi_spill *s, const run_cfg *cfg, uint64_t bytes){
+    return spill_open_parts(s, cfg, psi_spill_parts(bytes, cfg->mem / 2, SPILL_MAX));
+}
+
+/* ---------------- 并行与随机置换 ---------------- */
+
+typedef void (*range_fn)(void *ctx, size_t lo, size_t hi);
+
+typedef struct {
+    size_t n, next;
+    range_fn fn;
+    void *ctx;
+} pfor_t;
+
+static void *pfor_worker(void *arg){
+    pfor_t *p = arg;
+    for(;;){
+        size_t lo = __atomic_fetch_add(&p->next, GRAIN, __ATOMIC_RELAXED);
+        if(lo >= p->n) break;
+        p->fn(p->ctx, lo, lo + GRAIN < p->n ? lo + GRAIN : p->n);
+    }
+    return NULL;
+}
+
+static void parallel_for(size_t n, int nthreads, range_fn fn, void *ctx){
+    pfor_t p = { n, 0, fn, ctx };
+    pthread_t th[256];
+    int started = 0;
+    if(nthreads > 256) nthreads = 256;
+    for(int i=1;i<nthreads && (size_t)i*GRAIN < n;i++)
+        if(pthread_create(&th[started], NULL, pfor_worker, &p) == 0) started++;
+    pfor_worker(&p);
+    for(int i=0;i<started;i++) pthread_join(th[i], NULL);
+}
+
+/* getrandom 缓冲，拒绝采样得到 [0, bound) 上的均匀数 */
+typedef struct { uint64_t buf[512]; int pos; } rng_t;
+
+static uint64_t rng_below(rng_t *r, uint64_t bound){
+    uint64_t lim = -bound % bound;                  // 2^64 mod bound
+    for(;;){
+        if(r->pos == 0){
+            if(getrandom(r->buf, sizeof(r->buf), 0) != (ssize_t)sizeof(r->buf)) abort();
+            r->pos = 512;
+        }
+        uint64_t x = r->buf[--r->pos];
+        if(x >= lim) return x % bound;
+    }
+}
+
+/* 随机置换 π（Fisher-Yates） */
+static size_t *random_perm(size_t n){
+    size_t *p = malloc((n ? n : 1) * sizeof(size_t));
+    rng_t r = { .pos = 0 };
+    if(!p) return NULL;
+    for(size_t i=0;i<n;i++) p[i] = i;
+    for(size_t i=n; i>1; i--){
+        size_t j = (size_t)rng_below(&r, i);
+        size_t t = p[i-1]; p[i-1] = p[j]; p[j] = t;
+    }
+    return p;
+}
+
+/* 压缩点数组原地洗牌 */
+static void shuffle_points(uint8_t *a, size_t n){
+    rng_t r = { .pos = 0 };
+    uint8_t t[P256_COMPRESSED];
+    for(size_t i=n; i>1; i--){
+        size_t j = (size_t)rng_below(&r, i);
+        memcpy(t, a + (i-1) * P256_COMPRESSED, P256_COMPRESSED);
+        memcpy(a + (i-1) * P256_COMPRESSED, a + j * P256_COMPRESSED, P256_COMPRESSED);
+        memcpy(a + j * P256_COMPRESSED, t, P256_COMPRESSED);
+    }
+}
+
+/* ---------------- 数据集 ---------------- */
+
+/*
+  输入先逐条写进随机桶（记录 = u32 标识符长度 | 标识符 | cols × u64 值），再逐桶读回、桶内洗牌后计算发送。
+  每条记录独立均匀地选桶、桶内均匀洗牌，拼接起来就是整个集合上的均匀随机置换。
+*/
+
+/* 一方的输入：文件，或合成数据（user(first_other + i)，前 overlap 个为 user0..user(overlap-1)） */
+typedef struct {
+    const char *path;           // NULL 时为合成数据
+    size_t n, first_other, overlap;
+    unsigned cols;              // 每条的值列数，P1 为 0
+} source;
+
+static int synth_id(char *buf, size_t cap, size_t u){
+    return snprintf(buf, cap, "user%zu@example.com", u);
+}
+
+static uint64_t synth_val(size_t u, unsigned c){
+    return (uint64_t)((u * 2654435761u + c * 40503u) % 1000) + 1;
+}
+
+/* 一个桶解析后的视图 */
+typedef struct {
+    uint8_t *data;              // 桶内容
+    const uint8_t **id;
+    size_t *len;
+    uint64_t *val;              // n × cols
+    size_t n;
+    unsigned cols;
+} dataset;
+
+static void dataset_free(dataset *d){
+    free(d->data); free(d->id); free(d->len); free(d->val);
+    memset(d, 0, sizeof(*d));
+}
+
+static int dataset_parse(dataset *d, uint8_t *data, size_t size, unsigned cols){
+    memset(d, 0, sizeof(*d));
+    d->data = data;
+    d->cols = cols;
+    size_t n = 0;
+    for(size_t off=0; off + 4 <= size; n++){
+        uint32_t l;
+        memcpy(&l, data + off, 4);
+        off += 4 + l + 8 * (size_t)cols;
+    }
+    d->id = malloc((n ? n : 1) * sizeof(*d->id));
+    d->len = malloc((n ? n : 1) * sizeof(*d->len));
+    d->val = cols ? malloc(n * cols * sizeof(*d->val)) : NULL;
+    if(!d->id || !d->len || (cols && n && !d->val)){ dataset_free(d); return -1; }
+    for(size_t off=0; d->n < n; d->n++){
+        uint32_t l;
+        memcpy(&l, data + off, 4);
+        d->id[d->n] = data + off + 4;
+        d->len[d->n] = l;
+        if(cols) memcpy(d->val + d->n * cols, data + off + 4 + l, 8 * (size_t)cols);
+        off += 4 + l + 8 * (size_t)cols;
+    }
+    return 0;
+}
+
+static int put_record(psi_spill *s, rng_t *r, const char *id, size_t len, const uint64_t *val, unsigned cols){
+    unsigned part = (unsigned)rng_below(r, s->nparts);
+    uint32_t l = (uint32_t)len;
+    if(psi_spill_put(s, part, &l, 4) != 0 || psi_spill_put(s, part, id, len) != 0) return -1;
+    return cols ? psi_spill_put(s, part, val, 8 * (size_t)cols) : 0;
+}
+
+/* 把输入逐条写进随机桶；n 返回条数，totals（可为 NULL）返回各列全体值之和，溢出 64 位时置 *overflow */
+static int scatter_source(psi_spill *s, const source *src, const run_cfg *cfg,
+                          size_t *n, uint64_t *totals, int *overflow){
+    rng_t r = { .pos = 0 };
+    uint64_t val[64];
+    unsigned cols = src->cols;
+    *n = 0;
+    if(cols > 64) return -1;
+    if(totals) memset(totals, 0, cols * sizeof(uint64_t));
+    if(overflow) *overflow = 0;
+    if(!src->path){
+        // 每条约 记录 + 解析数组 + 置换
+        if(spill_open(s, cfg, src->n * (64 + 16 * (uint64_t)cols)) != 0) return -1;
+        char id[40];                    // "user" + 20 位十进制 + "@example.com"
+        for(size_t i=0;i<src->n;i++){
+            size_t u = i < src->overlap ? i : src->first_other + (i - src->overlap);
+            for(unsigned c=0;c<cols;c++){
+                val[c] = synth_val(u, c);
+                if(totals && __builtin_add_overflow(totals[c], val[c], &totals[c])) *overflow = 1;
+            }
+            if(put_record(s, &r, id, (size_t)synth_id(id, sizeof(id), u), val, cols) != 0) return -1;
+            (*n)++;
+        }
+        return 0;
+    }
+    FILE *f = fopen(src->path, "rb");
+    struct stat st;
+    if(!f) return -1;
+    // 解析后每条多出约 32 字节数组开销，按文件大小的 3 倍估计
+    if(fstat(fileno(f), &st) != 0 || spill_open(s, cfg, 3 * (uint64_t)st.st_size) != 0){ fclose(f); return -1; }
+    char *line = NULL;
+    size_t cap = 0;
+    ssize_t got;
+    int rc = 0;
+    while(rc == 0 && (got = getline(&line, &cap, f)) >= 0){
+        char *p = line, *e = line + got;
+        if(e > p && e[-1] == '\n') e--;
+        if(e > p && e[-1] == '\r') e--;
+        if(e == p) continue;
+        for(unsigned c=cols; c-- > 0; ){
+            char *comma = e - 1;
+            while(comma > p && *comma != ',') comma--;
+            if(*comma != ','){ rc = -1; break; }
+            *e = 0;
+            val[c] = strtoull(comma + 1, NULL, 10);
+            if(totals && __builtin_add_overflow(totals[c], val[c], &totals[c])) *overflow = 1;
+            e = comma;
+        }
+        if(rc == 0 && (e - p > UINT32_MAX || put_record(s, &r, p, (size_t)(e - p), val, cols) != 0)) rc = -1;
+        if(rc == 0) (*n)++;
+    }
+    free(line);
+    fclose(f);
+    return rc;
+}
+
+/* ---------------- 批量 EC 运算 ---------------- */
+
+/* out[i] = compress(k·H(id[perm[i]]))，i ∈ [lo, hi) 相对于帧起点 */
+typedef struct {
+    const dataset *d;
+    const size_t *perm;
+    size_t base;
+    const p256_fe *k;
+    uint8_t *out;               // 每条 rec 字节，前 33 字节为点
+    size_t rec;
+} hash_job;
+
+static void hash_range(void *ctx, size_t lo, size_t hi){
+    hash_job *j = ctx;
+    const uint8_t *msg[GRAIN] = {0};
+    size_t len[GRAIN] = {0};
+    p256_affine pt[GRAIN];
+    size_t m = hi - lo;
+    for(size_t i=0;i<m;i++){
+        size_t idx = j->perm[j->base + lo + i];
+        msg[i] = j->d->id[idx];
+        len[i] = j->d->len[idx];
+    }
+    p256_hash_to_curve_batch(pt, msg, len, m, (const uint8_t *)P256_PISUM_DST, strlen(P256_PISUM_DST));
+    p256_mul_batch(pt, pt, m, j->k);
+    for(size_t i=0;i<m;i++) p256_compress(j->out + (lo + i) * j->rec, &pt[i]);
+}
+
+/* 压缩点 → k·点 → 压缩点（in 与 out 的条目间距分别为 in_rec / 33） */
+typedef struct {
+    const uint8_t *in;
+    size_t in_rec;
+    const p256_fe *k;
+    uint8_t *out;
+    int bad;
+} exp_job;
+
+static void exp_range(void *ctx, size_t lo, size_t hi){
+    exp_job *j = ctx;
+    p256_affine pt[GRAIN] = {0};
+    size_t m = hi - lo;
+    for(size_t i=0;i<m;i++)
+        if(p256_decompress(&pt[i], j->in + (lo + i) * j->in_rec) != 0){
+            __atomic_store_n(&j->bad, 1, __ATOMIC_RELAXED);
+            return;
+        }
+    p256_mul_batch(pt, pt, m, j->k);
+    for(size_t i=0;i<m;i++) p256_compress(j->out + (lo + i) * P256_COMPRESSED, &pt[i]);
+}
+
+/* 逐桶读回输入，桶内打乱后发送 k·H(id)；sk 非 NULL 时每条附带打包后的 Enc(val)。最后发结束帧 */
+static int send_hashed(psi_chan *ch, uint32_t tag, psi_spill *s, unsigned cols, const p256_fe *k,
+                       const paillier_sk *sk, paillier_pool *pool, unsigned slot_bits, int nthreads){
+    size_t rec = P256_COMPRESSED + (sk ? paillier_ct_bytes(&sk->pk) : 0);
+    uint8_t *frame = malloc(FRAME_ITEMS * rec);
+    uint64_t *vals = sk ? malloc(FRAME_ITEMS * cols * sizeof(uint64_t)) : NULL;
+    int rc = (frame && (!sk || vals)) ? 0 : -1;
+    for(unsigned part=0; rc == 0 && part<s->nparts; part++){
+        uint8_t *data;
+        size_t size;
+        dataset d;
+        if(psi_spill_take(s, part, &data, &size) != 0 || dataset_parse(&d, data, size, cols) != 0){ rc = -1; break; }
+        size_t *perm = random_perm(d.n);
+        if(!perm) rc = -1;
+        for(size_t base=0; rc == 0 && base<d.n; base+=FRAME_ITEMS){
+            size_t m = d.n - base < FRAME_ITEMS ? d.n - base : FRAME_ITEMS;
+            hash_job j = { &d, perm, base, k, frame, rec };
+            parallel_for(m, nthreads, hash_range, &j);
+            if(sk){
+                for(size_t i=0;i<m;i++)
+                    memcpy(vals + i * cols, d.val + perm[base + i] * cols, cols * sizeof(uint64_t));
+                paillier_encrypt_batch(&sk->pk, sk, pool, frame + P256_COMPRESSED, rec, vals, m,
+                                       cols, slot_bits, nthreads);
+            }
+            rc = psi_send(ch, tag, frame, m * rec);
+        }
+        free(perm);
+        dataset_free(&d);
+    }
+    if(rc == 0) rc = psi_send(ch, tag, NULL, 0);
+    free(frame);
+    free(vals);
+    return rc;
+}
+
+/* ---------------- P1 ---------------- */
+
+typedef struct {
+    const uint8_t *pairs;       // (点, 密文) 记录，密文在点之后
+    size_t rec;
+    const uint8_t *pts;         // k1·H(w_j)^k2，间距 pts_rec
+    size_t pts_rec;
+    const psi_set *z;
+    const paillier_pk *pk;
+    mpz_t acc;
+    size_t matched;
+    int bad;
+    pthread_mutex_t lock;
+} match_job;
+
+static void match_range(void *ctx, size_t lo, size_t hi){
+    match_job *j = ctx;
+    mpz_t local, c;
+    size_t hits = 0;
+    mpz_init_set_ui(local, 1);
+    mpz_init(c);
+    for(size_t i=lo;i<hi;i++){
+        if(!psi_set_contains(j->z, j->pts + i * j->pts_rec)) continue;
+        if(paillier_ct_import(j->pk, c, j->pairs + i * j->rec + P256_COMPRESSED) != 0){
+            __atomic_store_n(&j->bad, 1, __ATOMIC_RELAXED);
+            break;
+        }
+        paillier_add(j->pk, local, local, c);
+        hits++;
+    }
+    pthread_mutex_lock(&j->lock);
+    paillier_add(j->pk, j->acc, j->acc, local);
+    j->matched += hits;
+    pthread_mutex_unlock(&j->lock);
+    mpz_clears(local, c, NULL);
+}
+
+/* 连接分区：点的 x 坐标与进程内随机密钥混合，对方无法把大量点挤进同一分区 */
+static unsigned part_of(const uint8_t *pt, uint64_t salt, unsigned k){
+    uint64_t x;
+    memcpy(&x, pt + 9, 8);
+    x = (x ^ salt) * 0x9e3779b97f4a7c15ULL;
+    return (unsigned)((x >> 32) * k >> 32);
+}
+
+static int run_p1(psi_chan *ch, const source *src, const run_cfg *cfg){
+    psi_buf b = {0};
+    paillier_pk pk;
+    p256_fe k1;
+    psi_set z;
+    psi_spill ids = {0}, zsp = {0}, psp = {0};
+    uint64_t salt;
+    size_t n1;
+    double t0 = now_sec(), t1, t2, t3;
+    int rc = -1, nthreads = cfg->nthreads;
+
+    memset(&z, 0, sizeof(z));
+    if(scatter_source(&ids, src, cfg, &n1, NULL, NULL) != 0){
+        fprintf(stderr, "P1: cannot read input\n");
+        psi_spill_close(&ids);
+        return -1;
+    }
+    if(psi_recv_expect(ch, TAG_PK, &b, SMALL_FRAME) != 0 || paillier_pk_import(&pk, b.p, b.len) != 0){
+        fprintf(stderr, "P1: bad public key\n");
+        psi_buf_free(&b);
+        psi_spill_close(&ids);
+        return -1;
+    }
+    uint8_t n1be[8];
+    for(int i=0;i<8;i++) n1be[i] = (uint8_t)(n1 >> (56 - 8 * i));
+    if(p256_scalar_random(&k1) != 0 || getrandom(&salt, sizeof(salt), 0) != (ssize_t)sizeof(salt)) goto out;
+    if(psi_send(ch, TAG_N1, n1be, 8) != 0) goto out;
+
+    // Round 1
+    if(send_hashed(ch, TAG_R1, &ids, 0, &k1, NULL, NULL, 0, nthreads) != 0) goto out;
+    psi_spill_close(&ids);
+    t1 = now_sec();
+    fprintf(stderr, "P1 round1: %zu items hashed and exponentiated in %.2f s (%.0f items/s)\n",
+            n1, t1 - t0, n1 / (t1 - t0));
+
+    // Round 2：Z 按分区暂存；只有一个分区时直接进集合
+    if(spill_open(&zsp, cfg, (uint64_t)n1 * (P256_COMPRESSED + 16)) != 0) goto out;
+    unsigned kj = zsp.nparts;
+    if(kj == 1 && psi_set_init(&z, n1) != 0) goto out;
+    for(;;){
+        if(psi_recv_expect(ch, TAG_Z, &b, FRAME_ITEMS * P256_COMPRESSED) != 0) goto out;
+        if(!b.len) break;
+        if(b.len % P256_COMPRESSED) goto out;
+        for(size_t off=0; off<b.len; off+=P256_COMPRESSED){
+            if(kj == 1){
+                if(psi_set_add(&z, b.p + off) < 0){ fprintf(stderr, "P1: Z larger than own set\n"); goto out; }
+            } else if(psi_spill_put(&zsp, part_of(b.p + off, salt, kj), b.p + off, P256_COMPRESSED) != 0) goto out;
+        }
+    }
+    if(zsp.bytes > (uint64_t)n1 * P256_COMPRESSED){ fprintf(stderr, "P1: Z larger than own set\n"); goto out; }
+    t2 = now_sec();
+
+    // Round 2 的 (H(w_j)^k2, Enc(t_j))：单分区时边收边匹配，否则 (k1·点, 密文) 按分区落盘
+    match_job mj;
+    memset(&mj, 0, sizeof(mj));
+    mj.rec = P256_COMPRESSED + paillier_ct_bytes(&pk);
+    mj.z = &z;
+    mj.pk = &pk;
+    mpz_init_set_ui(mj.acc, 1);
+    pthread_mutex_init(&mj.lock, NULL);
+    uint8_t *pts = malloc(FRAME_ITEMS * P256_COMPRESSED);
+    uint8_t *rec = malloc(mj.rec);
+    size_t npairs = 0;
+    if(kj > 1 && spill_open_parts(&psp, cfg, kj) != 0) mj.bad = 1;
+    while(!mj.bad){
+        if(!pts || !rec || psi_recv_expect(ch, TAG_PAIRS, &b, (uint64_t)FRAME_ITEMS * mj.rec) != 0 || b.len % mj.rec){ mj.bad = 1; break; }
+        if(!b.len) break;
+        size_t m = b.len / mj.rec;
+        if(m > FRAME_ITEMS){ mj.bad = 1; break; }
+        exp_job ej = { b.p, mj.rec, &k1, pts, 0 };
+        parallel_for(m, nthreads, exp_range, &ej);
+        if(ej.bad){ mj.bad = 1; break; }
+        npairs += m;
+        if(kj == 1){
+            mj.pairs = b.p;
+            mj.pts = pts;
+            mj.pts_rec = P256_COMPRESSED;
+            parallel_for(m, nthreads, match_range, &mj);
+            continue;
+        }
+        for(size_t i=0;i<m && !mj.bad;i++){
+            memcpy(rec, pts + i * P256_COMPRESSED, P256_COMPRESSED);
+            memcpy(rec + P256_COMPRESSED, b.p + i * mj.rec + P256_COMPRESSED, mj.rec - P256_COMPRESSED);
+            if(psi_spill_put(&psp, part_of(rec, salt, kj), rec, mj.rec) != 0) mj.bad = 1;
+        }
+    }
+    free(rec);
+    psi_buf_free(&b);           // 分区连接阶段不再需要接收缓冲
+    // 分区哈希连接：每个分区的 Z 建集合，再流式扫描同分区的 (点, 密文)
+    uint8_t *chunk = kj > 1 ? malloc(FRAME_ITEMS * mj.rec) : NULL;
+    for(unsigned part=0; kj > 1 && !mj.bad && part<kj; part++){
+        uint8_t *zp;
+        size_t zlen;
+        if(!chunk || psi_spill_take(&zsp, part, &zp, &zlen) != 0 || psi_set_init(&z, zlen / P256_COMPRESSED) != 0){
+            mj.bad = 1;
+            break;
+        }
+        for(size_t off=0; off<zlen; off+=P256_COMPRESSED) psi_set_add(&z, zp + off);
+        free(zp);
+        ssize_t got;
+        while((got = psi_spill_read(&psp, part, chunk, FRAME_ITEMS * mj.rec)) > 0){
+            mj.pairs = chunk;
+            mj.pts = chunk;
+            mj.pts_rec = mj.rec;
+            parallel_for((size_t)got / mj.rec, nthreads, match_range, &mj);
+        }
+        if(got < 0) mj.bad = 1;
+        psi_set_free(&z);
+    }
+    free(chunk);
+    free(pts);
+    t3 = now_sec();
+    if(!mj.bad){
+        fprintf(stderr, "P1 round3: %zu pairs, intersection size %zu, %.2f s (%.0f pairs/s), %u partition(s)\n",
+                npairs, mj.matched, t3 - t2, npairs / (t3 - t2), kj);
+        // Round 3：重随机化后发回
+        uint8_t *ct = malloc(paillier_ct_bytes(&pk));
+        paillier_rerandomize(&pk, mj.acc);
+        if(ct){
+            paillier_ct_export(&pk, ct, mj.acc);
+            rc = psi_send(ch, TAG_SUM, ct, paillier_ct_bytes(&pk));
+        }
+        free(ct);
+    } else {
+        fprintf(stderr, "P1: malformed round-2 message or spill failure\n");
+    }
+    mpz_clear(mj.acc);
+    pthread_mutex_destroy(&mj.lock);
+    fprintf(stderr, "P1 total %.2f s, sent %.1f MB, received %.1f MB, spilled %.1f MB, peak RSS %.1f MB\n",
+            now_sec() - t0, ch->sent / 1e6, ch->received / 1e6,
+            ((kj > 1 ? zsp.bytes : 0) + psp.bytes) / 1e6, peak_rss_mb());
+out:
+    psi_set_free(&z);
+    psi_spill_close(&ids);
+    psi_spill_close(&zsp);
+    psi_spill_close(&psp);
+    paillier_pk_clear(&pk);
+    psi_buf_free(&b);
+    memset(&k1, 0, sizeof(k1));
+    return rc;
+}
+
+/* ---------------- P2 ---------------- */
+
+static int run_p2(psi_chan *ch, const source *src, const run_cfg *cfg, unsigned keybits, uint64_t *sums){
+    psi_buf b = {0};
+    paillier_sk sk;
+    paillier_pool *pool = NULL;
+    p256_fe k2;
+    psi_spill own = {0}, zsp = {0};
+    uint64_t totals[64];
+    uint8_t *zbuf = NULL;
+    size_t n2, nz = 0;
+    int rc = -1, overflow, nthreads = cfg->nthreads;
+    unsigned cols = src->cols, slot_bits = 1;
+    double t0 = now_sec(), t1, t2, t3;
+
+    if(scatter_source(&own, src, cfg, &n2, totals, &overflow) != 0){
+        fprintf(stderr, "P2: cannot read input\n");
+        psi_spill_close(&own);
+        return -1;
+    }
+    // 槽宽取各列全体值之和的位数：交集和不会超过它，逐槽相加不会进位到相邻槽
+    for(unsigned c=0;c<cols;c++){
+        unsigned bits = totals[c] ? 64 - (unsigned)__builtin_clzll(totals[c]) : 1;
+        if(bits > slot_bits) slot_bits = bits;
+    }
+    if(overflow){ fprintf(stderr, "P2: column sum exceeds 64 bits\n"); psi_spill_close(&own); return -1; }
+    if(paillier_keygen(&sk, keybits) != 0){ psi_spill_close(&own); return -1; }
+    if(cols > paillier_pack_slots(&sk.pk, slot_bits)){
+        fprintf(stderr, "P2: %u columns of %u bits do not fit a %u-bit plaintext\n", cols, slot_bits, keybits);
+        goto out;
+    }
+    // 随机化因子与数据无关，第一轮期间由后台线程先算
+    size_t pool_cap = n2 < POOL_MAX ? n2 : POOL_MAX;
+    if(cfg->mem && pool_cap > cfg->mem / 8 / paillier_ct_bytes(&sk.pk)) pool_cap = cfg->mem / 8 / paillier_ct_bytes(&sk.pk);
+    pool = paillier_pool_new(&sk.pk, &sk, pool_cap, nthreads);
+    if(!pool || p256_scalar_random(&k2) != 0) goto out;
+    uint8_t *pkb = malloc(sk.pk.nbytes);
+    if(!pkb) goto out;
+    paillier_pk_export(&sk.pk, pkb);
+    rc = psi_send(ch, TAG_PK, pkb, sk.pk.nbytes);
+    free(pkb);
+    if(rc != 0) goto out;
+    rc = -1;
+    t1 = now_sec();
+    fprintf(stderr, "P2 setup: %u-bit Paillier key in %.2f s, %u column(s) packed in %u-bit slots\n",
+            keybits, t1 - t0, cols, slot_bits);
+
+    // Round 2：Z = (H(v_i)^k1)^k2，经随机桶打乱
+    uint64_t n1 = 0;
+    if(psi_recv_expect(ch, TAG_N1, &b, 8) != 0 || b.len != 8) goto out;
+    for(int i=0;i<8;i++) n1 = n1 << 8 | b.p[i];
+    if(spill_open(&zsp, cfg, n1 * 2 * P256_COMPRESSED) != 0) goto out;
+    zbuf = malloc(FRAME_ITEMS * P256_COMPRESSED);
+    rng_t r = { .pos = 0 };
+    for(;;){
+        if(!zbuf || psi_recv_expect(ch, TAG_R1, &b, FRAME_ITEMS * P256_COMPRESSED) != 0 || b.len % P256_COMPRESSED) goto out;
+        if(!b.len) break;
+        size_t m = b.len / P256_COMPRESSED;
+        if(m > FRAME_ITEMS || nz + m > n1) goto out;
+        exp_job ej = { b.p, P256_COMPRESSED, &k2, zbuf, 0 };
+        parallel_for(m, nthreads, exp_range, &ej);
+        if(ej.bad){ fprintf(stderr, "P2: invalid point in round 1\n"); goto out; }
+        for(size_t i=0;i<m;i++)
+            if(psi_spill_put(&zsp, (unsigned)rng_below(&r, zsp.nparts), zbuf + i * P256_COMPRESSED, P256_COMPRESSED) != 0)
+                goto out;
+        nz += m;
+    }
+    for(unsigned part=0; part<zsp.nparts; part++){
+        uint8_t *zs;
+        size_t zlen;
+        if(psi_spill_take(&zsp, part, &zs, &zlen) != 0) goto out;
+        shuffle_points(zs, zlen / P256_COMPRESSED);
+        for(size_t base=0; base<zlen; base+=FRAME_ITEMS * P256_COMPRESSED){
+            size_t m = zlen - base < FRAME_ITEMS * P256_COMPRESSED ? zlen - base : FRAME_ITEMS * P256_COMPRESSED;
+            if(psi_send(ch, TAG_Z, zs + base, m) != 0){ free(zs); goto out; }
+        }
+        free(zs);
+    }
+    if(psi_send(ch, TAG_Z, NULL, 0) != 0) goto out;
+    t2 = now_sec();
+    fprintf(stderr, "P2 round2 Z: %zu items in %.2f s (%.0f items/s), %u bucket(s)\n",
+            nz, t2 - t1, nz / (t2 - t1), zsp.nparts);
+
+    // Round 2：(H(w_j)^k2, Enc(t_j))
+    if(send_hashed(ch, TAG_PAIRS, &own, cols, &k2, &sk, pool, slot_bits, nthreads) != 0) goto out;
+    t3 = now_sec();
+    fprintf(stderr, "P2 round2 pairs: %zu items hashed, exponentiated and encrypted in %.2f s (%.0f items/s), %u bucket(s)\n",
+            n2, t3 - t2, n2 / (t3 - t2), own.nparts);
+
+    // 解密
+    if(psi_recv_expect(ch, TAG_SUM, &b, paillier_ct_bytes(&sk.pk)) != 0 || b.len != paillier_ct_bytes(&sk.pk)) goto out;
+    mpz_t c;
+    mpz_init(c);
+    if(paillier_ct_import(&sk.pk, c, b.p) == 0){
+        paillier_decrypt(&sk, c, c);
+        paillier_unpack(sums, c, cols, slot_bits);
+        rc = 0;
+    }
+    mpz_clear(c);
+    fprintf(stderr, "P2 total %.2f s, sent %.1f MB, received %.1f MB, spilled %.1f MB, peak RSS %.1f MB\n",
+            now_sec() - t0, ch->sent / 1e6, ch->received / 1e6,
+            ((own.nparts > 1 ? own.bytes : 0) + (zsp.nparts > 1 ? zsp.bytes : 0)) / 1e6, peak_rss_mb());
+out:
+    free(zbuf);
+    psi_buf_free(&b);
+    psi_spill_close(&own);
+    psi_spill_close(&zsp);
+    paillier_pool_free(pool);
+    paillier_sk_clear(&sk);
+    memset(&k2, 0, sizeof(k2));
+    return rc;
+}
+
+/* ---------------- 命令行 ---------------- */
+
+static int default_threads(void){
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+static void print_sums(const char *label, const uint64_t *v, unsigned cols){
+    printf("%s%s:", label, cols > 1 ? "s" : "");
+    for(unsigned c=0;c<cols;c++) printf(" %llu", (unsigned long long)v[c]);
+    printf("\n");
+}
+
+/* 逐行写出，不在内存里保留数据集 */
+static int cmd_gen(int argc, char **argv){
+    if(argc < 7) return 2;
+    size_t n1 = strtoull(argv[2], NULL, 10), n2 = strtoull(argv[3], NULL, 10), ov = strtoull(argv[4], NULL, 10);
+    unsigned cols = argc > 7 ? (unsigned)atoi(argv[7]) : 1;
+    if(ov > n1 || ov > n2 || cols == 0 || cols > 64) return 2;
+    FILE *f1 = fopen(argv[5], "w"), *f2 = fopen(argv[6], "w");
+    if(!f1 || !f2) return 1;
+    char id[40];                    // "user" + 20 位十进制 + "@example.com"
+    for(size_t u=0;u<n1;u++){
+        synth_id(id, sizeof(id), u);
+        fprintf(f1, "%s\n", id);
+    }
+    for(size_t i=0;i<n2;i++){
+        size_t u = i < ov ? i : n1 + (i - ov);
+        synth_id(id, sizeof(id), u);
+        fputs(id, f2);
+        for(unsigned c=0;c<cols;c++) fprintf(f2, ",%llu", (unsigned long long)synth_val(u, c));
+        fputc('\n', f2);
+    }
+    int rc = ferror(f1) || ferror(f2);
+    rc |= fclose(f1) != 0;
+    rc |= fclose(f2) != 0;
+    return rc ? 1 : 0;
+}
+
+static int cmd_local(int argc, char **argv, run_cfg *cfg){
+    if(argc < 5) return 2;
+    size_t n1 = strtoull(argv[2], NULL, 10), n2 = strtoull(argv[3], NULL, 10), ov = strtoull(argv[4], NULL, 10);
+    unsigned keybits = argc > 6 ? (unsigned)atoi(argv[6]) : 2048;
+    unsigned cols = argc > 7 ? (unsigned)atoi(argv[7]) : 1;
+    cfg->nthreads = argc > 5 ? atoi(argv[5]) : default_threads();
+    if(ov > n1 || ov > n2 || cols == 0 || cols > 64) return 2;
+    source a = { NULL, n1, 0, n1, 0 }, b = { NULL, n2, n1, ov, cols };
+    uint64_t expect[64] = {0}, sums[64] = {0};
+    for(size_t u=0;u<ov;u++)
+        for(unsigned c=0;c<cols;c++) expect[c] += synth_val(u, c);
+
+    int sv[2];
+    if(socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) return 1;
+    pid_t pid = fork();
+    if(pid < 0) return 1;
+    if(pid == 0){
+        close(sv[1]);
+        psi_chan *ch = psi_chan_fd(sv[0]);
+        int rc = ch ? run_p1(ch, &a, cfg) : -1;
+        psi_chan_close(ch);
+        _exit(rc == 0 ? 0 : 1);
+    }
+    close(sv[0]);
+    psi_chan *ch = psi_chan_fd(sv[1]);
+    int rc = ch ? run_p2(ch, &b, cfg, keybits, sums) : -1;
+    psi_chan_close(ch);
+    int st = 0;
+    waitpid(pid, &st, 0);
+    int ok = rc == 0 && WIFEXITED(st) && WEXITSTATUS(st) == 0 && memcmp(sums, expect, cols * sizeof(uint64_t)) == 0;
+    print_sums("P2 recovered intersection-sum", sums, cols);
+    print_sums("Ground-truth intersection-sum", expect, cols);
+    printf("%s\n", ok ? "OK: protocol result matches plaintext sum." : "FAIL");
+    return ok ? 0 : 1;
+}
+
+static int cmd_party(int p2, int argc, char **argv, run_cfg *cfg){
+    if(argc < 4) return 2;
+    unsigned cols = p2 ? (argc > 6 ? (unsigned)atoi(argv[6]) : 1) : 0;
+    if(p2 && (cols == 0 || cols > 64)) return 2;
+    source src = { argv[3], 0, 0, 0, cols };
+    cfg->nthreads = argc > 4 ? atoi(argv[4]) : default_threads();
+    psi_chan *ch = p2 ? psi_chan_listen(argv[2]) : psi_chan_connect(argv[2]);
+    if(!ch){ fprintf(stderr, "cannot %s %s\n", p2 ? "listen on" : "connect to", argv[2]); return 1; }
+    int rc;
+    if(p2){
+        uint64_t sums[64] = {0};
+        rc = run_p2(ch, &src, cfg, argc > 5 ? (unsigned)atoi(argv[5]) : 2048, sums);
+        if(rc == 0) print_sums("P2 recovered intersection-sum", sums, cols);
+    } else {
+        rc = run_p1(ch, &src, cfg);
+    }
+    psi_chan_close(ch);
+    return rc == 0 ? 0 : 1;
+}
+
+static int parse_hex(uint8_t *out, size_t len, const char *hex){
+    if(strlen(hex) != 2 * len) return -1;
+    for(size_t i=0;i<len;i++){
+        unsigned v;
+        if(sscanf(hex + 2*i, "%2x", &v) != 1) return -1;
+        out[i] = (uint8_t)v;
+    }
+    return 0;
+}
+
+static void print_hex(const uint8_t *b, size_t n){
+    for(size_t i=0;i<n;i++) printf("%02x", b[i]);
+}
+
+/* 与 p256_ref.py 对照用 */
+static int cmd_kat(int argc, char **argv){
+    if(argc >= 4 && strcmp(argv[2], "h2c") == 0){
+        const char *dst = argc > 4 ? argv[4] : P256_PISUM_DST;
+        const uint8_t *msg = (const uint8_t *)argv[3];
+        size_t len = strlen(argv[3]);
+        p256_affine q;
+        uint8_t xy[64];
+        p256_hash_to_curve_batch(&q, &msg, &len, 1, (const uint8_t *)dst, strlen(dst));
+        p256_affine_to_bytes(xy, &q);
+        print_hex(xy, 32); printf(" "); print_hex(xy + 32, 32); printf("\n");
+        return 0;
+    }
+    if(argc >= 5 && strcmp(argv[2], "mul") == 0){
+        uint8_t kb[32], pb[P256_COMPRESSED];
+        p256_fe k;
+        p256_affine q;
+        if(parse_hex(kb, 32, argv[3]) != 0 || p256_scalar_from_bytes(&k, kb) != 0) return 2;
+        if(parse_hex(pb, P256_COMPRESSED, argv[4]) != 0 || p256_decompress(&q, pb) != 0) return 2;
+        p256_mul_batch(&q, &q, 1, &k);
+        p256_compress(pb, &q);
+        print_hex(pb, P256_COMPRESSED); printf("\n");
+        return 0;
+    }
+    return 2;
+}
+
+int main(int argc, char **argv){
+    run_cfg cfg = { default_threads(), 0, getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp" };
+    const char *prog = argv[0];
+    // 选项 -m <MB>（内存预算）、-d <目录>（落盘位置）放在子命令之前
+    while(argc >= 3 && argv[1][0] == '-'){
+        if(strcmp(argv[1], "-m") == 0) cfg.mem = strtoull(argv[2], NULL, 10) << 20;
+        else if(strcmp(argv[1], "-d") == 0) cfg.tmpdir = argv[2];
+        else break;
+        argc -= 2;
+        argv += 2;
+    }
+    // 分区数多时每个分区占一个文件描述符
+    struct rlimit rl;
+    if(getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max){
+        rl.rlim_cur = rl.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+    int rc = 2;
+    if(argc >= 2){
+        if(strcmp(argv[1], "gen") == 0) rc = cmd_gen(argc, argv);
+        else if(strcmp(argv[1], "local") == 0) rc = cmd_local(argc, argv, &cfg);
+        else if(strcmp(argv[1], "p1") == 0) rc = cmd_party(0, argc, argv, &cfg);
+        else if(strcmp(argv[1], "p2") == 0) rc = cmd_party(1, argc, argv, &cfg);
+        else if(strcmp(argv[1], "kat") == 0) rc = cmd_kat(argc, argv);
+    }
+    if(rc == 2)
+        fprintf(stderr, "usage: %s gen <n1> <n2> <overlap> <p1_ids.txt> <p2_pairs.txt> [cols]\n"
+                        "       %s [-m MB] [-d tmpdir] p2 <listen-addr> <p2_pairs.txt> [threads] [keybits] [cols]\n"
+                        "       %s [-m MB] [-d tmpdir] p1 <connect-addr> <p1_ids.txt> [threads]\n"
+                        "       %s [-m MB] [-d tmpdir] local <n1> <n2> <overlap> [threads] [keybits] [cols]\n"
+                        "       %s kat h2c <msg> [dst] | kat mul <k hex> <point hex>\n",
+                prog, prog, prog, prog, prog);
+    return rc;
+}
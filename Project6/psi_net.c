@@ -0,0 +1,218 @@
+// psi_net.c
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include "psi_net.h"
+
+typedef struct {
+    psi_chan base;
+    int fd;
+    int not_sock;                       // send 返回过 ENOTSOCK（管道等），之后直接 write
+} fd_chan;
+
+/* 套接字上用 MSG_NOSIGNAL：对方断开时得到 EPIPE 而不是被 SIGPIPE 杀掉 */
+static ssize_t fd_write(psi_chan *c, const void *buf, size_t len){
+    fd_chan *f = (fd_chan *)c;
+    ssize_t r;
+    for(;;){
+        r = f->not_sock ? write(f->fd, buf, len) : send(f->fd, buf, len, MSG_NOSIGNAL);
+        if(r < 0 && !f->not_sock && errno == ENOTSOCK){ f->not_sock = 1; continue; }
+        if(r < 0 && errno == EINTR) continue;
+        return r;
+    }
+}
+
+static ssize_t fd_read(psi_chan *c, void *buf, size_t len){
+    ssize_t r;
+    do r = read(((fd_chan *)c)->fd, buf, len); while(r < 0 && errno == EINTR);
+    return r;
+}
+
+static void fd_close(psi_chan *c){
+    close(((fd_chan *)c)->fd);
+    free(c);
+}
+
+psi_chan *psi_chan_fd(int fd){
+    fd_chan *c = calloc(1, sizeof(*c));
+    if(!c) return NULL;
+    c->base.write = fd_write;
+    c->base.read = fd_read;
+    c->base.close = fd_close;
+    c->fd = fd;
+    return &c->base;
+}
+
+void psi_chan_close(psi_chan *c){
+    if(c) c->close(c);
+}
+
+/* ---------------- 地址 ---------------- */
+
+static int tune_socket(int fd, int tcp){
+    int one = 1, buf = 4 << 20;
+    if(tcp) setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buf, sizeof(buf));
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buf, sizeof(buf));
+    return fd;
+}
+
+static int unix_addr(const char *addr, struct sockaddr_un *sa){
+    if(strncmp(addr, "unix:", 5) != 0) return 0;
+    memset(sa, 0, sizeof(*sa));
+    sa->sun_family = AF_UNIX;
+    snprintf(sa->sun_path, sizeof(sa->sun_path), "%s", addr + 5);
+    return 1;
+}
+
+static struct addrinfo *tcp_addr(const char *addr, int passive){
+    char host[256];
+    const char *colon = strrchr(addr, ':');
+    if(!colon || (size_t)(colon - addr) >= sizeof(host)) return NULL;
+    memcpy(host, addr, (size_t)(colon - addr));
+    host[colon - addr] = 0;
+    struct addrinfo hints = {0}, *res = NULL;
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+    if(getaddrinfo(host[0] ? host : NULL, colon + 1, &hints, &res) != 0) return NULL;
+    return res;
+}
+
+psi_chan *psi_chan_listen(const char *addr){
+    struct sockaddr_un su;
+    int ls, fd, is_unix = unix_addr(addr, &su);
+    if(is_unix){
+        if((ls = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) return NULL;
+        unlink(su.sun_path);
+        if(bind(ls, (struct sockaddr *)&su, sizeof(su)) != 0 || listen(ls, 1) != 0){ close(ls); return NULL; }
+    } else {
+        struct addrinfo *ai = tcp_addr(addr, 1);
+        if(!ai) return NULL;
+        int one = 1;
+        if((ls = socket(ai->ai_family, SOCK_STREAM, 0)) < 0){ freeaddrinfo(ai); return NULL; }
+        setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        int rc = bind(ls, ai->ai_addr, ai->ai_addrlen);
+        freeaddrinfo(ai);
+        if(rc != 0 || listen(ls, 1) != 0){ close(ls); return NULL; }
+    }
+    do fd = accept(ls, NULL, NULL); while(fd < 0 && errno == EINTR);
+    close(ls);
+    if(is_unix) unlink(su.sun_path);
+    if(fd < 0) return NULL;
+    return psi_chan_fd(tune_socket(fd, !is_unix));
+}
+
+psi_chan *psi_chan_connect(const char *addr){
+    struct sockaddr_un su;
+    int is_unix = unix_addr(addr, &su);
+    for(int attempt=0; attempt<300; attempt++){
+        int fd = -1;
+        if(is_unix){
+            if((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) return NULL;
+            if(connect(fd, (struct sockaddr *)&su, sizeof(su)) == 0) return psi_chan_fd(tune_socket(fd, 0));
+        } else {
+            struct addrinfo *ai = tcp_addr(addr, 0);
+            if(!ai) return NULL;
+            for(struct addrinfo *p = ai; p; p = p->ai_next){
+                if((fd = socket(p->ai_family, SOCK_STREAM, 0)) < 0) continue;
+                if(connect(fd, p->ai_addr, p->ai_addrlen) == 0){
+                    freeaddrinfo(ai);
+                    return psi_chan_fd(tune_socket(fd, 1));
+                }
+                close(fd);
+                fd = -1;
+            }
+            freeaddrinfo(ai);
+        }
+        if(fd >= 0) close(fd);
+        usleep(100000);
+    }
+    return NULL;
+}
+
+/* ---------------- 帧 ---------------- */
+
+static int write_all(psi_chan *c, const void *buf, size_t len){
+    const uint8_t *p = buf;
+    while(len){
+        ssize_t r = c->write(c, p, len);
+        if(r <= 0){
+            fprintf(stderr, "send failed: %s\n", r < 0 ? strerror(errno) : "no progress");
+            return -1;
+        }
+        p += r; len -= (size_t)r;
+        c->sent += (uint64_t)r;
+    }
+    return 0;
+}
+
+static int read_all(psi_chan *c, void *buf, size_t len){
+    uint8_t *p = buf;
+    while(len){
+        ssize_t r = c->read(c, p, len);
+        if(r <= 0){
+            fprintf(stderr, "receive failed: %s\n", r < 0 ? strerror(errno) : "connection closed by peer");
+            return -1;
+        }
+        p += r; len -= (size_t)r;
+        c->received += (uint64_t)r;
+    }
+    return 0;
+}
+
+int psi_send(psi_chan *c, uint32_t tag, const void *buf, uint64_t len){
+    uint8_t h[12];
+    for(int i=0;i<4;i++) h[i] = (uint8_t)(tag >> (24 - 8*i));
+    for(int i=0;i<8;i++) h[4+i] = (uint8_t)(len >> (56 - 8*i));
+    if(write_all(c, h, sizeof(h)) != 0) return -1;
+    return len ? write_all(c, buf, (size_t)len) : 0;
+}
+
+int psi_recv(psi_chan *c, uint32_t *tag, psi_buf *b, uint64_t max){
+    uint8_t h[12];
+    uint64_t len = 0;
+    uint32_t t = 0;
+    if(read_all(c, h, sizeof(h)) != 0) return -1;
+    for(int i=0;i<4;i++) t = (t << 8) | h[i];
+    for(int i=0;i<8;i++) len = (len << 8) | h[4+i];
+    if(len > max){
+        fprintf(stderr, "message tag %08x too large (%llu > %llu bytes)\n", t, (unsigned long long)len,
+                (unsigned long long)max);
+        return -1;
+    }
+    if(len > b->cap){
+        uint8_t *np = realloc(b->p, (size_t)len);
+        if(!np) return -1;
+        b->p = np;
+        b->cap = (size_t)len;
+    }
+    if(read_all(c, b->p, (size_t)len) != 0) return -1;
+    b->len = (size_t)len;
+    *tag = t;
+    return 0;
+}
+
+int psi_recv_expect(psi_chan *c, uint32_t tag, psi_buf *b, uint64_t max){
+    uint32_t t;
+    if(psi_recv(c, &t, b, max) != 0) return -1;
+    if(t != tag){
+        fprintf(stderr, "unexpected message tag %08x (want %08x)\n", t, tag);
+        return -1;
+    }
+    return 0;
+}
+
+void psi_buf_free(psi_buf *b){
+    free(b->p);
+    b->p = NULL;
+    b->len = b->cap = 0;
+}
@@ -0,0 +1,44 @@
+// psi_net.h
+#ifndef PSI_NET_H
+#define PSI_NET_H
+#include <stdint.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+/*
+  双方之间的消息通道。每条消息为 12 字节头（tag 4 字节 + 长度 8 字节，大端）加负载；
+  大的集合按帧分批发送，长度为 0 的帧表示该 tag 的数据结束。
+  psi_chan 只要求 read / write / close 三个回调：psi_chan_fd 覆盖 TCP、Unix socket、socketpair 和管道，
+  其他传输（如 TLS）实现这三个回调即可接入。
+*/
+
+typedef struct psi_chan psi_chan;
+struct psi_chan {
+    ssize_t (*write)(psi_chan *c, const void *buf, size_t len);     // 可以只写一部分
+    ssize_t (*read)(psi_chan *c, void *buf, size_t len);            // 可以只读一部分，0 表示对方关闭
+    void    (*close)(psi_chan *c);
+    uint64_t sent, received;    // 累计字节数（含帧头）
+};
+
+typedef struct {
+    uint8_t *p;
+    size_t len, cap;
+} psi_buf;
+
+/* 接管 fd（关闭通道时一并关闭）。套接字用 send(MSG_NOSIGNAL) 写，对方断开时 write 返回 -1（EPIPE）；
+   fd 不是套接字时退回 write，此时 SIGPIPE 由调用方处理 */
+psi_chan *psi_chan_fd(int fd);
+/* addr 为 "host:port" 或 "unix:/path"。listen 只接受一个连接；connect 在对方尚未监听时重试约 30 秒 */
+psi_chan *psi_chan_listen(const char *addr);
+psi_chan *psi_chan_connect(const char *addr);
+void      psi_chan_close(psi_chan *c);
+
+int  psi_send(psi_chan *c, uint32_t tag, const void *buf, uint64_t len);
+/* 接收下一条消息到 b（按需扩容）。负载超过 max 字节时不分配、直接返回 -1，
+   调用方按该消息的已知最大长度传 max，防止对方的长度字段触发巨量分配。连接断开或格式错误返回 -1 */
+int  psi_recv(psi_chan *c, uint32_t *tag, psi_buf *b, uint64_t max);
+/* 同上，tag 不符时返回 -1 */
+int  psi_recv_expect(psi_chan *c, uint32_t tag, psi_buf *b, uint64_t max);
+void psi_buf_free(psi_buf *b);
+
+#endif
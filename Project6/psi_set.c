@@ -0,0 +1,53 @@
+// psi_set.c
+#include <stdlib.h>
+#include <string.h>
+#include <sys/random.h>
+#include "psi_set.h"
+
+static inline size_t slot_of(const psi_set *s, const uint8_t *key){
+    uint64_t x;
+    memcpy(&x, key + 1, 8);
+    x = (x ^ s->salt ^ key[0]) * 0x9e3779b97f4a7c15ULL;
+    return (size_t)(x >> 17) & s->mask;
+}
+
+int psi_set_init(psi_set *s, size_t max){
+    size_t cap = 16;
+    while(cap < 2 * max) cap <<= 1;
+    memset(s, 0, sizeof(*s));
+    if(max >= UINT32_MAX) return -1;
+    s->keys = malloc((max ? max : 1) * P256_COMPRESSED);
+    s->slots = calloc(cap, sizeof(uint32_t));
+    if(!s->keys || !s->slots){ psi_set_free(s); return -1; }
+    s->max = max;
+    s->mask = cap - 1;
+    if(getrandom(&s->salt, sizeof(s->salt), 0) != (ssize_t)sizeof(s->salt)) s->salt = (uint64_t)(uintptr_t)s;
+    return 0;
+}
+
+int psi_set_add(psi_set *s, const uint8_t key[P256_COMPRESSED]){
+    size_t i = slot_of(s, key);
+    for(;; i = (i + 1) & s->mask){
+        uint32_t v = s->slots[i];
+        if(!v) break;
+        if(memcmp(s->keys + (size_t)(v - 1) * P256_COMPRESSED, key, P256_COMPRESSED) == 0) return 0;
+    }
+    if(s->n == s->max) return -1;
+    memcpy(s->keys + s->n * P256_COMPRESSED, key, P256_COMPRESSED);
+    s->slots[i] = (uint32_t)(++s->n);
+    return 1;
+}
+
+int psi_set_contains(const psi_set *s, const uint8_t key[P256_COMPRESSED]){
+    for(size_t i = slot_of(s, key);; i = (i + 1) & s->mask){
+        uint32_t v = s->slots[i];
+        if(!v) return 0;
+        if(memcmp(s->keys + (size_t)(v - 1) * P256_COMPRESSED, key, P256_COMPRESSED) == 0) return 1;
+    }
+}
+
+void psi_set_free(psi_set *s){
+    free(s->keys);
+    free(s->slots);
+    memset(s, 0, sizeof(*s));
+}
@@ -0,0 +1,27 @@
+// psi_set.h
+#ifndef PSI_SET_H
+#define PSI_SET_H
+#include <stdint.h>
+#include <stddef.h>
+#include "p256.h"
+
+/*
+  压缩点集合（开放寻址、线性探测）：键为 33 字节压缩点，按插入顺序连续存放；
+  槽位只存 4 字节下标，负载因子 ≤ 1/2。点的 x 坐标本身近似均匀，槽位由 x 的前 8 字节与
+  进程内随机密钥混合得到，对方无法构造大量碰撞。建好后只读，可多线程并发查询。
+*/
+typedef struct {
+    uint8_t  *keys;         // n × P256_COMPRESSED
+    uint32_t *slots;        // 下标 + 1，0 表示空
+    size_t    n, max, mask;
+    uint64_t  salt;
+} psi_set;
+
+/* 预留 max 个元素 */
+int  psi_set_init(psi_set *s, size_t max);
+/* 返回 1 新插入，0 已存在，-1 超出容量 */
+int  psi_set_add(psi_set *s, const uint8_t key[P256_COMPRESSED]);
+int  psi_set_contains(const psi_set *s, const uint8_t key[P256_COMPRESSED]);
+void psi_set_free(psi_set *s);
+
+#endif
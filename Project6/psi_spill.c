@@ -0,0 +1,107 @@
+// psi_spill.c
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "psi_spill.h"
+
+static FILE *temp_file(const char *dir, size_t bufsize){
+    size_t n = strlen(dir) + 32;
+    char *path = malloc(n);
+    if(!path) return NULL;
+    snprintf(path, n, "%s/pisum-spill-XXXXXX", dir);
+    int fd = mkstemp(path);
+    if(fd >= 0) unlink(path);
+    free(path);
+    if(fd < 0) return NULL;
+    FILE *f = fdopen(fd, "w+b");
+    if(!f){ close(fd); return NULL; }
+    setvbuf(f, NULL, _IOFBF, bufsize);
+    return f;
+}
+
+int psi_spill_open(psi_spill *s, unsigned nparts, const char *dir, size_t bufsize){
+    memset(s, 0, sizeof(*s));
+    if(nparts == 0) return -1;
+    s->part = calloc(nparts, sizeof(*s->part));
+    if(!s->part) return -1;
+    s->nparts = nparts;
+    if(dir)
+        for(unsigned i=0;i<nparts;i++)
+            if(!(s->part[i].f = temp_file(dir, bufsize))){ psi_spill_close(s); return -1; }
+    return 0;
+}
+
+int psi_spill_put(psi_spill *s, unsigned part, const void *rec, size_t len){
+    psi_spill_part *p = &s->part[part];
+    if(p->f){
+        if(fwrite(rec, 1, len, p->f) != len) return -1;
+    } else {
+        if(p->len + len > p->cap){
+            size_t nc = p->cap ? p->cap : 4096;
+            while(nc < p->len + len) nc *= 2;
+            uint8_t *nm = realloc(p->mem, nc);
+            if(!nm) return -1;
+            p->mem = nm;
+            p->cap = nc;
+        }
+        memcpy(p->mem + p->len, rec, len);
+        p->len += len;
+    }
+    p->bytes += len;
+    s->bytes += len;
+    return 0;
+}
+
+/* 第一次读之前把文件桶的写缓冲刷掉并回到开头 */
+static int start_reading(psi_spill_part *p){
+    if(p->reading) return 0;
+    p->reading = 1;
+    if(p->f && (fflush(p->f) != 0 || fseeko(p->f, 0, SEEK_SET) != 0)) return -1;
+    return 0;
+}
+
+int psi_spill_take(psi_spill *s, unsigned part, uint8_t **data, size_t *len){
+    psi_spill_part *p = &s->part[part];
+    if(!p->f){
+        *data = p->mem;
+        *len = p->len;
+        p->mem = NULL;
+        p->len = p->cap = p->pos = 0;
+        return 0;
+    }
+    if(start_reading(p) != 0) return -1;
+    *len = (size_t)p->bytes;
+    *data = malloc(*len ? *len : 1);
+    if(!*data || fread(*data, 1, *len, p->f) != *len){ free(*data); *data = NULL; return -1; }
+    fclose(p->f);
+    p->f = NULL;
+    return 0;
+}
+
+ssize_t psi_spill_read(psi_spill *s, unsigned part, void *buf, size_t max){
+    psi_spill_part *p = &s->part[part];
+    if(start_reading(p) != 0) return -1;
+    if(!p->f){
+        size_t n = p->len - p->pos < max ? p->len - p->pos : max;
+        memcpy(buf, p->mem + p->pos, n);
+        p->pos += n;
+        return (ssize_t)n;
+    }
+    size_t n = fread(buf, 1, max, p->f);
+    return ferror(p->f) ? -1 : (ssize_t)n;
+}
+
+void psi_spill_close(psi_spill *s){
+    for(unsigned i=0;s->part && i<s->nparts;i++){
+        if(s->part[i].f) fclose(s->part[i].f);
+        free(s->part[i].mem);
+    }
+    free(s->part);
+    memset(s, 0, sizeof(*s));
+}
+
+unsigned psi_spill_parts(uint64_t total, uint64_t budget, unsigned max){
+    if(budget == 0) return 1;
+    uint64_t k = (total + budget - 1) / budget;
+    return k < 1 ? 1 : k > max ? max : (unsigned)k;
+}
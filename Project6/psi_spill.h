@@ -0,0 +1,41 @@
+// psi_spill.h
+#ifndef PSI_SPILL_H
+#define PSI_SPILL_H
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+/*
+  有界内存下的分桶暂存：记录按调用方给出的桶号追加，写完后逐桶顺序读回。
+  dir 为 NULL 时桶放在内存里（集合能放进内存时的快速路径）；否则每个桶是 dir 下的一个临时文件，
+  创建后立即 unlink，进程退出即回收。外部洗牌（随机桶 + 桶内洗牌）与分区哈希连接都建立在它上面。
+*/
+
+typedef struct {
+    FILE    *f;             // 文件桶；内存桶为 NULL
+    uint8_t *mem;
+    size_t   len, cap, pos; // 内存桶的长度 / 容量 / 读位置
+    uint64_t bytes;         // 写入字节数
+    int      reading;
+} psi_spill_part;
+
+typedef struct {
+    psi_spill_part *part;
+    unsigned nparts;
+    uint64_t bytes;         // 全部桶累计写入字节数（文件桶即落盘量）
+} psi_spill;
+
+/* nparts 个桶；bufsize 为每个文件桶的 stdio 缓冲。成功返回 0 */
+int  psi_spill_open(psi_spill *s, unsigned nparts, const char *dir, size_t bufsize);
+int  psi_spill_put(psi_spill *s, unsigned part, const void *rec, size_t len);
+/* 读出整个桶到 *data（malloc，调用方释放），之后该桶清空 */
+int  psi_spill_take(psi_spill *s, unsigned part, uint8_t **data, size_t *len);
+/* 顺序读出桶内下一段，最多 max 字节；返回读到的字节数，0 表示读完，-1 出错 */
+ssize_t psi_spill_read(psi_spill *s, unsigned part, void *buf, size_t max);
+void psi_spill_close(psi_spill *s);
+
+/* 按总字节数与内存预算选桶数：每桶约 budget 字节，至少 1 个，最多 max 个 */
+unsigned psi_spill_parts(uint64_t total, uint64_t budget, unsigned max);
+
+#endif
@@ -0,0 +1,97 @@
+// sha256.c
+#include "sha256.h"
+#include <string.h>
+
+#define ROTR32(x,n) ((uint32_t)(((x) >> (n)) | ((x) << (32 - (n)))))
+
+static const uint32_t K[64] = {
+    0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
+    0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
+    0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
+    0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7,0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967,
+    0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13,0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85,
+    0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3,0xd192e819,0xd6990624,0xf40e3585,0x106aa070,
+    0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5,0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3,
+    0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
+};
+
+static void sha256_compress(uint32_t st[8], const uint8_t block[64]){
+    uint32_t W[64];
+    // 大端读取
+    for(int i=0;i<16;i++){
+        W[i] = ((uint32_t)block[4*i]<<24)|((uint32_t)block[4*i+1]<<16)|
+               ((uint32_t)block[4*i+2]<<8)|((uint32_t)block[4*i+3]);
+    }
+    for(int j=16;j<64;j++){
+        uint32_t s0 = ROTR32(W[j-15],7) ^ ROTR32(W[j-15],18) ^ (W[j-15] >> 3);
+        uint32_t s1 = ROTR32(W[j-2],17) ^ ROTR32(W[j-2],19) ^ (W[j-2] >> 10);
+        W[j] = W[j-16] + s0 + W[j-7] + s1;
+    }
+
+    uint32_t A=st[0],B=st[1],C=st[2],D=st[3],E=st[4],F=st[5],G=st[6],H=st[7];
+    for(int j=0;j<64;j++){
+        uint32_t S1 = ROTR32(E,6) ^ ROTR32(E,11) ^ ROTR32(E,25);
+        uint32_t ch = (E & F) ^ (~E & G);
+        uint32_t T1 = H + S1 + ch + K[j] + W[j];
+        uint32_t S0 = ROTR32(A,2) ^ ROTR32(A,13) ^ ROTR32(A,22);
+        uint32_t maj = (A & B) ^ (A & C) ^ (B & C);
+        uint32_t T2 = S0 + maj;
+        H = G; G = F; F = E; E = D + T1;
+        D = C; C = B; B = A; A = T1 + T2;
+    }
+    st[0]+=A; st[1]+=B; st[2]+=C; st[3]+=D;
+    st[4]+=E; st[5]+=F; st[6]+=G; st[7]+=H;
+}
+
+void sha256_init(sha256_ctx *ctx){
+    static const uint32_t IV[8] = {
+        0x6a09e667,0xbb67ae85,0x3c6ef372,0xa54ff53a,0x510e527f,0x9b05688c,0x1f83d9ab,0x5be0cd19
+    };
+    memcpy(ctx->state, IV, sizeof(IV));
+    ctx->bitlen = 0;
+    ctx->buffer_len = 0;
+}
+
+void sha256_update(sha256_ctx *ctx, const void *data, size_t len){
+    const uint8_t *p = (const uint8_t*)data;
+    ctx->bitlen += (uint64_t)len * 8;
+    if(ctx->buffer_len){
+        size_t take = 64 - ctx->buffer_len;
+        if(take > len) take = len;
+        memcpy(ctx->buffer + ctx->buffer_len, p, take);
+        ctx->buffer_len += take; p += take; len -= take;
+        if(ctx->buffer_len < 64) return;
+        sha256_compress(ctx->state, ctx->buffer);
+        ctx->buffer_len = 0;
+    }
+    for(; len >= 64; p += 64, len -= 64) sha256_compress(ctx->state, p);
+    memcpy(ctx->buffer, p, len);
+    ctx->buffer_len = len;
+}
+
+void sha256_final(sha256_ctx *ctx, uint8_t out[32]){
+    uint64_t bitlen = ctx->bitlen;
+    size_t n = ctx->buffer_len;
+    ctx->buffer[n++] = 0x80;
+    if(n > 56){
+        memset(ctx->buffer + n, 0, 64 - n);
+        sha256_compress(ctx->state, ctx->buffer);
+        n = 0;
+    }
+    memset(ctx->buffer + n, 0, 56 - n);
+    for(int i=0;i<8;i++) ctx->buffer[56+i] = (uint8_t)(bitlen >> (56 - 8*i));
+    sha256_compress(ctx->state, ctx->buffer);
+    for(int i=0;i<8;i++){
+        out[4*i]   = (uint8_t)(ctx->state[i] >> 24);
+        out[4*i+1] = (uint8_t)(ctx->state[i] >> 16);
+        out[4*i+2] = (uint8_t)(ctx->state[i] >> 8);
+        out[4*i+3] = (uint8_t)(ctx->state[i]);
+    }
+}
+
+void sha256_hash(const void *data, size_t len, uint8_t out[32]){
+    sha256_ctx c;
+    sha256_init(&c);
+    sha256_update(&c, data, len);
+    sha256_final(&c, out);
+}
@@ -0,0 +1,20 @@
+// sha256.h
+#ifndef SHA256_H
+#define SHA256_H
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t bitlen;     // 已处理的比特数
+    uint8_t  buffer[64]; // 分组缓冲
+    size_t   buffer_len;
+} sha256_ctx;
+
+void sha256_init(sha256_ctx *ctx);
+void sha256_update(sha256_ctx *ctx, const void *data, size_t len);
+void sha256_final(sha256_ctx *ctx, uint8_t out[32]);
+
+void sha256_hash(const void *data, size_t len, uint8_t out[32]);
+
+#endif